@@ -26,6 +26,7 @@
 
 #include "nx_ipv6.h"
 #include "nx_ipv4.h"
+#include "nx_arp.h"
 #include "nxd_bsd.h"
 #include "nx_link.h"
 
@@ -6795,6 +6796,13 @@ ULONG           physical_addr_lsw;
 #else
                 /* Determine if NetX Duo supports keepalive. */
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+                tx_mutex_get(nx_bsd_protection_ptr, TX_WAIT_FOREVER);
+
+                /* Bring the socket timeouts up to date before they are changed.  */
+                _nx_tcp_socket_timer_sync(bsd_socket_ptr -> nx_bsd_socket_tcp_socket);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
                 /* Update the BSD socket with this attribute. */
                 bsd_socket_ptr -> nx_bsd_socket_tcp_socket -> nx_tcp_socket_keepalive_enabled =
                                         (UINT)(((struct nx_bsd_sock_keepalive *)option_value) -> keepalive_enabled);
@@ -6811,6 +6819,13 @@ ULONG           physical_addr_lsw;
                     /* Clear the socket keep alive timeout. */
                     bsd_socket_ptr -> nx_bsd_socket_tcp_socket -> nx_tcp_socket_keepalive_timeout =  0;
                 }
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+                /* Schedule the socket timeouts on the timer wheel.  */
+                _nx_tcp_socket_timer_schedule(bsd_socket_ptr -> nx_bsd_socket_tcp_socket);
+
+                tx_mutex_put(nx_bsd_protection_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 #endif /* NX_ENABLE_TCP_KEEPALIVE */
             }
             else
@@ -11682,7 +11697,7 @@ ULONG                   destination_ip;
         /* Yes, look into the ARP Routing Table to derive the physical address.  */
 
         /* Calculate the hash index for the destination IP address.  */
-        index =  (UINT) ((destination_ip + (destination_ip >> 8)) & NX_ARP_TABLE_MASK);
+        index =  NX_ARP_TABLE_INDEX(ip_ptr, destination_ip);
 
         /* Disable interrupts temporarily.  */
         TX_DISABLE
@@ -12081,6 +12096,11 @@ ULONG                   destination_ip;
                 arp_ptr -> nx_arp_retries =               0;
                 arp_ptr -> nx_arp_ip_interface =          packet_ptr -> nx_packet_address.nx_packet_interface_ptr;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+                /* Schedule the next update of the ARP entry.  */
+                _nx_arp_entry_timer_schedule(ip_ptr, arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
                 /* Ensure the queue next pointer is NULL for the packet before it
                    is placed on the ARP waiting queue.  */
                 packet_ptr -> nx_packet_queue_next =  NX_NULL;
@@ -12228,6 +12248,7 @@ ULONG                   destination_ip;
 /*                                                                        */
 /*    _nx_packet_transmit_release           Release transmit packet       */
 /*    _nx_nd_cache_add_entry                Add new entry to ND Cache     */
+/*    _nx_nd_cache_probe_list_add           Add entry to probe list       */
 /*    IPv6_Address_Type                     Find IPv6 address type        */
 /*    _nx_packet_copy                       Packet copy                   */
 /*    _nx_ip_packet_deferred_receive        Places received packets in    */
@@ -12657,6 +12678,12 @@ NX_IP          *ip_ptr;
 
                     /* Start Neighbor discovery process by advancing to the incomplete state. */
                     NDCacheEntry -> nx_nd_cache_nd_status = ND_CACHE_STATE_INCOMPLETE;
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+                    /* Hand the entry to the fast periodic update. */
+                    _nx_nd_cache_probe_list_add(ip_ptr, NDCacheEntry);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
                 }
 
                 _nx_icmpv6_send_ns(ip_ptr, next_hop_address,
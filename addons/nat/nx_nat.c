@@ -75,7 +75,6 @@ static UINT    _nx_nat_entry_port_verify(NX_IP *ip_ptr, UINT protocol, UINT port
 static UINT    _nx_nat_socket_port_verify(NX_IP *ip_ptr, UINT protocol, UINT port);      
 static UINT    _nx_nat_utility_get_source_port(NX_PACKET *packet_ptr, UCHAR protocol, USHORT *source_port);
 static UINT    _nx_nat_utility_get_destination_port(NX_PACKET *packet_ptr, UCHAR protocol, USHORT *destination_port); 
-static VOID    _nx_nat_checksum_adjust(UCHAR *checksum, UCHAR *old_data, INT old_data_length, UCHAR *new_data, INT new_data_length);
 
 
 /**************************************************************************/ 
@@ -1595,7 +1594,7 @@ NX_NAT_TRANSLATION_ENTRY        *record_entry;
                 new_port = record_entry -> local_port;
 
                 /* Adjust the checksum for port.  */
-                _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_port, sizeof(USHORT), (UCHAR *)&new_port, sizeof(USHORT));
+                checksum = _nx_ip_checksum_adjust(checksum, old_port, new_port);
             }
 
             /* Set the old address and new address.  */
@@ -1603,7 +1602,7 @@ NX_NAT_TRANSLATION_ENTRY        *record_entry;
             new_address = record_entry -> local_ip_address;
 
             /* Adjust the checksum for address.  */
-            _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_address, sizeof(LONG), (UCHAR *)&new_address, sizeof(LONG)); 
+            checksum = _nx_ip_checksum_adjust_ulong(checksum, old_address, new_address); 
 
             /* OK to clear the TCP checksum field to zero before the checksum update. */
             tcp_header_ptr -> nx_tcp_header_word_4 = tcp_header_ptr -> nx_tcp_header_word_4 & NX_LOWER_16_MASK;  
@@ -1801,7 +1800,7 @@ NX_NAT_TRANSLATION_ENTRY        *record_entry;
                 new_port = record_entry -> local_port;
 
                 /* Adjust the checksum for port.  */
-                _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_port, sizeof(USHORT), (UCHAR *)&new_port, sizeof(USHORT));
+                checksum = _nx_ip_checksum_adjust(checksum, old_port, new_port);
             }
                                               
             /* Set the old address and new address.  */
@@ -1809,7 +1808,13 @@ NX_NAT_TRANSLATION_ENTRY        *record_entry;
             new_address = record_entry -> local_ip_address;     
 
             /* Adjust the checksum for address.  */
-            _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_address, sizeof(LONG), (UCHAR *)&new_address, sizeof(LONG)); 
+            checksum = _nx_ip_checksum_adjust_ulong(checksum, old_address, new_address); 
+
+            /* A computed UDP checksum of zero is transmitted as all ones, RFC768.  */
+            if (checksum == 0)
+            {
+                checksum = 0xFFFF;
+            }
 
             /* OK to clear the UDP checksum field to zero before the checksum update. */
             udp_header_ptr -> nx_udp_header_word_1 = udp_header_ptr -> nx_udp_header_word_1 & ~NX_LOWER_16_MASK;  
@@ -2013,7 +2018,7 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
                 new_port = record_entry -> local_port;
 
                 /* Adjust the checksum.  */
-                _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_port, sizeof(USHORT), (UCHAR *)&new_port, sizeof(USHORT)); 
+                checksum = _nx_ip_checksum_adjust(checksum, old_port, new_port); 
 
                 /* Ok to zero out the checksum because we'll replace it with an updated checksum. */
                 icmp_header_ptr -> nx_icmp_header_word_0 = icmp_header_ptr -> nx_icmp_header_word_0 & ~NX_LOWER_16_MASK;
@@ -2298,7 +2303,7 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
             new_port = record_entry -> external_port;
 
             /* Adjust the checksum for port.  */
-            _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_port, sizeof(USHORT), (UCHAR *)&new_port, sizeof(USHORT));
+            checksum = _nx_ip_checksum_adjust(checksum, old_port, new_port);
         }
                                     
         /* Set the old address and new address.  */
@@ -2306,7 +2311,7 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
         new_address = nat_ptr -> nx_nat_ip_ptr -> nx_ip_interface[nat_ptr -> nx_nat_global_interface_index].nx_interface_ip_address;
 
         /* Adjust the checksum for address.  */
-        _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_address, sizeof(LONG), (UCHAR *)&new_address, sizeof(LONG)); 
+        checksum = _nx_ip_checksum_adjust_ulong(checksum, old_address, new_address); 
 
         /* OK to clear the TCP checksum field to zero before the checksum update. */
         tcp_header_ptr -> nx_tcp_header_word_4 = tcp_header_ptr -> nx_tcp_header_word_4 & NX_LOWER_16_MASK;  
@@ -2473,7 +2478,7 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
             new_port = record_entry -> external_port;
 
             /* Adjust the checksum for port.  */
-            _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_port, sizeof(USHORT), (UCHAR *)&new_port, sizeof(USHORT));
+            checksum = _nx_ip_checksum_adjust(checksum, old_port, new_port);
         }
                                     
         /* Set the old address and new address.  */
@@ -2481,7 +2486,13 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
         new_address = nat_ptr -> nx_nat_ip_ptr -> nx_ip_interface[nat_ptr -> nx_nat_global_interface_index].nx_interface_ip_address;
 
         /* Adjust the checksum for address.  */
-        _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_address, sizeof(LONG), (UCHAR *)&new_address, sizeof(LONG)); 
+        checksum = _nx_ip_checksum_adjust_ulong(checksum, old_address, new_address); 
+
+        /* A computed UDP checksum of zero is transmitted as all ones, RFC768.  */
+        if (checksum == 0)
+        {
+            checksum = 0xFFFF;
+        }
 
         /* OK to clear the UDP checksum field to zero before the checksum update. */
         udp_header_ptr -> nx_udp_header_word_1 = udp_header_ptr -> nx_udp_header_word_1 & ~NX_LOWER_16_MASK;  
@@ -2661,7 +2672,7 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
             new_port = record_entry -> external_port;
 
             /* Adjust the checksum.  */
-            _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_port, sizeof(USHORT), (UCHAR *)&new_port, sizeof(USHORT)); 
+            checksum = _nx_ip_checksum_adjust(checksum, old_port, new_port); 
 
             /* Ok to zero out the checksum because we'll replace it with an updated checksum. */
             icmp_header_ptr -> nx_icmp_header_word_0 = icmp_header_ptr -> nx_icmp_header_word_0 & ~NX_LOWER_16_MASK;
@@ -2731,7 +2742,9 @@ NX_NAT_TRANSLATION_ENTRY    *record_entry;
 /*                                                                        */ 
 /*   nx_packet_release                    Release the packet              */ 
 /*   _nx_packet_data_append               Append the overflow data        */
-/*   _nx_nat_checksum_adjust              Adjust checksum for NAT changes */
+/*   _nx_ip_checksum_adjust               Adjust checksum for NAT changes */
+/*                                            to IP header                */
+/*   _nx_ip_checksum_adjust_ulong         Adjust checksum for NAT changes */
 /*                                            to IP header                */
 /*   _nx_ip_driver_packet_send            Forward packet to driver to send*/  
 /*                                                                        */ 
@@ -2826,14 +2839,14 @@ NX_IPV4_HEADER      *ip_header_ptr;
         checksum = ip_header_ptr -> nx_ip_header_word_2 & NX_LOWER_16_MASK;
 
         /* Adjust the checksum for address.  */
-        _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_address, sizeof(LONG), (UCHAR *)&new_address, sizeof(LONG));
+        checksum = _nx_ip_checksum_adjust_ulong(checksum, old_address, new_address);
 
         /* Check if the fragment field is updated.  */
         if (old_fragment != new_fragment)
         {
 
             /* Adjust the checksum for fragment field.  */
-            _nx_nat_checksum_adjust((UCHAR *)&checksum, (UCHAR *)&old_fragment, sizeof(LONG), (UCHAR *)&new_fragment, sizeof(LONG));
+            checksum = _nx_ip_checksum_adjust(checksum, (USHORT)old_fragment, (USHORT)new_fragment);
         }
 
         /* Clear the checksum value.  */
@@ -4484,138 +4497,4 @@ NX_ICMP_HEADER  *icmp_header_ptr;
     return NX_SUCCESS;
 }          
 
-           
-/**************************************************************************/ 
-/*                                                                        */ 
-/*  FUNCTION                                               RELEASE        */ 
-/*                                                                        */ 
-/*    _nx_nat_checksum_adjust                             PORTABLE C      */
-/*                                                           6.4.3        */
-/*  AUTHOR                                                                */
-/*                                                                        */
-/*    Yuxin Zhou, Microsoft Corporation                                   */
-/*                                                                        */
-/*  DESCRIPTION                                                           */ 
-/*                                                                        */ 
-/*   This function is an optimization for recomputing a checksum by just  */
-/*   computing the difference where a small amount of data has changed.   */
-/*   NAT uses this optimization when, for example, it is only changing an */
-/*   IP address or port.                                                  */
-/*                                                                        */ 
-/*  INPUT                                                                 */ 
-/*    old_checksum                       Pointer to the old checksum      */
-/*    old_data                           Pointer to the data being changed*/
-/*    new_data                           Pointer to new data replacing the*/
-/*                                              old data                  */
-/*    data_adjustment_length             Size of data being changed       */ 
-/*    adjusted_checksum                  Pointer to the updated checksum  */
-/*                                                                        */ 
-/*  OUTPUT                                                                */ 
-/*                                                                        */ 
-/*    NX_SUCCESS                          Successful completion status    */ 
-/*                                                                        */ 
-/*  CALLS                                                                 */ 
-/*                                                                        */ 
-/*    None                                                                */ 
-/*                                                                        */ 
-/*  CALLED BY                                                             */ 
-/*                                                                        */ 
-/*  _nx_nat_process_inbound_TCP_packet   Send TCP packet to local host    */ 
-/*  _nx_nat_process_inbound_UDP_packet   Send UDP packet to local host    */ 
-/*  _nx_nat_process_inbound_ICMP_packet  Send ICMP packet to local host   */ 
-/*  _nx_nat_process_outbound_TCP_packet  Send TCP packet to external host */ 
-/*  _nx_nat_process_outbound_UDP_packet  Send UDP packet to external host */ 
-/*  _nx_nat_process_outbound_ICMP_packet Send ICMP packet to external host*/
-/*                                                                        */ 
-/*  RELEASE HISTORY                                                       */ 
-/*                                                                        */ 
-/*    DATE              NAME                      DESCRIPTION             */
-/*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
-/*                                                                        */
-/**************************************************************************/
-static VOID  _nx_nat_checksum_adjust(UCHAR *checksum, UCHAR *old_data, INT old_data_length, UCHAR *new_data, INT new_data_length)
-{
-
-LONG    x, old_value, new_value;
-INT     i,j;     
-
-#ifdef NX_LITTLE_ENDIAN
-    i = 1;
-    j = 0;
-#else
-    i = 0;
-    j = 1;
-#endif
-
-    /* Checksum Adjustment, RFC 3022, Section 4.2, Page 9.  */
-
-    /* Get the old checksum.  */
-    x = checksum[i] * 256 + checksum[j];
-    x = ~x & 0xFFFF;
-
-    /* Update the checksum for old data.  */
-    while (old_data_length)
-    {
-
-        /* Get the old data.  */
-        old_value = old_data[i] * 256 + old_data[j];
-
-        /* Update the old data pointer.  */
-        old_data += 2;
-
-        /* Update the checksum.  */
-        x -= old_value & 0xFFFF;
-
-        /* Check the value.  */
-        if (x <= 0)
-        {
-
-            /* Update the value.  */
-            x --;
-            x &= 0xFFFF;
-        }
-
-        /* Update the old data length.  */
-        old_data_length -= 2;
-    }
-
-    /* Update the checksum for new data.  */
-    while (new_data_length)
-    {
-
-        /* Get the new data.  */
-        new_value = new_data[i] * 256 + new_data[j];
-
-        /* Update the new data pointer.  */
-        new_data += 2;
-
-        /* Update the checksum.  */
-        x += new_value & 0xFFFF;
-
-        /* Check the value.  */
-        if (x & 0x10000)
-        {
-
-            /* Update the value.  */
-            x ++;
-            x &= 0xFFFF;
-        }
-
-        /* Update the new data length.  */
-        new_data_length -= 2;
-    }
-
-    /* Update the value.  */
-    x = ~x & 0xFFFF;
-
-    /* Update the checksum.  */
-    checksum[i] = (UCHAR)(x /256);
-    checksum[j] = (UCHAR)(x & 0xFF);       
-
-    /* Return.  */
-    return;
-}
 #endif
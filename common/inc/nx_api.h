@@ -167,6 +167,13 @@ extern   "C" {
 #endif /* NX_ENABLE_INTERFACE_CAPABILITY */
 #endif /* NX_ENABLE_TCPIP_OFFLOAD */
 
+/* Packet clone references the data of the original packet as an external buffer.  */
+#ifdef NX_ENABLE_PACKET_CLONE
+#ifndef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+#define NX_ENABLE_PACKET_EXTERNAL_BUFFER
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+#endif /* NX_ENABLE_PACKET_CLONE */
+
 /* Define symbols for compatibility before and after ThreadX 5.8. */
 #if (((THREADX_MAJOR_VERSION << 8) | THREADX_MINOR_VERSION) >= 0x0508)
 #define NX_CLEANUP_PARAMETER , ULONG suspension_sequence
@@ -448,6 +455,21 @@ extern   "C" {
 #define NX_TRACE_UDP_SOCKET_INTERFACE_CLEAR                 448         /* I1 = socket_ptr,                                                         */
 #define NX_TRACE_IP_INTERFACE_INFO_GET                      449         /* I1 = ip_ptr, I2 = ip_address, I3 = mtu_size, I4 = interface_index        */
 #define NX_TRACE_PACKET_DATA_EXTRACT_OFFSET                 450         /* I1 = packet_ptr, I2 = buffer_length, I3 = bytes_copied,                  */
+#define NX_TRACE_PACKET_ALLOCATE_BULK                       451         /* I1 = pool ptr, I2 = packet count, I3 = packet type, I4 = available       */
+#define NX_TRACE_PACKET_RELEASE_BULK                        452         /* I1 = packet array, I2 = packet count                                     */
+#define NX_TRACE_PACKET_TRANSMIT_RELEASE_BULK               453         /* I1 = packet array, I2 = packet count                                     */
+#define NX_TRACE_PACKET_DATA_APPEND_EXTERNAL                454         /* I1 = packet ptr, I2 = data start, I3 = data size, I4 = pool ptr          */
+#define NX_TRACE_PACKET_CLONE                               455         /* I1 = packet ptr, I2 = new packet ptr, I3 = pool ptr, I4 = wait option    */
+#define NX_TRACE_TCP_CONNECTION_TABLE_ENABLE                456         /* I1 = ip ptr, I2 = table memory, I3 = table size, I4 = table entries      */
+#define NX_TRACE_TCP_SOCKET_CONGESTION_CONTROL_SET          457         /* I1 = socket ptr, I2 = congestion control, I3 = socket state              */
+#define NX_TRACE_TCP_SOCKET_ACK_POLICY_SET                  458         /* I1 = socket ptr, I2 = ack segments, I3 = quick ack segments              */
+#define NX_TRACE_TCP_SOCKET_PACING_SET                      459         /* I1 = socket ptr, I2 = pacing rate                                        */
+#define NX_TRACE_TCP_CLIENT_SOCKET_CONNECT_DATA             460         /* I1 = ip ptr, I2 = socket ptr, I3 = server IP, I4 = packet ptr            */
+#define NX_TRACE_TCP_SOCKET_WINDOW_AUTOTUNE_SET             461         /* I1 = socket ptr, I2 = window maximum                                     */
+#define NX_TRACE_IP_STATIC_ROUTE_TABLE_EXTEND               462         /* I1 = ip ptr, I2 = table memory, I3 = table size, I4 = routes added       */
+#define NXD_TRACE_IPV6_STATIC_ROUTE_ADD                     463         /* I1 = ip ptr, I2 = network address lsw, I3 = prefix length, I4 = next hop */
+#define NXD_TRACE_IPV6_STATIC_ROUTE_DELETE                  464         /* I1 = ip ptr, I2 = network address lsw, I3 = prefix length                */
+#define NX_TRACE_ARP_TABLE_RESIZE                           465         /* I1 = ip ptr, I2 = table memory, I3 = table size, I4 = table entries      */
 
 
 #endif
@@ -524,6 +546,11 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_PACKET_ALIGNMENT                      sizeof(ULONG)
 #endif /* NX_PACKET_ALIGNMENT */
 
+/* Define the maximum number of packet pools (size classes) in one packet pool group.  */
+#ifndef NX_PACKET_POOL_GROUP_MAX_CLASSES
+#define NX_PACKET_POOL_GROUP_MAX_CLASSES         4
+#endif /* NX_PACKET_POOL_GROUP_MAX_CLASSES */
+
 
 /* Define basic constants for the NetX TCP/IP Stack.  */
 #define AZURE_RTOS_NETXDUO
@@ -605,14 +632,24 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #endif /* NX_IPV6_HOST_ID_LENGTH */
 
 #define NX_IPv4_PACKET              (NX_PHYSICAL_HEADER + 20)   /* 20 bytes of IP header          */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+#define NX_IPv4_TCP_PACKET          (NX_IPv4_PACKET + 32)       /* IP header plus 20 bytes and    */
+                                                                /*   12 bytes of timestamps       */
+#else
 #define NX_IPv4_TCP_PACKET          (NX_IPv4_PACKET + 20)       /* IP header plus 20 bytes        */
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
 #define NX_IPv4_UDP_PACKET          (NX_IPv4_PACKET + 8)        /* IP header plus 8 bytes         */
 #define NX_IPv4_ICMP_PACKET         (NX_IPv4_PACKET)
 #define NX_IPv4_IGMP_PACKET         (NX_IPv4_PACKET)
 
 #define NX_IPv6_PACKET              (NX_PHYSICAL_HEADER + 40)   /* 40 bytes of basic IPv6 Header  */
 #define NX_IPv6_UDP_PACKET          (NX_IPv6_PACKET + 8)        /* IPv6 header plus 8 bytes       */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+#define NX_IPv6_TCP_PACKET          (NX_IPv6_PACKET + 32)       /* IPv6 header plus 20 bytes and  */
+                                                                /*   12 bytes of timestamps       */
+#else
 #define NX_IPv6_TCP_PACKET          (NX_IPv6_PACKET + 20)       /* IPv6 header plus 20 bytes      */
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
 #define NX_IPv6_ICMP_PACKET         (NX_IPv6_PACKET)
 #define NX_RECEIVE_PACKET           0                           /* This is for driver receive     */
 
@@ -687,6 +724,31 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 
 #endif /* NX_IP_MAX_REASSEMBLY_TIME */
 
+/* Define the number of IP fragment reassembly contexts, the number of hash buckets of the
+   contexts (a power of two), and the number of fragments and the number of payload bytes
+   one datagram can use while it is reassembled.  */
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+#ifndef NX_IP_FRAGMENT_CONTEXT_MAX
+#define NX_IP_FRAGMENT_CONTEXT_MAX          16
+#endif /* NX_IP_FRAGMENT_CONTEXT_MAX */
+
+#ifndef NX_IP_FRAGMENT_HASH_SIZE
+#define NX_IP_FRAGMENT_HASH_SIZE            32
+#endif /* NX_IP_FRAGMENT_HASH_SIZE */
+
+#ifndef NX_IP_FRAGMENT_MAX_FRAGMENTS
+#define NX_IP_FRAGMENT_MAX_FRAGMENTS        128
+#endif /* NX_IP_FRAGMENT_MAX_FRAGMENTS */
+
+#ifndef NX_IP_FRAGMENT_MAX_DATAGRAM_SIZE
+#define NX_IP_FRAGMENT_MAX_DATAGRAM_SIZE    65535
+#endif /* NX_IP_FRAGMENT_MAX_DATAGRAM_SIZE */
+
+/* Define the hash bucket of a datagram from its identification and the low words of its
+   source and destination addresses.  */
+#define NX_IP_FRAGMENT_HASH_INDEX(i, s, d)  ((UINT)(((i) ^ (s) ^ (d) ^ ((s) >> 16) ^ ((d) >> 16)) & (NX_IP_FRAGMENT_HASH_SIZE - 1)))
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
 
 /* Define the maximum number of the packets that can be queued for raw receive. */
 #ifndef NX_IP_RAW_MAX_QUEUE_DEPTH
@@ -697,6 +759,27 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_IP_ROUTING_TABLE_SIZE    8
 #endif /* NX_IP_ROUTING_TABLE_SIZE */
 
+/* The routing trie holds the static routes, it needs static routing.  */
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+#ifndef NX_ENABLE_IP_STATIC_ROUTING
+#define NX_ENABLE_IP_STATIC_ROUTING
+#endif /* NX_ENABLE_IP_STATIC_ROUTING */
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+/* Define the number of destinations held by the route cache, it must be a power of two.  */
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+#ifndef NX_IP_ROUTE_CACHE_SIZE
+#define NX_IP_ROUTE_CACHE_SIZE      16
+#endif /* NX_IP_ROUTE_CACHE_SIZE */
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
+/* Define the number of slots of the ARP timer wheel, it must be a power of two.  */
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+#ifndef NX_ARP_TIMER_WHEEL_SIZE
+#define NX_ARP_TIMER_WHEEL_SIZE     64
+#endif /* NX_ARP_TIMER_WHEEL_SIZE */
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
 /* For backward compatibility, map the smbol NX_RAW_PACKET_FILTER_ENABLE to
    NX_ENABLE_IP_RAW_PACKET_FILTER. */
 #ifdef NX_RAW_PACKET_FILTER_ENABLE
@@ -787,6 +870,21 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_IPV6_NEIGHBOR_CACHE_SIZE     16
 #endif /* NX_IPV6_NEIGHBOR_CACHE_SIZE */
 
+/* Define the number of hash buckets of the IPv6 ND cache table and of the IPv6 destination
+   table, they must be powers of two.  */
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+#ifndef NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE
+#define NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE        32
+#endif /* NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE */
+
+#ifndef NX_IPV6_DESTINATION_TABLE_HASH_SIZE
+#define NX_IPV6_DESTINATION_TABLE_HASH_SIZE     16
+#endif /* NX_IPV6_DESTINATION_TABLE_HASH_SIZE */
+
+/* Define the hash bucket of an IPv6 address in a table with s buckets.  */
+#define NX_IPV6_ADDRESS_HASH_INDEX(a, s)        ((UINT)(((a)[0] ^ (a)[1] ^ (a)[2] ^ (a)[3] ^ ((a)[3] >> 16)) & ((s) - 1)))
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
 /* Define the maximum ICMPv6 Duplicate Address Detect Transmit .  */
 /* For backward compatibility, convert map NX_DUP_ADDR_DETECT_TRANSMITS and NXDUO_DUP_ADDR_DETECT_TRANSMITS to NX_IPV6_DAD_TRANSMITS */
 #ifdef NX_DUP_ADDR_DETECT_TRANSMITS
@@ -1020,6 +1118,14 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_ARP_TABLE_SIZE                      NX_ROUTE_TABLE_SIZE
 #define NX_ARP_TABLE_MASK                      (NX_ARP_TABLE_SIZE - 1)
 
+/* Define the index of an IP address in the ARP table.  If NX_ENABLE_ARP_HASH_TABLE is defined,
+   the size of the table is set at run time by the nx_arp_table_resize service.  */
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+#define NX_ARP_TABLE_INDEX(i, a)               ((UINT)(((a) + ((a) >> 8)) & (i) -> nx_ip_arp_table_mask))
+#else
+#define NX_ARP_TABLE_INDEX(i, a)               ((UINT)(((a) + ((a) >> 8)) & NX_ARP_TABLE_MASK))
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
 
 
 #ifdef FEATURE_NX_IPV6
@@ -1125,6 +1231,17 @@ typedef struct ND_CACHE_ENTRY_STRUCT
      * outgoing packets shall be sent using this address.
      */
     struct NXD_IPV6_ADDRESS_STRUCT *nx_nd_cache_outgoing_address;
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* Next entry in the same hash bucket, and the hash bucket the entry is in. */
+    struct ND_CACHE_ENTRY_STRUCT *nx_nd_cache_hash_next;
+    UINT nx_nd_cache_hash_index;
+
+    /* Links of the entry in the list of entries being probed, and the list the entry is on. */
+    struct ND_CACHE_ENTRY_STRUCT *nx_nd_cache_probe_next;
+    struct ND_CACHE_ENTRY_STRUCT *nx_nd_cache_probe_previous;
+    struct ND_CACHE_ENTRY_STRUCT **nx_nd_cache_probe_list;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 } ND_CACHE_ENTRY;
 
 /* Define the destination table entry type. */
@@ -1151,6 +1268,12 @@ typedef struct NX_IPV6_DESTINATION_ENTRY_STRUCT
     /* MTU Timeout value. */
     ULONG nx_ipv6_destination_entry_MTU_timer_tick;
 #endif
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* Next entry in the same hash bucket, and the hash bucket the entry is in. */
+    struct NX_IPV6_DESTINATION_ENTRY_STRUCT *nx_ipv6_destination_entry_hash_next;
+    UINT nx_ipv6_destination_entry_hash_index;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 } NX_IPV6_DESTINATION_ENTRY;
 
 /* Define data structure for IPv6 prefix table. */
@@ -1198,19 +1321,83 @@ typedef struct NX_IPV6_DEFAULT_ROUTER_ENTRY_STRUCT
 
 #endif /* FEATURE_NX_IPV6 */
 /* Define the constants that determine how big the hash table is for UDP ports.  The
-   value must be a power of two, so subtracting one gives us the mask.  */
+   value must be a power of two, so subtracting one gives us the mask.  This can be
+   defined on the command line as well.  */
 
+#ifndef NX_UDP_PORT_TABLE_SIZE
 #define NX_UDP_PORT_TABLE_SIZE                     32
+#endif
 #define NX_UDP_PORT_TABLE_MASK                     (NX_UDP_PORT_TABLE_SIZE - 1)
 
 
 /* Define the constants that determine how big the hash table is for TCP ports.  The
-   value must be a power of two, so subtracting one gives us the mask.  */
+   value must be a power of two, so subtracting one gives us the mask.  This can be
+   defined on the command line as well.  */
 
+#ifndef NX_TCP_PORT_TABLE_SIZE
 #define NX_TCP_PORT_TABLE_SIZE                     32
+#endif
 #define NX_TCP_PORT_TABLE_MASK                     (NX_TCP_PORT_TABLE_SIZE - 1)
 
 
+/* Define the constants that determine how big the hash table is for TCP listen requests.  The
+   value must be a power of two, so subtracting one gives us the mask.  This can be
+   defined on the command line as well.  */
+
+#ifndef NX_TCP_LISTEN_TABLE_SIZE
+#define NX_TCP_LISTEN_TABLE_SIZE                   16
+#endif
+#define NX_TCP_LISTEN_TABLE_MASK                   (NX_TCP_LISTEN_TABLE_SIZE - 1)
+
+
+/* Define the constants that determine how big each level of the TCP timer wheel is.  The
+   number of slots of a level is two to the power of NX_TCP_TIMER_WHEEL_BITS.  This can be
+   defined on the command line as well.  */
+
+#ifndef NX_TCP_TIMER_WHEEL_BITS
+#define NX_TCP_TIMER_WHEEL_BITS                    5
+#endif
+#define NX_TCP_TIMER_WHEEL_SIZE                    (1 << NX_TCP_TIMER_WHEEL_BITS)
+#define NX_TCP_TIMER_WHEEL_MASK                    (NX_TCP_TIMER_WHEEL_SIZE - 1)
+#define NX_TCP_TIMER_WHEEL_LEVELS                  2
+
+
+/* Define the number of ranges of data SACKed by the peer that a TCP socket keeps track of
+   when selective acknowledgment is enabled with NX_ENABLE_TCP_SACK.  This can be defined
+   on the command line as well.  */
+
+#ifndef NX_TCP_SACK_SCOREBOARD_SIZE
+#define NX_TCP_SACK_SCOREBOARD_SIZE                8
+#endif
+
+
+/* Define the pacing rate of a TCP socket that is derived from the congestion window and the
+   smoothed round trip time when pacing is enabled with NX_ENABLE_TCP_PACING.  A rate of zero
+   disables pacing of the socket.  */
+
+#define NX_TCP_PACING_RATE_AUTO                    0xFFFFFFFF
+
+
+/* Define the number of servers a TCP client remembers the Fast Open cookie of, and the
+   largest cookie it accepts, when TCP Fast Open is enabled with NX_ENABLE_TCP_FAST_OPEN.
+   These can be defined on the command line as well.  */
+
+#ifndef NX_TCP_FAST_OPEN_CACHE_SIZE
+#define NX_TCP_FAST_OPEN_CACHE_SIZE                4
+#endif
+
+#define NX_TCP_FAST_OPEN_COOKIE_SIZE_MAX           16
+
+
+/* Define the lifetime of the SYN cookies a TCP server sends when a listen queue is full and
+   SYN cookies are enabled with NX_ENABLE_TCP_SYN_COOKIES, in seconds.  A cookie is accepted
+   for up to twice this period.  This can be defined on the command line as well.  */
+
+#ifndef NX_TCP_SYN_COOKIE_PERIOD
+#define NX_TCP_SYN_COOKIE_PERIOD                   64
+#endif
+
+
 /* Define the maximum number of multicast groups the system can support.  This might
    be further limited by the underlying physical hardware.  */
 
@@ -1405,6 +1592,8 @@ typedef struct NX_IPV6_DEFAULT_ROUTER_ENTRY_STRUCT
 #define NX_INTERFACE_CAPABILITY_IGMP_RX_CHECKSUM   0x00000800
 #define NX_INTERFACE_CAPABILITY_PTP_TIMESTAMP      0x00001000
 #define NX_INTERFACE_CAPABILITY_TCPIP_OFFLOAD      0x00002000
+#define NX_INTERFACE_CAPABILITY_TCP_SEGMENTATION   0x00004000
+#define NX_INTERFACE_CAPABILITY_TCP_RECEIVE_OFFLOAD 0x00008000
 #define NX_INTERFACE_CAPABILITY_CHECKSUM_ALL       (NX_INTERFACE_CAPABILITY_IPV4_TX_CHECKSUM | \
                                                     NX_INTERFACE_CAPABILITY_IPV4_RX_CHECKSUM | \
                                                     NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM | \
@@ -1658,6 +1847,33 @@ typedef  struct NX_PACKET_STRUCT
     USHORT      nx_packet_ipsec_state;
 #endif /* NX_IPSEC_ENABLE */
 
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+    /* Define the function to notify the application when the external buffer referenced
+       by this packet is no longer used, and the context passed to it.  The notify function
+       is NX_NULL if the data area of the packet is in the packet pool.  */
+    VOID        (*nx_packet_external_buffer_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context);
+    VOID        *nx_packet_external_buffer_context;
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+
+#ifdef NX_ENABLE_PACKET_CLONE
+    /* Define the number of clones referencing the data of this packet.  The packet is
+       returned to the pool when it is released and no clone references it.  */
+    ULONG       nx_packet_clone_count;
+#endif /* NX_ENABLE_PACKET_CLONE */
+
+#if defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD)
+    /* Define the payload size of the segments a TCP packet larger than the MSS is split
+       into before transmission.  It is zero if the packet is not segmented.  On a received
+       packet held for coalescing, it is the payload size of the first segment.  */
+    ULONG       nx_packet_tcp_segment_size;
+#endif /* defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD) */
+
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    /* Define the flag set by TCP receive coalescing on the packets it holds.  The checksums
+       of the segments of such a packet are already verified.  */
+    UCHAR       nx_packet_tcp_coalesced;
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
 #ifdef NX_ENABLE_PACKET_DEBUG_INFO
     /* Indicate the current thread that owns the packet. */
     CHAR       *nx_packet_debug_thread;
@@ -1726,9 +1942,96 @@ typedef struct NX_PACKET_POOL_STRUCT
     /* Low watermark. */
     UINT        nx_packet_pool_low_watermark;
 #endif /* NX_ENABLE_LOW_WATERMARK */
+
+#ifdef NX_ENABLE_PACKET_CACHE
+    /* Define the head pointer and count of the packet caches created on this pool.  */
+    struct NX_PACKET_CACHE_STRUCT
+               *nx_packet_pool_cache_created_ptr;
+    ULONG       nx_packet_pool_cache_created_count;
+
+    /* Define the cache statistics accumulated from deleted packet caches.  */
+    ULONG       nx_packet_pool_cache_hits;
+    ULONG       nx_packet_pool_cache_misses;
+#endif /* NX_ENABLE_PACKET_CACHE */
+
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+    /* Define the packet pool group this pool belongs to.  */
+    struct NX_PACKET_POOL_GROUP_STRUCT
+               *nx_packet_pool_group_ptr;
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+
+#ifdef NX_ENABLE_PACKET_CLONE
+    /* Define the number of packets of this pool whose data is shared with clones, and
+       the number of clone references to them.  */
+    ULONG       nx_packet_pool_shared_packets;
+    ULONG       nx_packet_pool_clone_references;
+#endif /* NX_ENABLE_PACKET_CLONE */
 } NX_PACKET_POOL;
 
 
+/* Define the Packet Cache control block.  A packet cache holds a small stack of free
+   packets taken from one packet pool.  It is owned by a single thread (or a single
+   driver context), so packets are allocated from and released to the cache without
+   disabling interrupts.  The cache is refilled from and drained to the packet pool
+   in batches.  */
+
+typedef struct NX_PACKET_CACHE_STRUCT
+{
+
+    /* Define the packet cache ID used for error checking.  */
+    ULONG       nx_packet_cache_id;
+
+    /* Define the packet cache's name.  */
+    CHAR       *nx_packet_cache_name;
+
+    /* Define the packet pool this cache is created on.  */
+    struct NX_PACKET_POOL_STRUCT
+               *nx_packet_cache_pool_ptr;
+
+    /* Define the head pointer and the number of packets held in the cache.  */
+    struct NX_PACKET_STRUCT
+               *nx_packet_cache_list;
+    ULONG       nx_packet_cache_count;
+
+    /* Define the maximum number of packets held in the cache, and the number of
+       packets moved between the cache and the pool at once.  */
+    ULONG       nx_packet_cache_size;
+    ULONG       nx_packet_cache_batch_size;
+
+    /* Define statistics for this packet cache.  */
+    ULONG       nx_packet_cache_hits;
+    ULONG       nx_packet_cache_misses;
+
+    /* Define the created list next and previous pointers.  */
+    struct NX_PACKET_CACHE_STRUCT
+               *nx_packet_cache_created_next,
+               *nx_packet_cache_created_previous;
+} NX_PACKET_CACHE;
+
+
+/* Define the Packet Pool Group control block.  A packet pool group holds packet pools
+   of different payload sizes, each pool being one size class.  Packets are allocated
+   from the smallest class that fits the requested length.  */
+
+typedef struct NX_PACKET_POOL_GROUP_STRUCT
+{
+
+    /* Define the packet pool group ID used for error checking.  */
+    ULONG       nx_packet_pool_group_id;
+
+    /* Define the packet pool group's name.  */
+    CHAR       *nx_packet_pool_group_name;
+
+    /* Define the packet pools of the group, sorted by payload size in ascending order.  */
+    struct NX_PACKET_POOL_STRUCT
+               *nx_packet_pool_group_pools[NX_PACKET_POOL_GROUP_MAX_CLASSES];
+    UINT        nx_packet_pool_group_count;
+
+    /* Define the number of allocations served by a larger class than the best-fit one.  */
+    ULONG       nx_packet_pool_group_fallbacks;
+} NX_PACKET_POOL_GROUP;
+
+
 #ifndef NX_DISABLE_IPV4
 /* Define the Address Resolution Protocol (ARP) structure that makes up the
    route table in each IP instance.  This is how IP addresses are translated
@@ -1779,6 +2082,16 @@ typedef struct NX_ARP_STRUCT
        the oldest packet is discarded in favor of keeping the newer packet.  */
     struct NX_PACKET_STRUCT
         *nx_arp_packets_waiting;
+
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+    /* Define the links of the entry in the ARP timer wheel, the list the entry is on,
+       and the tick of the timer wheel at which the next update is due.  */
+    struct NX_ARP_STRUCT
+         *nx_arp_timer_next,
+         *nx_arp_timer_previous,
+        **nx_arp_timer_list;
+    ULONG nx_arp_timer_expiration;
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
 } NX_ARP;
 #endif /* NX_DISABLE_IPV4 */
 
@@ -1909,6 +2222,194 @@ typedef struct NX_UDP_SOCKET_STRUCT
 #endif
 
 
+#ifdef NX_ENABLE_TCP_SACK
+
+/* Define the TCP SACK block structure.  A block covers the data from the begin sequence up to,
+   but not including, the end sequence.  */
+
+typedef struct NX_TCP_SACK_BLOCK_STRUCT
+{
+
+    ULONG       nx_tcp_sack_block_begin;
+    ULONG       nx_tcp_sack_block_end;
+} NX_TCP_SACK_BLOCK;
+
+#endif /* NX_ENABLE_TCP_SACK */
+
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+
+/* Define the TCP timer structure.  A TCP socket with an armed timeout is linked to a slot
+   of a timer wheel of the IP instance, so that the periodic processing only visits the
+   sockets with expiring timeouts.  */
+
+typedef struct NX_TCP_TIMER_STRUCT
+{
+
+    /* Define the links of the list this timer is on.  */
+    struct NX_TCP_TIMER_STRUCT
+                *nx_tcp_timer_next,
+                *nx_tcp_timer_previous;
+
+    /* Define the head pointer of the list this timer is on.  It is NX_NULL if the
+       timer is not armed.  */
+    struct NX_TCP_TIMER_STRUCT
+                **nx_tcp_timer_list;
+
+    /* Define the tick of the wheel the timer expires at.  */
+    ULONG       nx_tcp_timer_expiration;
+
+    /* Define the tick of the wheel the timeouts of the socket are up to date with.  */
+    ULONG       nx_tcp_timer_updated;
+
+    /* Define the socket this timer belongs to.  */
+    struct NX_TCP_SOCKET_STRUCT
+                *nx_tcp_timer_socket;
+} NX_TCP_TIMER;
+
+
+/* Define the TCP timer wheel structure.  A slot of the lowest level holds the timers
+   expiring at one tick.  A slot of the next level holds the timers expiring in the
+   NX_TCP_TIMER_WHEEL_SIZE ticks covered by the lower level, these are moved down when
+   the wheel reaches them.  */
+
+typedef struct NX_TCP_TIMER_WHEEL_STRUCT
+{
+
+    /* Define the current tick of the wheel.  */
+    ULONG       nx_tcp_timer_wheel_tick;
+
+    /* Define the slots of each level.  */
+    NX_TCP_TIMER
+                *nx_tcp_timer_wheel_slots[NX_TCP_TIMER_WHEEL_LEVELS][NX_TCP_TIMER_WHEEL_SIZE];
+
+    /* Define the list of timers expired at the current tick.  */
+    NX_TCP_TIMER
+                *nx_tcp_timer_wheel_expired;
+} NX_TCP_TIMER_WHEEL;
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+/* Define the TCP Fast Open cookie cache entry.  A client keeps the cookie a server returned,
+   along with the MSS of the server, so the next connection to the server can carry data in
+   the SYN.  A cookie length of zero marks an unused entry.  */
+
+typedef struct NX_TCP_FAST_OPEN_ENTRY_STRUCT
+{
+
+    /* Define the address of the server.  */
+    NXD_ADDRESS nx_tcp_fast_open_entry_address;
+
+    /* Define the MSS of the server.  */
+    ULONG       nx_tcp_fast_open_entry_mss;
+
+    /* Define the cookie of the server.  */
+    UINT        nx_tcp_fast_open_entry_cookie_length;
+    UCHAR       nx_tcp_fast_open_entry_cookie[NX_TCP_FAST_OPEN_COOKIE_SIZE_MAX];
+} NX_TCP_FAST_OPEN_ENTRY;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+
+/* Define the TCP congestion control structure.  A congestion control module is a table of
+   the operations that adjust the congestion window of a socket.  The core TCP processing
+   keeps the fast recovery procedure, and calls the module when the connection is
+   established, when new data is acknowledged outside of fast recovery, when a loss is
+   detected by duplicate ACKs, and when the retransmission timer expires.  The round trip
+   time passed to the ACK operation is in timer ticks, or NX_TCP_RTT_INVALID if the ACK
+   does not complete a measurement.  */
+
+struct NX_TCP_SOCKET_STRUCT;
+
+typedef struct NX_TCP_CONGESTION_CONTROL_STRUCT
+{
+
+    /* Define the name of the congestion control module.  */
+    CHAR        *nx_tcp_congestion_control_name;
+
+    /* Define the operations of the congestion control module.  */
+    VOID        (*nx_tcp_congestion_control_initialize)(struct NX_TCP_SOCKET_STRUCT *socket_ptr);
+    VOID        (*nx_tcp_congestion_control_ack)(struct NX_TCP_SOCKET_STRUCT *socket_ptr, ULONG acked_bytes, ULONG round_trip_time);
+    VOID        (*nx_tcp_congestion_control_loss)(struct NX_TCP_SOCKET_STRUCT *socket_ptr);
+    VOID        (*nx_tcp_congestion_control_timeout)(struct NX_TCP_SOCKET_STRUCT *socket_ptr);
+    ULONG       (*nx_tcp_congestion_control_window_get)(struct NX_TCP_SOCKET_STRUCT *socket_ptr);
+} NX_TCP_CONGESTION_CONTROL;
+
+#define NX_TCP_RTT_INVALID                         0xFFFFFFFF
+
+
+/* Define the TCP congestion control modules.  NewReno is the default of a socket, the
+   others are selected with nx_tcp_socket_congestion_control_set.  */
+
+extern const NX_TCP_CONGESTION_CONTROL nx_tcp_congestion_control_newreno;
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+extern const NX_TCP_CONGESTION_CONTROL nx_tcp_congestion_control_cubic;
+extern const NX_TCP_CONGESTION_CONTROL nx_tcp_congestion_control_delay;
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+
+/* Define the state of the CUBIC congestion control module, RFC 9438.  The windows are in
+   bytes and the times in milliseconds.  */
+
+typedef struct NX_TCP_CUBIC_STRUCT
+{
+
+    /* Define the window before the last reduction, W_max.  */
+    ULONG       nx_tcp_cubic_window_max;
+
+    /* Define the window at the plateau of the cubic function of the current epoch.  */
+    ULONG       nx_tcp_cubic_origin;
+
+    /* Define the time to reach the origin from the start of the current epoch, K.  */
+    ULONG       nx_tcp_cubic_k;
+
+    /* Define the start time of the current epoch in timer ticks.  */
+    ULONG       nx_tcp_cubic_epoch_start;
+    UINT        nx_tcp_cubic_epoch_valid;
+
+    /* Define the window estimated for Reno, W_est.  */
+    ULONG       nx_tcp_cubic_reno_window;
+
+    /* Define the latest round trip time measured in timer ticks.  */
+    ULONG       nx_tcp_cubic_round_trip_time;
+} NX_TCP_CUBIC;
+
+
+/* Define the state of the delay-based congestion control module.  The module estimates
+   the bandwidth-delay product of the path from the delivery rate and the minimum round
+   trip time, and sets the window to twice the product.  */
+
+typedef struct NX_TCP_DELAY_STRUCT
+{
+
+    /* Define the phase of the module.  */
+    UINT        nx_tcp_delay_phase;
+
+    /* Define the minimum round trip time in timer ticks, and when it was measured.  */
+    ULONG       nx_tcp_delay_min_rtt;
+    ULONG       nx_tcp_delay_min_rtt_time;
+
+    /* Define the maximum delivery rate in bytes per timer tick.  */
+    ULONG       nx_tcp_delay_bandwidth;
+
+    /* Define the bytes delivered and the start time of the current round trip.  */
+    ULONG       nx_tcp_delay_round_bytes;
+    ULONG       nx_tcp_delay_round_start;
+
+    /* Define the delivery rate when the startup phase last grew the rate, and the number of
+       round trips since then.  */
+    ULONG       nx_tcp_delay_full_bandwidth;
+    UINT        nx_tcp_delay_full_rounds;
+
+    /* Define the time to leave the phase that probes the minimum round trip time.  */
+    ULONG       nx_tcp_delay_probe_rtt_end;
+} NX_TCP_DELAY;
+
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+
 /* Define the basic TCP socket structure.  This structure is used to manage all information
    necessary to manage TCP transmission and reception.  */
 
@@ -2080,6 +2581,147 @@ typedef struct NX_TCP_SOCKET_STRUCT
     ULONG       nx_tcp_snd_win_scale_value;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
+#ifdef NX_ENABLE_TCP_SACK
+    /* Define whether selective acknowledgment is permitted on the connection.  It is set when
+       this side sends the SYN, and then holds whether the peer offered SACK in its SYN.  */
+    UINT        nx_tcp_socket_sack_permitted;
+
+    /* Begin sequence of the most recent out-of-order data received, reported in the first
+       SACK block.  */
+    ULONG       nx_tcp_socket_sack_recent_sequence;
+
+    /* Define the scoreboard of the data SACKed by the peer.  The ranges are sorted by sequence
+       number and do not overlap.  */
+    NX_TCP_SACK_BLOCK
+                nx_tcp_socket_sack_scoreboard[NX_TCP_SACK_SCOREBOARD_SIZE];
+    UINT        nx_tcp_socket_sack_scoreboard_count;
+
+    /* Highest sequence retransmitted during the fast recovery, HighRxt of RFC 6675.  */
+    ULONG       nx_tcp_socket_sack_high_retransmit;
+#endif /* NX_ENABLE_TCP_SACK */
+
+    /* Define the congestion control module of the socket.  */
+    const NX_TCP_CONGESTION_CONTROL
+                *nx_tcp_socket_congestion_control;
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+    /* Define the segment timed for the round trip time measurement.  The measurement is
+       discarded if any data is retransmitted before the segment is acknowledged.  */
+    UINT        nx_tcp_socket_rtt_timing;
+    ULONG       nx_tcp_socket_rtt_sequence;
+    ULONG       nx_tcp_socket_rtt_start_time;
+
+    /* Define the state of the congestion control module.  */
+    union
+    {
+        NX_TCP_CUBIC
+                nx_tcp_socket_cubic;
+        NX_TCP_DELAY
+                nx_tcp_socket_delay;
+    } nx_tcp_socket_congestion_state;
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Define whether the timestamps option is used on the connection.  It is set when this
+       side sends the SYN, and then holds whether the peer sent the option in its SYN.  */
+    UINT        nx_tcp_socket_timestamp_permitted;
+
+    /* Most recent timestamp received from the peer, TS.Recent of RFC 7323, and the local
+       timestamp clock when it was recorded.  */
+    ULONG       nx_tcp_socket_timestamp_recent;
+    ULONG       nx_tcp_socket_timestamp_recent_time;
+
+    /* Timestamp echoed by the segment being processed, zero if there is none.  */
+    ULONG       nx_tcp_socket_timestamp_echo;
+
+    /* Define the smoothed round trip time, the round trip time variation and the
+       retransmission timeout, in microseconds.  The timeout is zero until the first round
+       trip time is measured.  */
+    ULONG       nx_tcp_socket_rtt_smoothed;
+    ULONG       nx_tcp_socket_rtt_variance;
+    ULONG       nx_tcp_socket_rto;
+
+    /* Retransmission timeout used before the round trip time is measured, in ticks.  */
+    ULONG       nx_tcp_socket_timeout_rate_initial;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Define the ACK policy of the socket.  In-sequence data is acknowledged once the data
+       not yet acknowledged reaches the number of full size segments, and the number of
+       data segments after an idle period or out-of-order data that are acknowledged
+       immediately.  */
+    UINT        nx_tcp_socket_ack_segments;
+    UINT        nx_tcp_socket_quick_ack_segments;
+
+    /* Define the number of segments left to acknowledge immediately.  */
+    UINT        nx_tcp_socket_quick_ack_count;
+
+    /* Define whether the connection is interactive, that is, the application answered the
+       last data received before the delayed ACK timeout.  An interactive connection does not
+       enter the quick-ACK mode after an idle period, since its ACKs are sent with the data.  */
+    UINT        nx_tcp_socket_ack_interactive;
+
+    /* Define the time the last in-sequence data was received, in timer ticks.  */
+    ULONG       nx_tcp_socket_ack_receive_time;
+
+    /* Define whether the socket is on the list of sockets whose ACK is coalesced with the
+       ACKs of the following received packets, and the link of the list.  */
+    UINT        nx_tcp_socket_ack_pending;
+    struct NX_TCP_SOCKET_STRUCT
+                *nx_tcp_socket_ack_pending_next;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
+#ifdef NX_ENABLE_TCP_PACING
+    /* Define the pacing rate of the socket in bytes per second.  It is zero if the socket is
+       not paced, and NX_TCP_PACING_RATE_AUTO if the rate is derived from the congestion window
+       and the smoothed round trip time.  */
+    ULONG       nx_tcp_socket_pacing_rate;
+
+    /* Define the bytes the socket may send before data is held back, and the time the credit
+       was last updated.  The credit goes below zero when a segment larger than the credit is
+       sent.  */
+    LONG        nx_tcp_socket_pacing_credit;
+    ULONG       nx_tcp_socket_pacing_time;
+
+    /* Define the smoothed round trip time in timer ticks, zero until it is measured.  */
+    ULONG       nx_tcp_socket_pacing_rtt;
+
+    /* Define whether data of the socket is held back until the pacing timer expires.  */
+    UINT        nx_tcp_socket_pacing_waiting;
+#endif /* NX_ENABLE_TCP_PACING */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Define the initial data of a client connection, carried in the SYN when the cookie of
+       the server is known, and the bytes of it the SYN carries.  The data is owned by the
+       socket until it is sent.  */
+    NX_PACKET   *nx_tcp_socket_fast_open_packet;
+    ULONG       nx_tcp_socket_fast_open_length;
+
+    /* Define whether the SYN carries a Fast Open option.  A client sends it to present a
+       cookie or to request one, a server to return the cookie of the client.  */
+    UINT        nx_tcp_socket_fast_open_option;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+    /* Define the largest receive window autotuning may grow the window to, zero if the window
+       is not tuned, and the window the socket was created with.  The window of each connection
+       starts from the initial window.  */
+    ULONG       nx_tcp_socket_rx_autotune_maximum;
+    ULONG       nx_tcp_socket_rx_autotune_initial;
+
+    /* Define the round trip time seen by the receiver in timer ticks, zero until it is
+       measured, and the sequence number and time that end the current measurement.  */
+    ULONG       nx_tcp_socket_rx_autotune_rtt;
+    ULONG       nx_tcp_socket_rx_autotune_rtt_sequence;
+    ULONG       nx_tcp_socket_rx_autotune_rtt_time;
+
+    /* Define the bytes the application received since the time the measurement started, and
+       the most bytes it received in one round trip time.  */
+    ULONG       nx_tcp_socket_rx_autotune_copied;
+    ULONG       nx_tcp_socket_rx_autotune_time;
+    ULONG       nx_tcp_socket_rx_autotune_space;
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
     /* Define the TCP keepalive timer parameters.  If enabled with NX_ENABLE_TCP_KEEPALIVE,
        these parameters are used to implement the keepalive timer.  */
 #ifdef NX_ENABLE_TCP_KEEPALIVE
@@ -2093,6 +2735,27 @@ typedef struct NX_TCP_SOCKET_STRUCT
                 *nx_tcp_socket_bound_next,
                 *nx_tcp_socket_bound_previous;
 
+    /* Define the TCP connection table links.  A socket that has received packets
+       of a connection is also hashed by local port, peer port and peer address
+       into the connection table of the IP instance, if the table is enabled.  */
+    struct NX_TCP_SOCKET_STRUCT
+                *nx_tcp_socket_connection_next,
+                *nx_tcp_socket_connection_previous;
+
+    /* Define the index of the connection table entry this socket is linked to.  */
+    ULONG       nx_tcp_socket_connection_index;
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Define the TCP timers of the socket.  The fast timer covers the transmit and
+       the delayed ACK timeouts, the keepalive timer covers the keepalive timeout.  */
+    NX_TCP_TIMER
+                nx_tcp_socket_fast_timer;
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    NX_TCP_TIMER
+                nx_tcp_socket_keepalive_timer;
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
     /* Define the TCP socket bind suspension thread pointer.  This pointer points
        to the thread that that is suspended attempting to bind to a port that is
        already bound to another socket.  */
@@ -2240,6 +2903,11 @@ typedef struct NX_TCP_LISTEN_STRUCT
     struct NX_TCP_LISTEN_STRUCT
                 *nx_tcp_listen_next,
                 *nx_tcp_listen_previous;
+
+    /* Define the link between active TCP listen structures in the same entry of the
+       listen table.  */
+    struct NX_TCP_LISTEN_STRUCT
+                *nx_tcp_listen_hash_next;
 } NX_TCP_LISTEN;
 
 /* There should be at least one physical interface. */
@@ -2280,6 +2948,12 @@ typedef struct NX_TCP_LISTEN_STRUCT
 #ifndef NX_DISABLE_FRAGMENTATION
 #error "IP fragmentation is not supported if packet chain is disabled."
 #endif /* NX_DISABLE_FRAGMENTATION */
+#ifdef NX_ENABLE_PACKET_CLONE
+#error "Packet clone is not supported if packet chain is disabled."
+#endif /* NX_ENABLE_PACKET_CLONE */
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+#error "TCP receive offload is not supported if packet chain is disabled."
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
 #endif /* NX_DISABLE_PACKET_CHAIN */
 
 struct NX_IP_DRIVER_STRUCT;
@@ -2461,6 +3135,61 @@ typedef struct NX_IP_ROUTING_ENTRY_STRUCT
 } NX_IP_ROUTING_ENTRY;
 #endif /* defined(NX_ENABLE_IP_STATIC_ROUTING) && !defined(NX_DISABLE_IPV4) */
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+/* Define the number of words of a route prefix.  IPv4 prefixes use the first word only.  */
+#ifdef FEATURE_NX_IPV6
+#define NX_IP_ROUTE_PREFIX_WORDS    4
+#else
+#define NX_IP_ROUTE_PREFIX_WORDS    1
+#endif /* FEATURE_NX_IPV6 */
+
+/* Define the node of a routing trie.  The trie is a binary trie with path compression: each
+   node holds its complete prefix, and the child of a node is selected by the first bit after
+   the prefix.  A node either holds a route or joins two subtries.  */
+typedef struct NX_IP_ROUTE_NODE_STRUCT
+{
+    /* Prefix in host byte order, the bits after the prefix length are zero.  */
+    ULONG       nx_ip_route_node_prefix[NX_IP_ROUTE_PREFIX_WORDS];
+    ULONG       nx_ip_route_node_prefix_length;
+
+    /* Next hop address in host byte order and interface of the route.  The interface is
+       NX_NULL if the node holds no route.  */
+    ULONG       nx_ip_route_node_next_hop[NX_IP_ROUTE_PREFIX_WORDS];
+    struct NX_INTERFACE_STRUCT
+               *nx_ip_route_node_interface;
+
+    /* Define the links of the trie.  Free nodes are linked through the first child.  */
+    struct NX_IP_ROUTE_NODE_STRUCT
+               *nx_ip_route_node_parent;
+    struct NX_IP_ROUTE_NODE_STRUCT
+               *nx_ip_route_node_child[2];
+} NX_IP_ROUTE_NODE;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+/* Define the entry of the IPv4 route cache.  An entry holds the route found for a destination
+   and the ARP entry of its next hop, which are valid while the generations they were stored
+   with match those of the IP instance.  */
+typedef struct NX_IP_ROUTE_CACHE_ENTRY_STRUCT
+{
+    /* Destination and next hop addresses in host byte order.  */
+    ULONG       nx_ip_route_cache_destination;
+    ULONG       nx_ip_route_cache_next_hop;
+
+    /* Outgoing interface, NX_NULL if the entry is not used.  */
+    struct NX_INTERFACE_STRUCT
+               *nx_ip_route_cache_interface;
+
+    /* ARP entry of the next hop, NX_NULL until the first packet is sent.  */
+    struct NX_ARP_STRUCT
+               *nx_ip_route_cache_arp;
+
+    /* Route and ARP generations of the IP instance when the route and the ARP entry were stored.  */
+    ULONG       nx_ip_route_cache_route_generation;
+    ULONG       nx_ip_route_cache_arp_generation;
+} NX_IP_ROUTE_CACHE_ENTRY;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
 #ifndef NX_DISABLE_IPV4
 typedef struct NX_IPV4_MULTICAST_STRUCT
 {
@@ -2499,6 +3228,42 @@ typedef struct NX_IPV6_MULTICAST_STRUCT
 
 #endif /* NX_ENABLE_IPV6_MULTICAST  */
 
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+/* Define the IP fragment reassembly context.  A context holds the fragments of one
+   datagram, sorted by offset and linked through nx_packet_fragment_next.  */
+typedef struct NX_IP_FRAGMENT_CONTEXT_STRUCT
+{
+
+    /* Define the first fragment, the fragment with the highest offset and its
+       offset as found in the header of the fragment.  */
+    NX_PACKET *nx_ip_fragment_context_head;
+    NX_PACKET *nx_ip_fragment_context_last;
+    ULONG      nx_ip_fragment_context_last_offset;
+
+    /* Define the next context in the same hash bucket, and the hash bucket the
+       context is in.  */
+    struct NX_IP_FRAGMENT_CONTEXT_STRUCT
+              *nx_ip_fragment_context_hash_next;
+    UINT       nx_ip_fragment_context_hash_index;
+
+    /* Define the links of the context in the active list, or in the free list.  */
+    struct NX_IP_FRAGMENT_CONTEXT_STRUCT
+              *nx_ip_fragment_context_next,
+              *nx_ip_fragment_context_previous;
+
+    /* Define the identification and the IP version of the datagram.  */
+    ULONG      nx_ip_fragment_context_id;
+    ULONG      nx_ip_fragment_context_version;
+
+    /* Define the number of fragments, the number of payload bytes received, and
+       the payload length of the datagram, which is zero until the last fragment
+       is received.  */
+    ULONG      nx_ip_fragment_context_count;
+    ULONG      nx_ip_fragment_context_received;
+    ULONG      nx_ip_fragment_context_length;
+} NX_IP_FRAGMENT_CONTEXT;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
+
 
 /* Determine if the IP control block has an extension defined. If not, 
    define the extension to whitespace.  */
@@ -2560,6 +3325,21 @@ typedef struct NX_IP_STRUCT
 
     /* Define the destination table size. */
     UINT        nx_ipv6_destination_table_size;
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* Define the hash buckets of the destination table and of the ND cache table.
+       An entry stays in its bucket until the entry is reused for another address,
+       so the lookups skip the entries that are no longer valid.  */
+    NX_IPV6_DESTINATION_ENTRY
+               *nx_ipv6_destination_hash[NX_IPV6_DESTINATION_TABLE_HASH_SIZE];
+    ND_CACHE_ENTRY
+               *nx_ipv6_nd_cache_hash[NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE];
+
+    /* Define the list of ND cache entries in the INCOMPLETE or PROBE state, so the
+       ND cache fast periodic update only visits the entries being probed.  */
+    ND_CACHE_ENTRY
+               *nx_ipv6_nd_cache_probe_list;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 #endif /* FEATURE_NX_IPV6 */
 
     /* Define the statistic and error counters for this IP instance.   */
@@ -2671,6 +3451,12 @@ typedef struct NX_IP_STRUCT
                 *nx_ip_auxiliary_packet_pool;
 #endif /* NX_ENABLE_DUAL_PACKET_POOL */
 
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+    /* Define the packet pool group used for internal packets such as TCP control packets.  */
+    struct NX_PACKET_POOL_GROUP_STRUCT
+                *nx_ip_packet_pool_group;
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+
     /* Define the internal mutex used for protection inside the NetX
        data structures.  */
     TX_MUTEX    nx_ip_protection;
@@ -2754,6 +3540,32 @@ typedef struct NX_IP_STRUCT
     NX_PACKET   *nx_ip_fragment_assembly_head,
                 *nx_ip_fragment_assembly_tail;
 
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+    /* Define the fragment reassembly contexts.  A context in use is in the hash bucket
+       of its datagram and on the active list, in the order of the re-assembly queue.
+       The other contexts are on the free list.  */
+    NX_IP_FRAGMENT_CONTEXT
+                nx_ip_fragment_contexts[NX_IP_FRAGMENT_CONTEXT_MAX];
+    NX_IP_FRAGMENT_CONTEXT
+               *nx_ip_fragment_context_hash[NX_IP_FRAGMENT_HASH_SIZE];
+    NX_IP_FRAGMENT_CONTEXT
+               *nx_ip_fragment_context_active_head,
+               *nx_ip_fragment_context_active_tail,
+               *nx_ip_fragment_context_free_list;
+    ULONG       nx_ip_fragment_contexts_used;
+
+#ifndef NX_DISABLE_IP_INFO
+    /* Define the number of duplicate fragments replaced, the number of fragments
+       dropped because they end beyond NX_IP_FRAGMENT_MAX_DATAGRAM_SIZE or exceed
+       NX_IP_FRAGMENT_MAX_FRAGMENTS, and the number of contexts reused before their
+       datagram was complete.  */
+    ULONG       nx_ip_fragment_duplicates;
+    ULONG       nx_ip_fragment_oversize_drops;
+    ULONG       nx_ip_fragment_limit_drops;
+    ULONG       nx_ip_fragment_context_evictions;
+#endif /* NX_DISABLE_IP_INFO */
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
+
 #ifdef NX_ENABLE_6LOWPAN
     /* Define the created 6LoWPAN list. */
     VOID        *nx_ip_6lowpan_created_ptr;
@@ -2912,6 +3724,36 @@ typedef struct NX_IP_STRUCT
     /* Define the count of incoming TCP packets on the queue.  */
     ULONG       nx_ip_tcp_received_packet_count;
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    /* Define the list of received TCP packets held for coalescing with the following
+       segments of the same connection, and the number of packets on the list.  */
+    NX_PACKET   *nx_ip_tcp_coalesce_head,
+                *nx_ip_tcp_coalesce_tail;
+    UINT        nx_ip_tcp_coalesce_count;
+
+    /* Define the flag set by the IP helper thread while it processes the deferred
+       receive queue.  TCP packets are held for coalescing only when it is set.  */
+    UINT        nx_ip_tcp_coalesce_active;
+
+    /* Define the routine that passes the held TCP packets to TCP processing.  This is
+       setup when TCP is enabled.  */
+    void        (*nx_ip_tcp_coalesce_flush)(struct NX_IP_STRUCT *);
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Define the list of TCP sockets with an ACK pending.  While the IP helper thread
+       processes a batch of received packets, the ACKs of in-sequence data are held on
+       this list and sent once for each socket when the batch is done.  */
+    struct NX_TCP_SOCKET_STRUCT
+                *nx_ip_tcp_ack_pending_head;
+
+    /* Define the flag set while ACKs are held on the list.  */
+    UINT        nx_ip_tcp_ack_pending_active;
+
+    /* Define the routine that sends the held ACKs.  This is setup when TCP is enabled.  */
+    void        (*nx_ip_tcp_ack_pending_flush)(struct NX_IP_STRUCT *);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
     /* Define the TCP listen request structure that contains the maximum number of
        listen requests allowed for this IP instance.  */
     NX_TCP_LISTEN
@@ -2926,6 +3768,71 @@ typedef struct NX_IP_STRUCT
     NX_TCP_LISTEN
                 *nx_ip_tcp_active_listen_requests;
 
+    /* Define the TCP listen table.  Active listen requests are also hashed
+       by port into this table, so that a connection request finds its listen
+       request without searching all of them.  */
+    NX_TCP_LISTEN
+                *nx_ip_tcp_listen_table[NX_TCP_LISTEN_TABLE_SIZE];
+
+    /* Define the TCP connection table.  The memory of the table is supplied by the
+       nx_tcp_connection_table_enable service.  The number of entries is a power of
+       two and is zero if the table is not enabled.  */
+    struct NX_TCP_SOCKET_STRUCT
+                **nx_ip_tcp_connection_table;
+    ULONG       nx_ip_tcp_connection_table_size;
+
+    /* Define the TCP connection table statistics.  */
+    ULONG       nx_ip_tcp_connection_table_lookups;
+    ULONG       nx_ip_tcp_connection_table_hits;
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Define the TCP timer wheels.  The fast timer wheel advances with the fast TCP
+       periodic processing, the keepalive timer wheel with the TCP periodic processing.  */
+    NX_TCP_TIMER_WHEEL
+                nx_ip_tcp_fast_timer_wheel;
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    NX_TCP_TIMER_WHEEL
+                nx_ip_tcp_keepalive_timer_wheel;
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
+#ifdef NX_ENABLE_TCP_PACING
+    /* Define the one-shot timer that wakes the IP helper thread when data of a paced TCP
+       socket may be sent, with one timer tick resolution.  The timer is armed for the
+       earliest socket, and the tick it expires at is kept while it is armed.  */
+    TX_TIMER    nx_ip_tcp_pacing_timer;
+    ULONG       nx_ip_tcp_pacing_expiration;
+    UINT        nx_ip_tcp_pacing_timer_armed;
+    UINT        nx_ip_tcp_pacing_timer_created;
+
+    /* Define the routine that releases the paced sockets.  This is setup when TCP is
+       enabled.  */
+    void        (*nx_ip_tcp_pacing_process)(struct NX_IP_STRUCT *);
+#endif /* NX_ENABLE_TCP_PACING */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Define the secret the TCP Fast Open cookies of the clients are derived from.  This is
+       setup when TCP is enabled.  */
+    ULONG       nx_ip_tcp_fast_open_key[2];
+
+    /* Define the cookies of the servers TCP clients connected to, and the entry replaced
+       next.  */
+    NX_TCP_FAST_OPEN_ENTRY
+                nx_ip_tcp_fast_open_cache[NX_TCP_FAST_OPEN_CACHE_SIZE];
+    UINT        nx_ip_tcp_fast_open_cache_next;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+    /* Define the secret the SYN cookies are derived from.  This is setup when TCP is
+       enabled.  */
+    ULONG       nx_ip_tcp_syn_cookie_key[2];
+
+    /* Define the number of SYN cookies sent in place of queuing a connection request, and
+       the number of connections established from a valid cookie.  */
+    ULONG       nx_ip_tcp_syn_cookies_sent;
+    ULONG       nx_ip_tcp_syn_cookies_received;
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
 #ifdef NX_ENABLE_HTTP_PROXY
     /* Define the IP address of HTTP proxy server.  */
     NXD_ADDRESS nx_ip_http_proxy_ip_address;
@@ -2951,8 +3858,35 @@ typedef struct NX_IP_STRUCT
 #ifndef NX_DISABLE_IPV4
     /* Define the destination routing information associated with this IP
        instance.  */
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+    /* The table is the built-in table until other memory is supplied by the
+       nx_arp_table_resize service.  The number of entries is a power of two.  */
+    struct NX_ARP_STRUCT
+               **nx_ip_arp_table;
+    ULONG       nx_ip_arp_table_mask;
+    struct NX_ARP_STRUCT
+                *nx_ip_arp_table_default[NX_ARP_TABLE_SIZE];
+
+    /* Define the ARP timer wheel.  Each dynamic ARP entry waiting for an update is
+       in the slot of the tick its update is due, so the ARP periodic update only
+       visits the entries that expire.  */
+    struct NX_ARP_STRUCT
+                *nx_ip_arp_timer_wheel[NX_ARP_TIMER_WHEEL_SIZE];
+    struct NX_ARP_STRUCT
+                *nx_ip_arp_timer_expired;
+    ULONG       nx_ip_arp_timer_tick;
+
+#ifndef NX_DISABLE_ARP_INFO
+    /* Define the number of packets sent to a resolved ARP entry, the number sent to
+       an unresolved or missing entry, and the number of active entries reused.  */
+    ULONG       nx_ip_arp_cache_hits;
+    ULONG       nx_ip_arp_cache_misses;
+    ULONG       nx_ip_arp_cache_evictions;
+#endif /* NX_DISABLE_ARP_INFO */
+#else
     struct NX_ARP_STRUCT
                 *nx_ip_arp_table[NX_ARP_TABLE_SIZE];
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
 
     /* Define the head pointer of the static ARP list.  */
     struct NX_ARP_STRUCT
@@ -3043,9 +3977,11 @@ typedef struct NX_IP_STRUCT
     /* Define the static routing table, if the feature is enabled. */
 #ifdef NX_ENABLE_IP_STATIC_ROUTING
 
+#ifndef NX_ENABLE_IP_ROUTE_TRIE
     /* IPv4 static routing table. */
     NX_IP_ROUTING_ENTRY
                 nx_ip_routing_table[NX_IP_ROUTING_TABLE_SIZE];
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
     /* Number of entries in the IPv4 static routing table. */
     ULONG       nx_ip_routing_table_entry_count;
@@ -3053,6 +3989,44 @@ typedef struct NX_IP_STRUCT
 #endif /* NX_ENABLE_IP_STATIC_ROUTING */
 #endif /* !NX_DISABLE_IPV4  */
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* Define the roots of the IPv4 and IPv6 routing tries.  */
+    NX_IP_ROUTE_NODE
+               *nx_ip_route_trie_ipv4;
+    NX_IP_ROUTE_NODE
+               *nx_ip_route_trie_ipv6;
+
+    /* Define the number of IPv4 and IPv6 routes, and the number of routes the nodes can hold.
+       A route takes at most two nodes, one for the route and one to join it to the trie.  */
+    ULONG       nx_ip_route_trie_count;
+    ULONG       nx_ip_route_trie_capacity;
+
+    /* Define the nodes built into the IP instance, the number of them in use, and the list of
+       free nodes, which also holds the nodes of the memory added by the application.  */
+    NX_IP_ROUTE_NODE
+                nx_ip_route_trie_nodes[NX_IP_ROUTING_TABLE_SIZE * 2];
+    ULONG       nx_ip_route_trie_nodes_used;
+    NX_IP_ROUTE_NODE
+               *nx_ip_route_trie_free_list;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Define the IPv4 route cache, indexed by the hash of the destination address.  */
+    NX_IP_ROUTE_CACHE_ENTRY
+                nx_ip_route_cache[NX_IP_ROUTE_CACHE_SIZE];
+
+    /* Define the route generation, which changes when a route, an address or the state of a
+       link changes, and the ARP generation, which changes when an ARP entry is removed.  */
+    ULONG       nx_ip_route_cache_generation;
+    ULONG       nx_ip_route_cache_arp_generation;
+
+#ifndef NX_DISABLE_IP_INFO
+    /* Define the number of routes found in the route cache and the number found again.  */
+    ULONG       nx_ip_route_cache_hits;
+    ULONG       nx_ip_route_cache_misses;
+#endif /* NX_DISABLE_IP_INFO */
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
 #ifdef FEATURE_NX_IPV6
 
     /* Number of valid entries in the IPv6 default router table. */
@@ -3220,6 +4194,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_arp_static_entries_delete                    _nx_arp_static_entries_delete
 #define nx_arp_static_entry_create                      _nx_arp_static_entry_create
 #define nx_arp_static_entry_delete                      _nx_arp_static_entry_delete
+#define nx_arp_table_info_get                           _nx_arp_table_info_get
+#define nx_arp_table_resize                             _nx_arp_table_resize
 
 /* APIs for ICMP. */
 #define nx_icmp_enable                                  _nx_icmp_enable
@@ -3253,6 +4229,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_forwarding_enable                         _nx_ip_forwarding_enable
 #define nx_ip_fragment_disable                          _nx_ip_fragment_disable
 #define nx_ip_fragment_enable                           _nx_ip_fragment_enable
+#define nx_ip_fragment_info_get                         _nx_ip_fragment_info_get
 #define nx_ip_gateway_address_clear                     _nx_ip_gateway_address_clear
 #define nx_ip_gateway_address_get                       _nx_ip_gateway_address_get
 #define nx_ip_gateway_address_set                       _nx_ip_gateway_address_set
@@ -3271,9 +4248,11 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_interface_status_check                    _nx_ip_interface_status_check
 #define nx_ip_link_status_change_notify_set             _nx_ip_link_status_change_notify_set
 #define nx_ip_max_payload_size_find                     _nx_ip_max_payload_size_find
+#define nx_ip_packet_pool_group_set                     _nx_ip_packet_pool_group_set
 #define nx_ip_status_check                              _nx_ip_status_check
 #define nx_ip_static_route_add                          _nx_ip_static_route_add
 #define nx_ip_static_route_delete                       _nx_ip_static_route_delete
+#define nx_ip_static_route_table_extend                 _nx_ip_static_route_table_extend
 #define nx_ipv4_multicast_interface_join                _nx_ipv4_multicast_interface_join
 #define nx_ipv4_multicast_interface_leave               _nx_ipv4_multicast_interface_leave
 #define nxd_ipv6_address_change_notify                  _nxd_ipv6_address_change_notify
@@ -3289,6 +4268,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nxd_ipv6_enable                                 _nxd_ipv6_enable
 #define nxd_ipv6_multicast_interface_join               _nxd_ipv6_multicast_interface_join
 #define nxd_ipv6_multicast_interface_leave              _nxd_ipv6_multicast_interface_leave
+#define nxd_ipv6_static_route_add                       _nxd_ipv6_static_route_add
+#define nxd_ipv6_static_route_delete                    _nxd_ipv6_static_route_delete
 #define nxd_ipv6_stateless_address_autoconfig_disable   _nxd_ipv6_stateless_address_autoconfig_disable
 #define nxd_ipv6_stateless_address_autoconfig_enable    _nxd_ipv6_stateless_address_autoconfig_enable
 
@@ -3312,17 +4293,34 @@ typedef struct NX_IP_DRIVER_STRUCT
 
 /* APIs for packet pool. */
 #define nx_packet_allocate                              _nx_packet_allocate
+#define nx_packet_allocate_bulk                         _nx_packet_allocate_bulk
+#define nx_packet_cache_allocate                        _nx_packet_cache_allocate
+#define nx_packet_cache_create                          _nx_packet_cache_create
+#define nx_packet_cache_delete                          _nx_packet_cache_delete
+#define nx_packet_cache_flush                           _nx_packet_cache_flush
+#define nx_packet_cache_release                         _nx_packet_cache_release
+#define nx_packet_clone                                 _nx_packet_clone
 #define nx_packet_copy                                  _nx_packet_copy
 #define nx_packet_data_append                           _nx_packet_data_append
+#define nx_packet_data_append_external                  _nx_packet_data_append_external
 #define nx_packet_data_extract_offset                   _nx_packet_data_extract_offset
 #define nx_packet_data_retrieve                         _nx_packet_data_retrieve
 #define nx_packet_length_get                            _nx_packet_length_get
 #define nx_packet_pool_create                           _nx_packet_pool_create
 #define nx_packet_pool_delete                           _nx_packet_pool_delete
+#define nx_packet_pool_group_allocate                   _nx_packet_pool_group_allocate
+#define nx_packet_pool_group_create                     _nx_packet_pool_group_create
+#define nx_packet_pool_group_delete                     _nx_packet_pool_group_delete
+#define nx_packet_pool_group_info_get                   _nx_packet_pool_group_info_get
+#define nx_packet_pool_group_pool_add                   _nx_packet_pool_group_pool_add
+#define nx_packet_pool_cache_info_get                   _nx_packet_pool_cache_info_get
 #define nx_packet_pool_info_get                         _nx_packet_pool_info_get
 #define nx_packet_pool_low_watermark_set                _nx_packet_pool_low_watermark_set
+#define nx_packet_pool_shared_info_get                  _nx_packet_pool_shared_info_get
 #define nx_packet_release                               _nx_packet_release
+#define nx_packet_release_bulk                          _nx_packet_release_bulk
 #define nx_packet_transmit_release                      _nx_packet_transmit_release
+#define nx_packet_transmit_release_bulk                 _nx_packet_transmit_release_bulk
 #define nx_packet_vlan_priority_set                     _nx_packet_vlan_priority_set
 
 /* APIs for RARP. */
@@ -3335,6 +4333,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_client_socket_connect                    _nx_tcp_client_socket_connect
 #define nx_tcp_client_socket_port_get                   _nx_tcp_client_socket_port_get
 #define nx_tcp_client_socket_unbind                     _nx_tcp_client_socket_unbind
+#define nx_tcp_connection_table_enable                  _nx_tcp_connection_table_enable
+#define nx_tcp_connection_table_info_get                _nx_tcp_connection_table_info_get
 #define nx_tcp_enable                                   _nx_tcp_enable
 #define nx_tcp_free_port_find                           _nx_tcp_free_port_find
 #define nx_tcp_info_get                                 _nx_tcp_info_get
@@ -3343,7 +4343,11 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_server_socket_relisten                   _nx_tcp_server_socket_relisten
 #define nx_tcp_server_socket_unaccept                   _nx_tcp_server_socket_unaccept
 #define nx_tcp_server_socket_unlisten                   _nx_tcp_server_socket_unlisten
+#define nx_tcp_socket_ack_policy_set                    _nx_tcp_socket_ack_policy_set
+#define nx_tcp_socket_pacing_set                        _nx_tcp_socket_pacing_set
+#define nx_tcp_socket_window_autotune_set               _nx_tcp_socket_window_autotune_set
 #define nx_tcp_socket_bytes_available                   _nx_tcp_socket_bytes_available
+#define nx_tcp_socket_congestion_control_set            _nx_tcp_socket_congestion_control_set
 #define nx_tcp_socket_create                            _nx_tcp_socket_create
 #define nx_tcp_socket_delete                            _nx_tcp_socket_delete
 #define nx_tcp_socket_disconnect                        _nx_tcp_socket_disconnect
@@ -3365,6 +4369,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_socket_window_update_notify_set          _nx_tcp_socket_window_update_notify_set
 #define nx_tcp_socket_vlan_priority_set                 _nx_tcp_socket_vlan_priority_set
 #define nxd_tcp_client_socket_connect                   _nxd_tcp_client_socket_connect
+#define nxd_tcp_client_socket_connect_data              _nxd_tcp_client_socket_connect_data
 #define nxd_tcp_socket_peer_info_get                    _nxd_tcp_socket_peer_info_get
 
 /* APIs for UDP. */
@@ -3412,6 +4417,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_arp_static_entries_delete                    _nxe_arp_static_entries_delete
 #define nx_arp_static_entry_create                      _nxe_arp_static_entry_create
 #define nx_arp_static_entry_delete                      _nxe_arp_static_entry_delete
+#define nx_arp_table_info_get                           _nxe_arp_table_info_get
+#define nx_arp_table_resize                             _nxe_arp_table_resize
 
 /* APIs for ICMP. */
 #define nx_icmp_enable                                  _nxe_icmp_enable
@@ -3445,6 +4452,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_forwarding_enable                         _nxe_ip_forwarding_enable
 #define nx_ip_fragment_disable                          _nxe_ip_fragment_disable
 #define nx_ip_fragment_enable                           _nxe_ip_fragment_enable
+#define nx_ip_fragment_info_get                         _nxe_ip_fragment_info_get
 #define nx_ip_gateway_address_clear                     _nxe_ip_gateway_address_clear
 #define nx_ip_gateway_address_get                       _nxe_ip_gateway_address_get
 #define nx_ip_gateway_address_set                       _nxe_ip_gateway_address_set
@@ -3463,9 +4471,11 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_interface_status_check                    _nxe_ip_interface_status_check
 #define nx_ip_link_status_change_notify_set             _nxe_ip_link_status_change_notify_set
 #define nx_ip_max_payload_size_find                     _nxe_ip_max_payload_size_find
+#define nx_ip_packet_pool_group_set                     _nxe_ip_packet_pool_group_set
 #define nx_ip_status_check                              _nxe_ip_status_check
 #define nx_ip_static_route_add                          _nxe_ip_static_route_add
 #define nx_ip_static_route_delete                       _nxe_ip_static_route_delete
+#define nx_ip_static_route_table_extend                 _nxe_ip_static_route_table_extend
 #define nx_ipv4_multicast_interface_join                _nxe_ipv4_multicast_interface_join
 #define nx_ipv4_multicast_interface_leave               _nxe_ipv4_multicast_interface_leave
 #define nxd_ipv6_address_change_notify                  _nxde_ipv6_address_change_notify
@@ -3481,6 +4491,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nxd_ipv6_enable                                 _nxde_ipv6_enable
 #define nxd_ipv6_multicast_interface_join               _nxde_ipv6_multicast_interface_join
 #define nxd_ipv6_multicast_interface_leave              _nxde_ipv6_multicast_interface_leave
+#define nxd_ipv6_static_route_add                       _nxde_ipv6_static_route_add
+#define nxd_ipv6_static_route_delete                    _nxde_ipv6_static_route_delete
 #define nxd_ipv6_stateless_address_autoconfig_disable   _nxde_ipv6_stateless_address_autoconfig_disable
 #define nxd_ipv6_stateless_address_autoconfig_enable    _nxde_ipv6_stateless_address_autoconfig_enable
 
@@ -3504,17 +4516,34 @@ typedef struct NX_IP_DRIVER_STRUCT
 
 /* APIs for packet pool. */
 #define nx_packet_allocate                              _nxe_packet_allocate
+#define nx_packet_allocate_bulk                         _nxe_packet_allocate_bulk
+#define nx_packet_cache_allocate                        _nxe_packet_cache_allocate
+#define nx_packet_cache_create(p, c, n, s, b)           _nxe_packet_cache_create(p, c, n, s, b, sizeof(NX_PACKET_CACHE))
+#define nx_packet_cache_delete                          _nxe_packet_cache_delete
+#define nx_packet_cache_flush                           _nxe_packet_cache_flush
+#define nx_packet_cache_release(c, p)                   _nxe_packet_cache_release(c, &p)
+#define nx_packet_clone                                 _nxe_packet_clone
 #define nx_packet_copy                                  _nxe_packet_copy
 #define nx_packet_data_append                           _nxe_packet_data_append
+#define nx_packet_data_append_external                  _nxe_packet_data_append_external
 #define nx_packet_data_extract_offset                   _nxe_packet_data_extract_offset
 #define nx_packet_data_retrieve                         _nxe_packet_data_retrieve
 #define nx_packet_length_get                            _nxe_packet_length_get
 #define nx_packet_pool_create(p, n, l, m, s)            _nxe_packet_pool_create(p, n, l, m, s, sizeof(NX_PACKET_POOL))
 #define nx_packet_pool_delete                           _nxe_packet_pool_delete
+#define nx_packet_pool_group_allocate                   _nxe_packet_pool_group_allocate
+#define nx_packet_pool_group_create(g, n)               _nxe_packet_pool_group_create(g, n, sizeof(NX_PACKET_POOL_GROUP))
+#define nx_packet_pool_group_delete                     _nxe_packet_pool_group_delete
+#define nx_packet_pool_group_info_get                   _nxe_packet_pool_group_info_get
+#define nx_packet_pool_group_pool_add                   _nxe_packet_pool_group_pool_add
+#define nx_packet_pool_cache_info_get                   _nxe_packet_pool_cache_info_get
 #define nx_packet_pool_info_get                         _nxe_packet_pool_info_get
 #define nx_packet_pool_low_watermark_set                _nxe_packet_pool_low_watermark_set
+#define nx_packet_pool_shared_info_get                  _nxe_packet_pool_shared_info_get
 #define nx_packet_release(p)                            _nxe_packet_release(&p)
+#define nx_packet_release_bulk                          _nxe_packet_release_bulk
 #define nx_packet_transmit_release(p)                   _nxe_packet_transmit_release(&p)
+#define nx_packet_transmit_release_bulk                 _nxe_packet_transmit_release_bulk
 #define nx_packet_vlan_priority_set                     _nxe_packet_vlan_priority_set
 
 /* APIs for RARP. */
@@ -3527,6 +4556,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_client_socket_connect                    _nxe_tcp_client_socket_connect
 #define nx_tcp_client_socket_port_get                   _nxe_tcp_client_socket_port_get
 #define nx_tcp_client_socket_unbind                     _nxe_tcp_client_socket_unbind
+#define nx_tcp_connection_table_enable                  _nxe_tcp_connection_table_enable
+#define nx_tcp_connection_table_info_get                _nxe_tcp_connection_table_info_get
 #define nx_tcp_enable                                   _nxe_tcp_enable
 #define nx_tcp_free_port_find                           _nxe_tcp_free_port_find
 #define nx_tcp_info_get                                 _nxe_tcp_info_get
@@ -3535,7 +4566,11 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_server_socket_relisten                   _nxe_tcp_server_socket_relisten
 #define nx_tcp_server_socket_unaccept                   _nxe_tcp_server_socket_unaccept
 #define nx_tcp_server_socket_unlisten                   _nxe_tcp_server_socket_unlisten
+#define nx_tcp_socket_ack_policy_set                    _nxe_tcp_socket_ack_policy_set
+#define nx_tcp_socket_pacing_set                        _nxe_tcp_socket_pacing_set
+#define nx_tcp_socket_window_autotune_set               _nxe_tcp_socket_window_autotune_set
 #define nx_tcp_socket_bytes_available                   _nxe_tcp_socket_bytes_available
+#define nx_tcp_socket_congestion_control_set            _nxe_tcp_socket_congestion_control_set
 #define nx_tcp_socket_create(i, s, n, t, f, l, w, u, d) _nxe_tcp_socket_create(i, s, n, t, f, l, w, u, d, sizeof(NX_TCP_SOCKET))
 #define nx_tcp_socket_delete                            _nxe_tcp_socket_delete
 #define nx_tcp_socket_disconnect                        _nxe_tcp_socket_disconnect
@@ -3557,6 +4592,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_socket_window_update_notify_set          _nxe_tcp_socket_window_update_notify_set
 #define nx_tcp_socket_vlan_priority_set                 _nxe_tcp_socket_vlan_priority_set
 #define nxd_tcp_client_socket_connect                   _nxde_tcp_client_socket_connect
+#define nxd_tcp_client_socket_connect_data              _nxde_tcp_client_socket_connect_data
 #define nxd_tcp_socket_peer_info_get                    _nxde_tcp_socket_peer_info_get
 
 /* APIs for UDP. */
@@ -3607,6 +4643,10 @@ UINT nx_arp_ip_address_find(NX_IP *ip_ptr, ULONG *ip_address,  ULONG physical_ms
 UINT nx_arp_static_entries_delete(NX_IP *ip_ptr);
 UINT nx_arp_static_entry_create(NX_IP *ip_ptr, ULONG ip_address, ULONG physical_msw, ULONG physical_lsw);
 UINT nx_arp_static_entry_delete(NX_IP *ip_ptr, ULONG ip_address,  ULONG physical_msw, ULONG physical_lsw);
+UINT nx_arp_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_entries,
+                           ULONG *table_longest_chain, ULONG *cache_hits,
+                           ULONG *cache_misses, ULONG *cache_evictions);
+UINT nx_arp_table_resize(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 
 /* APIs for ICMP. */
 UINT nx_icmp_enable(NX_IP *ip_ptr);
@@ -3657,6 +4697,9 @@ UINT nx_ip_forwarding_disable(NX_IP *ip_ptr);
 UINT nx_ip_forwarding_enable(NX_IP *ip_ptr);
 UINT nx_ip_fragment_disable(NX_IP *ip_ptr);
 UINT nx_ip_fragment_enable(NX_IP *ip_ptr);
+UINT nx_ip_fragment_info_get(NX_IP *ip_ptr, ULONG *contexts_in_use, ULONG *duplicates,
+                             ULONG *oversize_drops, ULONG *limit_drops, ULONG *context_evictions,
+                             ULONG *reassembly_failures);
 UINT nx_ip_gateway_address_clear(NX_IP *ip_ptr);
 UINT nx_ip_gateway_address_get(NX_IP *ip_ptr, ULONG *ip_address);
 UINT nx_ip_gateway_address_set(NX_IP *ip_ptr, ULONG ip_address);
@@ -3690,9 +4733,11 @@ UINT nx_ip_link_status_change_notify_set(NX_IP *ip_ptr,
 UINT nx_ip_max_payload_size_find(NX_IP *ip_ptr, NXD_ADDRESS *dest_address, UINT if_index,
                                  UINT src_port, UINT dest_port, ULONG protocol, ULONG *start_offset_ptr,
                                  ULONG *payload_length_ptr);
+UINT nx_ip_packet_pool_group_set(NX_IP *ip_ptr, NX_PACKET_POOL_GROUP *group_ptr);
 UINT nx_ip_status_check(NX_IP *ip_ptr, ULONG needed_status, ULONG *actual_status, ULONG wait_option);
 UINT nx_ip_static_route_add(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask, ULONG next_hop);
 UINT nx_ip_static_route_delete(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask);
+UINT nx_ip_static_route_table_extend(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 UINT nx_ipv4_multicast_interface_join(NX_IP *ip_ptr, ULONG group_address, UINT interface_index);
 UINT nx_ipv4_multicast_interface_leave(NX_IP *ip_ptr, ULONG group_address, UINT interface_index);
 UINT nxd_ipv6_address_change_notify(NX_IP *ip_ptr,
@@ -3715,6 +4760,9 @@ UINT nxd_ipv6_disable(NX_IP *ip_ptr);
 UINT nxd_ipv6_enable(NX_IP *ip_ptr);
 UINT nxd_ipv6_multicast_interface_join(NX_IP *ip_ptr, NXD_ADDRESS *group_address, UINT interface_index);
 UINT nxd_ipv6_multicast_interface_leave(NX_IP *ip_ptr, NXD_ADDRESS *group_address, UINT interface_index);
+UINT nxd_ipv6_static_route_add(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length,
+                               NXD_ADDRESS *next_hop, UINT interface_index);
+UINT nxd_ipv6_static_route_delete(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length);
 UINT nxd_ipv6_stateless_address_autoconfig_disable(NX_IP *ip_ptr, UINT interface_index);
 UINT nxd_ipv6_stateless_address_autoconfig_enable(NX_IP *ip_ptr, UINT interface_index);
 
@@ -3757,10 +4805,33 @@ UINT nxd_nd_cache_ip_address_find(NX_IP *ip_ptr, NXD_ADDRESS *ip_address,
 /* APIs for packet pool. */
 UINT nx_packet_allocate(NX_PACKET_POOL *pool_ptr,  NX_PACKET **packet_ptr,
                         ULONG packet_type, ULONG wait_option);
+UINT nx_packet_allocate_bulk(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_array, UINT packet_count,
+                             ULONG packet_type, UINT *allocated_count, ULONG wait_option);
+UINT nx_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                              ULONG packet_type, ULONG wait_option);
+#ifndef NX_DISABLE_ERROR_CHECKING
+UINT _nxe_packet_cache_create(NX_PACKET_POOL *pool_ptr, NX_PACKET_CACHE *cache_ptr, CHAR *name_ptr,
+                              ULONG cache_size, ULONG batch_size, UINT cache_control_block_size);
+#else
+UINT _nx_packet_cache_create(NX_PACKET_POOL *pool_ptr, NX_PACKET_CACHE *cache_ptr, CHAR *name_ptr,
+                             ULONG cache_size, ULONG batch_size);
+#endif
+UINT nx_packet_cache_delete(NX_PACKET_CACHE *cache_ptr);
+UINT nx_packet_cache_flush(NX_PACKET_CACHE *cache_ptr);
+#ifndef NX_DISABLE_ERROR_CHECKING
+UINT _nxe_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr_ptr);
+#else
+UINT _nx_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET *packet_ptr);
+#endif
+UINT nx_packet_clone(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
+                     NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT nx_packet_copy(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
                     NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT nx_packet_data_append(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
                            NX_PACKET_POOL *pool_ptr, ULONG wait_option);
+UINT nx_packet_data_append_external(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
+                                    VOID (*release_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context),
+                                    VOID *context, NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT nx_packet_data_extract_offset(NX_PACKET *packet_ptr, ULONG offset, VOID *buffer_start,
                                    ULONG buffer_length, ULONG *bytes_copied);
 UINT nx_packet_data_retrieve(NX_PACKET *packet_ptr, VOID *buffer_start, ULONG *bytes_copied);
@@ -3773,10 +4844,24 @@ UINT _nx_packet_pool_create(NX_PACKET_POOL *pool_ptr, CHAR *name, ULONG payload_
                             VOID *memory_ptr, ULONG memory_size);
 #endif
 UINT nx_packet_pool_delete(NX_PACKET_POOL *pool_ptr);
+UINT nx_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                   ULONG packet_type, ULONG packet_length, ULONG wait_option);
+#ifndef NX_DISABLE_ERROR_CHECKING
+UINT _nxe_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name_ptr,
+                                   UINT group_control_block_size);
+#else
+UINT _nx_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name_ptr);
+#endif
+UINT nx_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr);
+UINT nx_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT *pool_count, ULONG *fallbacks);
+UINT nx_packet_pool_group_pool_add(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET_POOL *pool_ptr);
+UINT nx_packet_pool_cache_info_get(NX_PACKET_POOL *pool_ptr, ULONG *cached_packets,
+                                   ULONG *cache_hits, ULONG *cache_misses);
 UINT nx_packet_pool_info_get(NX_PACKET_POOL *pool_ptr, ULONG *total_packets, ULONG *free_packets,
                              ULONG *empty_pool_requests, ULONG *empty_pool_suspensions,
                              ULONG *invalid_packet_releases);
 UINT nx_packet_pool_low_watermark_set(NX_PACKET_POOL *pool_ptr, ULONG low_water_mark);
+UINT nx_packet_pool_shared_info_get(NX_PACKET_POOL *pool_ptr, ULONG *shared_packets, ULONG *clone_references);
 #ifndef NX_DISABLE_ERROR_CHECKING
 UINT _nxe_packet_release(NX_PACKET **packet_ptr_ptr);
 UINT _nxe_packet_transmit_release(NX_PACKET **packet_ptr_ptr);
@@ -3784,6 +4869,8 @@ UINT _nxe_packet_transmit_release(NX_PACKET **packet_ptr_ptr);
 UINT _nx_packet_release(NX_PACKET *packet_ptr);
 UINT _nx_packet_transmit_release(NX_PACKET *packet_ptr);
 #endif
+UINT nx_packet_release_bulk(NX_PACKET **packet_array, UINT packet_count);
+UINT nx_packet_transmit_release_bulk(NX_PACKET **packet_array, UINT packet_count);
 UINT nx_packet_vlan_priority_set(NX_PACKET *packet_ptr, UINT vlan_priority);
 
 /* APIs for RARP. */
@@ -3798,6 +4885,10 @@ UINT nx_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, ULONG server_ip,
                                   UINT server_port, ULONG wait_option);
 UINT nx_tcp_client_socket_port_get(NX_TCP_SOCKET *socket_ptr, UINT *port_ptr);
 UINT nx_tcp_client_socket_unbind(NX_TCP_SOCKET *socket_ptr);
+UINT nx_tcp_connection_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
+UINT nx_tcp_connection_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_connections,
+                                      ULONG *table_entries_used, ULONG *table_longest_chain,
+                                      ULONG *table_lookups, ULONG *table_hits);
 UINT nx_tcp_enable(NX_IP *ip_ptr);
 UINT nx_tcp_free_port_find(NX_IP *ip_ptr, UINT port, UINT *free_port_ptr);
 UINT nx_tcp_info_get(NX_IP *ip_ptr, ULONG *tcp_packets_sent, ULONG *tcp_bytes_sent,
@@ -3812,7 +4903,11 @@ UINT nx_tcp_server_socket_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket
 UINT nx_tcp_server_socket_relisten(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr);
 UINT nx_tcp_server_socket_unaccept(NX_TCP_SOCKET *socket_ptr);
 UINT nx_tcp_server_socket_unlisten(NX_IP *ip_ptr, UINT port);
+UINT nx_tcp_socket_ack_policy_set(NX_TCP_SOCKET *socket_ptr, UINT ack_segments, UINT quick_ack_segments);
+UINT nx_tcp_socket_pacing_set(NX_TCP_SOCKET *socket_ptr, ULONG pacing_rate);
+UINT nx_tcp_socket_window_autotune_set(NX_TCP_SOCKET *socket_ptr, ULONG window_maximum);
 UINT nx_tcp_socket_bytes_available(NX_TCP_SOCKET *socket_ptr, ULONG *bytes_available);
+UINT nx_tcp_socket_congestion_control_set(NX_TCP_SOCKET *socket_ptr, const NX_TCP_CONGESTION_CONTROL *congestion_control);
 #ifndef NX_DISABLE_ERROR_CHECKING
 UINT _nxe_tcp_socket_create(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, CHAR *name,
                             ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG window_size,
@@ -3862,6 +4957,8 @@ UINT nx_tcp_socket_window_update_notify_set(NX_TCP_SOCKET *socket_ptr,
 UINT nx_tcp_socket_vlan_priority_set(NX_TCP_SOCKET *socket_ptr, UINT vlan_priority);
 UINT nxd_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip,
                                    UINT server_port, ULONG wait_option);
+UINT nxd_tcp_client_socket_connect_data(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip,
+                                        UINT server_port, NX_PACKET *packet_ptr, ULONG wait_option);
 UINT nxd_tcp_socket_peer_info_get(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *peer_ip_address, ULONG *peer_port);
 
 /* APIs for UDP. */
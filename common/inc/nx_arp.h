@@ -104,6 +104,11 @@ VOID _nx_arp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_arp_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_arp_periodic_update(NX_IP *ip_ptr);
 UINT _nx_arp_interface_entries_delete(NX_IP *ip_ptr, UINT index);
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+VOID _nx_arp_entry_timer_schedule(NX_IP *ip_ptr, NX_ARP *arp_ptr);
+VOID _nx_arp_entry_timer_cancel(NX_ARP *arp_ptr);
+VOID _nx_arp_timer_wheel_advance(NX_IP *ip_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
 
 #endif /* NX_DISABLE_IPV4 */
 
@@ -125,6 +130,10 @@ UINT _nx_arp_static_entry_create(NX_IP *ip_ptr, ULONG ip_address,  ULONG physica
 UINT _nx_arp_static_entry_delete(NX_IP *ip_ptr, ULONG ip_address,  ULONG physical_msw, ULONG physical_lsw);
 UINT _nx_arp_probe_send(NX_IP *ip_ptr, UINT interface_index, ULONG probe_address);
 UINT _nx_arp_announce_send(NX_IP *ip_ptr, UINT interface_index);
+UINT _nx_arp_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_entries,
+                            ULONG *table_longest_chain, ULONG *cache_hits,
+                            ULONG *cache_misses, ULONG *cache_evictions);
+UINT _nx_arp_table_resize(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 
 /* Define error checking shells for ARP services.  These are only referenced by the
    application.  */
@@ -143,5 +152,9 @@ UINT _nxe_arp_ip_address_find(NX_IP *ip_ptr, ULONG *ip_address, ULONG physical_m
 UINT _nxe_arp_static_entries_delete(NX_IP *ip_ptr);
 UINT _nxe_arp_static_entry_create(NX_IP *ip_ptr, ULONG ip_address,  ULONG physical_msw, ULONG physical_lsw);
 UINT _nxe_arp_static_entry_delete(NX_IP *ip_ptr, ULONG ip_address, ULONG physical_msw, ULONG physical_lsw);
+UINT _nxe_arp_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_entries,
+                             ULONG *table_longest_chain, ULONG *cache_hits,
+                             ULONG *cache_misses, ULONG *cache_evictions);
+UINT _nxe_arp_table_resize(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 #endif
 
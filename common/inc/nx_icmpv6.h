@@ -399,6 +399,10 @@ UINT _nx_icmpv6_dest_table_find(NX_IP *ip_ptr, ULONG *destination_address, NX_IP
 UINT _nx_icmpv6_dest_table_add(NX_IP *ip_ptr, ULONG *destination_address,
                                NX_IPV6_DESTINATION_ENTRY **dest_entry_ptr, ULONG *next_hop,
                                ULONG path_mtu, ULONG mtu_timeout, NXD_IPV6_ADDRESS *ipv6_address);
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+VOID _nx_icmpv6_dest_table_hash_insert(NX_IP *ip_ptr, NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr);
+VOID _nx_icmpv6_dest_table_hash_remove(NX_IP *ip_ptr, NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 VOID _nx_icmpv6_process_echo_reply(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_icmpv6_process_echo_request(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_icmpv6_process_ns(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
@@ -91,6 +91,9 @@
 #define NX_IP_HW_DONE_EVENT          ((ULONG)0x00002000)       /* HW done event                */
 #endif /* NX_IPSEC_ENABLE */
 #define NX_IP_LINK_STATUS_EVENT      ((ULONG)0x00004000)       /* Link status change event     */
+#ifdef NX_ENABLE_TCP_PACING
+#define NX_IP_TCP_PACING_EVENT       ((ULONG)0x00008000)       /* TCP pacing timer event       */
+#endif /* NX_ENABLE_TCP_PACING */
 
 
 #ifndef NX_IP_FAST_TIMER_RATE
@@ -102,6 +105,18 @@
 #define NX_IP_STATUS_CHECK_WAIT_TIME 1
 #endif /* NX_IP_STATUS_CHECK_WAIT_TIME */
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+/* Define the macro to get a bit of an address in host byte order, bit 0 being the most
+   significant bit of the first word.  */
+#define NX_IP_ROUTE_TRIE_BIT(address, bit)  (((address)[(bit) >> 5] >> (31 - ((bit) & 31))) & 1)
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+/* Define the routine that returns the 64-bit sum of 32-bit words for the checksum computation.
+   Ports may define it in nx_port.h to a vectorized routine.  */
+#ifndef NX_CHECKSUM_WORDS
+#define NX_CHECKSUM_WORDS(ptr, count)       _nx_ip_checksum_words(ptr, count)
+#endif /* NX_CHECKSUM_WORDS */
+
 #include "nx_ipv4.h"
 
 
@@ -110,6 +125,10 @@
 UINT   _nx_ip_auxiliary_packet_pool_set(NX_IP *ip_ptr, NX_PACKET_POOL *auxiliary_pool);
 USHORT _nx_ip_checksum_compute(NX_PACKET *packet_ptr, ULONG protocol, UINT data_length,
                                ULONG *_src_ip_addr, ULONG *_dest_ip_addr);
+USHORT _nx_ip_checksum_adjust(USHORT checksum, USHORT old_value, USHORT new_value);
+USHORT _nx_ip_checksum_adjust_ulong(USHORT checksum, ULONG old_value, ULONG new_value);
+ULONG  _nx_ip_checksum_copy(UCHAR *destination_ptr, UCHAR *source_ptr, UINT length);
+ULONG64 _nx_ip_checksum_words(ULONG *long_ptr, ULONG word_count);
 UINT   _nx_ip_interface_address_mapping_configure(NX_IP *ip_ptr, UINT interface_index, UINT mapping_needed);
 UINT   _nx_ip_interface_capability_get(NX_IP *ip_ptr, UINT interface_index, ULONG *interface_capability_flag);
 UINT   _nx_ip_interface_capability_set(NX_IP *ip_ptr, UINT interface_index, ULONG interface_capability_flag);
@@ -139,6 +158,9 @@ UINT _nx_ip_forwarding_disable(NX_IP *ip_ptr);
 UINT _nx_ip_forwarding_enable(NX_IP *ip_ptr);
 UINT _nx_ip_fragment_disable(NX_IP *ip_ptr);
 UINT _nx_ip_fragment_enable(NX_IP *ip_ptr);
+UINT _nx_ip_fragment_info_get(NX_IP *ip_ptr, ULONG *contexts_in_use, ULONG *duplicates,
+                              ULONG *oversize_drops, ULONG *limit_drops, ULONG *context_evictions,
+                              ULONG *reassembly_failures);
 UINT _nx_ip_info_get(NX_IP *ip_ptr, ULONG *ip_total_packets_sent, ULONG *ip_total_bytes_sent,
                      ULONG *ip_total_packets_received, ULONG *ip_total_bytes_received,
                      ULONG *ip_invalid_packets, ULONG *ip_receive_packets_dropped,
@@ -149,6 +171,7 @@ UINT _nx_ip_interface_detach(NX_IP *ip_ptr, UINT index);
 UINT _nx_ip_max_payload_size_find(NX_IP *ip_ptr, NXD_ADDRESS *dest_address, UINT if_index,
                                   UINT src_port, UINT dest_port, ULONG protocol, ULONG *start_offset_ptr,
                                   ULONG *payload_length_ptr);
+UINT _nx_ip_packet_pool_group_set(NX_IP *ip_ptr, NX_PACKET_POOL_GROUP *group_ptr);
 UINT _nx_ip_raw_packet_disable(NX_IP *ip_ptr);
 UINT _nx_ip_raw_packet_enable(NX_IP *ip_ptr);
 UINT _nx_ip_raw_packet_filter_set(NX_IP *ip_ptr,  UINT (*raw_packet_filter)(NX_IP *, ULONG, NX_PACKET *));
@@ -164,16 +187,33 @@ UINT _nx_ip_link_status_change_notify_set(NX_IP *ip_ptr,  VOID (*link_status_cha
 VOID _nx_ip_thread_entry(ULONG ip_ptr_value);
 VOID _nx_ip_raw_packet_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 UINT _nx_ip_raw_packet_processing(NX_IP *ip_ptr, ULONG protocol, NX_PACKET *packet_ptr);
+UINT _nx_ip_static_route_table_extend(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 UINT _nxd_ip_raw_packet_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr,
                              NXD_ADDRESS *destination_ip, ULONG protocol, UINT ttl, ULONG tos);
 #ifndef NX_DISABLE_FRAGMENTATION
 VOID _nx_ip_fragment_timeout_check(NX_IP *ip_ptr);
 VOID _nx_ip_fragment_packet(struct NX_IP_DRIVER_STRUCT *driver_req_ptr);
 VOID _nx_ip_fragment_assembly(NX_IP *ip_ptr);
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+VOID _nx_ip_fragment_context_initialize(NX_IP *ip_ptr);
+NX_IP_FRAGMENT_CONTEXT *_nx_ip_fragment_context_find(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG id, UINT hash_index);
+NX_IP_FRAGMENT_CONTEXT *_nx_ip_fragment_context_allocate(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG id, UINT hash_index);
+VOID _nx_ip_fragment_context_release(NX_IP *ip_ptr, NX_IP_FRAGMENT_CONTEXT *context);
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
 #endif /* NX_DISABLE_FRAGMENTATION */
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
 VOID _nx_ip_packet_checksum_compute(NX_PACKET *packet_ptr);
 #endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+NX_IP_ROUTE_NODE *_nx_ip_route_trie_node_allocate(NX_IP *ip_ptr);
+VOID  _nx_ip_route_trie_node_release(NX_IP *ip_ptr, NX_IP_ROUTE_NODE *node_ptr);
+ULONG _nx_ip_route_trie_common_length(ULONG *address, ULONG *prefix, ULONG prefix_length);
+NX_IP_ROUTE_NODE *_nx_ip_route_trie_find(NX_IP_ROUTE_NODE *root_ptr, ULONG *address, ULONG address_length);
+NX_IP_ROUTE_NODE *_nx_ip_route_trie_search(NX_IP_ROUTE_NODE *root_ptr, ULONG *prefix, ULONG prefix_length);
+NX_IP_ROUTE_NODE *_nx_ip_route_trie_insert(NX_IP *ip_ptr, NX_IP_ROUTE_NODE **root_ptr, ULONG *prefix, ULONG prefix_length);
+VOID  _nx_ip_route_trie_remove(NX_IP *ip_ptr, NX_IP_ROUTE_NODE **root_ptr, NX_IP_ROUTE_NODE *node_ptr);
+ULONG _nx_ip_route_trie_interface_remove(NX_IP *ip_ptr, NX_IP_ROUTE_NODE **root_ptr, NX_INTERFACE *interface_ptr);
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -193,6 +233,9 @@ UINT _nxe_ip_forwarding_disable(NX_IP *ip_ptr);
 UINT _nxe_ip_forwarding_enable(NX_IP *ip_ptr);
 UINT _nxe_ip_fragment_disable(NX_IP *ip_ptr);
 UINT _nxe_ip_fragment_enable(NX_IP *ip_ptr);
+UINT _nxe_ip_fragment_info_get(NX_IP *ip_ptr, ULONG *contexts_in_use, ULONG *duplicates,
+                               ULONG *oversize_drops, ULONG *limit_drops, ULONG *context_evictions,
+                               ULONG *reassembly_failures);
 UINT _nxe_ip_info_get(NX_IP *ip_ptr, ULONG *ip_total_packets_sent, ULONG *ip_total_bytes_sent,
                       ULONG *ip_total_packets_received, ULONG *ip_total_bytes_received,
                       ULONG *ip_invalid_packets, ULONG *ip_receive_packets_dropped,
@@ -203,6 +246,7 @@ UINT _nxe_ip_interface_detach(NX_IP *ip_ptr, UINT index);
 UINT _nxe_ip_max_payload_size_find(NX_IP *ip_ptr, NXD_ADDRESS *dest_address, UINT if_index,
                                    UINT src_port, UINT dest_port, ULONG protocol, ULONG *start_offset_ptr,
                                    ULONG *payload_length_ptr);
+UINT _nxe_ip_packet_pool_group_set(NX_IP *ip_ptr, NX_PACKET_POOL_GROUP *group_ptr);
 UINT _nxe_ip_raw_packet_disable(NX_IP *ip_ptr);
 UINT _nxe_ip_raw_packet_enable(NX_IP *ip_ptr);
 UINT _nxe_ip_raw_packet_receive(NX_IP *ip_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
@@ -227,6 +271,7 @@ UINT _nxe_ip_interface_status_check(NX_IP *ip_ptr, UINT interface_index, ULONG n
 UINT _nxe_ip_raw_packet_filter_set(NX_IP *ip_ptr,
                                    UINT (*raw_packet_filter)(NX_IP *, ULONG, NX_PACKET *));
 UINT _nxe_ip_raw_receive_queue_max_set(NX_IP *ip_ptr, ULONG queue_max);
+UINT _nxe_ip_static_route_table_extend(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 
 
 VOID _nx_ip_fast_periodic_timer_create(NX_IP *ip_ptr);
@@ -100,6 +100,11 @@
 #endif /* NX_FRAG_OFFSET_MASK */
 #define NX_IP_ALIGN_FRAGS                8            /* Fragment alignment       */
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+/* Define the index of the route cache entry of a destination address.  */
+#define NX_IP_ROUTE_CACHE_INDEX(address) ((UINT)(((address) + ((address) >> 8)) & (NX_IP_ROUTE_CACHE_SIZE - 1)))
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
 /* Define basic IP Header constant.  */
 
 /* Define Basic Internet packet header data type.  This will be used to
@@ -163,6 +168,10 @@ UINT  _nx_ip_header_add(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG source_ip, U
                         ULONG type_of_service, ULONG time_to_live, ULONG protocol, ULONG fragment);
 VOID  _nx_ip_driver_packet_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG destination_ip, ULONG fragment, ULONG next_hop_address);
 ULONG _nx_ip_route_find(NX_IP *ip_ptr, ULONG destination_address, NX_INTERFACE **nx_ip_interface, ULONG *next_hop_address);
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+ULONG _nx_ip_route_cache_find(NX_IP *ip_ptr, ULONG destination_address, NX_INTERFACE **ip_interface_ptr, ULONG *next_hop_address);
+NX_ARP *_nx_ip_route_cache_arp_find(NX_IP *ip_ptr, ULONG destination_address, ULONG next_hop_address);
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
 VOID  _nx_ipv4_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 UINT  _nx_ipv4_option_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 #endif /* NX_DISABLE_IPV4 */
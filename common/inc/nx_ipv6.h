@@ -255,6 +255,9 @@ UINT  _nxd_ipv6_raw_packet_send_internal(NX_IP *ip_ptr, NX_PACKET *packet_ptr,
 VOID  _nxd_ipv6_prefix_router_timer_tick(NX_IP *ip_ptr);
 NX_IPV6_DEFAULT_ROUTER_ENTRY* _nxd_ipv6_find_default_router_from_address(NX_IP *ip_ptr, ULONG *ip_addr);
 INT   _nxd_ipv6_search_onlink(NX_IP *ip_ptr, ULONG *dest_addr);
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+UINT  _nxd_ipv6_static_route_find(NX_IP *ip_ptr, NX_INTERFACE *if_ptr, ULONG *dest_addr, ULONG *next_hop_address);
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
 #endif /* FEATURE_NX_IPV6 */
 
@@ -299,12 +302,18 @@ UINT _nxd_ipv6_default_router_entry_get(NX_IP *ip_ptr, UINT interface_index, UIN
 UINT _nxd_ipv6_default_router_number_of_entries_get(NX_IP *ip_ptr, UINT interface_index, UINT *num_entries);
 UINT _nxd_ipv6_multicast_interface_join(NX_IP *ip_ptr, NXD_ADDRESS *group_address, UINT interface_index);
 UINT _nxd_ipv6_multicast_interface_leave(NX_IP *ip_ptr, NXD_ADDRESS *group_address, UINT interface_index);
+UINT _nxd_ipv6_static_route_add(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length,
+                                NXD_ADDRESS *next_hop, UINT interface_index);
+UINT _nxd_ipv6_static_route_delete(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length);
 UINT _nxd_ipv6_stateless_address_autoconfig_disable(NX_IP *ip_ptr, UINT interface_index);
 UINT _nxd_ipv6_stateless_address_autoconfig_enable(NX_IP *ip_ptr, UINT interface_index);
 
 /* Define error checking shells for API services.  These are only referenced by the application.  */
 UINT _nxde_ipv6_enable(NX_IP *ip_ptr);
 UINT _nxde_ipv6_disable(NX_IP *ip_ptr);
+UINT _nxde_ipv6_static_route_add(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length,
+                                 NXD_ADDRESS *next_hop, UINT interface_index);
+UINT _nxde_ipv6_static_route_delete(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length);
 UINT _nxde_ipv6_stateless_address_autoconfig_disable(NX_IP *ip_ptr, UINT interface_index);
 UINT _nxde_ipv6_stateless_address_autoconfig_enable(NX_IP *ip_ptr, UINT interface_index);
 UINT _nxde_ipv6_address_get(NX_IP *ip_ptr, UINT address_index, NXD_ADDRESS *ip_address, ULONG *prefix_length, UINT *interface_index);
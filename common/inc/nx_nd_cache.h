@@ -135,6 +135,19 @@ VOID _nx_nd_cache_slow_periodic_update(NX_IP *ip_ptr);
 
 /* Invalidate a given entry from the neighbor discovery table. */
 VOID _nx_invalidate_destination_entry(NX_IP *ip_ptr, ULONG *next_hop_ip);
+
+/* Invalidate the destination entries whose address matches a given prefix. */
+VOID _nx_invalidate_destination_prefix(NX_IP *ip_ptr, ULONG *prefix, ULONG prefix_length);
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+/* Link an entry to the hash bucket of its address, and remove it from its bucket. */
+VOID _nx_nd_cache_hash_insert(NX_IP *ip_ptr, ND_CACHE_ENTRY *entry);
+VOID _nx_nd_cache_hash_remove(NX_IP *ip_ptr, ND_CACHE_ENTRY *entry);
+
+/* Add an entry to the list of entries being probed, and remove it from the list. */
+VOID _nx_nd_cache_probe_list_add(NX_IP *ip_ptr, ND_CACHE_ENTRY *entry);
+VOID _nx_nd_cache_probe_list_remove(ND_CACHE_ENTRY *entry);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 #endif /* FEATURE_NX_IPV6 */
 
 
@@ -60,14 +60,18 @@
 
 
 #define NX_PACKET_POOL_ID           ((ULONG)0x5041434B)
+#define NX_PACKET_CACHE_ID          ((ULONG)0x50434348)
+#define NX_PACKET_POOL_GROUP_ID     ((ULONG)0x50475250)
 
 
-/* Define constants for packet free, allocated, enqueued, and driver transmit done.
+/* Define constants for packet free, allocated, shared, enqueued, and driver transmit done.
    These will be used in the nx_packet_tcp_queue_next field to indicate the state of
    the packet.  */
 
 #define NX_PACKET_FREE              ((ALIGN_TYPE)0xFFFFFFFF) /* Packet is available and in the pool  */
 #define NX_PACKET_ALLOCATED         ((ALIGN_TYPE)0xAAAAAAAA) /* Packet has been allocated            */
+#define NX_PACKET_SHARED            ((ALIGN_TYPE)0x55555555) /* Packet is released, clones reference */
+                                                             /*   its data                           */
 #define NX_PACKET_ENQUEUED          ((ALIGN_TYPE)0xEEEEEEEE) /* Packet is the tail of TCP queue.     */
                                                              /* A value that is none of the above    */
                                                              /*   also indicates the packet is in a  */
@@ -95,10 +99,28 @@
 
 UINT _nx_packet_allocate(NX_PACKET_POOL *pool_ptr,  NX_PACKET **packet_ptr,
                          ULONG packet_type, ULONG wait_option);
+UINT _nx_packet_allocate_bulk(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_array, UINT packet_count,
+                              ULONG packet_type, UINT *allocated_count, ULONG wait_option);
+UINT _nx_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                               ULONG packet_type, ULONG wait_option);
+UINT _nx_packet_cache_create(NX_PACKET_POOL *pool_ptr, NX_PACKET_CACHE *cache_ptr, CHAR *name_ptr,
+                             ULONG cache_size, ULONG batch_size);
+UINT _nx_packet_cache_delete(NX_PACKET_CACHE *cache_ptr);
+VOID _nx_packet_cache_drain(NX_PACKET_CACHE *cache_ptr, ULONG packet_count);
+VOID _nx_packet_clone_reference_release(VOID *buffer_start, ULONG buffer_size, VOID *context);
+UINT _nx_packet_cache_flush(NX_PACKET_CACHE *cache_ptr);
+UINT _nx_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET *packet_ptr);
+UINT _nx_packet_clone(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
+                      NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT _nx_packet_copy(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
                      NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT _nx_packet_data_append(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
                             NX_PACKET_POOL *pool_ptr, ULONG wait_option);
+UINT _nx_packet_data_append_checksum(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
+                                     NX_PACKET_POOL *pool_ptr, ULONG wait_option, ULONG *checksum_ptr);
+UINT _nx_packet_data_append_external(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
+                                     VOID (*release_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context),
+                                     VOID *context, NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT _nx_packet_data_extract_offset(NX_PACKET *packet_ptr, ULONG offset, VOID *buffer_start, ULONG buffer_length, ULONG *bytes_copied);
 UINT _nx_packet_data_retrieve(NX_PACKET *packet_ptr, VOID *buffer_start, ULONG *bytes_copied);
 UINT _nx_packet_data_adjust(NX_PACKET *packet_ptr, ULONG header_size);
@@ -106,18 +128,34 @@ UINT _nx_packet_data_adjust(NX_PACKET *packet_ptr, ULONG header_size);
 UINT _nx_packet_debug_info_get(NX_PACKET_POOL *pool_ptr, UINT packet_index, NX_PACKET **packet_pptr,
                                ULONG *packet_status, CHAR **thread_info, CHAR **file_info, ULONG *line);
 #endif /* NX_ENABLE_PACKET_DEBUG_INFO */
+VOID _nx_packet_external_buffer_release(NX_PACKET *packet_ptr);
+VOID _nx_packet_fields_reset(NX_PACKET *packet_ptr, ULONG packet_type);
 UINT _nx_packet_length_get(NX_PACKET *packet_ptr, ULONG *length);
 UINT _nx_packet_pool_create(NX_PACKET_POOL *pool_ptr, CHAR *name, ULONG payload_size,
                             VOID *memory_ptr, ULONG memory_size);
 UINT _nx_packet_pool_delete(NX_PACKET_POOL *pool_ptr);
+UINT _nx_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                    ULONG packet_type, ULONG packet_length, ULONG wait_option);
+UINT _nx_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name_ptr);
+UINT _nx_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr);
+UINT _nx_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT *pool_count, ULONG *fallbacks);
+UINT _nx_packet_pool_group_pool_add(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET_POOL *pool_ptr);
+VOID _nx_packet_pool_bulk_return(NX_PACKET_POOL *pool_ptr, NX_PACKET *head_ptr,
+                                 NX_PACKET *tail_ptr, ULONG packet_count);
+UINT _nx_packet_pool_cache_info_get(NX_PACKET_POOL *pool_ptr, ULONG *cached_packets,
+                                    ULONG *cache_hits, ULONG *cache_misses);
 UINT _nx_packet_pool_info_get(NX_PACKET_POOL *pool_ptr, ULONG *total_packets, ULONG *free_packets,
                               ULONG *empty_pool_requests, ULONG *empty_pool_suspensions,
                               ULONG *invalid_packet_releases);
 UINT _nx_packet_release(NX_PACKET *packet_ptr);
+UINT _nx_packet_release_bulk(NX_PACKET **packet_array, UINT packet_count);
 UINT _nx_packet_transmit_release(NX_PACKET *packet_ptr);
+UINT _nx_packet_transmit_release_bulk(NX_PACKET **packet_array, UINT packet_count);
 VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID _nx_packet_pool_initialize(VOID);
 UINT _nx_packet_pool_low_watermark_set(NX_PACKET_POOL *pool_ptr, ULONG low_watermark);
+UINT _nx_packet_pool_shared_info_get(NX_PACKET_POOL *pool_ptr, ULONG *shared_packets, ULONG *clone_references);
+UINT _nx_packet_shared_release(NX_PACKET *packet_ptr);
 
 UINT _nx_packet_vlan_priority_set(NX_PACKET *packet_ptr, UINT vlan_priority);
 
@@ -126,22 +164,48 @@ UINT _nx_packet_vlan_priority_set(NX_PACKET *packet_ptr, UINT vlan_priority);
 
 UINT _nxe_packet_allocate(NX_PACKET_POOL *pool_ptr,  NX_PACKET **packet_ptr,
                           ULONG packet_type, ULONG wait_option);
+UINT _nxe_packet_allocate_bulk(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_array, UINT packet_count,
+                               ULONG packet_type, UINT *allocated_count, ULONG wait_option);
+UINT _nxe_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                                ULONG packet_type, ULONG wait_option);
+UINT _nxe_packet_cache_create(NX_PACKET_POOL *pool_ptr, NX_PACKET_CACHE *cache_ptr, CHAR *name_ptr,
+                              ULONG cache_size, ULONG batch_size, UINT cache_control_block_size);
+UINT _nxe_packet_cache_delete(NX_PACKET_CACHE *cache_ptr);
+UINT _nxe_packet_cache_flush(NX_PACKET_CACHE *cache_ptr);
+UINT _nxe_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr_ptr);
+UINT _nxe_packet_clone(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
+                       NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT _nxe_packet_copy(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
                       NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT _nxe_packet_data_append(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
                              NX_PACKET_POOL *pool_ptr, ULONG wait_option);
+UINT _nxe_packet_data_append_external(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
+                                      VOID (*release_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context),
+                                      VOID *context, NX_PACKET_POOL *pool_ptr, ULONG wait_option);
 UINT _nxe_packet_data_extract_offset(NX_PACKET *packet_ptr, ULONG offset, VOID *buffer_start, ULONG buffer_length, ULONG *bytes_copied);
 UINT _nxe_packet_data_retrieve(NX_PACKET *packet_ptr, VOID *buffer_start, ULONG *bytes_copied);
 UINT _nxe_packet_length_get(NX_PACKET *packet_ptr, ULONG *length);
 UINT _nxe_packet_pool_create(NX_PACKET_POOL *pool_ptr, CHAR *name, ULONG payload_size,
                              VOID *memory_ptr, ULONG memory_size, UINT pool_control_block_size);
 UINT _nxe_packet_pool_delete(NX_PACKET_POOL *pool_ptr);
+UINT _nxe_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                     ULONG packet_type, ULONG packet_length, ULONG wait_option);
+UINT _nxe_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name_ptr,
+                                   UINT group_control_block_size);
+UINT _nxe_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr);
+UINT _nxe_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT *pool_count, ULONG *fallbacks);
+UINT _nxe_packet_pool_group_pool_add(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET_POOL *pool_ptr);
+UINT _nxe_packet_pool_cache_info_get(NX_PACKET_POOL *pool_ptr, ULONG *cached_packets,
+                                     ULONG *cache_hits, ULONG *cache_misses);
 UINT _nxe_packet_pool_info_get(NX_PACKET_POOL *pool_ptr, ULONG *total_packets, ULONG *free_packets,
                                ULONG *empty_pool_requests, ULONG *empty_pool_suspensions,
                                ULONG *invalid_packet_releases);
 UINT _nxe_packet_release(NX_PACKET **packet_ptr_ptr);
+UINT _nxe_packet_release_bulk(NX_PACKET **packet_array, UINT packet_count);
 UINT _nxe_packet_transmit_release(NX_PACKET **packet_ptr_ptr);
+UINT _nxe_packet_transmit_release_bulk(NX_PACKET **packet_array, UINT packet_count);
 UINT _nxe_packet_pool_low_watermark_set(NX_PACKET_POOL *pool_ptr, ULONG low_watermark);
+UINT _nxe_packet_pool_shared_info_get(NX_PACKET_POOL *pool_ptr, ULONG *shared_packets, ULONG *clone_references);
 
 UINT _nxe_packet_vlan_priority_set(NX_PACKET *packet_ptr, UINT vlan_priority);
 
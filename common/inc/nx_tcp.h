@@ -103,6 +103,200 @@
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
 
+/* Define the SACK options for the TCP header, RFC 2018.  */
+
+#ifdef NX_ENABLE_TCP_SACK
+#define NX_TCP_SACK_PERMITTED_OPTION    ((ULONG)0x01010402) /* NOP, NOP, SACK-permitted     */
+#define NX_TCP_SACK_OPTION              ((ULONG)0x01010500) /* NOP, NOP, SACK, length       */
+#define NX_TCP_SACK_PERMITTED_KIND      0x04                /* SACK-permitted option kind   */
+#define NX_TCP_SACK_KIND                0x05                /* SACK option kind             */
+#define NX_TCP_SACK_BLOCK_SIZE          8                   /* Begin and end sequence       */
+#define NX_TCP_SACK_BLOCKS_MAX          4                   /* Blocks fitting in 40 bytes   */
+#define NX_TCP_SACK_TIMESTAMP_BLOCKS_MAX 3                  /* Blocks fitting with the      */
+                                                            /*   timestamps option          */
+#define NX_TCP_SACK_OPTION_SIZE         (sizeof(ULONG) + NX_TCP_SACK_BLOCKS_MAX * NX_TCP_SACK_BLOCK_SIZE)
+#endif /* NX_ENABLE_TCP_SACK */
+
+
+/* Define the timestamps option for the TCP header, RFC 7323.  */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+#define NX_TCP_TIMESTAMP_OPTION         ((ULONG)0x0101080A) /* NOP, NOP, timestamps, length */
+#define NX_TCP_TIMESTAMP_KIND           0x08                /* Timestamps option kind       */
+#define NX_TCP_TIMESTAMP_LENGTH         10                  /* Kind, length, TSval, TSecr   */
+#define NX_TCP_TIMESTAMP_OPTION_SIZE    12                  /* Option with the NOPs         */
+#define NX_TCP_TIMESTAMP_RECENT_EXPIRE  ((ULONG)(24 * 24 * 60 * 60) * 1000)
+                                                            /* TS.Recent is invalid after   */
+                                                            /*   24 days idle, in ms        */
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+
+/* Define the Fast Open option for the TCP header, RFC 7413.  A server returns cookies of
+   NX_TCP_FAST_OPEN_COOKIE_SIZE bytes, and accepts cookies of 4 to 16 bytes from servers
+   when it is a client.  */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+#define NX_TCP_FAST_OPEN_OPTION         ((ULONG)0x01012202) /* NOP, NOP, Fast Open, length  */
+#define NX_TCP_FAST_OPEN_KIND           0x22                /* Fast Open option kind        */
+#define NX_TCP_FAST_OPEN_COOKIE_SIZE    8                   /* Cookie returned by server    */
+#define NX_TCP_FAST_OPEN_COOKIE_SIZE_MIN 4                  /* Smallest cookie accepted     */
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+
+/* Define the layout of a SYN cookie, the initial sequence number of a SYN+ACK sent when a
+   listen queue is full.  The cookie holds the time it was created in, the index of the MSS
+   of the client in NX_TCP_SYN_COOKIE_MSS_TABLE, and a keyed hash of the connection.  */
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+#define NX_TCP_SYN_COOKIE_COUNT_SHIFT   27                  /* Time of the cookie           */
+#define NX_TCP_SYN_COOKIE_COUNT_MASK    ((ULONG)0x1F)
+#define NX_TCP_SYN_COOKIE_MSS_SHIFT     25                  /* Index of the MSS             */
+#define NX_TCP_SYN_COOKIE_MSS_MASK      ((ULONG)0x03)
+#define NX_TCP_SYN_COOKIE_HASH_MASK     ((ULONG)0x01FFFFFF) /* Hash of the connection       */
+#define NX_TCP_SYN_COOKIE_MSS_TABLE     {536, 1220, 1440, 1460}
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
+
+/* Define the size of the largest TCP control packet, a SYN or a zero window probe, or an ACK
+   with SACK blocks.  The data a SYN carries with a Fast Open cookie fills the rest of the
+   packet.  */
+
+#define NX_TCP_OPTION_SIZE_MAX          40                  /* Largest TCP option area      */
+#if (defined(NX_ENABLE_TCP_SACK) && defined(NX_ENABLE_TCP_TIMESTAMPS)) || defined(NX_ENABLE_TCP_FAST_OPEN)
+#define NX_TCP_CONTROL_SIZE             (NX_TCP_OPTION_SIZE_MAX + sizeof(NX_TCP_HEADER))
+#elif defined(NX_ENABLE_TCP_SACK)
+#define NX_TCP_CONTROL_SIZE             (NX_TCP_SACK_OPTION_SIZE + sizeof(NX_TCP_HEADER))
+#elif defined(NX_ENABLE_TCP_TIMESTAMPS)
+#define NX_TCP_CONTROL_SIZE             (NX_TCP_SYN_SIZE + NX_TCP_TIMESTAMP_OPTION_SIZE + 1)
+#else
+#define NX_TCP_CONTROL_SIZE             (NX_TCP_SYN_SIZE + 1)
+#endif /* (NX_ENABLE_TCP_SACK && NX_ENABLE_TCP_TIMESTAMPS) || NX_ENABLE_TCP_FAST_OPEN */
+
+
+/* Define the size of the TCP header of data segments, which carry the timestamps option when
+   it is used on the connection.  */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+#define NX_TCP_SEGMENT_HEADER_SIZE(s)   ((s) -> nx_tcp_socket_timestamp_permitted ?                  \
+                                         (ULONG)(sizeof(NX_TCP_HEADER) + NX_TCP_TIMESTAMP_OPTION_SIZE) : \
+                                         (ULONG)sizeof(NX_TCP_HEADER))
+#else
+#define NX_TCP_SEGMENT_HEADER_SIZE(s)   ((ULONG)sizeof(NX_TCP_HEADER))
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+
+/* Define constants for the CUBIC and the delay-based congestion control modules.  */
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+#define NX_TCP_CUBIC_BETA               7                   /* Window decrease, 0.7         */
+#define NX_TCP_CUBIC_TIME_MAX           100000              /* Largest time offset in ms    */
+#define NX_TCP_DELAY_STARTUP            0                   /* Doubling the window          */
+#define NX_TCP_DELAY_STEADY             1                   /* Window at twice the BDP      */
+#define NX_TCP_DELAY_PROBE_RTT          2                   /* Draining to measure the RTT  */
+#define NX_TCP_DELAY_FULL_ROUNDS        3                   /* Rounds without rate growth   */
+#define NX_TCP_DELAY_MIN_RTT_EXPIRE     (10 * NX_IP_PERIODIC_RATE)
+#define NX_TCP_DELAY_PROBE_RTT_TIME     (NX_IP_PERIODIC_RATE / 5)
+#define NX_TCP_CONGESTION_WINDOW_MAX    0x40000000          /* Largest congestion window    */
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+
+/* Define the timestamp clock and the limits of the retransmission timeout computed from the
+   measured round trip time.  The timestamp clock counts milliseconds.  By default, it is
+   derived from the ThreadX timer, and its granularity is one timer tick.  The limits of the
+   retransmission timeout are in microseconds.  */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+#ifndef NX_TCP_TIMESTAMP_GET
+#define NX_TCP_TIMESTAMP_GET()          ((ULONG)(((ULONG64)tx_time_get() * 1000) / NX_IP_PERIODIC_RATE))
+#ifndef NX_TCP_TIMESTAMP_GRANULARITY
+#define NX_TCP_TIMESTAMP_GRANULARITY    ((NX_IP_PERIODIC_RATE < 1000) ? (1000000 / NX_IP_PERIODIC_RATE) : 1000)
+#endif /* NX_TCP_TIMESTAMP_GRANULARITY */
+#endif /* NX_TCP_TIMESTAMP_GET */
+
+#ifndef NX_TCP_TIMESTAMP_GRANULARITY
+#define NX_TCP_TIMESTAMP_GRANULARITY    1000        /* Clock granularity in us       */
+#endif /* NX_TCP_TIMESTAMP_GRANULARITY */
+
+#ifndef NX_TCP_RTO_MIN
+#define NX_TCP_RTO_MIN                  200000      /* Minimum timeout of 200 ms     */
+#endif /* NX_TCP_RTO_MIN */
+
+#ifndef NX_TCP_RTO_MAX
+#define NX_TCP_RTO_MAX                  60000000    /* Maximum timeout of 60 s       */
+#endif /* NX_TCP_RTO_MAX */
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+
+/* Define the largest payload of one TCP packet handed to the IP layer with segmentation
+   offload.  The packet is split into segments of MSS size by the interface, or in software
+   when the interface does not support segmentation offload.  */
+
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+#ifndef NX_TCP_SEGMENTATION_SIZE_MAX
+#define NX_TCP_SEGMENTATION_SIZE_MAX    32768       /* Maximum payload in bytes      */
+#endif /* NX_TCP_SEGMENTATION_SIZE_MAX */
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+
+
+/* Define the constants of TCP receive offload.  In-order segments of one connection received
+   together are coalesced into one packet, up to NX_TCP_COALESCE_SIZE_MAX bytes of data, before
+   TCP processing.  Up to NX_TCP_COALESCE_FLOWS connections are coalesced at the same time.  */
+
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+#ifndef NX_TCP_COALESCE_SIZE_MAX
+#define NX_TCP_COALESCE_SIZE_MAX        32768       /* Maximum payload in bytes      */
+#endif /* NX_TCP_COALESCE_SIZE_MAX */
+
+#ifndef NX_TCP_COALESCE_FLOWS
+#define NX_TCP_COALESCE_FLOWS           4           /* Connections coalesced at once */
+#endif /* NX_TCP_COALESCE_FLOWS */
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+
+/* Define the constants of the TCP ACK policy.  In-sequence data is acknowledged at least
+   every NX_TCP_ACK_SEGMENTS full size segments, RFC 5681, Section 4.2.  After an idle period
+   or out-of-order data, the next NX_TCP_QUICK_ACK_SEGMENTS data segments are acknowledged
+   immediately.  */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+#ifndef NX_TCP_ACK_SEGMENTS
+#ifdef NX_TCP_ACK_EVERY_N_PACKETS
+#define NX_TCP_ACK_SEGMENTS             NX_TCP_ACK_EVERY_N_PACKETS
+#else
+#define NX_TCP_ACK_SEGMENTS             2           /* Full size segments per ACK    */
+#endif /* NX_TCP_ACK_EVERY_N_PACKETS */
+#endif /* NX_TCP_ACK_SEGMENTS */
+
+#ifndef NX_TCP_QUICK_ACK_SEGMENTS
+#define NX_TCP_QUICK_ACK_SEGMENTS       8           /* Segments acked immediately    */
+#endif /* NX_TCP_QUICK_ACK_SEGMENTS */
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
+
+/* Define the constants of TCP pacing.  A paced socket sends at most NX_TCP_PACING_BURST_SEGMENTS
+   full size segments back to back, or the data of one timer tick at the pacing rate if that
+   is more.  The rate derived from the congestion window and the smoothed round trip time is
+   scaled by the gain in percent, which is higher in slow start so that the window can grow.  */
+
+#ifdef NX_ENABLE_TCP_PACING
+#ifndef NX_TCP_PACING_RATE_DEFAULT
+#define NX_TCP_PACING_RATE_DEFAULT      0           /* Pacing disabled by default    */
+#endif /* NX_TCP_PACING_RATE_DEFAULT */
+
+#ifndef NX_TCP_PACING_BURST_SEGMENTS
+#define NX_TCP_PACING_BURST_SEGMENTS    2           /* Segments sent back to back    */
+#endif /* NX_TCP_PACING_BURST_SEGMENTS */
+
+#ifndef NX_TCP_PACING_SLOW_START_GAIN
+#define NX_TCP_PACING_SLOW_START_GAIN   200         /* Gain in slow start, percent   */
+#endif /* NX_TCP_PACING_SLOW_START_GAIN */
+
+#ifndef NX_TCP_PACING_GAIN
+#define NX_TCP_PACING_GAIN              120         /* Gain after slow start, percent*/
+#endif /* NX_TCP_PACING_GAIN */
+#endif /* NX_ENABLE_TCP_PACING */
+
+
 /* Define constants for the optional TCP keepalive Timer.  To enable this
    feature, the TCP source must be compiled with NX_ENABLE_TCP_KEEPALIVE
    defined.  */
@@ -240,11 +434,17 @@ typedef  struct NX_TCP_HEADER_STRUCT
 /* Define TCP component API function prototypes.  */
 
 UINT _nxd_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip, UINT server_port, ULONG wait_option);
+UINT _nxd_tcp_client_socket_connect_data(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip, UINT server_port,
+                                         NX_PACKET *packet_ptr, ULONG wait_option);
 UINT _nxd_tcp_socket_peer_info_get(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *peer_ip_address, ULONG *peer_port);
 UINT _nx_tcp_client_socket_bind(NX_TCP_SOCKET *socket_ptr, UINT port, ULONG wait_option);
 UINT _nx_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, ULONG server_ip, UINT server_port, ULONG wait_option);
 UINT _nx_tcp_client_socket_port_get(NX_TCP_SOCKET *socket_ptr, UINT *port_ptr);
 UINT _nx_tcp_client_socket_unbind(NX_TCP_SOCKET *socket_ptr);
+UINT _nx_tcp_connection_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
+UINT _nx_tcp_connection_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_connections,
+                                         ULONG *table_entries_used, ULONG *table_longest_chain,
+                                         ULONG *table_lookups, ULONG *table_hits);
 UINT _nx_tcp_enable(NX_IP *ip_ptr);
 UINT _nx_tcp_free_port_find(NX_IP *ip_ptr, UINT port, UINT *free_port_ptr);
 UINT _nx_tcp_info_get(NX_IP *ip_ptr, ULONG *tcp_packets_sent, ULONG *tcp_bytes_sent,
@@ -304,14 +504,61 @@ VOID _nx_tcp_client_bind_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID _nx_tcp_deferred_cleanup_check(NX_IP *ip_ptr);
 VOID _nx_tcp_fast_periodic_processing(NX_IP *ip_ptr);
 VOID _nx_tcp_socket_retransmit(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, UINT need_fast_retransmit);
+VOID _nx_tcp_socket_retransmit_packet(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr);
+VOID _nx_tcp_congestion_control_newreno_initialize(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_congestion_control_newreno_ack(NX_TCP_SOCKET *socket_ptr, ULONG acked_bytes, ULONG round_trip_time);
+VOID _nx_tcp_congestion_control_newreno_loss(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_congestion_control_newreno_timeout(NX_TCP_SOCKET *socket_ptr);
+ULONG _nx_tcp_congestion_control_newreno_window_get(NX_TCP_SOCKET *socket_ptr);
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+VOID _nx_tcp_congestion_control_cubic_initialize(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_congestion_control_cubic_ack(NX_TCP_SOCKET *socket_ptr, ULONG acked_bytes, ULONG round_trip_time);
+VOID _nx_tcp_congestion_control_cubic_loss(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_congestion_control_cubic_timeout(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_congestion_control_delay_initialize(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_congestion_control_delay_ack(NX_TCP_SOCKET *socket_ptr, ULONG acked_bytes, ULONG round_trip_time);
+VOID _nx_tcp_congestion_control_delay_loss(NX_TCP_SOCKET *socket_ptr);
+ULONG _nx_tcp_congestion_control_delay_window_get(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
 VOID _nx_tcp_connect_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+VOID _nx_tcp_connection_table_add(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr);
+NX_TCP_SOCKET *_nx_tcp_connection_table_find(NX_IP *ip_ptr, UINT port, UINT peer_port, ULONG *peer_ip, ULONG ip_version);
+UINT _nx_tcp_connection_table_index(NX_IP *ip_ptr, UINT port, UINT peer_port, ULONG *peer_ip, ULONG ip_version);
+VOID _nx_tcp_connection_table_remove(NX_TCP_SOCKET *socket_ptr);
 VOID _nx_tcp_disconnect_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+NX_TCP_FAST_OPEN_ENTRY *_nx_tcp_fast_open_cache_find(NX_IP *ip_ptr, NXD_ADDRESS *server_ip);
+VOID _nx_tcp_fast_open_cache_update(NX_TCP_SOCKET *socket_ptr, UCHAR *cookie, UINT cookie_length);
+VOID _nx_tcp_fast_open_cookie_generate(NX_IP *ip_ptr, NXD_ADDRESS *client_ip, UCHAR *cookie);
+ULONG _nx_tcp_fast_open_option_build(NX_TCP_SOCKET *socket_ptr, ULONG control_bits, ULONG *option_ptr, ULONG option_words_max);
+UINT _nx_tcp_fast_open_option_get(UCHAR *option_ptr, ULONG option_area_size, UINT *fast_open_found,
+                                  UCHAR **cookie, UINT *cookie_length);
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 VOID _nx_tcp_initialize(VOID);
 UINT _nx_tcp_mss_option_get(UCHAR *option_ptr, ULONG option_area_size, ULONG *mss);
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
 UINT _nx_tcp_window_scaling_option_get(UCHAR *option_ptr, ULONG option_area_size, ULONG *window_scale);
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+VOID  _nx_tcp_timestamp_option_build(NX_TCP_SOCKET *socket_ptr, ULONG *option_ptr);
+UINT  _nx_tcp_timestamp_option_get(UCHAR *option_ptr, ULONG option_area_size, UINT *timestamp_found,
+                                   ULONG *timestamp_value, ULONG *timestamp_echo);
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+#ifdef NX_ENABLE_TCP_SACK
+ULONG _nx_tcp_sack_option_build(NX_TCP_SOCKET *socket_ptr, ULONG *option_ptr);
+UINT _nx_tcp_sack_permitted_option_get(UCHAR *option_ptr, ULONG option_area_size, UINT *sack_permitted);
+#endif /* NX_ENABLE_TCP_SACK */
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+ULONG _nx_tcp_syn_cookie_check(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr);
+ULONG _nx_tcp_syn_cookie_compute(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr,
+                                 ULONG client_sequence, ULONG count, ULONG mss_index);
+VOID _nx_tcp_syn_cookie_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr, ULONG mss);
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
 VOID _nx_tcp_no_connection_reset(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr);
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+VOID _nx_tcp_packet_coalesce(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+VOID _nx_tcp_packet_coalesce_flush(NX_IP *ip_ptr);
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
 VOID _nx_tcp_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_tcp_packet_send_ack(NX_TCP_SOCKET *socket_ptr, ULONG tx_sequence);
@@ -324,10 +571,43 @@ VOID _nx_tcp_packet_send_control(NX_TCP_SOCKET *socket_ptr, ULONG control_bits,
 VOID _nx_tcp_periodic_processing(NX_IP *ip_ptr);
 VOID _nx_tcp_queue_process(NX_IP *ip_ptr);
 VOID _nx_tcp_receive_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+#ifdef NX_ENABLE_TCP_PACING
+VOID _nx_tcp_pacing_process(NX_IP *ip_ptr);
+VOID _nx_tcp_pacing_timer_create(NX_IP *ip_ptr);
+#endif /* NX_ENABLE_TCP_PACING */
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+VOID _nx_tcp_socket_ack_pending_flush(NX_IP *ip_ptr);
+VOID _nx_tcp_socket_ack_pending_remove(NX_TCP_SOCKET *socket_ptr);
+UINT _nx_tcp_socket_ack_policy_check(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+UINT _nx_tcp_socket_ack_policy_set(NX_TCP_SOCKET *socket_ptr, UINT ack_segments, UINT quick_ack_segments);
 UINT _nx_tcp_socket_bytes_available(NX_TCP_SOCKET *socket_ptr, ULONG *bytes_available);
+UINT _nx_tcp_socket_congestion_control_set(NX_TCP_SOCKET *socket_ptr, const NX_TCP_CONGESTION_CONTROL *congestion_control);
 VOID _nx_tcp_socket_connection_reset(NX_TCP_SOCKET *socket_ptr);
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+UINT _nx_tcp_socket_fast_open_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, UCHAR *cookie, UINT cookie_length);
+VOID _nx_tcp_socket_fast_open_send(NX_TCP_SOCKET *socket_ptr, ULONG acked_length);
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 VOID _nx_tcp_socket_packet_process(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr);
+#ifdef NX_ENABLE_TCP_PACING
+UINT _nx_tcp_socket_pacing_check(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_PACING */
+UINT _nx_tcp_socket_pacing_set(NX_TCP_SOCKET *socket_ptr, ULONG pacing_rate);
 UINT _nx_tcp_socket_peer_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *peer_ip_address, ULONG *peer_port);
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+VOID _nx_tcp_socket_rtt_update(NX_TCP_SOCKET *socket_ptr, ULONG round_trip_time);
+UINT _nx_tcp_socket_timestamp_check(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr);
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+#ifdef NX_ENABLE_TCP_SACK
+UINT _nx_tcp_socket_sack_retransmit(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_socket_sack_update(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tcp_header_ptr);
+#endif /* NX_ENABLE_TCP_SACK */
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+VOID _nx_tcp_socket_segment_send(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr);
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+VOID _nx_tcp_socket_syn_cookie_establish(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr);
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
 
 VOID _nx_tcp_socket_receive_queue_flush(NX_TCP_SOCKET *socket_ptr);
 UINT _nx_tcp_socket_state_ack_check(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tcp_header_ptr);
@@ -344,21 +624,42 @@ VOID _nx_tcp_socket_state_syn_received(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER
 VOID _nx_tcp_socket_state_transmit_check(NX_TCP_SOCKET *socket_ptr);
 VOID _nx_tcp_socket_thread_resume(TX_THREAD **suspension_list_head, UINT status);
 VOID _nx_tcp_socket_thread_suspend(TX_THREAD **suspension_list_head, VOID (*suspend_cleanup)(TX_THREAD * NX_CLEANUP_PARAMETER), NX_TCP_SOCKET *socket_ptr, TX_MUTEX *mutex_ptr, ULONG wait_option);
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+VOID _nx_tcp_socket_timer_schedule(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_socket_timer_sync(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 VOID _nx_tcp_socket_transmit_queue_flush(NX_TCP_SOCKET *socket_ptr);
 VOID _nx_tcp_socket_block_cleanup(NX_TCP_SOCKET *socket_ptr);
 VOID _nx_tcp_transmit_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+VOID _nx_tcp_timer_wheel_advance(NX_TCP_TIMER_WHEEL *wheel_ptr);
+VOID _nx_tcp_timer_wheel_insert(NX_TCP_TIMER_WHEEL *wheel_ptr, NX_TCP_TIMER *timer_ptr, ULONG expiration);
+VOID _nx_tcp_timer_wheel_remove(NX_TCP_TIMER *timer_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 UINT _nx_tcp_socket_vlan_priority_set(NX_TCP_SOCKET *socket_ptr, UINT vlan_priority);
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+VOID _nx_tcp_socket_window_autotune(NX_TCP_SOCKET *socket_ptr, ULONG bytes_received);
+VOID _nx_tcp_socket_window_autotune_reset(NX_TCP_SOCKET *socket_ptr);
+VOID _nx_tcp_socket_window_autotune_rtt(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+UINT _nx_tcp_socket_window_autotune_set(NX_TCP_SOCKET *socket_ptr, ULONG window_maximum);
 
 
 /* Define error checking shells for TCP API services.  These are only referenced by the
    application.  */
 
 UINT _nxde_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip, UINT server_port, ULONG wait_option);
+UINT _nxde_tcp_client_socket_connect_data(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip, UINT server_port,
+                                          NX_PACKET *packet_ptr, ULONG wait_option);
 UINT _nxde_tcp_socket_peer_info_get(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *peer_ip_address, ULONG *peer_port);
 UINT _nxe_tcp_client_socket_bind(NX_TCP_SOCKET *socket_ptr, UINT port, ULONG wait_option);
 UINT _nxe_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, ULONG server_ip, UINT server_port, ULONG wait_option);
 UINT _nxe_tcp_client_socket_port_get(NX_TCP_SOCKET *socket_ptr, UINT *port_ptr);
 UINT _nxe_tcp_client_socket_unbind(NX_TCP_SOCKET *socket_ptr);
+UINT _nxe_tcp_connection_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
+UINT _nxe_tcp_connection_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_connections,
+                                          ULONG *table_entries_used, ULONG *table_longest_chain,
+                                          ULONG *table_lookups, ULONG *table_hits);
 UINT _nxe_tcp_enable(NX_IP *ip_ptr);
 UINT _nxe_tcp_free_port_find(NX_IP *ip_ptr, UINT port, UINT *free_port_ptr);
 UINT _nxe_tcp_info_get(NX_IP *ip_ptr, ULONG *tcp_packets_sent, ULONG *tcp_bytes_sent,
@@ -373,7 +674,9 @@ UINT _nxe_tcp_server_socket_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *sock
 UINT _nxe_tcp_server_socket_relisten(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr);
 UINT _nxe_tcp_server_socket_unaccept(NX_TCP_SOCKET *socket_ptr);
 UINT _nxe_tcp_server_socket_unlisten(NX_IP *ip_ptr, UINT port);
+UINT _nxe_tcp_socket_ack_policy_set(NX_TCP_SOCKET *socket_ptr, UINT ack_segments, UINT quick_ack_segments);
 UINT _nxe_tcp_socket_bytes_available(NX_TCP_SOCKET *socket_ptr, ULONG *bytes_available);
+UINT _nxe_tcp_socket_congestion_control_set(NX_TCP_SOCKET *socket_ptr, const NX_TCP_CONGESTION_CONTROL *congestion_control);
 UINT _nxe_tcp_socket_create(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, CHAR *name,
                             ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG window_size,
                             VOID (*tcp_urgent_data_callback)(NX_TCP_SOCKET *socket_ptr),
@@ -390,6 +693,7 @@ UINT _nxe_tcp_socket_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *tcp_packets_sent
 UINT _nxe_tcp_socket_mss_get(NX_TCP_SOCKET *socket_ptr, ULONG *mss);
 UINT _nxe_tcp_socket_mss_peer_get(NX_TCP_SOCKET *socket_ptr, ULONG *peer_mss);
 UINT _nxe_tcp_socket_mss_set(NX_TCP_SOCKET *socket_ptr, ULONG mss);
+UINT _nxe_tcp_socket_pacing_set(NX_TCP_SOCKET *socket_ptr, ULONG pacing_rate);
 UINT _nxe_tcp_socket_peer_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *peer_ip_address, ULONG *peer_port);
 UINT _nxe_tcp_socket_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
 UINT _nxe_tcp_socket_receive_notify(NX_TCP_SOCKET *socket_ptr,
@@ -406,6 +710,7 @@ UINT _nxe_tcp_socket_disconnect_complete_notify(NX_TCP_SOCKET *socket_ptr, VOID
 UINT _nxe_tcp_socket_queue_depth_notify_set(NX_TCP_SOCKET *socket_ptr,  VOID (*tcp_socket_queue_depth_notify)(NX_TCP_SOCKET *socket_ptr));
 UINT _nxe_tcp_socket_timed_wait_callback(NX_TCP_SOCKET *socket_ptr, VOID (*tcp_timed_wait_callback)(NX_TCP_SOCKET *socket_ptr));
 UINT _nxe_tcp_socket_vlan_priority_set(NX_TCP_SOCKET *socket_ptr, UINT vlan_priority);
+UINT _nxe_tcp_socket_window_autotune_set(NX_TCP_SOCKET *socket_ptr, ULONG window_maximum);
 
 /* TCP component data declarations follow.  */
 
@@ -129,6 +129,29 @@
 #define NX_IP_ROUTING_TABLE_SIZE 8
 */
 
+/* Defined, this option keeps the IPv4 and IPv6 static routes in a binary trie, so the longest
+   matching prefix is found in time bound by the address length instead of the number of routes.
+   The IP instance holds NX_IP_ROUTING_TABLE_SIZE routes, more can be added with memory supplied
+   by nx_ip_static_route_table_extend.  IPv6 static routes are added by nxd_ipv6_static_route_add.
+   This option implies NX_ENABLE_IP_STATIC_ROUTING.  By default this option is not defined. */
+/*
+#define NX_ENABLE_IP_ROUTE_TRIE
+*/
+
+/* Defined, this option caches the IPv4 route and the ARP entry of the next hop found for the
+   most recent destinations, so packets sent to the same destination skip the route and ARP
+   lookups.  The cache is invalidated when a route, an address, the state of a link or an ARP
+   entry changes.  By default this option is not defined. */
+/*
+#define NX_ENABLE_IP_ROUTE_CACHE
+*/
+
+/* This define specifies the number of destinations held by the IPv4 route cache, it must be a
+   power of two.  The default value is 16. */
+/*
+#define NX_IP_ROUTE_CACHE_SIZE 16
+*/
+
 /* Defined, this option enables random IP id. By default IP id is increased by one for each packet. */
 /*
 #define NX_ENABLE_IP_ID_RANDOMIZATION
@@ -300,6 +323,27 @@
 #define NX_IPV6_DESTINATION_TABLE_SIZE  8
 */
 
+/* Defined, this option makes the lookups in the IPv6 neighbor cache and in the IPv6 destination
+   table go through hash buckets instead of scanning the tables, and lets the ND cache fast periodic
+   update visit only the entries in the INCOMPLETE or PROBE state.  The send path then does not slow
+   down with large values of NX_IPV6_NEIGHBOR_CACHE_SIZE and NX_IPV6_DESTINATION_TABLE_SIZE.
+   By default this option is not defined. */
+/*
+#define NX_ENABLE_IPV6_ND_HASH_TABLE
+*/
+
+/* This define specifies the number of hash buckets of the IPv6 neighbor cache, it must be a power
+   of two.  The default value is 32. */
+/*
+#define NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE        32
+*/
+
+/* This define specifies the number of hash buckets of the IPv6 destination table, it must be a power
+   of two.  The default value is 16. */
+/*
+#define NX_IPV6_DESTINATION_TABLE_HASH_SIZE     16
+*/
+
 /* Define the size of the IPv6 prefix table. */
 /*
 #define NX_IPV6_PREFIX_LIST_TABLE_SIZE  8
@@ -380,6 +424,21 @@
 #define NX_ARP_DEFEND_INTERVAL  10
 */
 
+/* Defined, this option lets nx_arp_table_resize move the ARP table to memory supplied by the
+   application, so a network with many peers keeps short ARP lists.  The updates of the dynamic
+   ARP entries are scheduled in a timer wheel, so the ARP periodic update only visits the entries
+   whose update is due.  The table size and the ARP cache hits, misses and evictions are retrieved
+   by nx_arp_table_info_get.  By default this option is not defined. */
+/*
+#define NX_ENABLE_ARP_HASH_TABLE
+*/
+
+/* This define specifies the number of slots of the ARP timer wheel, it must be a power of two.
+   The default value is 64. */
+/*
+#define NX_ARP_TIMER_WHEEL_SIZE     64
+*/
+
 
 /* Configuration options for TCP */
 
@@ -425,11 +484,211 @@
 #define NX_MAX_LISTEN_REQUESTS      10
 */
 
+/* This define specifies the number of entries in the hash table of bound TCP sockets. The value
+   must be a power of two. The default value is 32.  */
+/*
+#define NX_TCP_PORT_TABLE_SIZE      32
+*/
+
+/* This define specifies the number of entries in the hash table of TCP server listen requests.
+   The value must be a power of two. The default value is 16.  */
+/*
+#define NX_TCP_LISTEN_TABLE_SIZE    16
+*/
+
 /* Defined, this option enables the optional TCP keepalive timer.  */
 /*
 #define NX_ENABLE_TCP_KEEPALIVE
 */
 
+/* Defined, this option enables the TCP timer wheels. The periodic TCP processing then only visits
+   the sockets with an expiring transmit, delayed ACK or keepalive timeout, instead of all created
+   sockets on every tick.  */
+/*
+#define NX_ENABLE_TCP_TIMER_WHEEL
+*/
+
+/* This define specifies the number of slots of each level of the TCP timer wheels as a power of
+   two. The default value is 5, which represents 32 slots.  */
+/*
+#define NX_TCP_TIMER_WHEEL_BITS     5
+*/
+
+/* Defined, this option enables TCP selective acknowledgment (SACK) as described in RFC 2018.
+   SACK is used on a connection only if both sides send the SACK-permitted option.  */
+/*
+#define NX_ENABLE_TCP_SACK
+*/
+
+/* This define specifies the number of SACKed sequence ranges recorded by a TCP socket to
+   select the data to retransmit. The default value is 8.  */
+/*
+#define NX_TCP_SACK_SCOREBOARD_SIZE 8
+*/
+
+/* Defined, this option enables the CUBIC and the delay-based TCP congestion control modules,
+   and the round trip time measurement they use.  A module is selected per socket with
+   nx_tcp_socket_congestion_control_set.  By default, and without this option, sockets use
+   NewReno.  */
+/*
+#define NX_ENABLE_TCP_CONGESTION_CONTROL
+*/
+
+/* Defined, this option enables the TCP timestamps option, RFC 7323.  The round trip time is
+   measured from the timestamps echoed in every ACK, and the retransmission timeout is computed
+   in microseconds from the measurements.  Segments with an old timestamp are dropped (PAWS).  */
+/*
+#define NX_ENABLE_TCP_TIMESTAMPS
+*/
+
+/* This define specifies the clock of the TCP timestamps, in milliseconds.  By default, the clock
+   is derived from the ThreadX timer, and its granularity is one timer tick.  A faster clock
+   improves the round trip time measurement on low latency links.  */
+/*
+#define NX_TCP_TIMESTAMP_GET()          ((ULONG)(((ULONG64)tx_time_get() * 1000) / NX_IP_PERIODIC_RATE))
+*/
+
+/* This define specifies the granularity of the timestamp clock, in microseconds.  The default
+   value is one timer tick with the default clock, and 1000 otherwise.  */
+/*
+#define NX_TCP_TIMESTAMP_GRANULARITY    1000
+*/
+
+/* These defines specify the lower and upper limits of the retransmission timeout computed from
+   the timestamps, in microseconds.  The default values are 200 milliseconds and 60 seconds.  */
+/*
+#define NX_TCP_RTO_MIN                  200000
+#define NX_TCP_RTO_MAX                  60000000
+*/
+
+/* Defined, this option enables TCP segmentation offload.  Data larger than the MSS is sent as
+   one TCP packet, up to NX_TCP_SEGMENTATION_SIZE_MAX bytes.  The packet is split into segments
+   by interfaces with the NX_INTERFACE_CAPABILITY_TCP_SEGMENTATION capability, and in software
+   before it is passed to the IP layer otherwise.  */
+/*
+#define NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+*/
+
+/* This define specifies the largest payload of one TCP packet sent with segmentation offload.
+   The default value is 32768.  */
+/*
+#define NX_TCP_SEGMENTATION_SIZE_MAX    32768
+*/
+
+/* Defined, this option enables TCP receive offload.  In-order segments of one connection
+   processed together by the IP helper thread are coalesced into one packet before TCP
+   processing.  Packets from interfaces with the NX_INTERFACE_CAPABILITY_TCP_RECEIVE_OFFLOAD
+   capability are already coalesced by the interface and are not coalesced again.  */
+/*
+#define NX_ENABLE_TCP_RECEIVE_OFFLOAD
+*/
+
+/* This define specifies the largest payload of one coalesced TCP packet.  The default value
+   is 32768.  */
+/*
+#define NX_TCP_COALESCE_SIZE_MAX        32768
+*/
+
+/* This define specifies the number of connections coalesced at the same time.  The default
+   value is 4.  */
+/*
+#define NX_TCP_COALESCE_FLOWS           4
+*/
+
+/* Defined, this option enables the TCP ACK policy.  In-sequence data is acknowledged once
+   NX_TCP_ACK_SEGMENTS full size segments are not yet acknowledged, or by the delayed ACK timer.
+   After an idle period or out-of-order data, the next NX_TCP_QUICK_ACK_SEGMENTS data segments
+   are acknowledged immediately.  The ACKs of a batch of packets processed together by the IP
+   helper thread are coalesced into one ACK per socket.  The policy of a socket is changed with
+   nx_tcp_socket_ack_policy_set.  This option replaces NX_TCP_ACK_EVERY_N_PACKETS.  */
+/*
+#define NX_ENABLE_TCP_ACK_POLICY
+*/
+
+/* This define specifies the default number of full size segments received before an ACK is
+   sent.  The default value is NX_TCP_ACK_EVERY_N_PACKETS if defined, otherwise 2.  */
+/*
+#define NX_TCP_ACK_SEGMENTS             2
+*/
+
+/* This define specifies the default number of data segments acknowledged immediately after an
+   idle period or out-of-order data.  The default value is 8.  */
+/*
+#define NX_TCP_QUICK_ACK_SEGMENTS       8
+*/
+
+/* Defined, this option enables TCP pacing.  Data of a paced socket is spread out at the pacing
+   rate instead of being sent in bursts up to the congestion window.  Held data is released by
+   a one-shot timer with one timer tick resolution, independent of the TCP periodic timers.
+   The rate of a socket is set with nx_tcp_socket_pacing_set, in bytes per second, or derived
+   from the congestion window and the smoothed round trip time with NX_TCP_PACING_RATE_AUTO.
+   The derived rate needs the round trip time measured with NX_ENABLE_TCP_CONGESTION_CONTROL or
+   NX_ENABLE_TCP_TIMESTAMPS.  Retransmissions are not paced.  */
+/*
+#define NX_ENABLE_TCP_PACING
+*/
+
+/* This define specifies the pacing rate of a new socket.  The default value is 0, the socket
+   is not paced.  */
+/*
+#define NX_TCP_PACING_RATE_DEFAULT      0
+*/
+
+/* This define specifies the number of full size segments a paced socket sends back to back.
+   The default value is 2.  */
+/*
+#define NX_TCP_PACING_BURST_SEGMENTS    2
+*/
+
+/* These defines specify the gain of the derived pacing rate in percent, in slow start and after
+   slow start.  The default values are 200 and 120.  */
+/*
+#define NX_TCP_PACING_SLOW_START_GAIN   200
+#define NX_TCP_PACING_GAIN              120
+*/
+
+/* Defined, this option enables TCP Fast Open, RFC 7413.  A client connected with
+   nxd_tcp_client_socket_connect_data requests a cookie from the server and, once the cookie is
+   cached, sends the initial data in the SYN of the following connections.  A server returns a
+   cookie derived from the client address and a secret key, and delivers the data of a SYN with a
+   valid cookie right away when an accept call is pending.  The data of a SYN may be replayed by
+   the network, only enable it for idempotent application protocols.  */
+/*
+#define NX_ENABLE_TCP_FAST_OPEN
+*/
+
+/* This define specifies the number of server cookies cached by a Fast Open client.  The default
+   value is 4.  */
+/*
+#define NX_TCP_FAST_OPEN_CACHE_SIZE     4
+*/
+
+/* Defined, this option enables SYN cookies.  Once the listen queue of a port is full, a new
+   connection request is answered with a SYN+ACK whose sequence number encodes the request, in
+   place of dropping the oldest queued request.  The final ACK of the handshake is validated and
+   establishes the connection on the listen socket, or is queued for the next relisten call.
+   A connection established from a cookie does not use window scaling, SACK or timestamps, and
+   the MSS of the client is rounded down to 536, 1220, 1440 or 1460 bytes.  */
+/*
+#define NX_ENABLE_TCP_SYN_COOKIES
+*/
+
+/* This define specifies the lifetime of a SYN cookie in seconds, a cookie is accepted for up to
+   twice this period.  The default value is 64.  */
+/*
+#define NX_TCP_SYN_COOKIE_PERIOD        64
+*/
+
+/* Defined, this option enables TCP receive window autotuning.  Once per round trip time measured
+   by the receiver, the receive window of a socket is grown to twice the data the application
+   received in that time, so that a fast reader is not limited by the window it was created
+   with.  The window grows up to the maximum set with nx_tcp_socket_window_autotune_set and by at
+   most half of the free space of the default packet pool, and starts from the initial window on
+   each connection.  Windows above 65535 bytes need NX_ENABLE_TCP_WINDOW_SCALING.  */
+/*
+#define NX_ENABLE_TCP_WINDOW_AUTOTUNING
+*/
+
 /* Defined, this option enables the optional TCP immediate ACK response processing.  */
 /*
 #define NX_TCP_IMMEDIATE_ACK
@@ -542,6 +801,39 @@
 #define NX_IPV6_MAX_REASSEMBLY_TIME 60
 */
 
+/* Defined, this option keeps the datagrams being reassembled in contexts found through a hash of
+   their addresses and identification, so the cost of a fragment does not grow with the number of
+   datagrams being reassembled.  In-order fragments are appended without walking the fragments of
+   the datagram, and the fragments are only walked once the datagram may be complete.  The drop
+   counters are retrieved by nx_ip_fragment_info_get.  By default this option is not defined. */
+/*
+#define NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+*/
+
+/* This define specifies the number of datagrams that can be reassembled at the same time.  When
+   all the contexts are in use, the oldest datagram is dropped.  The default value is 16. */
+/*
+#define NX_IP_FRAGMENT_CONTEXT_MAX          16
+*/
+
+/* This define specifies the number of hash buckets of the reassembly contexts, it must be a
+   power of two.  The default value is 32. */
+/*
+#define NX_IP_FRAGMENT_HASH_SIZE            32
+*/
+
+/* This define specifies the number of fragments one datagram can hold while it is reassembled.
+   Further fragments of the datagram are dropped.  The default value is 128. */
+/*
+#define NX_IP_FRAGMENT_MAX_FRAGMENTS        128
+*/
+
+/* This define specifies the largest payload of a reassembled datagram.  Fragments that end beyond
+   it are dropped.  The default value is 65535. */
+/*
+#define NX_IP_FRAGMENT_MAX_DATAGRAM_SIZE    65535
+*/
+
 /* Configuration options for checksum */
 
 /* Defined, this option disables checksum logic on received ICMPv4 packets.
@@ -621,6 +913,13 @@
 #define NX_DISABLE_UDP_TX_CHECKSUM
 */
 
+/* Defined, NX_CHECKSUM_WORDS(ptr, count) replaces the routine that returns the 64-bit sum of count
+   32-bit words at ptr when computing checksums.  By default the port's vectorized routine is used
+   if there is one, otherwise the portable routine _nx_ip_checksum_words.  */
+/*
+#define NX_CHECKSUM_WORDS(ptr, count)   _nx_ip_checksum_words(ptr, count)
+*/
+
 
 /* Configuration options for statistics.  */
 
@@ -710,6 +1009,42 @@
 #define NX_ENABLE_DUAL_PACKET_POOL
 */
 
+/* Defined, packet caches can be created in front of a packet pool. A packet cache is owned by
+   a single thread or driver context, and allocates and releases packets without disabling
+   interrupts. Packets are moved between the cache and the pool in batches. */
+/*
+#define NX_ENABLE_PACKET_CACHE
+*/
+
+/* Defined, packet pools of different payload sizes can be combined into a packet pool group.
+   Packets are allocated from the smallest pool that fits the requested length, falling back
+   to a larger pool when it is exhausted. A packet pool group assigned to an IP instance is
+   used for TCP control packets. */
+/*
+#define NX_ENABLE_PACKET_POOL_GROUP
+*/
+
+/* Defines the maximum number of packet pools in a packet pool group. The default value is 4. */
+/*
+#define NX_PACKET_POOL_GROUP_MAX_CLASSES 4
+*/
+
+/* Defined, application data can be appended to a packet chain without copying it, using
+   nx_packet_data_append_external. The packet references the application buffer and a notify
+   function is called when the packet is released, after the driver transmitted it and, for TCP,
+   after the data is acknowledged. Packet chain must be enabled. */
+/*
+#define NX_ENABLE_PACKET_EXTERNAL_BUFFER
+*/
+
+/* Defined, packets can be cloned with nx_packet_clone. The clone copies the headroom and the IP
+   and transport headers of the packet and shares the rest of the data through a reference
+   count. The internal loopback uses clones instead of copies. This option enables
+   NX_ENABLE_PACKET_EXTERNAL_BUFFER. Packet chain must be enabled. */
+/*
+#define NX_ENABLE_PACKET_CLONE
+*/
+
 /* Configuration options for Others */
 
 /* Defined, this option bypasses the basic NetX error checking. This define is typically used
@@ -730,6 +1065,12 @@
 #define NX_ENABLE_SOURCE_ADDRESS_CHECK
 */
 
+/* This define specifies the number of entries in the hash table of bound UDP sockets. The value
+   must be a power of two. The default value is 32.  */
+/*
+#define NX_UDP_PORT_TABLE_SIZE      32
+*/
+
 /* Defined, the extended notify support is enabled.  This feature adds additional callback/notify services
    to NetX Duo API for notifying the application of socket events, such as TCP connection and disconnect
    completion.  These extended notify functions are mainly used by the BSD wrapper. The default is this
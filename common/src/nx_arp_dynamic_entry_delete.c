@@ -59,6 +59,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_transmit_release           Release the transmitted packet*/
+/*    _nx_arp_entry_timer_cancel            Remove ARP entry from wheel   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -80,6 +81,11 @@ TX_INTERRUPT_SAVE_AREA
 NX_PACKET *packet_ptr, *next_packet_ptr;
 
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+    /* Remove the entry from the ARP timer wheel.  */
+    _nx_arp_entry_timer_cancel(arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
     /* Determine if this ARP entry is already active.  */
     if (arp_ptr -> nx_arp_active_list_head)
     {
@@ -118,6 +124,11 @@ NX_PACKET *packet_ptr, *next_packet_ptr;
         /* Decrease the number of active ARP entries.  */
         ip_ptr -> nx_ip_arp_dynamic_active_count--;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+        /* Invalidate the ARP entries in the route cache.  */
+        ip_ptr -> nx_ip_route_cache_arp_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
         /* Pickup the queued packets head pointer.  */
         next_packet_ptr =  arp_ptr -> nx_arp_packets_waiting;
 
@@ -65,6 +65,7 @@
 /*    _nx_arp_queue_send                    Send the queued packet        */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_arp_entry_timer_schedule          Schedule ARP entry update     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -120,7 +121,7 @@ ULONG         next_hop_address;
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
     /* Calculate the hash index for the specified IP address.  */
-    index =  (UINT)((ip_address + (ip_address >> 8)) & NX_ARP_TABLE_MASK);
+    index =  NX_ARP_TABLE_INDEX(ip_ptr, ip_address);
 
     /* Pickup the head pointer of the ARP entries for this IP instance.  */
     arp_list_head =  ip_ptr -> nx_ip_arp_table[index];
@@ -212,6 +213,11 @@ ULONG         next_hop_address;
            for possible ARP retries.  */
         arp_ptr -> nx_arp_entry_next_update =     NX_ARP_UPDATE_RATE;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+        /* Schedule the next update of the ARP entry.  */
+        _nx_arp_entry_timer_schedule(ip_ptr, arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
         /* The physical address was not specified so send an
            ARP request for the selected IP address.  */
         /*lint -e{668} suppress possibly passing a null pointer, since nx_interface is set in _nx_ip_route_find.  */
@@ -223,6 +229,11 @@ ULONG         next_hop_address;
         /* Update the next update time.  */
         arp_ptr -> nx_arp_entry_next_update = NX_ARP_EXPIRATION_RATE;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+        /* Schedule the next update of the ARP entry.  */
+        _nx_arp_entry_timer_schedule(ip_ptr, arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
         /* Call queue send function to send the packet queued up.  */
         _nx_arp_queue_send(ip_ptr, arp_ptr);
     }
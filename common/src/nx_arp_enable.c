@@ -126,6 +126,12 @@ NX_ARP *entry_ptr;
     ip_ptr -> nx_ip_arp_static_list =   NX_NULL;
     ip_ptr -> nx_ip_arp_dynamic_list =  (NX_ARP *)arp_cache_memory;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+    /* Clear the ARP timer wheel, the entries of a previous ARP cache are gone.  */
+    memset(ip_ptr -> nx_ip_arp_timer_wheel, 0, sizeof(ip_ptr -> nx_ip_arp_timer_wheel));
+    ip_ptr -> nx_ip_arp_timer_expired =  NX_NULL;
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
     /* Store the initial ARP cache information in the IP control block.  */
     ip_ptr -> nx_ip_arp_cache_memory  =  arp_cache_memory;
     ip_ptr -> nx_ip_arp_total_entries =  arp_entries;
@@ -90,6 +90,16 @@ UINT    status;
         /* Pickup pointer to last used dynamic ARP entry.  */
         arp_entry =  (ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous;
 
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_ARP_INFO)
+        /* Determine if the entry is still in use.  */
+        if (arp_entry -> nx_arp_active_list_head)
+        {
+
+            /* Yes, increment the ARP cache eviction count.  */
+            ip_ptr -> nx_ip_arp_cache_evictions++;
+        }
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_ARP_INFO */
+
         /* Remove from the dynamic list. */
         _nx_arp_dynamic_entry_delete(ip_ptr, arp_entry);
 
@@ -93,7 +93,7 @@ UINT    index;
        Search that linked list pointed in the IP ARP table.  */
 
     /* Calculate the hash index for the specified IP address.  */
-    index =  (UINT)((ip_address + (ip_address >> 8)) & NX_ARP_TABLE_MASK);
+    index =  NX_ARP_TABLE_INDEX(ip_ptr, ip_address);
 
     /* Pickup the head pointer of the ARP entries for this IP instance.  */
     arp_list_head =  ip_ptr -> nx_ip_arp_table[index];
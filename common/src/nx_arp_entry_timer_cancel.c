@@ -0,0 +1,109 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_timer_cancel                          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the ARP entry from the list it is on in the   */
+/*    ARP timer wheel, either a slot of the timer wheel or the expired    */
+/*    list.  Nothing is done if the entry is not in the timer wheel.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    arp_ptr                               Pointer to ARP entry          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_arp_dynamic_entry_delete          Delete dynamic ARP entry      */
+/*    _nx_arp_entry_timer_schedule          Schedule ARP entry update     */
+/*    _nx_arp_periodic_update               ARP periodic update           */
+/*                                            processing                  */
+/*    _nx_arp_static_entry_create           Create static ARP entry       */
+/*    _nx_arp_timer_wheel_advance           Advance the ARP timer wheel   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_timer_cancel(NX_ARP *arp_ptr)
+{
+
+    /* Determine if the entry is in the timer wheel.  */
+    if (arp_ptr -> nx_arp_timer_list == NX_NULL)
+    {
+
+        /* No, just return.  */
+        return;
+    }
+
+    /* Unlink the entry from the previous entry or the list head.  */
+    if (arp_ptr -> nx_arp_timer_previous)
+    {
+        (arp_ptr -> nx_arp_timer_previous) -> nx_arp_timer_next =  arp_ptr -> nx_arp_timer_next;
+    }
+    else
+    {
+        *(arp_ptr -> nx_arp_timer_list) =  arp_ptr -> nx_arp_timer_next;
+    }
+
+    /* Unlink the entry from the next entry.  */
+    if (arp_ptr -> nx_arp_timer_next)
+    {
+        (arp_ptr -> nx_arp_timer_next) -> nx_arp_timer_previous =  arp_ptr -> nx_arp_timer_previous;
+    }
+
+    /* Clear the links of the entry.  */
+    arp_ptr -> nx_arp_timer_next =      NX_NULL;
+    arp_ptr -> nx_arp_timer_previous =  NX_NULL;
+    arp_ptr -> nx_arp_timer_list =      NX_NULL;
+}
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_IPV4 */
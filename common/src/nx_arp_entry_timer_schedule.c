@@ -0,0 +1,114 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_timer_schedule                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the ARP entry in the slot of the ARP timer     */
+/*    wheel for the tick at which its next update is due, which is the    */
+/*    number of ticks in the next update field of the entry from now.     */
+/*    An entry that does not need updating is removed from the timer      */
+/*    wheel.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    arp_ptr                               Pointer to ARP entry          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_arp_entry_timer_cancel            Remove ARP entry from wheel   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_arp_dynamic_entry_set             Set dynamic ARP entry         */
+/*    _nx_arp_packet_receive                Process received ARP packet   */
+/*    _nx_arp_periodic_update               ARP periodic update           */
+/*                                            processing                  */
+/*    _nx_ip_driver_packet_send             Send an IP packet             */
+/*    _nxd_bsd_ipv4_packet_send             Send IPv4 packet for BSD      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_timer_schedule(NX_IP *ip_ptr, NX_ARP *arp_ptr)
+{
+
+ULONG    expiration;
+NX_ARP **list_ptr;
+
+
+    /* Remove the entry from its current slot.  */
+    _nx_arp_entry_timer_cancel(arp_ptr);
+
+    /* Determine if the entry needs updating.  */
+    if (arp_ptr -> nx_arp_entry_next_update == 0)
+    {
+
+        /* No, just return.  */
+        return;
+    }
+
+    /* Compute the tick at which the update is due.  */
+    expiration =  ip_ptr -> nx_ip_arp_timer_tick + arp_ptr -> nx_arp_entry_next_update;
+    arp_ptr -> nx_arp_timer_expiration =  expiration;
+
+    /* Link the entry to the front of the slot list.  An update due after more ticks
+       than the slots of the timer wheel stays in the slot until the tick is reached.  */
+    list_ptr =  &(ip_ptr -> nx_ip_arp_timer_wheel[expiration & (NX_ARP_TIMER_WHEEL_SIZE - 1)]);
+    arp_ptr -> nx_arp_timer_next =      *list_ptr;
+    arp_ptr -> nx_arp_timer_previous =  NX_NULL;
+    if (*list_ptr)
+    {
+        (*list_ptr) -> nx_arp_timer_previous =  arp_ptr;
+    }
+    *list_ptr =  arp_ptr;
+    arp_ptr -> nx_arp_timer_list =  list_ptr;
+}
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_IPV4 */
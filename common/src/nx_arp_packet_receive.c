@@ -63,6 +63,7 @@
 /*    (nx_ip_arp_allocate)                  ARP entry allocate call       */
 /*    (nx_ip_arp_gratuitous_response_handler) ARP gratuitous response     */
 /*    _nx_arp_queue_send                    Send the queued packet        */
+/*    _nx_arp_entry_timer_schedule          Schedule ARP entry update     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -402,7 +403,7 @@ NX_INTERFACE *interface_ptr;
        to see if there is a matching entry.  */
 
     /* Calculate the hash index for the sender IP address.  */
-    index =  (UINT)((sender_ip_address + (sender_ip_address >> 8)) & NX_ARP_TABLE_MASK);
+    index =  NX_ARP_TABLE_INDEX(ip_ptr, sender_ip_address);
 
     /* Pickup the first ARP entry.  */
     arp_ptr = NX_NULL;
@@ -411,7 +412,7 @@ NX_INTERFACE *interface_ptr;
     if (sender_ip_address != 0)
     {
         /* Calculate the hash index for the sender IP address.  */
-        index =  (UINT)((sender_ip_address + (sender_ip_address >> 8)) & NX_ROUTE_TABLE_MASK);
+        index =  NX_ARP_TABLE_INDEX(ip_ptr, sender_ip_address);
 
         /* Pickup the first ARP entry.  */
         arp_ptr =  ip_ptr -> nx_ip_arp_table[index];
@@ -466,6 +467,11 @@ NX_INTERFACE *interface_ptr;
                response.  */
             arp_ptr -> nx_arp_entry_next_update =  NX_ARP_EXPIRATION_RATE;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+            /* Schedule the next update of the ARP entry.  */
+            _nx_arp_entry_timer_schedule(ip_ptr, arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
             /* Reset the retry counter for this ARP entry.  */
             arp_ptr -> nx_arp_retries =  0;
 
@@ -505,7 +511,7 @@ NX_INTERFACE *interface_ptr;
     {
 
         /* Calculate the hash index for the sender IP address.  */
-        index =  (UINT)((sender_ip_address + (sender_ip_address >> 8)) & NX_ARP_TABLE_MASK);
+        index =  NX_ARP_TABLE_INDEX(ip_ptr, sender_ip_address);
 
         /* Allocate a new ARP entry in advance of the need to send to the IP
            address.  */
@@ -522,6 +528,11 @@ NX_INTERFACE *interface_ptr;
             arp_ptr -> nx_arp_entry_next_update =     NX_ARP_EXPIRATION_RATE;
             arp_ptr -> nx_arp_retries =               0;
             arp_ptr -> nx_arp_ip_interface         =  interface_ptr;
+
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+            /* Schedule the next update of the ARP entry.  */
+            _nx_arp_entry_timer_schedule(ip_ptr, arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
         }
     }
 #endif /* NX_DISABLE_ARP_AUTO_ENTRY */
@@ -46,6 +46,9 @@
 /*    through the dynamic ARP list to see if another ARP request needs to */
 /*    be sent.                                                            */
 /*                                                                        */
+/*    If NX_ENABLE_ARP_HASH_TABLE is defined, only the ARP entries whose  */
+/*    update is due at this tick of the ARP timer wheel are processed.    */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_ptr                                Pointer to IP instance        */
@@ -58,6 +61,9 @@
 /*                                                                        */
 /*    _nx_arp_packet_send                   Send periodic ARP request out */
 /*    _nx_packet_transmit_release           Release queued packet         */
+/*    _nx_arp_timer_wheel_advance           Advance the ARP timer wheel   */
+/*    _nx_arp_entry_timer_schedule          Schedule ARP entry update     */
+/*    _nx_arp_entry_timer_cancel            Remove ARP entry from wheel   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -83,12 +89,31 @@ NX_PACKET *packet_ptr;
 NX_PACKET *next_packet_ptr;
 
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+
+    /* Advance the ARP timer wheel, the ARP entries whose update is due at this tick
+       are moved to the expired list.  */
+    _nx_arp_timer_wheel_advance(ip_ptr);
+
+    /* Loop through the expired ARP entries.  */
+    while (ip_ptr -> nx_ip_arp_timer_expired)
+    {
+
+        /* Pickup the first expired ARP entry and remove it from the expired list.  */
+        arp_entry =  ip_ptr -> nx_ip_arp_timer_expired;
+        _nx_arp_entry_timer_cancel(arp_entry);
+
+        /* The update of this ARP entry is due now.  */
+        arp_entry -> nx_arp_entry_next_update =  1;
+#else
+
     /* Pickup pointer to ARP dynamic list.  */
     arp_entry =  ip_ptr -> nx_ip_arp_dynamic_list;
 
     /* Loop through the active ARP entries to see if they need updating.  */
     for (i = 0; i < ip_ptr -> nx_ip_arp_dynamic_active_count; i++)
     {
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
 
         /* Check this ARP entry to see if it need updating.  */
         if (arp_entry -> nx_arp_entry_next_update)
@@ -148,6 +173,11 @@ NX_PACKET *next_packet_ptr;
 
                         /* Clear the active head pointer.  */
                         arp_entry -> nx_arp_active_list_head =  NX_NULL;
+
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+                        /* Invalidate the ARP entries in the route cache.  */
+                        ip_ptr -> nx_ip_route_cache_arp_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
                     }
 
                     /* Determine if this is the only ARP entry on the dynamic list.  */
@@ -224,14 +254,22 @@ NX_PACKET *next_packet_ptr;
                     /* Setup the ARP update rate to the maximum value again.  */
                     arp_entry -> nx_arp_entry_next_update =  NX_ARP_UPDATE_RATE;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+                    /* Schedule the next update of the ARP entry.  */
+                    _nx_arp_entry_timer_schedule(ip_ptr, arp_entry);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
                     /* Send the ARP request out.  */
                     _nx_arp_packet_send(ip_ptr, arp_entry -> nx_arp_ip_address, arp_entry -> nx_arp_ip_interface);
                 }
             }
         }
 
+#ifndef NX_ENABLE_ARP_HASH_TABLE
+
         /* Move to the next ARP entry.  */
         arp_entry =  arp_entry -> nx_arp_pool_next;
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
     }
 
 
@@ -64,6 +64,7 @@
 /*    _nx_arp_queue_send                    Send the queued packet        */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_arp_entry_timer_cancel            Remove ARP entry from wheel   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -114,7 +115,7 @@ ULONG         next_hop_address;
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
     /* Calculate the hash index for the specified IP address.  */
-    index =  (UINT)((ip_address + (ip_address >> 8)) & NX_ARP_TABLE_MASK);
+    index =  NX_ARP_TABLE_INDEX(ip_ptr, ip_address);
 
     /* Pickup the head pointer of the ARP entries for this IP instance.  */
     arp_list_head =  ip_ptr -> nx_ip_arp_table[index];
@@ -248,6 +249,11 @@ ULONG         next_hop_address;
     /* Indicate the entry does not need updating.  */
     arp_ptr -> nx_arp_entry_next_update =  0;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+    /* Remove the entry from the ARP timer wheel.  */
+    _nx_arp_entry_timer_cancel(arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
     /* Place the important information in the ARP structure.  */
     arp_ptr -> nx_arp_route_static =          NX_TRUE;
     arp_ptr -> nx_arp_ip_address =            ip_address;
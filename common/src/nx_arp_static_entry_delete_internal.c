@@ -152,6 +152,11 @@ TX_INTERRUPT_SAVE_AREA
     arp_entry -> nx_arp_route_static =      NX_FALSE;
     arp_entry -> nx_arp_active_list_head =  NX_NULL;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the ARP entries in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_arp_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
     /* Place the ARP entry at the end of the dynamic ARP pool, which is where new
        ARP requests are allocated from.  */
 
@@ -0,0 +1,209 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_table_info_get                              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the occupancy of the ARP table of the       */
+/*    specified IP instance and the statistics of the ARP cache.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    table_size                            Destination for number of     */
+/*                                            table entries               */
+/*    table_entries                         Destination for number of ARP */
+/*                                            entries in the table        */
+/*    table_longest_chain                   Destination for number of ARP */
+/*                                            entries in the longest list */
+/*    cache_hits                            Destination for number of     */
+/*                                            packets sent to a resolved  */
+/*                                            ARP entry                   */
+/*    cache_misses                          Destination for number of     */
+/*                                            packets sent to an          */
+/*                                            unresolved ARP entry        */
+/*    cache_evictions                       Destination for number of ARP */
+/*                                            entries reused              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection             */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_arp_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_entries,
+                             ULONG *table_longest_chain, ULONG *cache_hits,
+                             ULONG *cache_misses, ULONG *cache_evictions)
+{
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+ULONG   i;
+ULONG   chain;
+ULONG   entries;
+ULONG   longest_chain;
+NX_ARP *arp_ptr;
+
+
+    /* Obtain the IP mutex so we can examine the table.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Initialize the counters.  */
+    entries =        0;
+    longest_chain =  0;
+
+    /* Loop through the lists of the table.  */
+    for (i = 0; i <= ip_ptr -> nx_ip_arp_table_mask; i++)
+    {
+
+        /* Pickup the head of the list.  */
+        arp_ptr =  ip_ptr -> nx_ip_arp_table[i];
+
+        /* Determine if the list is used.  */
+        if (arp_ptr)
+        {
+
+            /* Count the entries on this list.  */
+            chain =  0;
+            do
+            {
+                chain++;
+                arp_ptr =  arp_ptr -> nx_arp_active_next;
+            } while (arp_ptr != ip_ptr -> nx_ip_arp_table[i]);
+
+            /* Update the counters.  */
+            entries =  entries + chain;
+            if (chain > longest_chain)
+            {
+                longest_chain =  chain;
+            }
+        }
+    }
+
+    /* Determine if table size is wanted.  */
+    if (table_size)
+    {
+
+        /* Return the number of table entries.  */
+        *table_size =  ip_ptr -> nx_ip_arp_table_mask + 1;
+    }
+
+    /* Determine if table entries is wanted.  */
+    if (table_entries)
+    {
+
+        /* Return the number of ARP entries in the table.  */
+        *table_entries =  entries;
+    }
+
+    /* Determine if table longest chain is wanted.  */
+    if (table_longest_chain)
+    {
+
+        /* Return the number of ARP entries in the longest list.  */
+        *table_longest_chain =  longest_chain;
+    }
+
+    /* Determine if cache hits is wanted.  */
+    if (cache_hits)
+    {
+
+        /* Return the number of packets sent to a resolved ARP entry.  */
+#ifndef NX_DISABLE_ARP_INFO
+        *cache_hits =  ip_ptr -> nx_ip_arp_cache_hits;
+#else
+        *cache_hits =  0;
+#endif
+    }
+
+    /* Determine if cache misses is wanted.  */
+    if (cache_misses)
+    {
+
+        /* Return the number of packets sent to an unresolved ARP entry.  */
+#ifndef NX_DISABLE_ARP_INFO
+        *cache_misses =  ip_ptr -> nx_ip_arp_cache_misses;
+#else
+        *cache_misses =  0;
+#endif
+    }
+
+    /* Determine if cache evictions is wanted.  */
+    if (cache_evictions)
+    {
+
+        /* Return the number of ARP entries reused.  */
+#ifndef NX_DISABLE_ARP_INFO
+        *cache_evictions =  ip_ptr -> nx_ip_arp_cache_evictions;
+#else
+        *cache_evictions =  0;
+#endif
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_ARP_HASH_TABLE || NX_DISABLE_IPV4 */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(table_size);
+    NX_PARAMETER_NOT_USED(table_entries);
+    NX_PARAMETER_NOT_USED(table_longest_chain);
+    NX_PARAMETER_NOT_USED(cache_hits);
+    NX_PARAMETER_NOT_USED(cache_misses);
+    NX_PARAMETER_NOT_USED(cache_evictions);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_IPV4 */
+}
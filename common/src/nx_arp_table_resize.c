@@ -0,0 +1,195 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_table_resize                                PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function moves the ARP table of the IP instance to the         */
+/*    supplied memory.  The number of entries of the table is the         */
+/*    largest power of two that fits in the memory.  The active ARP       */
+/*    entries are moved to the lists of the new table.  If the table      */
+/*    memory is NX_NULL, the table built into the IP instance is used     */
+/*    again.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    table_memory                          Pointer to table memory       */
+/*    table_size                            Size of table memory in bytes */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection             */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_arp_table_resize(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size)
+{
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+ULONG    i;
+ULONG    entries;
+ULONG    previous_mask;
+NX_ARP **previous_table;
+NX_ARP **list_ptr;
+NX_ARP  *arp_ptr;
+
+
+    /* Determine if the built-in table is used again.  */
+    if (table_memory == NX_NULL)
+    {
+
+        /* Yes, use the built-in table.  */
+        table_memory =  ip_ptr -> nx_ip_arp_table_default;
+        entries =       NX_ARP_TABLE_SIZE;
+    }
+    else
+    {
+
+        /* Determine how many entries fit in the table memory.  The number of entries
+           must be a power of two, so subtracting one gives us the mask.  */
+        entries =  1;
+        while ((entries << 1) <= (table_size / sizeof(NX_ARP *)))
+        {
+            entries =  entries << 1;
+        }
+    }
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_ARP_TABLE_RESIZE, ip_ptr, table_memory, table_size, entries, NX_TRACE_ARP_EVENTS, 0, 0);
+
+    /* Obtain the IP mutex so we can move the ARP entries.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Determine if the table is already in use.  */
+    if ((NX_ARP **)table_memory == ip_ptr -> nx_ip_arp_table)
+    {
+
+        /* Release protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Nothing to move, return successful completion.  */
+        return(NX_SUCCESS);
+    }
+
+    /* Save the previous table.  */
+    previous_table =  ip_ptr -> nx_ip_arp_table;
+    previous_mask =   ip_ptr -> nx_ip_arp_table_mask;
+
+    /* Clear the new table and setup it in the IP instance.  */
+    memset(table_memory, 0, entries * sizeof(NX_ARP *));
+    ip_ptr -> nx_ip_arp_table =       (NX_ARP **)table_memory;
+    ip_ptr -> nx_ip_arp_table_mask =  entries - 1;
+
+    /* Loop through the lists of the previous table.  */
+    for (i = 0; i <= previous_mask; i++)
+    {
+
+        /* Move the entries of this list to the new table.  */
+        while (previous_table[i])
+        {
+
+            /* Pickup the first entry of the list.  */
+            arp_ptr =  previous_table[i];
+
+            /* Remove the entry from the list.  */
+            if (arp_ptr == arp_ptr -> nx_arp_active_next)
+            {
+
+                /* This is the only entry on the list.  */
+                previous_table[i] =  NX_NULL;
+            }
+            else
+            {
+
+                /* Update the list head pointer and the links of the adjacent entries.  */
+                previous_table[i] =  arp_ptr -> nx_arp_active_next;
+                (arp_ptr -> nx_arp_active_next) -> nx_arp_active_previous =  arp_ptr -> nx_arp_active_previous;
+                (arp_ptr -> nx_arp_active_previous) -> nx_arp_active_next =  arp_ptr -> nx_arp_active_next;
+            }
+
+            /* Pickup the list of the new table.  */
+            list_ptr =  &(ip_ptr -> nx_ip_arp_table[NX_ARP_TABLE_INDEX(ip_ptr, arp_ptr -> nx_arp_ip_address)]);
+
+            /* Add the entry to the end of the list, so the order of the entries is kept.  */
+            if (*list_ptr)
+            {
+                arp_ptr -> nx_arp_active_next =      *list_ptr;
+                arp_ptr -> nx_arp_active_previous =  (*list_ptr) -> nx_arp_active_previous;
+                (arp_ptr -> nx_arp_active_previous) -> nx_arp_active_next =  arp_ptr;
+                (*list_ptr) -> nx_arp_active_previous =  arp_ptr;
+            }
+            else
+            {
+                arp_ptr -> nx_arp_active_next =      arp_ptr;
+                arp_ptr -> nx_arp_active_previous =  arp_ptr;
+                *list_ptr =  arp_ptr;
+            }
+            arp_ptr -> nx_arp_active_list_head =  list_ptr;
+        }
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_ARP_HASH_TABLE || NX_DISABLE_IPV4 */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(table_memory);
+    NX_PARAMETER_NOT_USED(table_size);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_IPV4 */
+}
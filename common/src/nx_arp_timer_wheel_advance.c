@@ -0,0 +1,118 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_timer_wheel_advance                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function advances the ARP timer wheel by one tick.  The ARP    */
+/*    entries of the slot of the new tick whose update is due at this     */
+/*    tick are moved to the expired list, for the ARP periodic update to  */
+/*    process.  The other entries of the slot are due at a later turn of  */
+/*    the timer wheel.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_arp_entry_timer_cancel            Remove ARP entry from wheel   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_arp_periodic_update               ARP periodic update           */
+/*                                            processing                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_timer_wheel_advance(NX_IP *ip_ptr)
+{
+
+ULONG   tick;
+NX_ARP *arp_ptr;
+NX_ARP *next_ptr;
+
+
+    /* Advance the timer wheel.  */
+    ip_ptr -> nx_ip_arp_timer_tick++;
+    tick =  ip_ptr -> nx_ip_arp_timer_tick;
+
+    /* Pickup the first entry of the slot.  */
+    arp_ptr =  ip_ptr -> nx_ip_arp_timer_wheel[tick & (NX_ARP_TIMER_WHEEL_SIZE - 1)];
+
+    /* Loop through the entries of the slot.  */
+    while (arp_ptr)
+    {
+
+        /* Pickup the next entry.  */
+        next_ptr =  arp_ptr -> nx_arp_timer_next;
+
+        /* Determine if the update of the entry is due at this tick.  */
+        if (arp_ptr -> nx_arp_timer_expiration == tick)
+        {
+
+            /* Yes, remove the entry from the slot.  */
+            _nx_arp_entry_timer_cancel(arp_ptr);
+
+            /* Link the entry to the front of the expired list.  */
+            arp_ptr -> nx_arp_timer_next =  ip_ptr -> nx_ip_arp_timer_expired;
+            if (ip_ptr -> nx_ip_arp_timer_expired)
+            {
+                (ip_ptr -> nx_ip_arp_timer_expired) -> nx_arp_timer_previous =  arp_ptr;
+            }
+            ip_ptr -> nx_ip_arp_timer_expired =  arp_ptr;
+            arp_ptr -> nx_arp_timer_list =  &(ip_ptr -> nx_ip_arp_timer_expired);
+        }
+
+        /* Move to the next entry.  */
+        arp_ptr =  next_ptr;
+    }
+}
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_IPV4 */
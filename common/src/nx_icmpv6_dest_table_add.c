@@ -74,6 +74,8 @@
 /*    memset                               Clear memory block             */
 /*    _nx_nd_cache_find_entry              Find next hop in the ND cache  */
 /*    _nx_nd_cache_add_entry               Create an entry in ND cache    */
+/*    _nx_icmpv6_dest_table_hash_insert    Link entry to hash bucket      */
+/*    _nx_icmpv6_dest_table_hash_remove    Remove entry from hash bucket  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -164,6 +166,11 @@ UINT status;
        matching entry, so we handle it separately.
      */
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* Remove the slot from the hash bucket of its previous destination. */
+    _nx_icmpv6_dest_table_hash_remove(ip_ptr, &ip_ptr -> nx_ipv6_destination_table[i]);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
     /* Clear out any previous data from this slot. */
     /*lint -e{669} -e{826} suppress cast of pointer to pointer, since it is necessary  */
     memset(&ip_ptr -> nx_ipv6_destination_table[i], 0, sizeof(NX_IPV6_DESTINATION_ENTRY));
@@ -171,6 +178,11 @@ UINT status;
     /* Fill in the newly created table entry with the supplied and/or default information. */
     COPY_IPV6_ADDRESS(destination_address, ip_ptr -> nx_ipv6_destination_table[i].nx_ipv6_destination_entry_destination_address);
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* Link the entry to the hash bucket of the destination. */
+    _nx_icmpv6_dest_table_hash_insert(ip_ptr, &ip_ptr -> nx_ipv6_destination_table[i]);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
     /* Add next hop information to the entry. */
     COPY_IPV6_ADDRESS(next_hop, ip_ptr -> nx_ipv6_destination_table[i].nx_ipv6_destination_entry_next_hop);
 
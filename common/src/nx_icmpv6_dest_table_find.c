@@ -85,7 +85,10 @@ UINT _nx_icmpv6_dest_table_find(NX_IP *ip_ptr, ULONG *destination_address, NX_IP
                                 ULONG path_mtu, ULONG mtu_timeout)
 {
 
-UINT i, table_size;
+UINT                       i, table_size;
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+NX_IPV6_DESTINATION_ENTRY *entry;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 
     /* Destination address must be valid. */
     NX_ASSERT((destination_address != NX_NULL) && (dest_entry_ptr != NULL));
@@ -102,8 +105,41 @@ UINT i, table_size;
     /* Initialize the return value. */
     *dest_entry_ptr = NX_NULL;
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+    /* Search the hash bucket of the destination address. */
+    entry = ip_ptr -> nx_ipv6_destination_hash[NX_IPV6_ADDRESS_HASH_INDEX(destination_address, NX_IPV6_DESTINATION_TABLE_HASH_SIZE)];
+    while (entry)
+    {
+
+        /* Is this a valid entry of the address? */
+        if ((entry -> nx_ipv6_destination_entry_valid) &&
+            (CHECK_IPV6_ADDRESSES_SAME(&entry -> nx_ipv6_destination_entry_destination_address[0], destination_address)))
+        {
+            break;
+        }
+
+        entry = entry -> nx_ipv6_destination_entry_hash_next;
+    }
+
+    /* Start the loop below at the entry found, which it matches on the first pass,
+       or skip the loop if there is no entry of the address. */
+    if (entry)
+    {
+        i = (UINT)(entry - ip_ptr -> nx_ipv6_destination_table);
+    }
+    else
+    {
+        table_size = 0;
+    }
+#else
+
+    /* Start at the first entry. */
+    i = 0;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
     /* Loop through all entries. */
-    for (i = 0; table_size && (i < NX_IPV6_DESTINATION_TABLE_SIZE); i++)
+    for (; table_size && (i < NX_IPV6_DESTINATION_TABLE_SIZE); i++)
     {
 
         /* Skip invalid entries. */
@@ -0,0 +1,89 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Control Message Protocol (ICMP)                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#include "nx_icmpv6.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IPV6_ND_HASH_TABLE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_icmpv6_dest_table_hash_insert                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function links the destination table entry to the front of     */
+/*    the hash bucket of its destination address.  The entry must not be  */
+/*    in a hash bucket.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    dest_entry_ptr                        Pointer to destination entry  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_icmpv6_dest_table_add             Add destination table entry   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_icmpv6_dest_table_hash_insert(NX_IP *ip_ptr, NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr)
+{
+
+UINT index;
+
+
+    /* Compute the hash bucket of the destination address.  */
+    index = NX_IPV6_ADDRESS_HASH_INDEX(dest_entry_ptr -> nx_ipv6_destination_entry_destination_address,
+                                       NX_IPV6_DESTINATION_TABLE_HASH_SIZE);
+
+    /* Link the entry to the front of the bucket.  */
+    dest_entry_ptr -> nx_ipv6_destination_entry_hash_index = index;
+    dest_entry_ptr -> nx_ipv6_destination_entry_hash_next = ip_ptr -> nx_ipv6_destination_hash[index];
+    ip_ptr -> nx_ipv6_destination_hash[index] = dest_entry_ptr;
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IPV6_ND_HASH_TABLE */
@@ -0,0 +1,103 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Control Message Protocol (ICMP)                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#include "nx_icmpv6.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IPV6_ND_HASH_TABLE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_icmpv6_dest_table_hash_remove                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the destination table entry from the hash     */
+/*    bucket it was linked to.  Nothing is done if the entry is not in    */
+/*    the bucket.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    dest_entry_ptr                        Pointer to destination entry  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_icmpv6_dest_table_add             Add destination table entry   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_icmpv6_dest_table_hash_remove(NX_IP *ip_ptr, NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr)
+{
+
+NX_IPV6_DESTINATION_ENTRY **link_ptr;
+
+
+    /* Start at the head of the bucket the entry was linked to.  */
+    link_ptr = &(ip_ptr -> nx_ipv6_destination_hash[dest_entry_ptr -> nx_ipv6_destination_entry_hash_index]);
+
+    /* Search the bucket for the entry.  */
+    while (*link_ptr)
+    {
+
+        /* Is this the entry?  */
+        if (*link_ptr == dest_entry_ptr)
+        {
+
+            /* Yes, unlink it from the bucket.  */
+            *link_ptr = dest_entry_ptr -> nx_ipv6_destination_entry_hash_next;
+            break;
+        }
+
+        /* Move to the next entry of the bucket.  */
+        link_ptr = &((*link_ptr) -> nx_ipv6_destination_entry_hash_next);
+    }
+
+    /* Clear the link of the entry.  */
+    dest_entry_ptr -> nx_ipv6_destination_entry_hash_next = NX_NULL;
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IPV6_ND_HASH_TABLE */
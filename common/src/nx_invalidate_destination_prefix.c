@@ -0,0 +1,111 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Control Message Protocol (ICMP)                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_ipv6.h"
+#include "nx_icmpv6.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_invalidate_destination_prefix                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function invalidates all destination entries whose             */
+/*    destination address matches the supplied prefix, regardless of the  */
+/*    next hop.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP                 */
+/*    prefix                                Prefix in host byte order     */
+/*    prefix_length                         Length of the prefix          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_common_length       Compare address with prefix   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_ipv6_static_route_add            Add IPv6 static route         */
+/*    _nxd_ipv6_static_route_delete         Delete IPv6 static route      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_invalidate_destination_prefix(NX_IP *ip_ptr, ULONG *prefix, ULONG prefix_length)
+{
+
+UINT i, table_size;
+
+    /* Set a local variable for convenience. */
+    table_size = ip_ptr -> nx_ipv6_destination_table_size;
+
+    /* Loop through the whole table to match the destination address. */
+    for (i = 0; table_size && (i < NX_IPV6_DESTINATION_TABLE_SIZE); i++)
+    {
+
+        /* Skip over empty slots. */
+        if (!ip_ptr -> nx_ipv6_destination_table[i].nx_ipv6_destination_entry_valid)
+        {
+            continue;
+        }
+
+        /* Keep track of valid entries we have checked. */
+        table_size--;
+
+        /* Match the destination of the table entry with the prefix. */
+        if (_nx_ip_route_trie_common_length(ip_ptr -> nx_ipv6_destination_table[i].nx_ipv6_destination_entry_destination_address,
+                                            prefix, prefix_length) == prefix_length)
+        {
+
+            /* A matching entry is found.  Mark the entry as invalid. */
+            ip_ptr -> nx_ipv6_destination_table[i].nx_ipv6_destination_entry_valid = 0;
+
+            /* Decrease the count of available destinations. */
+            ip_ptr -> nx_ipv6_destination_table_size--;
+        }
+    }
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
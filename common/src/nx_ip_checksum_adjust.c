@@ -0,0 +1,98 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol Checksum Computation                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_checksum_adjust                              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates a checksum for the change of a 16-bit field,  */
+/*    according to RFC1624 page 2, Eqn. 3, without computing the          */
+/*    checksum of the whole data again. The checksum and the field        */
+/*    values must be in the same byte order.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    checksum                              Old checksum                  */
+/*    old_value                             Old value of the field        */
+/*    new_value                             New value of the field        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    checksum                              Updated checksum              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_forward_packet_process         Forward IP packet             */
+/*    NetX Duo internal routines                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+USHORT  _nx_ip_checksum_adjust(USHORT checksum, USHORT old_value, USHORT new_value)
+{
+
+ULONG sum;
+
+
+    /* Update the checksum, according to the RFC1624 page2, Eqn.3.
+       HC  - old checksum in header
+       HC' - new checksum in header
+       m   - old value of a 16-bit field
+       m'  - new value of a 16-bit field
+       HC' = ~(C + (-m) + m')
+           = ~(~HC + ~m + m') */
+    sum = ((~(ULONG)checksum) & NX_LOWER_16_MASK) + ((~(ULONG)old_value) & NX_LOWER_16_MASK) + new_value;
+
+    /* Fold a 4-byte value into a two byte value */
+    sum = (sum >> NX_SHIFT_BY_16) + (sum & NX_LOWER_16_MASK);
+
+    /* Do it again in case previous operation generates an overflow */
+    sum = (sum >> NX_SHIFT_BY_16) + (sum & NX_LOWER_16_MASK);
+
+    /* Return the new checksum.  */
+    return((USHORT)(~sum));
+}
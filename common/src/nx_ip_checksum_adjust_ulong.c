@@ -0,0 +1,93 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol Checksum Computation                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_checksum_adjust_ulong                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates a checksum for the change of a 32-bit field,  */
+/*    such as an IPv4 address, according to RFC1624 page 2, Eqn. 3. The   */
+/*    field is handled as two 16-bit fields. The checksum and the field   */
+/*    values must be in the same byte order.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    checksum                              Old checksum                  */
+/*    old_value                             Old value of the field        */
+/*    new_value                             New value of the field        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    checksum                              Updated checksum              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    NetX Duo internal routines                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+USHORT  _nx_ip_checksum_adjust_ulong(USHORT checksum, ULONG old_value, ULONG new_value)
+{
+
+ULONG sum;
+
+
+    /* HC' = ~(~HC + ~m + m') for both halves of the field.  */
+    sum = ((~(ULONG)checksum) & NX_LOWER_16_MASK) +
+          ((~old_value) >> NX_SHIFT_BY_16) + ((~old_value) & NX_LOWER_16_MASK) +
+          (new_value >> NX_SHIFT_BY_16) + (new_value & NX_LOWER_16_MASK);
+
+    /* Fold a 4-byte value into a two byte value */
+    sum = (sum >> NX_SHIFT_BY_16) + (sum & NX_LOWER_16_MASK);
+
+    /* Do it again in case previous operation generates an overflow */
+    sum = (sum >> NX_SHIFT_BY_16) + (sum & NX_LOWER_16_MASK);
+
+    /* Return the new checksum.  */
+    return((USHORT)(~sum));
+}
@@ -62,7 +62,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_ip_checksum_words                 Sum words of the data         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -83,6 +83,8 @@ USHORT  _nx_ip_checksum_compute(NX_PACKET *packet_ptr, ULONG protocol,
 {
 
 ULONG      checksum = 0;
+ULONG64    words_checksum;
+ULONG      word_count;
 USHORT     tmp;
 USHORT    *short_ptr;
 ULONG     *long_ptr;
@@ -200,14 +202,18 @@ UINT       i;
             /*lint -e{923} suppress cast of pointer to ULONG.  */
             data_length -= (UINT)(((end_ptr + 3) & (ALIGN_TYPE)(~3llu)) - (ALIGN_TYPE)long_ptr);
 
-            /* Loop to calculate the packet's checksum.  */
-            /*lint -e{946} suppress pointer subtraction, since it is necessary. */
-            while ((ALIGN_TYPE)long_ptr < end_ptr)
-            {
-                checksum += (*long_ptr & NX_LOWER_16_MASK);
-                checksum += (*long_ptr >> NX_SHIFT_BY_16);
-                long_ptr++;
-            }
+            /* Calculate the number of 32-bit words to sum.  */
+            /*lint -e{923} suppress cast of pointer to ULONG.  */
+            word_count = (ULONG)((end_ptr - (ALIGN_TYPE)long_ptr + 3) >> 2);
+
+            /* Sum the words in a 64-bit accumulator, using the vectorized routine of the port if there is one.  */
+            words_checksum = NX_CHECKSUM_WORDS(long_ptr, word_count);
+            long_ptr += word_count;
+
+            /* Fold the 64-bit value into a 32-bit value twice, then into a 16-bit value.  */
+            words_checksum = (words_checksum >> 32) + (words_checksum & 0xFFFFFFFF);
+            words_checksum = (words_checksum >> 32) + (words_checksum & 0xFFFFFFFF);
+            checksum += (ULONG)((words_checksum >> NX_SHIFT_BY_16) + (words_checksum & NX_LOWER_16_MASK));
         }
 #ifndef NX_DISABLE_PACKET_CHAIN
 
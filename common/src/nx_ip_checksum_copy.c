@@ -0,0 +1,168 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol Checksum Computation                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_checksum_copy                                PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies the supplied data and computes the one's       */
+/*    complement sum of the data in the same pass. The data is summed as  */
+/*    16-bit words in host memory order, starting at an even offset of    */
+/*    the checksummed stream. A trailing odd byte is padded with zero.    */
+/*    The returned value is folded to 16 bits but not complemented, so    */
+/*    that it can be added to the sum of other parts of the same packet.  */
+/*    A part starting at an odd offset must be byte swapped by the        */
+/*    caller before it is added.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    destination_ptr                       Pointer to destination buffer */
+/*    source_ptr                            Pointer to source data        */
+/*    length                                Number of bytes to copy       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    checksum                              One's complement sum of data  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_data_append_checksum       Append data and sum it        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_checksum_copy(UCHAR *destination_ptr, UCHAR *source_ptr, UINT length)
+{
+
+ULONG64 checksum = 0;
+ULONG   word;
+USHORT  short_value;
+
+
+    /* Determine if both buffers are four bytes aligned.  */
+    /*lint -e{923} suppress cast of pointer to ULONG.  */
+    if ((((ALIGN_TYPE)destination_ptr | (ALIGN_TYPE)source_ptr) & 3) == 0)
+    {
+
+        /* Yes, copy and sum four words at a time in a 64-bit accumulator.  */
+        while (length >= 16)
+        {
+
+            /*lint --e{927} --e{826} suppress cast of pointer to pointer, since it is necessary  */
+            word =  ((ULONG *)source_ptr)[0];
+            ((ULONG *)destination_ptr)[0] =  word;
+            checksum += word;
+            word =  ((ULONG *)source_ptr)[1];
+            ((ULONG *)destination_ptr)[1] =  word;
+            checksum += word;
+            word =  ((ULONG *)source_ptr)[2];
+            ((ULONG *)destination_ptr)[2] =  word;
+            checksum += word;
+            word =  ((ULONG *)source_ptr)[3];
+            ((ULONG *)destination_ptr)[3] =  word;
+            checksum += word;
+
+            source_ptr += 16;
+            destination_ptr += 16;
+            length -= 16;
+        }
+
+        /* Copy and sum the remaining words.  */
+        while (length >= 4)
+        {
+
+            /*lint --e{927} --e{826} suppress cast of pointer to pointer, since it is necessary  */
+            word =  *((ULONG *)source_ptr);
+            *((ULONG *)destination_ptr) =  word;
+            checksum += word;
+
+            source_ptr += 4;
+            destination_ptr += 4;
+            length -= 4;
+        }
+    }
+
+    /* Copy and sum the rest of the data two bytes at a time.  The bytes are
+       assembled in memory order so that unaligned buffers are summed the same way.  */
+    while (length >= 2)
+    {
+
+        /*lint -e{928} suppress cast from pointer to pointer, since it is necessary  */
+        ((UCHAR *)&short_value)[0] =  source_ptr[0];
+        ((UCHAR *)&short_value)[1] =  source_ptr[1];
+        destination_ptr[0] =  source_ptr[0];
+        destination_ptr[1] =  source_ptr[1];
+        checksum += short_value;
+
+        source_ptr += 2;
+        destination_ptr += 2;
+        length -= 2;
+    }
+
+    /* Determine if there is one byte left.  */
+    if (length)
+    {
+
+        /* Pad the last byte with zero.  */
+        short_value =  0;
+        /*lint -e{928} suppress cast from pointer to pointer, since it is necessary  */
+        ((UCHAR *)&short_value)[0] =  *source_ptr;
+        *destination_ptr =  *source_ptr;
+        checksum += short_value;
+    }
+
+    /* Fold the 64-bit value into a 32-bit value twice.  */
+    checksum = (checksum >> 32) + (checksum & 0xFFFFFFFF);
+    checksum = (checksum >> 32) + (checksum & 0xFFFFFFFF);
+
+    /* Fold the 32-bit value into a 16-bit value twice.  */
+    checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
+    checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
+
+    /* Return the one's complement sum.  */
+    return((ULONG)checksum);
+}
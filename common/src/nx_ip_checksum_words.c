@@ -0,0 +1,103 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol Checksum Computation                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_checksum_words                               PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the sum of an array of 32-bit words in a      */
+/*    64-bit accumulator.  It is the portable default of                  */
+/*    NX_CHECKSUM_WORDS, which ports may replace with a vectorized        */
+/*    routine.  The caller folds the sum into the 16-bit checksum.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    long_ptr                              Pointer to the words          */
+/*    word_count                            Number of words to sum        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    words_checksum                        Unfolded sum of the words     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_checksum_compute               Compute checksum              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG64 _nx_ip_checksum_words(ULONG *long_ptr, ULONG word_count)
+{
+
+ULONG64 words_checksum = 0;
+
+
+    /* Sum the words in a 64-bit accumulator, so that no carry needs to be handled per word.
+       The one's complement sum is the same as summing the two 16-bit halves of each word.  */
+
+    /* Loop to calculate the sum, four words at a time.  */
+    while (word_count >= 4)
+    {
+        words_checksum += long_ptr[0];
+        words_checksum += long_ptr[1];
+        words_checksum += long_ptr[2];
+        words_checksum += long_ptr[3];
+        long_ptr += 4;
+        word_count -= 4;
+    }
+
+    /* Sum the remaining words.  */
+    while (word_count)
+    {
+        words_checksum += *long_ptr;
+        long_ptr++;
+        word_count--;
+    }
+
+    /* Return the unfolded sum.  */
+    return(words_checksum);
+}
@@ -210,6 +210,17 @@ TX_THREAD *current_thread;
     ip_ptr -> nx_ip_auxiliary_packet_pool = default_pool;
 #endif /* NX_ENABLE_DUAL_PACKET_POOL */
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* The nodes built into the IP instance hold the first static routes.  */
+    ip_ptr -> nx_ip_route_trie_capacity =  NX_IP_ROUTING_TABLE_SIZE;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+    /* The ARP table built into the IP instance is used until it is resized.  */
+    ip_ptr -> nx_ip_arp_table =       ip_ptr -> nx_ip_arp_table_default;
+    ip_ptr -> nx_ip_arp_table_mask =  NX_ARP_TABLE_MASK;
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_IPV4 */
+
     /* Create the internal IP protection mutex.  */
     tx_mutex_create(&(ip_ptr -> nx_ip_protection), name, TX_NO_INHERIT);
 
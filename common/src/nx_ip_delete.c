@@ -246,6 +246,18 @@ NX_PACKET   *igmp_queue_head;
         ip_ptr -> nx_ip_fast_periodic_timer_created = 0;
     }
 
+#ifdef NX_ENABLE_TCP_PACING
+    /* Determine if the TCP pacing timer has been created.  */
+    if (ip_ptr -> nx_ip_tcp_pacing_timer_created)
+    {
+
+        /* Yes. Deactivate and delete the TCP pacing timer.  */
+        tx_timer_deactivate(&(ip_ptr -> nx_ip_tcp_pacing_timer));
+        tx_timer_delete(&(ip_ptr -> nx_ip_tcp_pacing_timer));
+        ip_ptr -> nx_ip_tcp_pacing_timer_created = 0;
+    }
+#endif /* NX_ENABLE_TCP_PACING */
+
     /* Terminate the internal IP thread.  */
     tx_thread_terminate(&(ip_ptr -> nx_ip_thread));
 
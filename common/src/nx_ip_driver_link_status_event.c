@@ -78,6 +78,11 @@ TX_INTERRUPT_SAVE_AREA
     /* Mark link status changed. */
     ip_ptr -> nx_ip_interface[interface_index].nx_interface_link_status_change = NX_TRUE;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache, another interface may be used now.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
     /* Wakeup IP helper thread to process the link status event.  */
     tx_event_flags_set(&(ip_ptr -> nx_ip_events), NX_IP_LINK_STATUS_EVENT, TX_OR);
 
@@ -28,6 +28,7 @@
 #include "nx_api.h"
 #include "nx_ip.h"
 #include "nx_packet.h"
+#include "nx_arp.h"
 
 #ifndef NX_DISABLE_IPV4
 /**************************************************************************/
@@ -62,10 +63,13 @@
 /*    (_nx_arp_packet_send)                 Send an ARP packet            */
 /*    _nx_ip_packet_deferred_receive        Receive loopback packet       */
 /*    _nx_packet_copy                       Copy packet to input packet   */
+/*    _nx_packet_clone                      Clone packet to input packet  */
 /*    _nx_packet_transmit_release           Release transmit packet       */
 /*    (nx_ip_fragment_processing)           Fragment processing           */
 /*    (ip_link_driver)                      User supplied link driver     */
 /*    _nx_ip_packet_checksum_compute        Compute checksum              */
+/*    _nx_ip_route_cache_arp_find           Find ARP entry of next hop    */
+/*    _nx_arp_entry_timer_schedule          Schedule ARP entry update     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -175,12 +179,19 @@ UINT         queued_count;
             NX_PARAMETER_NOT_USED(fragment);
             /* Look into the ARP Routing Table to derive the physical address.  */
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+
+            /* Find the ARP entry of the next hop, through the route cache entry of the destination.  */
+            arp_ptr =  _nx_ip_route_cache_arp_find(ip_ptr, destination_ip, next_hop_address);
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
             /* If we get here, the packet destination is a unicast address.  */
             destination_ip = next_hop_address;
 
             /* Calculate the hash index for the destination IP address.  */
-            index =  (UINT)((destination_ip + (destination_ip >> 8)) & NX_ARP_TABLE_MASK);
+            index =  NX_ARP_TABLE_INDEX(ip_ptr, destination_ip);
 
+#ifndef NX_ENABLE_IP_ROUTE_CACHE
             /* Determine if there is an entry for this IP address.  */
             arp_ptr =  ip_ptr -> nx_ip_arp_table[index];
 
@@ -207,6 +218,7 @@ UINT         queued_count;
                     break;
                 }
             }
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
 
             /* Determine if we actually found a matching and effective ARP entry.  */
             if ((arp_ptr) && (arp_ptr -> nx_arp_physical_address_msw | arp_ptr -> nx_arp_physical_address_lsw))
@@ -225,12 +237,27 @@ UINT         queued_count;
 
                 /* Restore interrupts.  */
                 TX_RESTORE
+
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_ARP_INFO)
+                /* Increment the ARP cache hit count.  */
+                ip_ptr -> nx_ip_arp_cache_hits++;
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_ARP_INFO */
             }
             else
             {
 
+#if defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_ARP_INFO)
+                /* Increment the ARP cache miss count.  */
+                ip_ptr -> nx_ip_arp_cache_misses++;
+#endif /* NX_ENABLE_ARP_HASH_TABLE && !NX_DISABLE_ARP_INFO */
+
                 /* Determine if fragmentation is needed before queue the packet on the ARP waiting queue.  */
-                if (packet_ptr -> nx_packet_length > packet_ptr -> nx_packet_address.nx_packet_interface_ptr -> nx_interface_ip_mtu_size)
+                if ((packet_ptr -> nx_packet_length > packet_ptr -> nx_packet_address.nx_packet_interface_ptr -> nx_interface_ip_mtu_size)
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+                    /* TCP packets to segment are split by the interface.  */
+                    && (packet_ptr -> nx_packet_tcp_segment_size == 0)
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+                   )
                 {
 
 #ifndef NX_DISABLE_FRAGMENTATION
@@ -383,6 +410,11 @@ UINT         queued_count;
                     arp_ptr -> nx_arp_retries =               0;
                     arp_ptr -> nx_arp_ip_interface =          packet_ptr -> nx_packet_address.nx_packet_interface_ptr;
 
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+                    /* Schedule the next update of the ARP entry.  */
+                    _nx_arp_entry_timer_schedule(ip_ptr, arp_ptr);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
+
                     /* Ensure the queue next pointer is NULL for the packet before it
                        is placed on the ARP waiting queue.  */
                     packet_ptr -> nx_packet_queue_next =  NX_NULL;
@@ -423,9 +455,15 @@ UINT         queued_count;
     if (loopback == NX_TRUE)
     {
 
+#ifdef NX_ENABLE_PACKET_CLONE
+        /* Clone the packet so it can be enqueued properly by the receive
+           processing.  The data of chained packets is shared, not copied.  */
+        if (_nx_packet_clone(packet_ptr, &packet_copy, ip_ptr -> nx_ip_default_packet_pool, NX_NO_WAIT) == NX_SUCCESS)
+#else
         /* Copy the packet so it can be enqueued properly by the receive
            processing.  */
         if (_nx_packet_copy(packet_ptr, &packet_copy, ip_ptr -> nx_ip_default_packet_pool, NX_NO_WAIT) == NX_SUCCESS)
+#endif /* NX_ENABLE_PACKET_CLONE */
         {
 
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
@@ -478,7 +516,12 @@ UINT         queued_count;
     {
 
         /* Determine if fragmentation is needed.  */
-        if (packet_ptr -> nx_packet_length > packet_ptr -> nx_packet_address.nx_packet_interface_ptr -> nx_interface_ip_mtu_size)
+        if ((packet_ptr -> nx_packet_length > packet_ptr -> nx_packet_address.nx_packet_interface_ptr -> nx_interface_ip_mtu_size)
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+            /* TCP packets to segment are split by the interface.  */
+            && (packet_ptr -> nx_packet_tcp_segment_size == 0)
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+           )
         {
 
 #ifndef NX_DISABLE_FRAGMENTATION
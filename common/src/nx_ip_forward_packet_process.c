@@ -60,6 +60,7 @@
 /*    _nx_packet_release                    Packet release                */
 /*    _nx_packet_data_adjust                Adjust the packet data to fill*/
 /*                                            the specified header        */
+/*    _nx_ip_checksum_adjust                Adjust checksum incrementally */
 /*    _nx_ip_driver_packet_send             Send the IP packet            */
 /*    _nx_ip_fragment_forward_packet        Fragment the forward packet   */
 /*    _nx_ip_packet_deferred_receive        IP deferred receive packet    */
@@ -162,13 +163,7 @@ ULONG           new_m;
         /* Update the TTL value.  */
         ip_header_ptr -> nx_ip_header_word_2 = (ip_header_ptr -> nx_ip_header_word_2 - 0x01000000);
 
-        /* Update the checksum, according to the RFC1624 page2, Eqn.3.
-           HC  - old checksum in header
-           HC' - new checksum in header
-           m   - old value of a 16-bit field
-           m'  - new value of a 16-bit field
-           HC' = ~(C + (-m) + m')
-            = ~(~HC + ~m + m') */
+        /* Update the checksum incrementally for the TTL change.  */
 
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
         if (packet_ptr -> nx_packet_ip_interface -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_IPV4_TX_CHECKSUM)
@@ -209,18 +204,11 @@ ULONG           new_m;
             /* Get the old TTL(m). */
             old_m = new_m + 0x0100;
 
-            /* Update the checksum, get the new checksum(HC'),
-               The new_m is ULONG value, so need get the lower value after invert. */
-            checksum = ((~checksum) & 0xFFFF) + ((~old_m) & 0xFFFF) + new_m;
-
-            /* Fold a 4-byte value into a two byte value */
-            checksum = (checksum >> 16) + (checksum & 0xFFFF);
-
-            /* Do it again in case previous operation generates an overflow */
-            checksum = (checksum >> 16) + (checksum & 0xFFFF);
+            /* Update the checksum, get the new checksum(HC').  */
+            checksum = _nx_ip_checksum_adjust((USHORT)checksum, (USHORT)old_m, (USHORT)new_m);
 
             /* Now store the new checksum in the IP header.  */
-            ip_header_ptr -> nx_ip_header_word_2 =  ((ip_header_ptr -> nx_ip_header_word_2 & 0xFFFF0000) | ((~checksum) & NX_LOWER_16_MASK));
+            ip_header_ptr -> nx_ip_header_word_2 =  ((ip_header_ptr -> nx_ip_header_word_2 & 0xFFFF0000) | checksum);
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
         }
         else
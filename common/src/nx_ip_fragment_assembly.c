@@ -58,6 +58,9 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_fragment_context_allocate      Allocate reassembly context   */
+/*    _nx_ip_fragment_context_find          Find reassembly context       */
+/*    _nx_ip_fragment_context_release       Release reassembly context    */
 /*    _nx_packet_release                    Release packet                */
 /*    _nx_ip_dispatch_process               The routine that examines     */
 /*                                            other optional headers and  */
@@ -109,6 +112,13 @@ NX_IPV6_HEADER                 *current_pkt_ip_header = NX_NULL;
 #ifdef NX_NAT_ENABLE
 UINT                            packet_consumed;
 #endif
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+NX_IP_FRAGMENT_CONTEXT         *context =  NX_NULL;
+UINT                            hash_index = 0;
+ULONG                           fragment_start = 0;
+ULONG                           fragment_length = 0;
+ULONG                           more_fragments = 0;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
 
 
     /* Disable interrupts.  */
@@ -161,6 +171,17 @@ UINT                            packet_consumed;
             {
                 current_fragment -> nx_packet_reassembly_time = current_ttl;
             }
+
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+            /* Pickup the hash bucket of the datagram, and the position of the payload and the
+               more fragments flag of this fragment.  */
+            hash_index = NX_IP_FRAGMENT_HASH_INDEX(current_id, current_header -> nx_ip_header_source_ip,
+                                                   current_header -> nx_ip_header_destination_ip);
+            fragment_start = current_offset * NX_IP_ALIGN_FRAGS;
+            fragment_length = (current_header -> nx_ip_header_word_0 & NX_LOWER_16_MASK) - (ULONG)sizeof(NX_IPV4_HEADER);
+            more_fragments = current_header -> nx_ip_header_word_1 & NX_IP_MORE_FRAGMENT;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
         }
 #endif /* NX_DISABLE_IPV4 */
 #ifdef FEATURE_NX_IPV6
@@ -185,12 +206,80 @@ UINT                            packet_consumed;
 
             /* Set the IPv6 reassembly time. RFC2460, Section4.5, Page22. */
             current_fragment -> nx_packet_reassembly_time = NX_IPV6_MAX_REASSEMBLY_TIME;
+
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+            /* Pickup the hash bucket of the datagram, and the position of the payload and the
+               more fragments flag of this fragment.  */
+            /*lint -e{613} suppress possible use of null pointer, since "current_pkt_ip_header" was set to none NULL above. */
+            hash_index = NX_IP_FRAGMENT_HASH_INDEX(current_id, current_pkt_ip_header -> nx_ip_header_source_ip[3],
+                                                   current_pkt_ip_header -> nx_ip_header_destination_ip[3]);
+            fragment_start = current_offset;
+            fragment_length = current_fragment -> nx_packet_length - (ULONG)sizeof(NX_IPV6_HEADER_FRAGMENT_OPTION);
+            more_fragments = (ULONG)(current_v6_fragment_option -> nx_ipv6_header_fragment_option_offset_flag & 1);
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
         }
 #endif
 
         /* Set the found pointer to NULL.  */
         found_ptr =  NX_NULL;
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+        /* Determine if the fragment ends beyond the maximum size of a datagram.  */
+        if ((fragment_start + fragment_length) > NX_IP_FRAGMENT_MAX_DATAGRAM_SIZE)
+        {
+
+#ifndef NX_DISABLE_IP_INFO
+
+            /* Increment the oversize drops and the IP receive packets dropped counts.  */
+            ip_ptr -> nx_ip_fragment_oversize_drops++;
+            ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif /* NX_DISABLE_IP_INFO */
+
+            /* Release the fragment.  */
+            _nx_packet_release(current_fragment);
+            continue;
+        }
+
+        /* Find the reassembly context of the datagram in its hash bucket.  */
+        context =  _nx_ip_fragment_context_find(ip_ptr, current_fragment, current_id, hash_index);
+        if (context)
+        {
+
+            /* Determine if the datagram already holds the maximum number of fragments.  */
+            if (context -> nx_ip_fragment_context_count >= NX_IP_FRAGMENT_MAX_FRAGMENTS)
+            {
+
+#ifndef NX_DISABLE_IP_INFO
+
+                /* Increment the limit drops and the IP receive packets dropped counts.  */
+                ip_ptr -> nx_ip_fragment_limit_drops++;
+                ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif /* NX_DISABLE_IP_INFO */
+
+                /* Release the fragment.  */
+                _nx_packet_release(current_fragment);
+                continue;
+            }
+
+            /* The first fragment of the context is the head of the fragment chain.  */
+            found_ptr =  context -> nx_ip_fragment_context_head;
+
+#ifndef NX_DISABLE_IPV4
+
+            /* The reassmebly timer should be MAX(reassembly time, Time To Live). RFC791, Section3.2, Page27.  */
+            if ((ip_version == NX_IP_VERSION_V4) && (found_ptr -> nx_packet_reassembly_time < current_ttl))
+            {
+                found_ptr -> nx_packet_reassembly_time = current_ttl;
+            }
+#endif /* NX_DISABLE_IPV4 */
+
+            /* Updated the reassembly time.  */
+            current_fragment -> nx_packet_reassembly_time = found_ptr -> nx_packet_reassembly_time;
+        }
+#else
+
         /* Does the assembly list have anything in it?  */
         if (ip_ptr -> nx_ip_fragment_assembly_head)
         {
@@ -277,6 +366,7 @@ UINT                            packet_consumed;
                 search_ptr =  search_ptr -> nx_packet_queue_next;
             }
         }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
 
         /* Was another IP packet fragment found?  */
         if (found_ptr)
@@ -293,8 +383,19 @@ UINT                            packet_consumed;
             previous_ptr =  NX_NULL;
             search_ptr =    found_ptr;
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+            /* Fragments usually arrive in order.  If the new fragment is beyond the fragment
+               with the highest offset, place it at the end without walking the list.  */
+            if (current_offset > context -> nx_ip_fragment_context_last_offset)
+            {
+                previous_ptr =  context -> nx_ip_fragment_context_last;
+                search_ptr =    NX_NULL;
+            }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
             /* Loop to walk through the fragment list.  */
-            do
+            while (search_ptr)
             {
 
 #ifndef NX_DISABLE_IPV4
@@ -349,7 +450,7 @@ UINT                            packet_consumed;
                    chain.  */
                 previous_ptr =  search_ptr;
                 search_ptr   =  search_ptr -> nx_packet_union_next.nx_packet_fragment_next;
-            } while (search_ptr);
+            }
 
 
             /* At this point, the previous pointer determines where to place the new fragment.  */
@@ -366,6 +467,21 @@ UINT                            packet_consumed;
                 /* This packet needs to be inserted at the front of the fragment chain.  */
                 current_fragment -> nx_packet_queue_next =     fragment_head -> nx_packet_queue_next;
                 current_fragment -> nx_packet_union_next.nx_packet_fragment_next =  fragment_head;
+
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+                /* The first fragment of the previous context is in front of this IP fragment
+                   chain on the re-assembly queue.  */
+                previous_fragment =  NX_NULL;
+                if (context -> nx_ip_fragment_context_previous)
+                {
+                    previous_fragment =  (context -> nx_ip_fragment_context_previous) -> nx_ip_fragment_context_head;
+                }
+
+                /* The new fragment is the first fragment of the context.  */
+                context -> nx_ip_fragment_context_head =  current_fragment;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
                 if (previous_fragment)
                 {
 
@@ -406,6 +522,35 @@ UINT                            packet_consumed;
                 old_ptr = current_fragment -> nx_packet_union_next.nx_packet_fragment_next;
                 current_fragment -> nx_packet_union_next.nx_packet_fragment_next =  old_ptr -> nx_packet_union_next.nx_packet_fragment_next;
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+                /* Remove the payload of the old packet from the context.  */
+#ifndef NX_DISABLE_IPV4
+                if (ip_version == NX_IP_VERSION_V4)
+                {
+
+                    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                    search_header =  (NX_IPV4_HEADER *)old_ptr -> nx_packet_prepend_ptr;
+                    context -> nx_ip_fragment_context_received -=
+                        (search_header -> nx_ip_header_word_0 & NX_LOWER_16_MASK) - (ULONG)sizeof(NX_IPV4_HEADER);
+                }
+#endif /* NX_DISABLE_IPV4 */
+#ifdef FEATURE_NX_IPV6
+                if (ip_version == NX_IP_VERSION_V6)
+                {
+                    context -> nx_ip_fragment_context_received -=
+                        old_ptr -> nx_packet_length - (ULONG)sizeof(NX_IPV6_HEADER_FRAGMENT_OPTION);
+                }
+#endif /* FEATURE_NX_IPV6 */
+                context -> nx_ip_fragment_context_count--;
+
+#ifndef NX_DISABLE_IP_INFO
+
+                /* Increment the duplicate fragments count.  */
+                ip_ptr -> nx_ip_fragment_duplicates++;
+#endif /* NX_DISABLE_IP_INFO */
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
                 /* Reset tcp_queue_next before releasing. */
                 /* Cast the ULONG into a packet pointer. Since this is exactly what we wish to do, disable the lint warning with the following comment:  */
                 /*lint -e{923} suppress cast of ULONG to pointer.  */
@@ -415,6 +560,34 @@ UINT                            packet_consumed;
                 _nx_packet_release(old_ptr);
             }
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+            /* Determine if the new fragment is now the fragment with the highest offset.  */
+            if (current_fragment -> nx_packet_union_next.nx_packet_fragment_next == NX_NULL)
+            {
+                context -> nx_ip_fragment_context_last =         current_fragment;
+                context -> nx_ip_fragment_context_last_offset =  current_offset;
+            }
+
+            /* Account the payload of the fragment.  The payload length of the datagram is
+               known once the fragment without the more fragments flag is received.  */
+            context -> nx_ip_fragment_context_count++;
+            context -> nx_ip_fragment_context_received += fragment_length;
+            if (more_fragments == 0)
+            {
+                context -> nx_ip_fragment_context_length =  fragment_start + fragment_length;
+            }
+
+            /* The datagram cannot be complete until as many bytes as its payload length are
+               received, so the fragment list is only walked when it may be complete.  The
+               walk below still finds the holes left by overlapping fragments.  */
+            if ((context -> nx_ip_fragment_context_length == 0) ||
+                (context -> nx_ip_fragment_context_received < context -> nx_ip_fragment_context_length))
+            {
+                continue;
+            }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
             /* At this point, the new IP fragment is in its proper place on the re-assembly
                list.  We now need to walk the list and determine if all the fragments are
                present.  */
@@ -513,6 +686,11 @@ UINT                            packet_consumed;
 
             /* The packet can be reassembled under the fragment head pointer now.  It must now
                be removed from the re-assembly list.  */
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+            /* Remove the fragment from the re-assembly list and release the context.  */
+            _nx_ip_fragment_context_release(ip_ptr, context);
+#else
             if (previous_fragment)
             {
 
@@ -537,6 +715,7 @@ UINT                            packet_consumed;
                 /* Setup the new tail pointer.  */
                 ip_ptr -> nx_ip_fragment_assembly_tail =  previous_fragment;
             }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
 
             /* If we get here, the necessary fragments to reassemble the packet
                are indeed available.  We now need to loop through the packet and reassemble
@@ -695,6 +874,23 @@ UINT                            packet_consumed;
         else
         {
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+            /* No context was found so this packet must be the first one of a new IP packet.
+               Take a context for it, which adds the packet to the end of the assembly queue.  */
+            context =  _nx_ip_fragment_context_allocate(ip_ptr, current_fragment, current_id, hash_index);
+
+            /* Account the payload of the fragment.  */
+            context -> nx_ip_fragment_context_last_offset =  current_offset;
+            context -> nx_ip_fragment_context_count =        1;
+            context -> nx_ip_fragment_context_received =     fragment_length;
+            context -> nx_ip_fragment_context_length =       0;
+            if (more_fragments == 0)
+            {
+                context -> nx_ip_fragment_context_length =  fragment_start + fragment_length;
+            }
+#else
+
             /* No other packet was found on the re-assembly list so this packet must be the
                first one of a new IP packet.  Just add it to the end of the assembly queue.  */
             if (ip_ptr -> nx_ip_fragment_assembly_head)
@@ -717,6 +913,7 @@ UINT                            packet_consumed;
                 current_fragment -> nx_packet_queue_next =                         NX_NULL;
                 current_fragment -> nx_packet_union_next.nx_packet_fragment_next = NX_NULL;
             }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
         }
     }
 }
@@ -0,0 +1,176 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_context_allocate                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes a reassembly context for the datagram of the    */
+/*    fragment, links it in the hash bucket of the datagram and at the    */
+/*    end of the active list, and places the fragment at the end of the   */
+/*    IP re-assembly queue.  The caller accounts the payload of the       */
+/*    fragment in the context.                                            */
+/*                                                                        */
+/*    If all the contexts are in use, the context of the oldest datagram  */
+/*    is reused and its fragments are released.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to first received     */
+/*                                            fragment of the datagram    */
+/*    id                                    Identification of the         */
+/*                                            datagram                    */
+/*    hash_index                            Hash bucket of the datagram   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    context                               Reassembly context            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_fragment_context_release       Release reassembly context    */
+/*    _nx_packet_release                    Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_assembly              Reassemble IP fragments       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_IP_FRAGMENT_CONTEXT  *_nx_ip_fragment_context_allocate(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG id, UINT hash_index)
+{
+
+NX_IP_FRAGMENT_CONTEXT *context;
+NX_PACKET              *fragment;
+NX_PACKET              *next_fragment;
+
+
+    /* Determine if a context is free.  */
+    if (ip_ptr -> nx_ip_fragment_context_free_list == NX_NULL)
+    {
+
+        /* No, reuse the context of the oldest datagram.  */
+        context =  ip_ptr -> nx_ip_fragment_context_active_head;
+        fragment = context -> nx_ip_fragment_context_head;
+        _nx_ip_fragment_context_release(ip_ptr, context);
+
+#ifndef NX_DISABLE_IP_INFO
+
+        /* Increment the reassembly failures and the context evictions counts.  */
+        ip_ptr -> nx_ip_reassembly_failures++;
+        ip_ptr -> nx_ip_fragment_context_evictions++;
+#endif /* NX_DISABLE_IP_INFO */
+
+        /* Release the fragments of the oldest datagram.  */
+        while (fragment)
+        {
+
+#ifndef NX_DISABLE_IP_INFO
+
+            /* Increment the IP receive packets dropped count.  */
+            ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif /* NX_DISABLE_IP_INFO */
+
+            /* Pickup the next fragment.  */
+            next_fragment =  fragment -> nx_packet_union_next.nx_packet_fragment_next;
+
+            /* Reset tcp_queue_next before releasing. */
+            /*lint -e{923} suppress cast of ULONG to pointer.  */
+            fragment -> nx_packet_union_next.nx_packet_tcp_queue_next = (NX_PACKET *)NX_PACKET_ALLOCATED;
+
+            /* Release this fragment.  */
+            _nx_packet_release(fragment);
+            fragment =  next_fragment;
+        }
+    }
+
+    /* Remove the context from the free list.  */
+    context =  ip_ptr -> nx_ip_fragment_context_free_list;
+    ip_ptr -> nx_ip_fragment_context_free_list =  context -> nx_ip_fragment_context_next;
+
+    /* Setup the context for the datagram of the fragment.  */
+    context -> nx_ip_fragment_context_head =      packet_ptr;
+    context -> nx_ip_fragment_context_last =      packet_ptr;
+    context -> nx_ip_fragment_context_id =        id;
+    context -> nx_ip_fragment_context_version =   packet_ptr -> nx_packet_ip_version;
+
+    /* Link the context to the front of the hash bucket.  */
+    context -> nx_ip_fragment_context_hash_index =  hash_index;
+    context -> nx_ip_fragment_context_hash_next =   ip_ptr -> nx_ip_fragment_context_hash[hash_index];
+    ip_ptr -> nx_ip_fragment_context_hash[hash_index] =  context;
+
+    /* Link the context to the end of the active list.  */
+    context -> nx_ip_fragment_context_next =      NX_NULL;
+    context -> nx_ip_fragment_context_previous =  ip_ptr -> nx_ip_fragment_context_active_tail;
+    if (ip_ptr -> nx_ip_fragment_context_active_tail)
+    {
+        (ip_ptr -> nx_ip_fragment_context_active_tail) -> nx_ip_fragment_context_next =  context;
+    }
+    else
+    {
+        ip_ptr -> nx_ip_fragment_context_active_head =  context;
+    }
+    ip_ptr -> nx_ip_fragment_context_active_tail =  context;
+    ip_ptr -> nx_ip_fragment_contexts_used++;
+
+    /* Place the fragment at the end of the IP fragment assembly list.  */
+    packet_ptr -> nx_packet_queue_next =                         NX_NULL;
+    packet_ptr -> nx_packet_union_next.nx_packet_fragment_next = NX_NULL;
+    if (ip_ptr -> nx_ip_fragment_assembly_head)
+    {
+        ip_ptr -> nx_ip_fragment_assembly_tail -> nx_packet_queue_next =  packet_ptr;
+    }
+    else
+    {
+        ip_ptr -> nx_ip_fragment_assembly_head =  packet_ptr;
+    }
+    ip_ptr -> nx_ip_fragment_assembly_tail =  packet_ptr;
+
+    /* Return the context.  */
+    return(context);
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
@@ -0,0 +1,161 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+#include "nx_ipv4.h"
+#include "nx_ipv6.h"
+
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_context_find                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function searches the hash bucket of the datagram of the       */
+/*    fragment for its reassembly context.  IPv4 datagrams are matched    */
+/*    on the source and destination addresses, the protocol and the       */
+/*    identification (RFC 791), IPv6 datagrams on the source and          */
+/*    destination addresses and the identification (RFC 2460).            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to received fragment  */
+/*    id                                    Identification of the         */
+/*                                            datagram                    */
+/*    hash_index                            Hash bucket of the datagram   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    context                               Reassembly context, or        */
+/*                                            NX_NULL if the datagram has */
+/*                                            no context                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_assembly              Reassemble IP fragments       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_IP_FRAGMENT_CONTEXT  *_nx_ip_fragment_context_find(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG id, UINT hash_index)
+{
+
+NX_IP_FRAGMENT_CONTEXT *context;
+#ifndef NX_DISABLE_IPV4
+NX_IPV4_HEADER         *current_header;
+NX_IPV4_HEADER         *search_header;
+#endif /* NX_DISABLE_IPV4 */
+#ifdef FEATURE_NX_IPV6
+NX_IPV6_HEADER         *current_ipv6_header;
+NX_IPV6_HEADER         *search_ipv6_header;
+#endif /* FEATURE_NX_IPV6 */
+
+
+    /* Walk the contexts of the hash bucket.  */
+    context =  ip_ptr -> nx_ip_fragment_context_hash[hash_index];
+    while (context)
+    {
+
+        /* Check the context only if the identification and the version match.  */
+        if ((context -> nx_ip_fragment_context_id == id) &&
+            (context -> nx_ip_fragment_context_version == packet_ptr -> nx_packet_ip_version))
+        {
+
+#ifndef NX_DISABLE_IPV4
+            if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+            {
+
+                /* Setup the IP headers of the fragment and of the first fragment of the context.  */
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                current_header =  (NX_IPV4_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                search_header =  (NX_IPV4_HEADER *)context -> nx_ip_fragment_context_head -> nx_packet_prepend_ptr;
+
+                /* Determine if the protocol and the addresses match.  */
+                if (((search_header -> nx_ip_header_word_2 & NX_IP_PROTOCOL_MASK) ==
+                     (current_header -> nx_ip_header_word_2 & NX_IP_PROTOCOL_MASK)) &&
+                    (search_header -> nx_ip_header_source_ip == current_header -> nx_ip_header_source_ip) &&
+                    (search_header -> nx_ip_header_destination_ip == current_header -> nx_ip_header_destination_ip))
+                {
+
+                    /* Yes, this is the context of the datagram.  */
+                    return(context);
+                }
+            }
+#endif /* NX_DISABLE_IPV4 */
+
+#ifdef FEATURE_NX_IPV6
+            if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
+            {
+
+                /* Setup the IPv6 headers of the fragment and of the first fragment of the context.  */
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                current_ipv6_header =  (NX_IPV6_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                search_ipv6_header =  (NX_IPV6_HEADER *)context -> nx_ip_fragment_context_head -> nx_packet_ip_header;
+
+                /* Determine if the addresses match.  */
+                if ((CHECK_IPV6_ADDRESSES_SAME(search_ipv6_header -> nx_ip_header_source_ip, current_ipv6_header -> nx_ip_header_source_ip)) &&
+                    (CHECK_IPV6_ADDRESSES_SAME(search_ipv6_header -> nx_ip_header_destination_ip, current_ipv6_header -> nx_ip_header_destination_ip)))
+                {
+
+                    /* Yes, this is the context of the datagram.  */
+                    return(context);
+                }
+            }
+#endif /* FEATURE_NX_IPV6 */
+        }
+
+        /* Move to the next context of the bucket.  */
+        context =  context -> nx_ip_fragment_context_hash_next;
+    }
+
+    /* No context was found.  */
+    return(NX_NULL);
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
@@ -0,0 +1,97 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_context_initialize                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places all the fragment reassembly contexts of the    */
+/*    IP instance on the free list and clears the hash buckets.  The re-  */
+/*    assembly queue must be empty.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    memset                                Clear the hash buckets        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_enable                Enable IP fragment processing */
+/*    _nx_ip_fragment_disable               Disable IP fragment           */
+/*                                            processing                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_fragment_context_initialize(NX_IP *ip_ptr)
+{
+
+UINT i;
+
+
+    /* Clear the hash buckets.  */
+    memset(ip_ptr -> nx_ip_fragment_context_hash, 0, sizeof(ip_ptr -> nx_ip_fragment_context_hash));
+
+    /* Link all the contexts on the free list.  */
+    ip_ptr -> nx_ip_fragment_context_free_list =  NX_NULL;
+    for (i = NX_IP_FRAGMENT_CONTEXT_MAX; i > 0; i--)
+    {
+        ip_ptr -> nx_ip_fragment_contexts[i - 1].nx_ip_fragment_context_head =  NX_NULL;
+        ip_ptr -> nx_ip_fragment_contexts[i - 1].nx_ip_fragment_context_next =  ip_ptr -> nx_ip_fragment_context_free_list;
+        ip_ptr -> nx_ip_fragment_context_free_list =  &(ip_ptr -> nx_ip_fragment_contexts[i - 1]);
+    }
+
+    /* No context is in use.  */
+    ip_ptr -> nx_ip_fragment_context_active_head =  NX_NULL;
+    ip_ptr -> nx_ip_fragment_context_active_tail =  NX_NULL;
+    ip_ptr -> nx_ip_fragment_contexts_used =        0;
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
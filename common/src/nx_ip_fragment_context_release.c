@@ -0,0 +1,159 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_context_release                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the first fragment of the reassembly context  */
+/*    from the IP re-assembly queue, unlinks the context from its hash    */
+/*    bucket and from the active list, and returns it to the free list.   */
+/*    The fragments of the datagram are not released.                     */
+/*                                                                        */
+/*    The context before this one in the active list holds the fragment   */
+/*    before this one in the re-assembly queue, so the fragment is        */
+/*    removed without a search of the queue.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    context                               Pointer to reassembly context */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_assembly              Reassemble IP fragments       */
+/*    _nx_ip_fragment_context_allocate      Allocate reassembly context   */
+/*    _nx_ip_fragment_timeout_check         Check for fragment timeouts   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_fragment_context_release(NX_IP *ip_ptr, NX_IP_FRAGMENT_CONTEXT *context)
+{
+
+NX_IP_FRAGMENT_CONTEXT **link_ptr;
+NX_PACKET               *fragment_head;
+NX_PACKET               *previous_fragment =  NX_NULL;
+
+
+    /* Pickup the first fragment of the context and the first fragment before it.  */
+    fragment_head =  context -> nx_ip_fragment_context_head;
+    if (context -> nx_ip_fragment_context_previous)
+    {
+        previous_fragment =  (context -> nx_ip_fragment_context_previous) -> nx_ip_fragment_context_head;
+    }
+
+    /* Remove the fragment from the re-assembly queue.  */
+    if (previous_fragment)
+    {
+        previous_fragment -> nx_packet_queue_next =  fragment_head -> nx_packet_queue_next;
+    }
+    else
+    {
+        ip_ptr -> nx_ip_fragment_assembly_head =  fragment_head -> nx_packet_queue_next;
+
+        /* Clear the timeout fragment pointer since the oldest fragment is removed.  */
+        ip_ptr -> nx_ip_timeout_fragment =  NX_NULL;
+    }
+
+    /* Determine if we need to adjust the tail pointer.  */
+    if (fragment_head == ip_ptr -> nx_ip_fragment_assembly_tail)
+    {
+        ip_ptr -> nx_ip_fragment_assembly_tail =  previous_fragment;
+    }
+
+    /* Search the hash bucket for the context.  */
+    link_ptr =  &(ip_ptr -> nx_ip_fragment_context_hash[context -> nx_ip_fragment_context_hash_index]);
+    while (*link_ptr)
+    {
+
+        /* Is this the context?  */
+        if (*link_ptr == context)
+        {
+
+            /* Yes, unlink it from the bucket.  */
+            *link_ptr =  context -> nx_ip_fragment_context_hash_next;
+            break;
+        }
+
+        /* Move to the next context of the bucket.  */
+        link_ptr =  &((*link_ptr) -> nx_ip_fragment_context_hash_next);
+    }
+
+    /* Unlink the context from the active list.  */
+    if (context -> nx_ip_fragment_context_previous)
+    {
+        (context -> nx_ip_fragment_context_previous) -> nx_ip_fragment_context_next =  context -> nx_ip_fragment_context_next;
+    }
+    else
+    {
+        ip_ptr -> nx_ip_fragment_context_active_head =  context -> nx_ip_fragment_context_next;
+    }
+    if (context -> nx_ip_fragment_context_next)
+    {
+        (context -> nx_ip_fragment_context_next) -> nx_ip_fragment_context_previous =  context -> nx_ip_fragment_context_previous;
+    }
+    else
+    {
+        ip_ptr -> nx_ip_fragment_context_active_tail =  context -> nx_ip_fragment_context_previous;
+    }
+    ip_ptr -> nx_ip_fragment_contexts_used--;
+
+    /* Return the context to the free list.  */
+    context -> nx_ip_fragment_context_head =       NX_NULL;
+    context -> nx_ip_fragment_context_last =       NX_NULL;
+    context -> nx_ip_fragment_context_hash_next =  NX_NULL;
+    context -> nx_ip_fragment_context_previous =   NX_NULL;
+    context -> nx_ip_fragment_context_next =       ip_ptr -> nx_ip_fragment_context_free_list;
+    ip_ptr -> nx_ip_fragment_context_free_list =   context;
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
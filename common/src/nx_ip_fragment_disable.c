@@ -57,6 +57,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_release                    Release packet                */
+/*    _nx_ip_fragment_context_initialize    Initialize reassembly         */
+/*                                            contexts                    */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -121,6 +123,12 @@ NX_PACKET *release_packet;
     /* Restore interrupts.  */
     TX_RESTORE
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+    /* Return all the reassembly contexts to the free list.  */
+    _nx_ip_fragment_context_initialize(ip_ptr);
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
     /* Release mutex protection.  */
     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
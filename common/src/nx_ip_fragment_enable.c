@@ -55,7 +55,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_ip_fragment_context_initialize    Initialize reassembly         */
+/*                                            contexts                    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -78,6 +79,15 @@ TX_INTERRUPT_SAVE_AREA
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_FRAGMENT_ENABLE, ip_ptr, 0, 0, 0, NX_TRACE_IP_EVENTS, 0, 0);
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+    /* Place the reassembly contexts on the free list if fragment processing is not enabled yet.  */
+    if (ip_ptr -> nx_ip_fragment_assembly == NX_NULL)
+    {
+        _nx_ip_fragment_context_initialize(ip_ptr);
+    }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
+
     /* Disable interrupts temporarily.  */
     TX_DISABLE
 
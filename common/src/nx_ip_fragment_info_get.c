@@ -0,0 +1,181 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_info_get                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the number of IP fragment reassembly        */
+/*    contexts in use and the fragment reassembly drop counters of the    */
+/*    specified IP instance.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    contexts_in_use                       Destination for number of     */
+/*                                            reassembly contexts in use  */
+/*    duplicates                            Destination for number of     */
+/*                                            duplicate fragments         */
+/*                                            replaced                    */
+/*    oversize_drops                        Destination for number of     */
+/*                                            fragments beyond the        */
+/*                                            maximum datagram size       */
+/*    limit_drops                           Destination for number of     */
+/*                                            fragments beyond the        */
+/*                                            fragment limit              */
+/*    context_evictions                     Destination for number of     */
+/*                                            contexts reused             */
+/*    reassembly_failures                   Destination for number of     */
+/*                                            datagrams not reassembled   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection             */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_fragment_info_get(NX_IP *ip_ptr, ULONG *contexts_in_use, ULONG *duplicates,
+                               ULONG *oversize_drops, ULONG *limit_drops, ULONG *context_evictions,
+                               ULONG *reassembly_failures)
+{
+#if defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE) && !defined(NX_DISABLE_FRAGMENTATION)
+
+    /* Obtain the IP mutex so we can examine the contexts.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Determine if contexts in use is wanted.  */
+    if (contexts_in_use)
+    {
+
+        /* Return the number of reassembly contexts in use.  */
+        *contexts_in_use =  ip_ptr -> nx_ip_fragment_contexts_used;
+    }
+
+    /* Determine if duplicates is wanted.  */
+    if (duplicates)
+    {
+
+        /* Return the number of duplicate fragments replaced.  */
+#ifndef NX_DISABLE_IP_INFO
+        *duplicates =  ip_ptr -> nx_ip_fragment_duplicates;
+#else
+        *duplicates =  0;
+#endif
+    }
+
+    /* Determine if oversize drops is wanted.  */
+    if (oversize_drops)
+    {
+
+        /* Return the number of fragments beyond the maximum datagram size.  */
+#ifndef NX_DISABLE_IP_INFO
+        *oversize_drops =  ip_ptr -> nx_ip_fragment_oversize_drops;
+#else
+        *oversize_drops =  0;
+#endif
+    }
+
+    /* Determine if limit drops is wanted.  */
+    if (limit_drops)
+    {
+
+        /* Return the number of fragments beyond the fragment limit of a datagram.  */
+#ifndef NX_DISABLE_IP_INFO
+        *limit_drops =  ip_ptr -> nx_ip_fragment_limit_drops;
+#else
+        *limit_drops =  0;
+#endif
+    }
+
+    /* Determine if context evictions is wanted.  */
+    if (context_evictions)
+    {
+
+        /* Return the number of contexts reused before their datagram was complete.  */
+#ifndef NX_DISABLE_IP_INFO
+        *context_evictions =  ip_ptr -> nx_ip_fragment_context_evictions;
+#else
+        *context_evictions =  0;
+#endif
+    }
+
+    /* Determine if reassembly failures is wanted.  */
+    if (reassembly_failures)
+    {
+
+        /* Return the number of datagrams that timed out or were evicted.  */
+#ifndef NX_DISABLE_IP_INFO
+        *reassembly_failures =  ip_ptr -> nx_ip_reassembly_failures;
+#else
+        *reassembly_failures =  0;
+#endif
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_IP_FRAGMENT_HASH_TABLE || NX_DISABLE_FRAGMENTATION */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(contexts_in_use);
+    NX_PARAMETER_NOT_USED(duplicates);
+    NX_PARAMETER_NOT_USED(oversize_drops);
+    NX_PARAMETER_NOT_USED(limit_drops);
+    NX_PARAMETER_NOT_USED(context_evictions);
+    NX_PARAMETER_NOT_USED(reassembly_failures);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE && !NX_DISABLE_FRAGMENTATION */
+}
@@ -197,6 +197,7 @@ NX_IPV6_HEADER                 *ipv6_header;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_fragment_context_release       Release reassembly context    */
 /*    _nx_packet_release                    Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -216,10 +217,48 @@ VOID  _nx_ip_fragment_timeout_check(NX_IP *ip_ptr)
 {
 
 NX_PACKET *fragment;
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+NX_IP_FRAGMENT_CONTEXT *context;
+NX_IP_FRAGMENT_CONTEXT *next_context;
+#else
 NX_PACKET *next_fragment;
 NX_PACKET *previous_fragment = NX_NULL;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
 
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH_TABLE
+
+    /* Loop through the reassembly contexts, which are in the order of the fragmented packet queue. */
+    context = ip_ptr -> nx_ip_fragment_context_active_head;
+    while (context)
+    {
+
+        /* Pickup the next context and the head packet of this context. */
+        next_context = context -> nx_ip_fragment_context_next;
+        fragment = context -> nx_ip_fragment_context_head;
+
+        /* Check if the timeout has expired. */
+        if (fragment -> nx_packet_reassembly_time == 0)
+        {
+
+            /* Timeout occured.  Remove the packet from the queue and release the context. */
+            _nx_ip_fragment_context_release(ip_ptr, context);
+
+            /* Send out an error message, release the packet fragments in this chain. */
+            _nx_ip_fragment_cleanup(ip_ptr, fragment);
+        }
+        else
+        {
+
+            /*  Decrement the time remaining to assemble the whole packet. */
+            fragment -> nx_packet_reassembly_time--;
+        }
+
+        /* Get the next context. */
+        context = next_context;
+    }
+#else
+
     /* Set a pointer to the head packet of the fragmented packet queue. */
     fragment = ip_ptr -> nx_ip_fragment_assembly_head;
 
@@ -269,6 +308,7 @@ NX_PACKET *previous_fragment = NX_NULL;
             fragment = fragment -> nx_packet_queue_next;
         }
     }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
 }
 #endif /* NX_DISABLE_FRAGMENTATION */
 
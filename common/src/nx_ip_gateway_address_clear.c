@@ -90,6 +90,11 @@ TX_INTERRUPT_SAVE_AREA
 
     ip_ptr -> nx_ip_gateway_interface = NX_NULL;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
     /* Restore interrupts.  */
     TX_RESTORE
 
@@ -116,6 +116,11 @@ ULONG previous_network_mask;
     ip_ptr -> nx_ip_interface[interface_index].nx_interface_ip_network_mask =  network_mask;
     ip_ptr -> nx_ip_interface[interface_index].nx_interface_ip_network      =  ip_address & network_mask;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
     /* Ensure the RARP function is disabled.  */
     ip_ptr -> nx_ip_rarp_periodic_update =  NX_NULL;
     ip_ptr -> nx_ip_rarp_queue_process =    NX_NULL;
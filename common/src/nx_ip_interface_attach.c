@@ -152,6 +152,12 @@ ULONG         address[4];
     nx_interface -> nx_interface_ip_network_mask   = network_mask;
     nx_interface -> nx_interface_ip_network        = ip_address & network_mask;
 #endif /* !NX_DISABLE_IPV4  */
+
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
     nx_interface -> nx_interface_link_driver_entry = ip_link_driver;
     nx_interface -> nx_interface_name              = interface_name;
 
@@ -94,9 +94,12 @@ NX_TCP_SOCKET    *socket_ptr;
 NXD_IPV6_ADDRESS *next_ipv6_address;
 NXD_IPV6_ADDRESS *ipv6_address;
 UINT              i;
-#ifdef NX_ENABLE_IP_STATIC_ROUTING
+#if defined(NX_ENABLE_IP_STATIC_ROUTING) && !defined(NX_ENABLE_IP_ROUTE_TRIE)
 UINT              j;
 #endif
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+ULONG             routes_removed;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
 #ifdef FEATURE_NX_IPV6
 NX_IPV6_DEFAULT_ROUTER_ENTRY *rt_entry;
@@ -151,6 +154,12 @@ NX_IPV6_DEFAULT_ROUTER_ENTRY *rt_entry;
 
 #ifndef NX_DISABLE_IPV4
 #ifdef NX_ENABLE_IP_STATIC_ROUTING
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* Remove routes associated with the interface that will be detached from the routing trie. */
+    routes_removed = _nx_ip_route_trie_interface_remove(ip_ptr, &(ip_ptr -> nx_ip_route_trie_ipv4), interface_ptr);
+    ip_ptr -> nx_ip_routing_table_entry_count -= routes_removed;
+    ip_ptr -> nx_ip_route_trie_count -= routes_removed;
+#else
     /* Remove router iterms associated with the interface that will be detached from route table. */
     for (i = 0; i < ip_ptr -> nx_ip_routing_table_entry_count; i++)
     {
@@ -181,9 +190,16 @@ NX_IPV6_DEFAULT_ROUTER_ENTRY *rt_entry;
             ip_ptr -> nx_ip_routing_table_entry_count--;
         }
     }
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 #endif /* NX_ENABLE_IP_STATIC_ROUTING  */
 #endif /* !NX_DISABLE_IPV4  */
 
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+    /* Remove IPv6 static routes associated with this interface. */
+    routes_removed = _nx_ip_route_trie_interface_remove(ip_ptr, &(ip_ptr -> nx_ip_route_trie_ipv6), interface_ptr);
+    ip_ptr -> nx_ip_route_trie_count -= routes_removed;
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
+
 #ifdef FEATURE_NX_IPV6
     /* Remove IPv6 routers associated with this interface. */
     for (i = 0; i < NX_IPV6_DEFAULT_ROUTER_TABLE_SIZE; i++)
@@ -223,6 +239,10 @@ NX_IPV6_DEFAULT_ROUTER_ENTRY *rt_entry;
         ip_ptr -> nx_ip_gateway_address   = 0;
     }
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
 
     /* Leave multicast groups related to the interface to be detached. */
     for (i = 0; i < NX_MAX_MULTICAST_GROUPS; i++)
@@ -61,6 +61,7 @@
 /*                                                                        */
 /*    _nx_ip_route_find                     Find out-going interface and  */
 /*                                            next hop                    */
+/*    _nx_ip_route_cache_find               Find route through the cache  */
 /*    nx_ip_packet_send                     Core IP packet send service   */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
@@ -95,7 +96,11 @@ ULONG next_hop_address = NX_NULL;
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
     /* Make sure a valid interface exists for the destination. */
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    if (_nx_ip_route_cache_find(ip_ptr, destination_ip, &packet_ptr -> nx_packet_address.nx_packet_interface_ptr, &next_hop_address) != NX_SUCCESS)
+#else
     if (_nx_ip_route_find(ip_ptr, destination_ip, &packet_ptr -> nx_packet_address.nx_packet_interface_ptr, &next_hop_address) != NX_SUCCESS)
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
     {
 
         /* Release protection. */
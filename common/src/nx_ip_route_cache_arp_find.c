@@ -0,0 +1,180 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv4.h"
+
+#if defined(NX_ENABLE_IP_ROUTE_CACHE) && !defined(NX_DISABLE_IPV4)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_cache_arp_find                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the ARP entry of the next hop of a              */
+/*    destination.  The ARP entry stored in the route cache entry of the  */
+/*    destination is used while the route and ARP generations of the IP   */
+/*    instance are unchanged, otherwise the ARP table is searched and     */
+/*    the entry found is stored for the next packet.  It is called with   */
+/*    the IP protection held.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    destination_address                   Destination address           */
+/*    next_hop_address                      Next hop address              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    arp_ptr                               ARP entry of the next hop,    */
+/*                                            NX_NULL if none is found    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_driver_packet_send             Send an IP packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_ARP  *_nx_ip_route_cache_arp_find(NX_IP *ip_ptr, ULONG destination_address, ULONG next_hop_address)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_ROUTE_CACHE_ENTRY *entry_ptr;
+NX_ARP                  *arp_ptr;
+UINT                     index;
+
+
+    /* Pickup the cache entry of the destination.  */
+    entry_ptr =  &(ip_ptr -> nx_ip_route_cache[NX_IP_ROUTE_CACHE_INDEX(destination_address)]);
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the entry holds the current route to the destination through the next hop.  */
+    if ((entry_ptr -> nx_ip_route_cache_interface) &&
+        (entry_ptr -> nx_ip_route_cache_destination == destination_address) &&
+        (entry_ptr -> nx_ip_route_cache_next_hop == next_hop_address) &&
+        (entry_ptr -> nx_ip_route_cache_route_generation == ip_ptr -> nx_ip_route_cache_generation))
+    {
+
+        /* Pickup the ARP entry stored in the entry.  */
+        arp_ptr =  entry_ptr -> nx_ip_route_cache_arp;
+
+        /* Determine if the ARP entry is still the one of the next hop.  */
+        if ((arp_ptr) &&
+            (entry_ptr -> nx_ip_route_cache_arp_generation == ip_ptr -> nx_ip_route_cache_arp_generation) &&
+            (arp_ptr -> nx_arp_ip_address == next_hop_address))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Yes, the ARP table need not be searched.  */
+            return(arp_ptr);
+        }
+    }
+    else
+    {
+
+        /* The entry is not for this route, the ARP entry is not stored.  */
+        entry_ptr =  NX_NULL;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Calculate the hash index for the next hop address.  */
+    index =  NX_ARP_TABLE_INDEX(ip_ptr, next_hop_address);
+
+    /* Determine if there is an entry for this IP address.  */
+    arp_ptr =  ip_ptr -> nx_ip_arp_table[index];
+
+    /* Loop to look for an ARP match.  */
+    while (arp_ptr)
+    {
+
+        /* Determine if this arp entry matches the next hop address.  */
+        if (arp_ptr -> nx_arp_ip_address == next_hop_address)
+        {
+
+            /* Yes, we found a match.  Get out of the loop!  */
+            break;
+        }
+
+        /* Move to the next active ARP entry.  */
+        arp_ptr =  arp_ptr -> nx_arp_active_next;
+
+        /* Determine if we are at the end of the ARP list.  */
+        if (arp_ptr == ip_ptr -> nx_ip_arp_table[index])
+        {
+
+            /* Clear the ARP pointer.  */
+            arp_ptr =  NX_NULL;
+            break;
+        }
+    }
+
+    /* Determine if the ARP entry is to be stored.  */
+    if ((entry_ptr) && (arp_ptr))
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Store the ARP entry for the next packet, unless the route changed meanwhile.  */
+        if ((entry_ptr -> nx_ip_route_cache_destination == destination_address) &&
+            (entry_ptr -> nx_ip_route_cache_next_hop == next_hop_address))
+        {
+            entry_ptr -> nx_ip_route_cache_arp =             arp_ptr;
+            entry_ptr -> nx_ip_route_cache_arp_generation =  ip_ptr -> nx_ip_route_cache_arp_generation;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return the ARP entry.  */
+    return(arp_ptr);
+}
+#endif /* NX_ENABLE_IP_ROUTE_CACHE && !NX_DISABLE_IPV4 */
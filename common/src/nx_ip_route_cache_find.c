@@ -0,0 +1,172 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv4.h"
+
+#if defined(NX_ENABLE_IP_ROUTE_CACHE) && !defined(NX_DISABLE_IPV4)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_cache_find                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the outgoing interface and the next hop of a    */
+/*    unicast destination through the route cache.  The cache entry of    */
+/*    the destination is used while the route generation of the IP        */
+/*    instance is unchanged and the link of the interface is up,          */
+/*    otherwise the route is found again by _nx_ip_route_find and stored  */
+/*    in the entry.  Multicast and broadcast destinations, and            */
+/*    destinations sent through an interface chosen by the caller, go to  */
+/*    _nx_ip_route_find directly.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    destination_address                   Destination address           */
+/*    ip_interface_ptr                      Pointer to interface, in and  */
+/*                                            out                         */
+/*    next_hop_address                      Pointer to next hop address   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status of route    */
+/*                                            find                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_find                     Find suitable outgoing        */
+/*                                            interface                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_send                    IP packet transmit            */
+/*    _nx_ip_raw_packet_send                Send raw IP packet            */
+/*    _nxd_tcp_client_socket_connect        TCP Client socket connection  */
+/*    _nxd_udp_socket_send                  UDP packet send               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_route_cache_find(NX_IP *ip_ptr, ULONG destination_address, NX_INTERFACE **ip_interface_ptr, ULONG *next_hop_address)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_ROUTE_CACHE_ENTRY *entry_ptr;
+ULONG                    generation;
+ULONG                    status;
+
+
+    /* Determine if the route is cached.  */
+    if ((*ip_interface_ptr != NX_NULL) ||
+        ((destination_address & NX_IP_CLASS_D_MASK) == NX_IP_CLASS_D_TYPE) ||
+        (destination_address == NX_IP_LIMITED_BROADCAST))
+    {
+
+        /* No, find the route.  */
+        return(_nx_ip_route_find(ip_ptr, destination_address, ip_interface_ptr, next_hop_address));
+    }
+
+    /* Pickup the cache entry of the destination.  */
+    entry_ptr =  &(ip_ptr -> nx_ip_route_cache[NX_IP_ROUTE_CACHE_INDEX(destination_address)]);
+
+    /* Disable interrupts, the cache is also used by threads that do not hold the IP protection.  */
+    TX_DISABLE
+
+    /* Determine if the entry holds the current route to the destination.  */
+    if ((entry_ptr -> nx_ip_route_cache_interface) &&
+        (entry_ptr -> nx_ip_route_cache_destination == destination_address) &&
+        (entry_ptr -> nx_ip_route_cache_route_generation == ip_ptr -> nx_ip_route_cache_generation) &&
+        (entry_ptr -> nx_ip_route_cache_interface -> nx_interface_link_up))
+    {
+
+        /* Yes, use the interface and the next hop of the entry.  */
+        *ip_interface_ptr =  entry_ptr -> nx_ip_route_cache_interface;
+        *next_hop_address =  entry_ptr -> nx_ip_route_cache_next_hop;
+
+#ifndef NX_DISABLE_IP_INFO
+
+        /* Increment the route cache hit count.  */
+        ip_ptr -> nx_ip_route_cache_hits++;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        return(NX_SUCCESS);
+    }
+
+#ifndef NX_DISABLE_IP_INFO
+
+    /* Increment the route cache miss count.  */
+    ip_ptr -> nx_ip_route_cache_misses++;
+#endif
+
+    /* Pickup the route generation before the route is found, so a change made meanwhile
+       leaves the entry stale.  */
+    generation =  ip_ptr -> nx_ip_route_cache_generation;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Find the route.  */
+    status =  _nx_ip_route_find(ip_ptr, destination_address, ip_interface_ptr, next_hop_address);
+
+    if (status == NX_SUCCESS)
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Store the route in the entry.  The ARP entry of the next hop is stored when the
+           first packet is sent.  */
+        entry_ptr -> nx_ip_route_cache_destination =       destination_address;
+        entry_ptr -> nx_ip_route_cache_next_hop =          *next_hop_address;
+        entry_ptr -> nx_ip_route_cache_interface =         *ip_interface_ptr;
+        entry_ptr -> nx_ip_route_cache_arp =               NX_NULL;
+        entry_ptr -> nx_ip_route_cache_route_generation =  generation;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return the status of the route find.  */
+    return(status);
+}
+#endif /* NX_ENABLE_IP_ROUTE_CACHE && !NX_DISABLE_IPV4 */
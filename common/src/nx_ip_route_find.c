@@ -95,6 +95,9 @@ ULONG  _nx_ip_route_find(NX_IP *ip_ptr, ULONG destination_address, NX_INTERFACE
 
 NX_INTERFACE *interface_ptr;
 ULONG         i;
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+NX_IP_ROUTE_NODE *node_ptr;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
     /* Initialize the next hop address. */
     *next_hop_address = 0;
@@ -157,6 +160,44 @@ ULONG         i;
 
 #ifdef NX_ENABLE_IP_STATIC_ROUTING
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* Search the routing trie from the longest matching prefix to the shortest. */
+    for (node_ptr = _nx_ip_route_trie_find(ip_ptr -> nx_ip_route_trie_ipv4, &destination_address, 32);
+         node_ptr != NX_NULL;
+         node_ptr = node_ptr -> nx_ip_route_node_parent)
+    {
+
+        /* Get the interface. */
+        interface_ptr = node_ptr -> nx_ip_route_node_interface;
+
+        /* Skip node that only joins two subtries, and interface that is not up. */
+        if ((interface_ptr == NX_NULL) || (interface_ptr -> nx_interface_link_up == NX_FALSE))
+        {
+            continue;
+        }
+
+        /* Is next hop address still reachable? */
+        if (interface_ptr -> nx_interface_ip_network !=
+            (node_ptr -> nx_ip_route_node_next_hop[0] & interface_ptr -> nx_interface_ip_network_mask))
+        {
+            continue;
+        }
+
+        /* Use the entry information for interface and next hop. */
+        if (*ip_interface_ptr == NX_NULL)
+        {
+            *ip_interface_ptr = interface_ptr;
+        }
+        else if (*ip_interface_ptr != interface_ptr)
+        {
+            continue;
+        }
+
+        *next_hop_address = node_ptr -> nx_ip_route_node_next_hop[0];
+
+        return(NX_SUCCESS);
+    }
+#else
     /* Search through the routing table for a suitable interface. */
     for (i = 0; i < ip_ptr -> nx_ip_routing_table_entry_count; i++)
     {
@@ -198,6 +239,7 @@ ULONG         i;
             return(NX_SUCCESS);
         }
     }
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
 #endif /* NX_ENABLE_IP_STATIC_ROUTING */
 
@@ -0,0 +1,124 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_common_length                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of leading bits an address has in  */
+/*    common with a prefix, up to the length of the prefix.  Only the     */
+/*    words covered by the prefix length are read, so an IPv4 address     */
+/*    can be passed as a single word.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    address                               Address in host byte order    */
+/*    prefix                                Prefix in host byte order     */
+/*    prefix_length                         Number of bits to compare     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    length                                Number of leading bits in     */
+/*                                            common                      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_route_trie_find                Find the longest matching     */
+/*                                            node                        */
+/*    _nx_ip_route_trie_insert              Insert a prefix into a        */
+/*                                            routing trie                */
+/*    _nx_ip_route_trie_search              Search a route of a prefix    */
+/*    _nx_invalidate_destination_prefix     Invalidate destinations of a  */
+/*                                            prefix                      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_route_trie_common_length(ULONG *address, ULONG *prefix, ULONG prefix_length)
+{
+
+ULONG length;
+ULONG difference;
+UINT  i;
+
+
+    /* Compare the address and the prefix a word at a time.  */
+    length =  0;
+    for (i = 0; length < prefix_length; i++)
+    {
+
+        /* Pickup the bits that differ.  */
+        difference =  address[i] ^ prefix[i];
+
+        if (difference)
+        {
+
+            /* Count the leading bits that are the same.  */
+            while ((difference & 0x80000000UL) == 0)
+            {
+                difference =  difference << 1;
+                length++;
+            }
+
+            break;
+        }
+
+        /* The whole word is the same.  */
+        length +=  32;
+    }
+
+    /* Limit the length to the prefix.  */
+    if (length > prefix_length)
+    {
+        length =  prefix_length;
+    }
+
+    /* Return the number of bits in common.  */
+    return(length);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
@@ -0,0 +1,117 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_find                              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the node of the routing trie with the longest   */
+/*    prefix that matches an address.  The node may only join two         */
+/*    subtries, so the caller walks from the node to the root through     */
+/*    the parent links, where the matching routes are found from the      */
+/*    longest prefix to the shortest.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    root_ptr                              Root of the routing trie      */
+/*    address                               Address in host byte order    */
+/*    address_length                        Number of bits of the address */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    node_ptr                              Longest matching node,        */
+/*                                            NX_NULL if no node matches  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_common_length       Compare address with prefix   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_route_find                     Find IPv4 route               */
+/*    _nxd_ipv6_static_route_find           Find IPv6 static route        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_IP_ROUTE_NODE  *_nx_ip_route_trie_find(NX_IP_ROUTE_NODE *root_ptr, ULONG *address, ULONG address_length)
+{
+
+NX_IP_ROUTE_NODE *node_ptr;
+NX_IP_ROUTE_NODE *match_ptr;
+ULONG             prefix_length;
+
+
+    /* Walk down the trie from the root.  */
+    match_ptr =  NX_NULL;
+    node_ptr =   root_ptr;
+    while (node_ptr)
+    {
+
+        /* Pickup the prefix length of the node.  */
+        prefix_length =  node_ptr -> nx_ip_route_node_prefix_length;
+
+        /* Stop if the address is not in the prefix of the node.  */
+        if (_nx_ip_route_trie_common_length(address, node_ptr -> nx_ip_route_node_prefix, prefix_length) < prefix_length)
+        {
+            break;
+        }
+
+        /* The node matches, remember it.  */
+        match_ptr =  node_ptr;
+
+        /* Stop if the whole address is matched.  */
+        if (prefix_length >= address_length)
+        {
+            break;
+        }
+
+        /* Move to the child selected by the bit after the prefix.  */
+        node_ptr =  node_ptr -> nx_ip_route_node_child[NX_IP_ROUTE_TRIE_BIT(address, prefix_length)];
+    }
+
+    /* Return the longest matching node.  */
+    return(match_ptr);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
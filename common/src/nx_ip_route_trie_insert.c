@@ -0,0 +1,197 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_insert                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function inserts a prefix into the routing trie and returns    */
+/*    its node.  If the prefix is already in the trie, the existing node  */
+/*    is returned, which may or may not hold a route.  Otherwise a node   */
+/*    is added for the prefix, and if the prefix diverges from an         */
+/*    existing node, a second node is added to join them.  The caller     */
+/*    sets the route of the node.  It is called with the IP protection    */
+/*    held.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    root_ptr                              Pointer to root of the trie   */
+/*    prefix                                Prefix in host byte order     */
+/*    prefix_length                         Length of the prefix          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    node_ptr                              Node of the prefix, NX_NULL   */
+/*                                            if no node is available     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_common_length       Compare address with prefix   */
+/*    _nx_ip_route_trie_node_allocate       Allocate a trie node          */
+/*    _nx_ip_route_trie_node_release        Release a trie node           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_static_route_add               Add IPv4 static route         */
+/*    _nxd_ipv6_static_route_add            Add IPv6 static route         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_IP_ROUTE_NODE  *_nx_ip_route_trie_insert(NX_IP *ip_ptr, NX_IP_ROUTE_NODE **root_ptr, ULONG *prefix, ULONG prefix_length)
+{
+
+NX_IP_ROUTE_NODE  *node_ptr;
+NX_IP_ROUTE_NODE  *parent_ptr;
+NX_IP_ROUTE_NODE  *new_node_ptr;
+NX_IP_ROUTE_NODE  *join_node_ptr;
+NX_IP_ROUTE_NODE **link_ptr;
+ULONG              common_length;
+ULONG              node_length;
+UINT               i;
+
+
+    /* Walk down the trie from the root, to the link where the prefix belongs.  */
+    common_length =  0;
+    parent_ptr =     NX_NULL;
+    link_ptr =       root_ptr;
+    while ((node_ptr = *link_ptr) != NX_NULL)
+    {
+
+        /* Compare the prefix with the prefix of the node.  */
+        node_length =  node_ptr -> nx_ip_route_node_prefix_length;
+        common_length =  _nx_ip_route_trie_common_length(prefix, node_ptr -> nx_ip_route_node_prefix,
+                                                         (node_length < prefix_length) ? node_length : prefix_length);
+
+        /* Stop unless the prefix is in the prefix of the node.  */
+        if (common_length < node_length)
+        {
+            break;
+        }
+
+        /* Determine if the node has the same prefix.  */
+        if (common_length == prefix_length)
+        {
+            return(node_ptr);
+        }
+
+        /* Move to the child selected by the bit after the prefix of the node.  */
+        parent_ptr =  node_ptr;
+        link_ptr =    &(node_ptr -> nx_ip_route_node_child[NX_IP_ROUTE_TRIE_BIT(prefix, node_length)]);
+    }
+
+    /* Allocate the node of the prefix.  */
+    new_node_ptr =  _nx_ip_route_trie_node_allocate(ip_ptr);
+    if (new_node_ptr == NX_NULL)
+    {
+        return(NX_NULL);
+    }
+
+    /* Copy the words covered by the prefix, clearing the bits after it.  */
+    for (i = 0; (i * 32) < prefix_length; i++)
+    {
+        new_node_ptr -> nx_ip_route_node_prefix[i] =  prefix[i];
+        if (prefix_length < ((i + 1) * 32))
+        {
+            new_node_ptr -> nx_ip_route_node_prefix[i] &=  (ULONG)(0xFFFFFFFFUL << (((i + 1) * 32) - prefix_length));
+        }
+    }
+    new_node_ptr -> nx_ip_route_node_prefix_length =  prefix_length;
+
+    /* Determine if the link is empty.  */
+    if (node_ptr == NX_NULL)
+    {
+
+        /* Yes, place the node at the link.  */
+        new_node_ptr -> nx_ip_route_node_parent =  parent_ptr;
+        *link_ptr =  new_node_ptr;
+        return(new_node_ptr);
+    }
+
+    /* Determine if the prefix covers the prefix of the node at the link.  */
+    if (common_length == prefix_length)
+    {
+
+        /* Yes, the node at the link moves under the new node.  */
+        new_node_ptr -> nx_ip_route_node_parent =  parent_ptr;
+        new_node_ptr -> nx_ip_route_node_child[NX_IP_ROUTE_TRIE_BIT(node_ptr -> nx_ip_route_node_prefix, prefix_length)] =  node_ptr;
+        node_ptr -> nx_ip_route_node_parent =  new_node_ptr;
+        *link_ptr =  new_node_ptr;
+        return(new_node_ptr);
+    }
+
+    /* The prefixes diverge, allocate a node to join them at the common prefix.  */
+    join_node_ptr =  _nx_ip_route_trie_node_allocate(ip_ptr);
+    if (join_node_ptr == NX_NULL)
+    {
+
+        /* No node is available, release the node of the prefix.  */
+        _nx_ip_route_trie_node_release(ip_ptr, new_node_ptr);
+        return(NX_NULL);
+    }
+
+    /* Copy the common prefix.  */
+    for (i = 0; (i * 32) < common_length; i++)
+    {
+        join_node_ptr -> nx_ip_route_node_prefix[i] =  new_node_ptr -> nx_ip_route_node_prefix[i];
+        if (common_length < ((i + 1) * 32))
+        {
+            join_node_ptr -> nx_ip_route_node_prefix[i] &=  (ULONG)(0xFFFFFFFFUL << (((i + 1) * 32) - common_length));
+        }
+    }
+    join_node_ptr -> nx_ip_route_node_prefix_length =  common_length;
+
+    /* Link both nodes under the joining node, which takes the place of the node at the link.  */
+    join_node_ptr -> nx_ip_route_node_parent =  parent_ptr;
+    join_node_ptr -> nx_ip_route_node_child[NX_IP_ROUTE_TRIE_BIT(prefix, common_length)] =  new_node_ptr;
+    join_node_ptr -> nx_ip_route_node_child[NX_IP_ROUTE_TRIE_BIT(node_ptr -> nx_ip_route_node_prefix, common_length)] =  node_ptr;
+    new_node_ptr -> nx_ip_route_node_parent =  join_node_ptr;
+    node_ptr -> nx_ip_route_node_parent =  join_node_ptr;
+    *link_ptr =  join_node_ptr;
+
+    /* Return the node of the prefix.  */
+    return(new_node_ptr);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
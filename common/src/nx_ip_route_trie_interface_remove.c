@@ -0,0 +1,135 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_interface_remove                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes all the routes of an interface from the       */
+/*    routing trie.  It is called with the IP protection held.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    root_ptr                              Pointer to root of the trie   */
+/*    interface_ptr                         Pointer to interface          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    routes_removed                        Number of routes removed      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_remove              Remove a route from a routing */
+/*                                            trie                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_interface_detach               Detach an IP interface        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_route_trie_interface_remove(NX_IP *ip_ptr, NX_IP_ROUTE_NODE **root_ptr, NX_INTERFACE *interface_ptr)
+{
+
+NX_IP_ROUTE_NODE *node_ptr;
+ULONG             routes_removed;
+
+
+    /* Visit the nodes of the trie in preorder.  */
+    routes_removed =  0;
+    node_ptr =  *root_ptr;
+    while (node_ptr)
+    {
+
+        /* Determine if the node holds a route of the interface.  */
+        if (node_ptr -> nx_ip_route_node_interface == interface_ptr)
+        {
+
+            /* Yes, remove the route.  */
+            _nx_ip_route_trie_remove(ip_ptr, root_ptr, node_ptr);
+            routes_removed++;
+
+            /* Nodes may have been released, start again from the root.  */
+            node_ptr =  *root_ptr;
+            continue;
+        }
+
+        /* Move to the first child of the node.  */
+        if (node_ptr -> nx_ip_route_node_child[0])
+        {
+            node_ptr =  node_ptr -> nx_ip_route_node_child[0];
+        }
+        else if (node_ptr -> nx_ip_route_node_child[1])
+        {
+            node_ptr =  node_ptr -> nx_ip_route_node_child[1];
+        }
+        else
+        {
+
+            /* Move up to the first node with a second child not visited yet.  */
+            while ((node_ptr -> nx_ip_route_node_parent) &&
+                   ((node_ptr -> nx_ip_route_node_parent -> nx_ip_route_node_child[1] == node_ptr) ||
+                    (node_ptr -> nx_ip_route_node_parent -> nx_ip_route_node_child[1] == NX_NULL)))
+            {
+                node_ptr =  node_ptr -> nx_ip_route_node_parent;
+            }
+
+            /* Move to the second child, the walk is done at the root.  */
+            if (node_ptr -> nx_ip_route_node_parent)
+            {
+                node_ptr =  node_ptr -> nx_ip_route_node_parent -> nx_ip_route_node_child[1];
+            }
+            else
+            {
+                node_ptr =  NX_NULL;
+            }
+        }
+    }
+
+    /* Return the number of routes removed.  */
+    return(routes_removed);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
@@ -0,0 +1,112 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_node_allocate                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a node of the routing trie.  The nodes      */
+/*    released to the free list, which also holds the nodes of the        */
+/*    memory added by the application, are used first, then the nodes     */
+/*    built into the IP instance.  It is called with the IP protection    */
+/*    held.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    node_ptr                              Pointer to the cleared node,  */
+/*                                            NX_NULL if no node is       */
+/*                                            available                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    memset                                Clear the node                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_route_trie_insert              Insert a prefix into a        */
+/*                                            routing trie                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_IP_ROUTE_NODE  *_nx_ip_route_trie_node_allocate(NX_IP *ip_ptr)
+{
+
+NX_IP_ROUTE_NODE *node_ptr;
+
+
+    /* Pickup the first node of the free list.  */
+    node_ptr =  ip_ptr -> nx_ip_route_trie_free_list;
+
+    if (node_ptr)
+    {
+
+        /* Remove the node from the free list.  */
+        ip_ptr -> nx_ip_route_trie_free_list =  node_ptr -> nx_ip_route_node_child[0];
+    }
+    else if (ip_ptr -> nx_ip_route_trie_nodes_used < (NX_IP_ROUTING_TABLE_SIZE * 2))
+    {
+
+        /* Use the next node built into the IP instance.  */
+        node_ptr =  &(ip_ptr -> nx_ip_route_trie_nodes[ip_ptr -> nx_ip_route_trie_nodes_used]);
+        ip_ptr -> nx_ip_route_trie_nodes_used++;
+    }
+    else
+    {
+
+        /* No node is available.  */
+        return(NX_NULL);
+    }
+
+    /* Clear the node.  */
+    memset(node_ptr, 0, sizeof(NX_IP_ROUTE_NODE));
+
+    /* Return the node.  */
+    return(node_ptr);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
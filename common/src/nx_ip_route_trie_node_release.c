@@ -0,0 +1,88 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_node_release                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a node of the routing trie to the free list.  */
+/*    It is called with the IP protection held.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    node_ptr                              Pointer to node to release    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_route_trie_insert              Insert a prefix into a        */
+/*                                            routing trie                */
+/*    _nx_ip_route_trie_remove              Remove a route from a routing */
+/*                                            trie                        */
+/*    _nx_ip_static_route_table_extend      Add memory for static routes  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_route_trie_node_release(NX_IP *ip_ptr, NX_IP_ROUTE_NODE *node_ptr)
+{
+
+    /* Clear the route and the links of the node.  */
+    node_ptr -> nx_ip_route_node_interface =  NX_NULL;
+    node_ptr -> nx_ip_route_node_parent =     NX_NULL;
+    node_ptr -> nx_ip_route_node_child[1] =   NX_NULL;
+
+    /* Place the node at the front of the free list.  */
+    node_ptr -> nx_ip_route_node_child[0] =   ip_ptr -> nx_ip_route_trie_free_list;
+    ip_ptr -> nx_ip_route_trie_free_list =    node_ptr;
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
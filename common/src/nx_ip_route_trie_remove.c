@@ -0,0 +1,141 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_remove                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the route of a node from the routing trie.    */
+/*    The nodes that are left holding no route with fewer than two        */
+/*    children are released, so the trie never holds more than two nodes  */
+/*    per route.  It is called with the IP protection held.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    root_ptr                              Pointer to root of the trie   */
+/*    node_ptr                              Node of the route             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_node_release        Release a trie node           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_route_trie_interface_remove    Remove routes of an interface */
+/*    _nx_ip_static_route_delete            Delete IPv4 static route      */
+/*    _nxd_ipv6_static_route_delete         Delete IPv6 static route      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_route_trie_remove(NX_IP *ip_ptr, NX_IP_ROUTE_NODE **root_ptr, NX_IP_ROUTE_NODE *node_ptr)
+{
+
+NX_IP_ROUTE_NODE  *parent_ptr;
+NX_IP_ROUTE_NODE  *child_ptr;
+NX_IP_ROUTE_NODE **link_ptr;
+
+
+    /* Clear the route of the node.  */
+    node_ptr -> nx_ip_route_node_interface =  NX_NULL;
+
+    /* Release the nodes that are no longer needed, from the node up to the root.  */
+    while ((node_ptr != NX_NULL) && (node_ptr -> nx_ip_route_node_interface == NX_NULL))
+    {
+
+        /* A node joining two subtries is still needed.  */
+        if ((node_ptr -> nx_ip_route_node_child[0] != NX_NULL) &&
+            (node_ptr -> nx_ip_route_node_child[1] != NX_NULL))
+        {
+            break;
+        }
+
+        /* Pickup the only child of the node, if any.  */
+        child_ptr =  node_ptr -> nx_ip_route_node_child[0];
+        if (child_ptr == NX_NULL)
+        {
+            child_ptr =  node_ptr -> nx_ip_route_node_child[1];
+        }
+
+        /* Find the link to the node.  */
+        parent_ptr =  node_ptr -> nx_ip_route_node_parent;
+        if (parent_ptr == NX_NULL)
+        {
+            link_ptr =  root_ptr;
+        }
+        else if (parent_ptr -> nx_ip_route_node_child[0] == node_ptr)
+        {
+            link_ptr =  &(parent_ptr -> nx_ip_route_node_child[0]);
+        }
+        else
+        {
+            link_ptr =  &(parent_ptr -> nx_ip_route_node_child[1]);
+        }
+
+        /* Replace the node with its child.  */
+        *link_ptr =  child_ptr;
+        if (child_ptr)
+        {
+            child_ptr -> nx_ip_route_node_parent =  parent_ptr;
+        }
+
+        /* Release the node.  */
+        _nx_ip_route_trie_node_release(ip_ptr, node_ptr);
+
+        /* The parent keeps its number of children if the child took the place of the node.  */
+        if (child_ptr)
+        {
+            break;
+        }
+
+        /* Check the parent, which lost a child.  */
+        node_ptr =  parent_ptr;
+    }
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
@@ -0,0 +1,118 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_search                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function searches the routing trie for the route of a prefix.  */
+/*    The prefix must match exactly.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    root_ptr                              Root of the routing trie      */
+/*    prefix                                Prefix in host byte order     */
+/*    prefix_length                         Length of the prefix          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    node_ptr                              Node of the route, NX_NULL if */
+/*                                            the route is not found      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_common_length       Compare address with prefix   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_static_route_add               Add IPv4 static route         */
+/*    _nx_ip_static_route_delete            Delete IPv4 static route      */
+/*    _nxd_ipv6_static_route_delete         Delete IPv6 static route      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_IP_ROUTE_NODE  *_nx_ip_route_trie_search(NX_IP_ROUTE_NODE *root_ptr, ULONG *prefix, ULONG prefix_length)
+{
+
+NX_IP_ROUTE_NODE *node_ptr;
+ULONG             node_length;
+
+
+    /* Walk down the trie from the root.  */
+    node_ptr =  root_ptr;
+    while (node_ptr)
+    {
+
+        /* Pickup the prefix length of the node.  */
+        node_length =  node_ptr -> nx_ip_route_node_prefix_length;
+
+        /* Stop if the prefix is not in the prefix of the node.  */
+        if ((node_length > prefix_length) ||
+            (_nx_ip_route_trie_common_length(prefix, node_ptr -> nx_ip_route_node_prefix, node_length) < node_length))
+        {
+            break;
+        }
+
+        /* Determine if the node has the same prefix.  */
+        if (node_length == prefix_length)
+        {
+
+            /* Yes, the route is found if the node holds one.  */
+            if (node_ptr -> nx_ip_route_node_interface)
+            {
+                return(node_ptr);
+            }
+
+            break;
+        }
+
+        /* Move to the child selected by the bit after the prefix of the node.  */
+        node_ptr =  node_ptr -> nx_ip_route_node_child[NX_IP_ROUTE_TRIE_BIT(prefix, node_length)];
+    }
+
+    /* The route is not found.  */
+    return(NX_NULL);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
@@ -61,6 +61,9 @@
 /*                                                                        */
 /*    tx_mutex_get                          Obtain a protection mutex     */
 /*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_ip_route_trie_search              Search a route of a prefix    */
+/*    _nx_ip_route_trie_insert              Insert a prefix into a        */
+/*                                            routing trie                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -85,10 +88,29 @@ UINT  _nx_ip_static_route_add(NX_IP *ip_ptr, ULONG network_address,
 #if !defined(NX_DISABLE_IPV4) && defined(NX_ENABLE_IP_STATIC_ROUTING)
 INT           i;
 NX_INTERFACE *nx_ip_interface = NX_NULL;
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+NX_IP_ROUTE_NODE *node_ptr;
+ULONG         prefix_length;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_STATIC_ROUTE_ADD, ip_ptr, network_address, net_mask, next_hop, NX_TRACE_IP_EVENTS, 0, 0);
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* Convert the network mask to the prefix length of the routing trie.  */
+    prefix_length = 0;
+    while ((prefix_length < 32) && (net_mask & (0x80000000UL >> prefix_length)))
+    {
+        prefix_length++;
+    }
+
+    /* The routing trie only holds contiguous network masks.  */
+    if ((prefix_length < 32) && (net_mask << prefix_length))
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
     /* Obtain the IP mutex so we can manipulate the internal routing table. */
     /* This routine does not need to be protected by mask off interrupt
        because it cannot be invoked from ISR. */
@@ -122,6 +144,40 @@ NX_INTERFACE *nx_ip_interface = NX_NULL;
     /* Obtain the network address, based on net_mask passed in. */
     network_address = network_address & net_mask;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* Check whether the same route exists. */
+    node_ptr = _nx_ip_route_trie_search(ip_ptr -> nx_ip_route_trie_ipv4, &network_address, prefix_length);
+    if (node_ptr == NX_NULL)
+    {
+
+        /* Check whether the table is full. */
+        if (ip_ptr -> nx_ip_route_trie_count >= ip_ptr -> nx_ip_route_trie_capacity)
+        {
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+            return(NX_OVERFLOW);
+        }
+
+        /* Add the network to the routing trie. */
+        node_ptr = _nx_ip_route_trie_insert(ip_ptr, &(ip_ptr -> nx_ip_route_trie_ipv4), &network_address, prefix_length);
+        if (node_ptr == NX_NULL)
+        {
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+            return(NX_OVERFLOW);
+        }
+
+        ip_ptr -> nx_ip_route_trie_count++;
+        ip_ptr -> nx_ip_routing_table_entry_count++;
+    }
+
+    /* Set the next hop and interface of the route. */
+    node_ptr -> nx_ip_route_node_next_hop[0] = next_hop;
+    node_ptr -> nx_ip_route_node_interface = nx_ip_interface;
+#else
     /* Search through the routing table, check whether the same entry exists. */
     for (i = 0; i < (INT)ip_ptr -> nx_ip_routing_table_entry_count; i++)
     {
@@ -189,6 +245,7 @@ NX_INTERFACE *nx_ip_interface = NX_NULL;
     ip_ptr -> nx_ip_routing_table[i].nx_ip_routing_entry_ip_interface = nx_ip_interface;
 
     ip_ptr -> nx_ip_routing_table_entry_count++;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
     /* Unlock the mutex. */
     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
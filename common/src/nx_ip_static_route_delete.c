@@ -62,6 +62,9 @@
 /*                                                                        */
 /*    tx_mutex_get                                                        */
 /*    tx_mutex_put                                                        */
+/*    _nx_ip_route_trie_search              Search a route of a prefix    */
+/*    _nx_ip_route_trie_remove              Remove a route from a routing */
+/*                                            trie                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -84,9 +87,15 @@ UINT  _nx_ip_static_route_delete(NX_IP *ip_ptr, ULONG network_address, ULONG net
 {
 
 #if !defined(NX_DISABLE_IPV4) && defined(NX_ENABLE_IP_STATIC_ROUTING)
+#ifndef NX_ENABLE_IP_ROUTE_TRIE
 UINT i;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 UINT found_match    = NX_FALSE;
 UINT status         = NX_NOT_SUCCESSFUL;
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+NX_IP_ROUTE_NODE *node_ptr;
+ULONG prefix_length;
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
 
     network_address = network_address & net_mask;
@@ -108,6 +117,30 @@ UINT status         = NX_NOT_SUCCESSFUL;
         return(NX_SUCCESS);
     }
 
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+    /* Convert the network mask to the prefix length of the routing trie. */
+    prefix_length = 0;
+    while ((prefix_length < 32) && (net_mask & (0x80000000UL >> prefix_length)))
+    {
+        prefix_length++;
+    }
+
+    /* Only contiguous network masks are in the routing trie. */
+    if ((prefix_length == 32) || ((net_mask << prefix_length) == 0))
+    {
+
+        /* Search the routing trie for the entry. */
+        node_ptr = _nx_ip_route_trie_search(ip_ptr -> nx_ip_route_trie_ipv4, &network_address, prefix_length);
+        if (node_ptr)
+        {
+
+            /* Found the entry, remove it from the trie. */
+            _nx_ip_route_trie_remove(ip_ptr, &(ip_ptr -> nx_ip_route_trie_ipv4), node_ptr);
+            ip_ptr -> nx_ip_route_trie_count--;
+            found_match = NX_TRUE;
+        }
+    }
+#else
     /* Search through the routing table, check whether the same entry exists. */
     for (i = 0; i < ip_ptr -> nx_ip_routing_table_entry_count; i++)
     {
@@ -139,6 +172,7 @@ UINT status         = NX_NOT_SUCCESSFUL;
             break;
         }
     }
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
 
     /* Don't forget to decrease table count if we were
        able to delete the requested static route. */
@@ -147,6 +181,11 @@ UINT status         = NX_NOT_SUCCESSFUL;
 
         ip_ptr -> nx_ip_routing_table_entry_count--;
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+        /* Invalidate the routes in the route cache.  */
+        ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
         /* Indicate successful deletion. */
         status = NX_SUCCESS;
     }
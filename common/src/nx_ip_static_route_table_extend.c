@@ -0,0 +1,117 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_static_route_table_extend                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds memory for the static routes of the IP           */
+/*    instance.  The IP instance holds NX_IP_ROUTING_TABLE_SIZE IPv4 and  */
+/*    IPv6 routes, and each route added beyond that takes two nodes of    */
+/*    the routing trie from the supplied memory.  The memory is used      */
+/*    until the IP instance is deleted.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    table_memory                          Pointer to table memory       */
+/*    table_size                            Size of table memory in bytes */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_ip_route_trie_node_release        Place node on the free list   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_static_route_table_extend(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size)
+{
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+ULONG             i;
+ULONG             routes;
+NX_IP_ROUTE_NODE *node_ptr;
+
+
+    /* Determine how many routes fit in the table memory.  */
+    routes =  (ULONG)(table_size / (2 * sizeof(NX_IP_ROUTE_NODE)));
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_STATIC_ROUTE_TABLE_EXTEND, ip_ptr, table_memory, table_size, routes, NX_TRACE_IP_EVENTS, 0, 0);
+
+    /* Obtain the IP mutex so we can manipulate the routing trie.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Place the nodes of the table memory on the free list.  */
+    node_ptr =  (NX_IP_ROUTE_NODE *)table_memory;
+    for (i = 0; i < (routes * 2); i++)
+    {
+        _nx_ip_route_trie_node_release(ip_ptr, &node_ptr[i]);
+    }
+
+    /* Update the number of routes the trie can hold.  */
+    ip_ptr -> nx_ip_route_trie_capacity +=  routes;
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_IP_ROUTE_TRIE */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(table_memory);
+    NX_PARAMETER_NOT_USED(table_size);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+}
@@ -86,6 +86,8 @@
 /*    (nx_ip_igmp_queue_process)            IGMP message queue processing */
 /*    (nx_ip_igmp_periodic_processing)      IGMP periodic processing      */
 /*    (nx_ip_tcp_queue_process)             TCP message queue processing  */
+/*    (nx_ip_tcp_coalesce_flush)            Process held TCP packets      */
+/*    (nx_ip_tcp_ack_pending_flush)         Send held TCP ACKs            */
 /*    (nx_ip_tcp_periodic_processing)       TCP periodic processing       */
 /*    (nx_tcp_deferred_cleanup_check)       TCP deferred cleanup check    */
 /*    _nx_ipsec_sa_lifetime_tick            IPsec lifetime tick update    */
@@ -305,6 +307,22 @@ NXD_IPV6_ADDRESS *interface_ipv6_address;
         if (ip_events & NX_IP_RECEIVE_EVENT)
         {
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+            /* Hold the TCP packets for coalescing while the queue is processed.  */
+            if (ip_ptr -> nx_ip_tcp_coalesce_flush)
+            {
+                ip_ptr -> nx_ip_tcp_coalesce_active =  NX_TRUE;
+            }
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+            /* Hold the TCP ACKs while the queue is processed.  */
+            if (ip_ptr -> nx_ip_tcp_ack_pending_flush)
+            {
+                ip_ptr -> nx_ip_tcp_ack_pending_active =  NX_TRUE;
+            }
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
             /* Loop to process all deferred packet requests.  */
             while (ip_ptr -> nx_ip_deferred_received_packet_head)
             {
@@ -335,6 +353,24 @@ NXD_IPV6_ADDRESS *interface_ipv6_address;
                 _nx_ip_packet_receive(ip_ptr, packet_ptr);
             }
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+            /* The queue is empty, process the held TCP packets.  */
+            if (ip_ptr -> nx_ip_tcp_coalesce_active)
+            {
+                ip_ptr -> nx_ip_tcp_coalesce_active =  NX_FALSE;
+                (ip_ptr -> nx_ip_tcp_coalesce_flush)(ip_ptr);
+            }
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+            /* The queue is empty, send the held TCP ACKs.  */
+            if (ip_ptr -> nx_ip_tcp_ack_pending_active)
+            {
+                ip_ptr -> nx_ip_tcp_ack_pending_active =  NX_FALSE;
+                (ip_ptr -> nx_ip_tcp_ack_pending_flush)(ip_ptr);
+            }
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
             /* Determine if there is anything else to do in the loop.  */
             ip_events =  ip_events & ~(NX_IP_RECEIVE_EVENT);
             if (!ip_events)
@@ -358,6 +394,26 @@ NXD_IPV6_ADDRESS *interface_ipv6_address;
             }
         }
 
+#ifdef NX_ENABLE_TCP_PACING
+        /* Check for a TCP pacing timer event.  */
+        if (ip_events & NX_IP_TCP_PACING_EVENT)
+        {
+
+            /* Release the paced TCP sockets that may send again.  */
+            if (ip_ptr -> nx_ip_tcp_pacing_process)
+            {
+                (ip_ptr -> nx_ip_tcp_pacing_process)(ip_ptr);
+            }
+
+            /* Determine if there is anything else to do in the loop.  */
+            ip_events =  ip_events & ~(NX_IP_TCP_PACING_EVENT);
+            if (!ip_events)
+            {
+                continue;
+            }
+        }
+#endif /* NX_ENABLE_TCP_PACING */
+
         /* Check for a fast TCP event.  */
         if (ip_events & NX_IP_FAST_EVENT)
         {
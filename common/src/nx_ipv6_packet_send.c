@@ -73,11 +73,14 @@
 /*    _nx_ipv6_header_add                   Add IPv6 header               */
 /*    _nx_packet_transmit_release           Release transmit packet       */
 /*    _nx_nd_cache_add_entry                Add new entry to ND Cache     */
+/*    _nx_nd_cache_probe_list_add           Add entry to probe list       */
 /*    IPv6_Address_Type                     Find IPv6 address type        */
 /*    _nx_packet_copy                       Packet copy                   */
+/*    _nx_packet_clone                      Packet clone                  */
 /*    _nx_ip_packet_deferred_receive        Places received packets in    */
 /*                                            deferred packet queue       */
 /*    _nx_icmpv6_send_ns                    Send neighbor solicitation    */
+/*    _nxd_ipv6_static_route_find           Find IPv6 static route        */
 /*    _nxd_ipv6_search_onlink               Find onlink match             */
 /*    _nx_ipv6_fragment_processing          Fragment processing           */
 /*    (ip_link_driver)                      User supplied link driver     */
@@ -203,7 +206,12 @@ NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr;
     if (address_type == IPV6_ADDRESS_LOOPBACK)
     {
 
+#ifdef NX_ENABLE_PACKET_CLONE
+        /* Clone the packet, the data of chained packets is shared, not copied.  */
+        if (_nx_packet_clone(packet_ptr, &packet_copy, ip_ptr -> nx_ip_default_packet_pool, NX_NO_WAIT) == NX_SUCCESS)
+#else
         if (_nx_packet_copy(packet_ptr, &packet_copy, ip_ptr -> nx_ip_default_packet_pool, NX_NO_WAIT) == NX_SUCCESS)
+#endif /* NX_ENABLE_PACKET_CLONE */
         {
 
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
@@ -301,9 +309,28 @@ NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr;
             if (status != NX_SUCCESS)
             {
 
-                /* No; If the packet is either onlink or there is no default router,
-                   just copy the packet destination address to the 'next hop' address.  */
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+                /* No; If a static route of the interface matches the destination,
+                   send the packet to the next hop of the route.  */
+                if (_nxd_ipv6_static_route_find(ip_ptr, if_ptr, dest_address, next_hop_address) == NX_SUCCESS)
+                {
 
+                    /* Add the next_hop in destination table. */
+                    status = _nx_icmpv6_dest_table_add(ip_ptr, dest_address, &dest_entry_ptr,
+                                                       next_hop_address, if_ptr -> nx_interface_ip_mtu_size,
+                                                       NX_WAIT_FOREVER, packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr);
+
+                    /* Get the NDCacheEntry. */
+                    if (status == NX_SUCCESS)
+                    {
+                        NDCacheEntry = dest_entry_ptr -> nx_ipv6_destination_entry_nd_entry;
+                    }
+                }
+                else
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+                /* If the packet is either onlink or there is no default router,
+                   just copy the packet destination address to the 'next hop' address.  */
                 if (_nxd_ipv6_search_onlink(ip_ptr, dest_address))
                 {
                     COPY_IPV6_ADDRESS(dest_address, next_hop_address);
@@ -448,6 +475,12 @@ NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr;
 
                             /* Start Neighbor discovery process by advancing to the incomplete state. */
                             NDCacheEntry -> nx_nd_cache_nd_status = ND_CACHE_STATE_INCOMPLETE;
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+                            /* Hand the entry to the fast periodic update. */
+                            _nx_nd_cache_probe_list_add(ip_ptr, NDCacheEntry);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
                         }
 
                         /* Note that the 2nd last parameter sendUnicast is set to Zero. In this case
@@ -520,7 +553,12 @@ NX_IPV6_DESTINATION_ENTRY *dest_entry_ptr;
     }
 
     /* Does the packet payload exceed next hop MTU?  */
-    if (packet_ptr -> nx_packet_length > next_hop_mtu)
+    if ((packet_ptr -> nx_packet_length > next_hop_mtu)
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+        /* TCP packets to segment are split by the interface.  */
+        && (packet_ptr -> nx_packet_tcp_segment_size == 0)
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+       )
     {
 #ifndef NX_DISABLE_FRAGMENTATION
 #ifdef NX_IPSEC_ENABLE
@@ -1457,6 +1457,10 @@ NX_INTERFACE *interface_ptr = NX_NULL;
     interface_ptr -> nx_interface_ip_network_mask   = network_mask;
     interface_ptr -> nx_interface_ip_network        = ip_address & network_mask;
 #endif /* !NX_DISABLE_IPV4  */
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+    /* Invalidate the routes in the route cache.  */
+    ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
     interface_ptr -> nx_interface_name              = interface_name;
     interface_ptr -> nx_interface_vlan_tag          = (USHORT)(vlan_tag & 0xFFFF);
     interface_ptr -> nx_interface_vlan_valid        = NX_TRUE;
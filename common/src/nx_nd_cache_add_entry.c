@@ -76,6 +76,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_nd_cache_hash_insert              Link entry to hash bucket     */
+/*    _nx_nd_cache_hash_remove              Remove entry from hash bucket */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*                                                                        */
@@ -205,9 +207,21 @@ UINT timer_ticks_left;
        clean the nd cache. */
     _nx_nd_cache_delete_internal(ip_ptr, &ip_ptr -> nx_ipv6_nd_cache[first_available]);
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+    /* Remove the entry from the hash bucket of its previous IP address. */
+    _nx_nd_cache_hash_remove(ip_ptr, &ip_ptr -> nx_ipv6_nd_cache[first_available]);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
     /* Record the IP address. */
     COPY_IPV6_ADDRESS(dest_ip, ip_ptr -> nx_ipv6_nd_cache[first_available].nx_nd_cache_dest_ip);
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+    /* Link the entry to the hash bucket of the IP address. */
+    _nx_nd_cache_hash_insert(ip_ptr, &ip_ptr -> nx_ipv6_nd_cache[first_available]);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
     /* A new entry starts with CREATED status. */
     ip_ptr -> nx_ipv6_nd_cache[first_available].nx_nd_cache_nd_status = ND_CACHE_STATE_CREATED;
 
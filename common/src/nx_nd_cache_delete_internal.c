@@ -62,6 +62,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_transmit_releas            Packet Release                */
+/*    _nx_nd_cache_probe_list_remove        Remove entry from probe list  */
 /*    memset                                                              */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -116,6 +117,12 @@ NX_PACKET *pkt, *next_pkt;
     entry -> nx_nd_cache_nd_status = ND_CACHE_STATE_INVALID;
     entry -> nx_nd_cache_is_static = 0;
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+    /* The entry is no longer being probed. */
+    _nx_nd_cache_probe_list_remove(entry);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
     /* Is there a corresponding link in the default router list? */
     if (entry -> nx_nd_cache_is_router)
     {
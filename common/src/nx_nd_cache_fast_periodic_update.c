@@ -50,6 +50,10 @@
 /*    a NS is sent.  If MAX NS has been sent, this entry times out        */
 /*    and is marked as INVALID.                                           */
 /*                                                                        */
+/*    If NX_ENABLE_IPV6_ND_HASH_TABLE is defined, only the entries in the */
+/*    probe list are visited, and the ones that left the PROBE and        */
+/*    INCOMPLETE states are removed from the list.                        */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_ptr                                Pointer to the IP instance    */
@@ -63,6 +67,7 @@
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*    _nx_icmpv6_send_ns                    Transmit a new NS message.    */
+/*    _nx_nd_cache_probe_list_remove        Remove entry from probe list  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -89,22 +94,42 @@
 VOID _nx_nd_cache_fast_periodic_update(NX_IP *ip_ptr)
 {
 
-INT i;
+ND_CACHE_ENTRY *entry;
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+ND_CACHE_ENTRY *next_entry;
+
+    /* Loop through the entries being probed, and invalidate the ones that are timed out. */
+    for (entry = ip_ptr -> nx_ipv6_nd_cache_probe_list; entry; entry = next_entry)
+    {
+
+        /* Pickup the next entry, the entry may be removed from the list. */
+        next_entry = entry -> nx_nd_cache_probe_next;
+#else
+INT             i;
 
     /* Loop through all entries, and invalidate the ones that are timed out. */
     for (i = 0; i < NX_IPV6_NEIGHBOR_CACHE_SIZE; i++)
     {
 
+        /* Pickup the entry. */
+        entry = &ip_ptr -> nx_ipv6_nd_cache[i];
+
         /* Check the entry is valid. */
-        if (ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_nd_status == ND_CACHE_STATE_INVALID)
+        if (entry -> nx_nd_cache_nd_status == ND_CACHE_STATE_INVALID)
         {
             continue;
         }
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 
         /* Is this entry being checked for neighbor discovery? */
-        if ((ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_nd_status != ND_CACHE_STATE_PROBE) &&
-            (ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_nd_status != ND_CACHE_STATE_INCOMPLETE))
+        if ((entry -> nx_nd_cache_nd_status != ND_CACHE_STATE_PROBE) &&
+            (entry -> nx_nd_cache_nd_status != ND_CACHE_STATE_INCOMPLETE))
         {
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+            /* The entry left the PROBE and INCOMPLETE states, remove it from the list. */
+            _nx_nd_cache_probe_list_remove(entry);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 
             /* No, so skip over. */
             continue;
@@ -113,33 +138,33 @@ INT i;
 
 
         /* Has this entry timed out? */
-        if (ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_timer_tick == 0)
+        if (entry -> nx_nd_cache_timer_tick == 0)
         {
 
             /* Yes, is the max number of solicitations used up? */
-            if (ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_num_solicit == 0)
+            if (entry -> nx_nd_cache_num_solicit == 0)
             {
 
                 /* Yes; We already sent #num_solicit packets. So the destination
                    is unreachable.  Clean up router, destination and cache table entries and crosslinks. */
-                _nx_nd_cache_delete_internal(ip_ptr, &ip_ptr -> nx_ipv6_nd_cache[i]);
+                _nx_nd_cache_delete_internal(ip_ptr, entry);
             }
             else
             {
             /*  Send another solicitation (NS) packet. */
             INT uniCastNS;
 
-                uniCastNS = (ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_nd_status == ND_CACHE_STATE_PROBE);
+                uniCastNS = (entry -> nx_nd_cache_nd_status == ND_CACHE_STATE_PROBE);
 
                 /* Send out another mcast ns.*/
-                _nx_icmpv6_send_ns(ip_ptr, ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_dest_ip,
-                                   1, ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_outgoing_address, uniCastNS, &ip_ptr -> nx_ipv6_nd_cache[i]);
+                _nx_icmpv6_send_ns(ip_ptr, entry -> nx_nd_cache_dest_ip,
+                                   1, entry -> nx_nd_cache_outgoing_address, uniCastNS, entry);
 
                 /* Keep track of how many we have sent. */
-                ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_num_solicit--;
+                entry -> nx_nd_cache_num_solicit--;
 
                 /* Reset the expiration timer for sending the next NS.  */
-                ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_timer_tick = ip_ptr -> nx_ipv6_retrans_timer_ticks;
+                entry -> nx_nd_cache_timer_tick = ip_ptr -> nx_ipv6_retrans_timer_ticks;
             }
         }
         else
@@ -149,7 +174,7 @@ INT i;
                function are states whose timer tick was set in actual timer ticks (as compared
                with the slow periodic update where cache entry'timer ticks' are updated in
                seconds.  This is intentional and correct behavior. */
-            ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_timer_tick--;
+            entry -> nx_nd_cache_timer_tick--;
         }
     }
 }
@@ -82,12 +82,38 @@
 UINT _nx_nd_cache_find_entry(NX_IP *ip_ptr,
                              ULONG *dest_ip, ND_CACHE_ENTRY **nd_cache_entry)
 {
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+ND_CACHE_ENTRY *entry;
+#else
 UINT i;
 UINT index;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 
     /* Initialize the return value. */
     *nd_cache_entry = NX_NULL;
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+    /* Search the hash bucket of the dest_ip. */
+    entry = ip_ptr -> nx_ipv6_nd_cache_hash[NX_IPV6_ADDRESS_HASH_INDEX(dest_ip, NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE)];
+    while (entry)
+    {
+
+        if ((entry -> nx_nd_cache_nd_status != ND_CACHE_STATE_INVALID) &&
+            (entry -> nx_nd_cache_interface_ptr) &&
+            (CHECK_IPV6_ADDRESSES_SAME(&entry -> nx_nd_cache_dest_ip[0], dest_ip)))
+        {
+
+            /* find the entry */
+            *nd_cache_entry = entry;
+
+            return(NX_SUCCESS);
+        }
+
+        entry = entry -> nx_nd_cache_hash_next;
+    }
+#else
+
     /* Compute a simple hash based on the dest_ip */
     index = (UINT)((dest_ip[0] + dest_ip[1] + dest_ip[2] + dest_ip[3]) %
                    (NX_IPV6_NEIGHBOR_CACHE_SIZE));
@@ -114,6 +140,7 @@ UINT index;
             index = 0;
         }
     }
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
 
     return(NX_NOT_SUCCESSFUL);
 }
@@ -0,0 +1,88 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Neighbor Discovery Cache                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#include "nx_nd_cache.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IPV6_ND_HASH_TABLE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nd_cache_hash_insert                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function links the ND cache entry to the front of the hash     */
+/*    bucket of its neighbor IP address.  The entry must not be in a      */
+/*    hash bucket.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    entry                                 Pointer to ND cache entry     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nd_cache_add_entry                Add entry to ND cache         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_nd_cache_hash_insert(NX_IP *ip_ptr, ND_CACHE_ENTRY *entry)
+{
+
+UINT index;
+
+
+    /* Compute the hash bucket of the neighbor IP address.  */
+    index = NX_IPV6_ADDRESS_HASH_INDEX(entry -> nx_nd_cache_dest_ip, NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE);
+
+    /* Link the entry to the front of the bucket.  */
+    entry -> nx_nd_cache_hash_index = index;
+    entry -> nx_nd_cache_hash_next = ip_ptr -> nx_ipv6_nd_cache_hash[index];
+    ip_ptr -> nx_ipv6_nd_cache_hash[index] = entry;
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IPV6_ND_HASH_TABLE */
@@ -0,0 +1,98 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Neighbor Discovery Cache                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#include "nx_nd_cache.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IPV6_ND_HASH_TABLE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nd_cache_probe_list_add                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the ND cache entry to the list of entries in     */
+/*    the INCOMPLETE or PROBE state, which the ND cache fast periodic     */
+/*    update processes.  Nothing is done if the entry is already in the   */
+/*    list.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    entry                                 Pointer to ND cache entry     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ipv6_packet_send                  Send IPv6 packet              */
+/*    _nx_nd_cache_slow_periodic_update     ND cache periodic update      */
+/*    _nxd_bsd_ipv6_packet_send             Send IPv6 packet for BSD      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_nd_cache_probe_list_add(NX_IP *ip_ptr, ND_CACHE_ENTRY *entry)
+{
+
+    /* Determine if the entry is already in the list.  */
+    if (entry -> nx_nd_cache_probe_list)
+    {
+
+        /* Yes, just return.  */
+        return;
+    }
+
+    /* Link the entry to the front of the list.  */
+    entry -> nx_nd_cache_probe_next = ip_ptr -> nx_ipv6_nd_cache_probe_list;
+    entry -> nx_nd_cache_probe_previous = NX_NULL;
+    if (ip_ptr -> nx_ipv6_nd_cache_probe_list)
+    {
+        (ip_ptr -> nx_ipv6_nd_cache_probe_list) -> nx_nd_cache_probe_previous = entry;
+    }
+    ip_ptr -> nx_ipv6_nd_cache_probe_list = entry;
+    entry -> nx_nd_cache_probe_list = &(ip_ptr -> nx_ipv6_nd_cache_probe_list);
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IPV6_ND_HASH_TABLE */
@@ -0,0 +1,105 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Neighbor Discovery Cache                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#include "nx_nd_cache.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IPV6_ND_HASH_TABLE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nd_cache_probe_list_remove                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the ND cache entry from the list of entries   */
+/*    being probed.  Nothing is done if the entry is not in the list.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    entry                                 Pointer to ND cache entry     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nd_cache_delete_internal          Delete ND cache entry         */
+/*    _nx_nd_cache_fast_periodic_update     ND cache periodic update      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_nd_cache_probe_list_remove(ND_CACHE_ENTRY *entry)
+{
+
+    /* Determine if the entry is in the list.  */
+    if (entry -> nx_nd_cache_probe_list == NX_NULL)
+    {
+
+        /* No, just return.  */
+        return;
+    }
+
+    /* Unlink the entry from the previous entry or the list head.  */
+    if (entry -> nx_nd_cache_probe_previous)
+    {
+        (entry -> nx_nd_cache_probe_previous) -> nx_nd_cache_probe_next = entry -> nx_nd_cache_probe_next;
+    }
+    else
+    {
+        *(entry -> nx_nd_cache_probe_list) = entry -> nx_nd_cache_probe_next;
+    }
+
+    /* Unlink the entry from the next entry.  */
+    if (entry -> nx_nd_cache_probe_next)
+    {
+        (entry -> nx_nd_cache_probe_next) -> nx_nd_cache_probe_previous = entry -> nx_nd_cache_probe_previous;
+    }
+
+    /* Clear the links of the entry.  */
+    entry -> nx_nd_cache_probe_next = NX_NULL;
+    entry -> nx_nd_cache_probe_previous = NX_NULL;
+    entry -> nx_nd_cache_probe_list = NX_NULL;
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IPV6_ND_HASH_TABLE */
@@ -64,6 +64,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_nd_cache_probe_list_add           Add entry to probe list       */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*                                                                        */
@@ -129,6 +130,12 @@ INT i;
                    processing of this entry now. */
                 ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_nd_status = ND_CACHE_STATE_PROBE;
                 ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_num_solicit = NX_MAX_UNICAST_SOLICIT;
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+
+                /* Hand the entry to the fast periodic update. */
+                _nx_nd_cache_probe_list_add(ip_ptr, &ip_ptr -> nx_ipv6_nd_cache[i]);
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
             }
         }
         else if (ip_ptr -> nx_ipv6_nd_cache[i].nx_nd_cache_nd_status == ND_CACHE_STATE_STALE)
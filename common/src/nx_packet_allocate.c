@@ -58,6 +58,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_packet_fields_reset               Set up fields of new packet   */
 /*    _tx_thread_system_suspend             Suspend thread                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -120,54 +121,7 @@ ULONG                  trace_timestamp;
         pool_ptr -> nx_packet_pool_available_list =  work_ptr -> nx_packet_queue_next;
 
         /* Setup various fields for this packet.  */
-        work_ptr -> nx_packet_queue_next =   NX_NULL;
-#ifndef NX_DISABLE_PACKET_CHAIN
-        work_ptr -> nx_packet_next =         NX_NULL;
-        work_ptr -> nx_packet_last =         NX_NULL;
-#endif /* NX_DISABLE_PACKET_CHAIN */
-        work_ptr -> nx_packet_length =       0;
-        work_ptr -> nx_packet_prepend_ptr =  work_ptr -> nx_packet_data_start + packet_type;
-        work_ptr -> nx_packet_append_ptr =   work_ptr -> nx_packet_prepend_ptr;
-        work_ptr -> nx_packet_address.nx_packet_interface_ptr = NX_NULL;
-#ifdef NX_ENABLE_INTERFACE_CAPABILITY
-        work_ptr -> nx_packet_interface_capability_flag = 0;
-#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
-        /* Set the TCP queue to the value that indicates it has been allocated.  */
-        /*lint -e{923} suppress cast of ULONG to pointer.  */
-        work_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
-
-#ifdef FEATURE_NX_IPV6
-
-        /* Clear the option state. */
-        work_ptr -> nx_packet_option_state = 0;
-#endif /* FEATURE_NX_IPV6 */
-
-#ifdef NX_IPSEC_ENABLE
-
-        /* Clear the ipsec state. */
-        work_ptr -> nx_packet_ipsec_state = 0;
-        work_ptr -> nx_packet_ipsec_sa_ptr = NX_NULL;
-#endif /* NX_IPSEC_ENABLE */
-
-#ifndef NX_DISABLE_IPV4
-        /* Initialize the IP version field */
-        work_ptr -> nx_packet_ip_version = NX_IP_VERSION_V4;
-#endif /* !NX_DISABLE_IPV4  */
-
-        /* Initialize the IP identification flag.  */
-        work_ptr -> nx_packet_identical_copy = NX_FALSE;
-
-#ifdef NX_ENABLE_VLAN
-        /* Initialize the packet vlan priority */
-        work_ptr -> nx_packet_vlan_priority = NX_VLAN_PRIORITY_INVALID;
-#endif /* NX_ENABLE_VLAN */
-
-        /* Initialize the IP header length. */
-        work_ptr -> nx_packet_ip_header_length = 0;
-
-#ifdef NX_ENABLE_THREAD
-        work_ptr -> nx_packet_type = 0;
-#endif /* NX_ENABLE_THREAD  */
+        _nx_packet_fields_reset(work_ptr, packet_type);
 
         /* Place the new packet pointer in the return destination.  */
         *packet_ptr =  work_ptr;
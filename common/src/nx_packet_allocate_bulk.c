@@ -0,0 +1,189 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_allocate_bulk                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates up to the specified number of packets from  */
+/*    the specified pool with a single critical section, which allows a   */
+/*    driver to refill a whole descriptor ring in one operation. Fewer    */
+/*    packets than requested are returned if the pool does not have       */
+/*    enough available packets.                                           */
+/*                                                                        */
+/*    If the pool is empty and the wait option specifies suspension, the  */
+/*    calling thread waits for a single packet in the regular packet      */
+/*    allocate service.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pool to allocate packets from */
+/*    packet_array                          Array to place allocated      */
+/*                                            packet pointers             */
+/*    packet_count                          Number of packets requested   */
+/*    packet_type                           Type of packet to allocate    */
+/*    allocated_count                       Pointer to place the number   */
+/*                                            of packets allocated        */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate a single packet      */
+/*    _nx_packet_fields_reset               Set up fields of new packet   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_allocate_bulk(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_array, UINT packet_count,
+                               ULONG packet_type, UINT *allocated_count, ULONG wait_option)
+{
+TX_INTERRUPT_SAVE_AREA
+
+UINT       status;              /* Return status           */
+UINT       count;               /* Number of packets       */
+UINT       i;                   /* Loop index              */
+NX_PACKET *work_ptr;            /* Working packet pointer  */
+
+
+    /* Make sure the packet_type does not go beyond nx_packet_data_end. */
+    if (pool_ptr -> nx_packet_pool_payload_size < packet_type)
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Set the allocated count to zero initially.  */
+    *allocated_count =  0;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_PACKET_ALLOCATE_BULK, pool_ptr, packet_count, packet_type, pool_ptr -> nx_packet_pool_available, NX_TRACE_PACKET_EVENTS, 0, 0);
+
+    /* Disable interrupts to get the packets from the pool.  */
+    TX_DISABLE
+
+    /* Calculate the number of packets to take.  */
+    count =  packet_count;
+    if (count > pool_ptr -> nx_packet_pool_available)
+    {
+        count =  (UINT)pool_ptr -> nx_packet_pool_available;
+    }
+
+    /* Determine if there is an available packet.  */
+    if (count == 0)
+    {
+
+        /* Determine if the request specifies suspension.  */
+        if (wait_option == NX_NO_WAIT)
+        {
+
+#ifndef NX_DISABLE_PACKET_INFO
+            /* Increment the packet pool empty request count.  */
+            pool_ptr -> nx_packet_pool_empty_requests++;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Immediate return, return error completion.  */
+            return(NX_NO_PACKET);
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Wait for a single packet in the regular allocate service.  */
+        status =  _nx_packet_allocate(pool_ptr, &packet_array[0], packet_type, wait_option);
+
+        /* Determine if a packet was allocated.  */
+        if (status == NX_SUCCESS)
+        {
+            *allocated_count =  1;
+        }
+
+        /* Return completion status.  */
+        return(status);
+    }
+
+    /* Remove the packets from the available list of the pool.  */
+    work_ptr =  pool_ptr -> nx_packet_pool_available_list;
+    for (i = 0; i < count; i++)
+    {
+        packet_array[i] =  work_ptr;
+        work_ptr =  work_ptr -> nx_packet_queue_next;
+    }
+    pool_ptr -> nx_packet_pool_available_list =  work_ptr;
+
+    /* Decrement the available count.  */
+    pool_ptr -> nx_packet_pool_available -= count;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* The packets are owned by the caller now, setup various fields
+       outside of the critical section.  */
+    for (i = 0; i < count; i++)
+    {
+
+        /* Pickup the packet pointer.  */
+        work_ptr =  packet_array[i];
+
+        /* Setup various fields for this packet.  */
+        _nx_packet_fields_reset(work_ptr, packet_type);
+
+        /* Add debug information. */
+        NX_PACKET_DEBUG(__FILE__, __LINE__, work_ptr);
+    }
+
+    /* Return the number of packets allocated.  */
+    *allocated_count =  count;
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+}
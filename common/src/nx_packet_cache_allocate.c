@@ -0,0 +1,188 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "tx_thread.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_allocate                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a packet from the specified packet cache.   */
+/*    If the cache holds a free packet, it is taken without disabling     */
+/*    interrupts. Otherwise the cache is refilled from its packet pool    */
+/*    with up to one batch of packets in a single critical section. If    */
+/*    the pool is empty as well, the regular packet allocate service is   */
+/*    used so that suspension and the empty pool statistics are handled   */
+/*    in one place.                                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Cache to allocate packet from */
+/*    packet_ptr                            Pointer to place allocated    */
+/*                                            packet pointer              */
+/*    packet_type                           Type of packet to allocate    */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate packet from the pool */
+/*    _nx_packet_fields_reset               Set up fields of new packet   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                                ULONG packet_type, ULONG wait_option)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_POOL *pool_ptr;          /* Pool of this cache      */
+NX_PACKET      *work_ptr;          /* Working packet pointer  */
+NX_PACKET      *last_ptr;          /* Last packet of refill   */
+ULONG           count;             /* Number of packets       */
+ULONG           i;                 /* Loop index              */
+
+
+    /* Pickup the pool pointer.  */
+    pool_ptr =  cache_ptr -> nx_packet_cache_pool_ptr;
+
+    /* Make sure the packet_type does not go beyond nx_packet_data_end. */
+    if (pool_ptr -> nx_packet_pool_payload_size < packet_type)
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Determine if there is a packet in the cache.  */
+    if (cache_ptr -> nx_packet_cache_count == 0)
+    {
+
+        /* No, refill the cache from the pool.  */
+        cache_ptr -> nx_packet_cache_misses++;
+
+        /* Disable interrupts to take a batch of packets from the pool.  */
+        TX_DISABLE
+
+        /* Calculate the number of packets to move.  */
+        count =  pool_ptr -> nx_packet_pool_available;
+        if (count > cache_ptr -> nx_packet_cache_batch_size)
+        {
+            count =  cache_ptr -> nx_packet_cache_batch_size;
+        }
+
+        if (count)
+        {
+
+            /* Find the last packet to move.  */
+            work_ptr =  pool_ptr -> nx_packet_pool_available_list;
+            last_ptr =  work_ptr;
+            for (i = 1; i < count; i++)
+            {
+                last_ptr =  last_ptr -> nx_packet_queue_next;
+            }
+
+            /* Unlink the packets from the available list of the pool.  */
+            pool_ptr -> nx_packet_pool_available_list =  last_ptr -> nx_packet_queue_next;
+            pool_ptr -> nx_packet_pool_available -= count;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Place the packets in the cache.  */
+            last_ptr -> nx_packet_queue_next =  NX_NULL;
+            cache_ptr -> nx_packet_cache_list =  work_ptr;
+            cache_ptr -> nx_packet_cache_count =  count;
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* The pool is empty, allocate through the pool to suspend if requested.  */
+            return(_nx_packet_allocate(pool_ptr, packet_ptr, packet_type, wait_option));
+        }
+    }
+    else
+    {
+
+        /* Yes, increment the cache hit count.  */
+        cache_ptr -> nx_packet_cache_hits++;
+    }
+
+    /* Pickup the first packet in the cache.  */
+    work_ptr =  cache_ptr -> nx_packet_cache_list;
+
+    /* Remove the packet from the cache.  */
+    cache_ptr -> nx_packet_cache_list =  work_ptr -> nx_packet_queue_next;
+    cache_ptr -> nx_packet_cache_count--;
+
+    /* Setup various fields for this packet.  */
+    _nx_packet_fields_reset(work_ptr, packet_type);
+
+    /* Place the new packet pointer in the return destination.  */
+    *packet_ptr =  work_ptr;
+
+    /* Add debug information. */
+    NX_PACKET_DEBUG(__FILE__, __LINE__, work_ptr);
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(packet_type);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
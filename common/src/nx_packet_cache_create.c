@@ -0,0 +1,146 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_create                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a packet cache in front of the specified      */
+/*    packet pool. The cache is initially empty and is filled on the      */
+/*    first packet allocation.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pool the cache is created on  */
+/*    cache_ptr                             Packet cache control block    */
+/*    name_ptr                              Packet cache string pointer   */
+/*    cache_size                            Maximum number of packets     */
+/*                                            held in the cache           */
+/*    batch_size                            Number of packets moved       */
+/*                                            between cache and pool at   */
+/*                                            once                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_create(NX_PACKET_POOL *pool_ptr, NX_PACKET_CACHE *cache_ptr, CHAR *name_ptr,
+                              ULONG cache_size, ULONG batch_size)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_CACHE *tail_ptr;      /* Working packet cache pointer */
+
+
+    /* Clear cache fields. */
+    memset(cache_ptr, 0, sizeof(NX_PACKET_CACHE));
+
+    /* Setup the basic packet cache fields.  */
+    cache_ptr -> nx_packet_cache_name =        name_ptr;
+    cache_ptr -> nx_packet_cache_pool_ptr =    pool_ptr;
+    cache_ptr -> nx_packet_cache_size =        cache_size;
+    cache_ptr -> nx_packet_cache_batch_size =  batch_size;
+
+    /* Disable interrupts to place the packet cache on the created list of the pool.  */
+    TX_DISABLE
+
+    /* Setup the packet cache ID to make it valid.  */
+    cache_ptr -> nx_packet_cache_id =  NX_PACKET_CACHE_ID;
+
+    /* Place the packet cache on the list of created packet caches.  First,
+       check for an empty list.  */
+    if (pool_ptr -> nx_packet_pool_cache_created_ptr)
+    {
+
+        /* Pickup tail pointer.  */
+        tail_ptr =  (pool_ptr -> nx_packet_pool_cache_created_ptr) -> nx_packet_cache_created_previous;
+
+        /* Place the new packet cache in the list.  */
+        (pool_ptr -> nx_packet_pool_cache_created_ptr) -> nx_packet_cache_created_previous =  cache_ptr;
+        tail_ptr -> nx_packet_cache_created_next =  cache_ptr;
+
+        /* Setup this packet cache's created links.  */
+        cache_ptr -> nx_packet_cache_created_previous =  tail_ptr;
+        cache_ptr -> nx_packet_cache_created_next =      pool_ptr -> nx_packet_pool_cache_created_ptr;
+    }
+    else
+    {
+
+        /* The created packet cache list is empty.  Add packet cache to empty list.  */
+        pool_ptr -> nx_packet_pool_cache_created_ptr =   cache_ptr;
+        cache_ptr -> nx_packet_cache_created_next =      cache_ptr;
+        cache_ptr -> nx_packet_cache_created_previous =  cache_ptr;
+    }
+
+    /* Increment the number of packet caches created.  */
+    pool_ptr -> nx_packet_pool_cache_created_count++;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return NX_SUCCESS.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(cache_size);
+    NX_PARAMETER_NOT_USED(batch_size);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
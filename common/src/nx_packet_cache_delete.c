@@ -0,0 +1,136 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_delete                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns all packets held in the specified packet      */
+/*    cache to its pool and deletes the cache. The statistics of the      */
+/*    cache are accumulated in the pool so they remain visible after the  */
+/*    deletion.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Packet cache to delete        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_flush                Flush packet cache            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_delete(NX_PACKET_CACHE *cache_ptr)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+
+
+    /* Return all packets in the cache to the pool.  */
+    _nx_packet_cache_flush(cache_ptr);
+
+    /* Pickup the pool pointer.  */
+    pool_ptr =  cache_ptr -> nx_packet_cache_pool_ptr;
+
+    /* Disable interrupts to remove the packet cache from the created list.  */
+    TX_DISABLE
+
+    /* Clear the packet cache ID to make it invalid.  */
+    cache_ptr -> nx_packet_cache_id =  0;
+
+    /* Accumulate the statistics of this cache.  */
+    pool_ptr -> nx_packet_pool_cache_hits +=    cache_ptr -> nx_packet_cache_hits;
+    pool_ptr -> nx_packet_pool_cache_misses +=  cache_ptr -> nx_packet_cache_misses;
+
+    /* Decrement the number of packet caches created.  */
+    pool_ptr -> nx_packet_pool_cache_created_count--;
+
+    /* See if the packet cache is the only one on the list.  */
+    if (cache_ptr == cache_ptr -> nx_packet_cache_created_next)
+    {
+
+        /* Only created packet cache, just set the created list to NULL.  */
+        pool_ptr -> nx_packet_pool_cache_created_ptr =  NX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        (cache_ptr -> nx_packet_cache_created_next) -> nx_packet_cache_created_previous =
+            cache_ptr -> nx_packet_cache_created_previous;
+        (cache_ptr -> nx_packet_cache_created_previous) -> nx_packet_cache_created_next =
+            cache_ptr -> nx_packet_cache_created_next;
+
+        /* See if we have to update the created list head pointer.  */
+        if (pool_ptr -> nx_packet_pool_cache_created_ptr == cache_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            pool_ptr -> nx_packet_pool_cache_created_ptr =  cache_ptr -> nx_packet_cache_created_next;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return NX_SUCCESS.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
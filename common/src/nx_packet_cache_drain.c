@@ -0,0 +1,117 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_drain                              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns up to the specified number of packets from    */
+/*    the packet cache to its packet pool. The packets are returned to    */
+/*    the pool in a single critical section. Threads suspended on the     */
+/*    pool are given packets first.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Cache to drain                */
+/*    packet_count                          Number of packets to drain    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_pool_bulk_return           Return packets to their pool  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_cache_release              Release packet to cache       */
+/*    _nx_packet_cache_flush                Flush packet cache            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_cache_drain(NX_PACKET_CACHE *cache_ptr, ULONG packet_count)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+NX_PACKET      *head_ptr;       /* First packet to drain   */
+NX_PACKET      *last_ptr;       /* Last packet to drain    */
+ULONG           i;              /* Loop index              */
+
+
+    /* Limit the count to the packets in the cache.  */
+    if (packet_count > cache_ptr -> nx_packet_cache_count)
+    {
+        packet_count =  cache_ptr -> nx_packet_cache_count;
+    }
+
+    /* Check for an empty request.  */
+    if (packet_count == 0)
+    {
+        return;
+    }
+
+    /* Pickup the pool pointer.  */
+    pool_ptr =  cache_ptr -> nx_packet_cache_pool_ptr;
+
+    /* Find the last packet to drain.  */
+    head_ptr =  cache_ptr -> nx_packet_cache_list;
+    last_ptr =  head_ptr;
+    for (i = 1; i < packet_count; i++)
+    {
+        last_ptr =  last_ptr -> nx_packet_queue_next;
+    }
+
+    /* Remove the packets from the cache.  */
+    cache_ptr -> nx_packet_cache_list =  last_ptr -> nx_packet_queue_next;
+    cache_ptr -> nx_packet_cache_count -= packet_count;
+
+    /* Return the packets to the pool.  */
+    _nx_packet_pool_bulk_return(pool_ptr, head_ptr, last_ptr, packet_count);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_count);
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
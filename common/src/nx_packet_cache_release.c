@@ -0,0 +1,197 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_release                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases a packet chain to the specified packet       */
+/*    cache. Packets are pushed onto the cache without disabling          */
+/*    interrupts. When the cache holds more packets than its size, one    */
+/*    batch of packets is drained back to the pool. Packets owned by      */
+/*    another pool, or released while threads are suspended on the pool,  */
+/*    are released to their pool directly so that waiting threads are     */
+/*    resumed.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Cache to release packet to    */
+/*    packet_ptr                            Packet pointer                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_external_buffer_release    Release external buffer       */
+/*    _nx_packet_shared_release             Release shared packet         */
+/*    _nx_packet_release                    Release packet to its pool    */
+/*    _nx_packet_cache_drain                Drain packets to the pool     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET *packet_ptr)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+#ifndef NX_DISABLE_PACKET_CHAIN
+NX_PACKET      *next_packet;    /* Working block pointer   */
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+    /* Loop to free all packets chained together, not assuming they are
+       from the same pool.  */
+    while (packet_ptr)
+    {
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+        /* Pickup the pool pointer.  */
+        pool_ptr =  packet_ptr -> nx_packet_pool_owner;
+
+        /* Check to see if the packet is releasable.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if (packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED))
+        {
+
+#ifndef NX_DISABLE_PACKET_INFO
+            /* Check for a good pool pointer...  error must be the packet!  */
+            if ((pool_ptr) && (pool_ptr -> nx_packet_pool_id == NX_PACKET_POOL_ID))
+            {
+
+                /* Increment the packet pool invalid release error count.  */
+                pool_ptr -> nx_packet_pool_invalid_releases++;
+            }
+#endif
+
+            /* Return an error indicating the packet could not be released.  */
+            return(NX_PTR_ERROR);
+        }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+        /* Pickup the next packet. */
+        next_packet =  packet_ptr -> nx_packet_next;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+#ifdef NX_ENABLE_PACKET_CLONE
+        /* Determine if the data of the packet is referenced by clones.  */
+        if ((packet_ptr -> nx_packet_clone_count) && (_nx_packet_shared_release(packet_ptr)))
+        {
+
+            /* Yes, the packet is returned to the pool when the last clone is released.
+               Move to the next packet in the chain.  */
+            packet_ptr =  next_packet;
+            continue;
+        }
+#endif /* NX_ENABLE_PACKET_CLONE */
+
+        /* Determine if this packet can be kept in the cache.  */
+        if ((pool_ptr != cache_ptr -> nx_packet_cache_pool_ptr) ||
+            (pool_ptr -> nx_packet_pool_suspension_list))
+        {
+
+            /* No, the packet belongs to another pool or threads are waiting for
+               packets.  Release it to the pool.  */
+#ifndef NX_DISABLE_PACKET_CHAIN
+            packet_ptr -> nx_packet_next =  NX_NULL;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+            _nx_packet_release(packet_ptr);
+        }
+        else
+        {
+
+            /* Add debug information. */
+            NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
+
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+            /* Determine if the packet references an external buffer.  */
+            if (packet_ptr -> nx_packet_external_buffer_notify)
+            {
+
+                /* Yes, return the external buffer to the application.  */
+                _nx_packet_external_buffer_release(packet_ptr);
+            }
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+
+            /* Mark the packet as free.  */
+            /*lint -e{923} suppress cast of ULONG to pointer.  */
+            packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_FREE;
+
+            /* Put the packet in the cache.  */
+            packet_ptr -> nx_packet_queue_next =  cache_ptr -> nx_packet_cache_list;
+            cache_ptr -> nx_packet_cache_list =  packet_ptr;
+            cache_ptr -> nx_packet_cache_count++;
+
+            /* Determine if the cache is full.  */
+            if (cache_ptr -> nx_packet_cache_count > cache_ptr -> nx_packet_cache_size)
+            {
+
+                /* Yes, return one batch of packets to the pool.  */
+                _nx_packet_cache_drain(cache_ptr, cache_ptr -> nx_packet_cache_batch_size);
+            }
+        }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+        /* Move to the next packet in the list.  */
+        packet_ptr =  next_packet;
+    }
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
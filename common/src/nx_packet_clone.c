@@ -0,0 +1,325 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_ipv6.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_clone                                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function clones the specified packet. The headroom of the      */
+/*    first packet and the IP and transport headers that follow it are    */
+/*    copied to a new packet, so the headers can be modified in place.    */
+/*    The rest of the data is not copied, the clone references it and the */
+/*    reference count of each source packet is incremented. A source     */
+/*    packet is returned to its pool once it is released and no clone     */
+/*    references it any more.                                             */
+/*                                                                        */
+/*    The data shared with the clone must not be modified by either the   */
+/*    owner of the packet or the owner of the clone.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to the source packet  */
+/*    new_packet_ptr                        Pointer for return of clone   */
+/*    pool_ptr                              Pointer to packet pool to use */
+/*                                            for clone                   */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate data packet          */
+/*    _nx_packet_data_append                Packet data append service    */
+/*    _nx_packet_data_append_external       Append external buffer        */
+/*    _nx_packet_clone_reference_release    Release clone reference       */
+/*    _nx_packet_release                    Release data packet           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_ip_driver_packet_send             Driver send packet            */
+/*    _nx_ipv6_packet_send                  IPv6 packet send              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_clone(NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
+                       NX_PACKET_POOL *pool_ptr, ULONG wait_option)
+{
+#ifdef NX_ENABLE_PACKET_CLONE
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET      *work_ptr;               /* Working packet pointer     */
+NX_PACKET      *source_ptr;             /* Source packet pointer      */
+NX_PACKET_POOL *source_pool_ptr;        /* Pool of source packet      */
+UCHAR          *header_ptr;             /* Protocol header pointer    */
+UCHAR          *data_ptr;               /* Shared data pointer        */
+ULONG           size;                   /* Packet data size           */
+ULONG           header_size;            /* Protocol header size       */
+UINT            protocol;               /* Transport protocol         */
+UINT            status;                 /* Return status              */
+UINT            data_prepend_offset;    /* Data prepend offset        */
+UINT            ip_header_offset;       /* IP header offset           */
+
+
+    /* Default the return packet pointer to NULL.  */
+    *new_packet_ptr =  NX_NULL;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_PACKET_CLONE, packet_ptr, 0, pool_ptr, wait_option, NX_TRACE_PACKET_EVENTS, 0, 0);
+
+    /* Determine if there is anything to clone.  */
+    if (packet_ptr -> nx_packet_length == 0)
+    {
+
+        /* Empty source packet, return an error.  */
+        return(NX_INVALID_PACKET);
+    }
+
+    /* Allocate a new packet from the packet pool supplied.  */
+    status =  _nx_packet_allocate(pool_ptr, &work_ptr, 0, wait_option);
+
+    /* Determine if the packet was not allocated.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Return the error code from the packet allocate routine.  */
+        return(status);
+    }
+
+    /* Copy the packet interface information. */
+    /*lint -e{644} suppress variable might not be initialized, since "work_ptr" was initialized by _nx_packet_allocate. */
+    work_ptr -> nx_packet_address.nx_packet_interface_ptr = packet_ptr -> nx_packet_address.nx_packet_interface_ptr;
+
+#ifdef FEATURE_NX_IPV6
+
+    /* Copy the IP version information. */
+    work_ptr -> nx_packet_ip_version = packet_ptr -> nx_packet_ip_version;
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+
+    /* Copy the packet interface capability. */
+    work_ptr -> nx_packet_interface_capability_flag = packet_ptr -> nx_packet_interface_capability_flag;
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+#ifdef NX_IPSEC_ENABLE
+    work_ptr -> nx_packet_ipsec_sa_ptr = packet_ptr -> nx_packet_ipsec_sa_ptr;
+#endif /* NX_IPSEC_ENABLE */
+
+    /* Calculate the data size of the first packet.  */
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    size =  (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+
+    /* Determine the size of the protocol headers at the start of the first packet.
+       A packet without IP header, such as application data, has no header to copy.  */
+    header_size =  0;
+    header_ptr =   packet_ptr -> nx_packet_prepend_ptr;
+    if ((packet_ptr -> nx_packet_ip_header == header_ptr) && (size >= 20))
+    {
+
+        /* Pickup the IP header length and the transport protocol.  */
+        if ((header_ptr[0] >> 4) == NX_IP_VERSION_V4)
+        {
+            header_size =  (ULONG)(header_ptr[0] & 0xF) << 2;
+            protocol =     header_ptr[9];
+        }
+#ifdef FEATURE_NX_IPV6
+        else if ((header_ptr[0] >> 4) == NX_IP_VERSION_V6)
+        {
+            header_size =  sizeof(NX_IPV6_HEADER);
+            protocol =     header_ptr[6];
+        }
+#endif /* FEATURE_NX_IPV6 */
+        else
+        {
+            header_size =  size;
+            protocol =     0;
+        }
+
+        /* Add the transport header length.  */
+        if ((protocol == NX_PROTOCOL_TCP) && ((header_size + 13) <= size))
+        {
+
+            /* The TCP header length is in the upper 4 bits of the 13th byte.  */
+            header_size +=  (ULONG)(header_ptr[header_size + 12] >> 4) << 2;
+        }
+        else if ((protocol == NX_PROTOCOL_UDP) || (protocol == NX_PROTOCOL_ICMP) ||
+                 (protocol == NX_PROTOCOL_ICMPV6))
+        {
+
+            /* UDP and ICMP headers are 8 bytes.  */
+            header_size +=  8;
+        }
+        else
+        {
+
+            /* Unknown header layout, copy all data of the first packet.  */
+            header_size =  size;
+        }
+
+        /* The headers can not be larger than the first packet.  */
+        if (header_size > size)
+        {
+            header_size =  size;
+        }
+    }
+
+    /* Copy the headroom and the protocol headers of the first packet.  */
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    status =  _nx_packet_data_append(work_ptr, packet_ptr -> nx_packet_data_start,
+                                     (ULONG)(header_ptr - packet_ptr -> nx_packet_data_start) + header_size,
+                                     pool_ptr, wait_option);
+
+    /* Loop to reference the data following the headers, starting with the rest of the first packet.  */
+    source_ptr =  packet_ptr;
+    data_ptr =    header_ptr + header_size;
+    size =        size - header_size;
+    while ((status == NX_SUCCESS) && (source_ptr))
+    {
+
+        /* Skip empty packets.  */
+        if (size)
+        {
+
+            /* Pickup the pool of the source packet.  */
+            source_pool_ptr =  source_ptr -> nx_packet_pool_owner;
+
+            /* Disable interrupts to add a reference to the source packet.  */
+            TX_DISABLE
+
+            /* Determine if the data of this packet is shared for the first time.  */
+            if (source_ptr -> nx_packet_clone_count == 0)
+            {
+
+                /* Yes, increment the number of shared packets.  */
+                source_pool_ptr -> nx_packet_pool_shared_packets++;
+            }
+
+            /* Increment the reference counts.  */
+            source_ptr -> nx_packet_clone_count++;
+            source_pool_ptr -> nx_packet_pool_clone_references++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Reference the data of the source packet.  */
+            status =  _nx_packet_data_append_external(work_ptr, data_ptr, size,
+                                                      _nx_packet_clone_reference_release, source_ptr,
+                                                      pool_ptr, wait_option);
+
+            /* Determine if there was an error in the data append.  */
+            if (status != NX_SUCCESS)
+            {
+
+                /* Remove the reference just added.  */
+                _nx_packet_clone_reference_release(data_ptr, size, source_ptr);
+            }
+        }
+
+        /* Move to the next packet in the packet chain.  */
+        source_ptr =  source_ptr -> nx_packet_next;
+        if (source_ptr)
+        {
+
+            /* Calculate this packet's data size.  */
+            /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+            data_ptr =  source_ptr -> nx_packet_prepend_ptr;
+            size =      (ULONG)(source_ptr -> nx_packet_append_ptr - source_ptr -> nx_packet_prepend_ptr);
+        }
+    }
+
+    /* Determine if there was an error in the data append.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* An error is present, release the new packet and the references.  */
+        _nx_packet_release(work_ptr);
+
+        /* Return the error code from the packet data append service.  */
+        return(status);
+    }
+
+    /* Adjust the prepend pointer and data length.  */
+    /*lint --e{946} --e{947} --e{732} suppress pointer subtraction, since it is necessary. */
+    data_prepend_offset = (UINT)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start);
+    work_ptr -> nx_packet_prepend_ptr = work_ptr -> nx_packet_data_start + data_prepend_offset;
+    work_ptr -> nx_packet_length =  work_ptr -> nx_packet_length - data_prepend_offset;
+
+    /* Set the ip_header information. */
+    ip_header_offset = (UINT)(packet_ptr -> nx_packet_ip_header - packet_ptr -> nx_packet_data_start);
+    work_ptr -> nx_packet_ip_header = work_ptr -> nx_packet_data_start + ip_header_offset;
+
+    /* Determine if the packet clone was successful.  */
+    if (packet_ptr -> nx_packet_length != work_ptr -> nx_packet_length)
+    {
+
+        /* An error is present, release the new packet.  */
+        _nx_packet_release(work_ptr);
+
+        /* Return an error code.  */
+        return(NX_INVALID_PACKET);
+    }
+
+    /* Everything is okay, return the new packet pointer.  */
+    *new_packet_ptr =  work_ptr;
+
+    /* Add debug information. */
+    NX_PACKET_DEBUG(__FILE__, __LINE__, work_ptr);
+
+    /* Return success status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CLONE */
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(new_packet_ptr);
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CLONE */
+}
@@ -0,0 +1,140 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_clone_reference_release                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the external buffer release notify function of     */
+/*    the packets of a clone. It removes the reference to the source      */
+/*    packet whose data the clone packet referenced. If the source        */
+/*    packet has already been released by its owner and this was the      */
+/*    last reference, the source packet is returned to its pool.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    buffer_start                          Start of the shared data      */
+/*    buffer_size                           Size of the shared data       */
+/*    context                               Source packet pointer         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release data packet           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_external_buffer_release    Release external buffer       */
+/*    _nx_packet_clone                      Clone packet                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_clone_reference_release(VOID *buffer_start, ULONG buffer_size, VOID *context)
+{
+#ifdef NX_ENABLE_PACKET_CLONE
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET      *source_ptr;     /* Source packet pointer   */
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+UINT            release;        /* Release source packet   */
+
+
+    NX_PARAMETER_NOT_USED(buffer_start);
+    NX_PARAMETER_NOT_USED(buffer_size);
+
+    /* Pickup the source packet and its pool.  */
+    source_ptr =  (NX_PACKET *)context;
+    pool_ptr =    source_ptr -> nx_packet_pool_owner;
+    release =     NX_FALSE;
+
+    /* Disable interrupts to remove the reference.  */
+    TX_DISABLE
+
+    /* Decrement the reference counts.  */
+    source_ptr -> nx_packet_clone_count--;
+    pool_ptr -> nx_packet_pool_clone_references--;
+
+    /* Determine if this was the last reference.  */
+    if (source_ptr -> nx_packet_clone_count == 0)
+    {
+
+        /* Yes, the data of the packet is no longer shared.  */
+        pool_ptr -> nx_packet_pool_shared_packets--;
+
+        /* Determine if the owner has already released the packet.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if (source_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next == ((NX_PACKET *)NX_PACKET_SHARED))
+        {
+
+            /* Yes, the packet is returned to the pool.  */
+            /*lint -e{923} suppress cast of ULONG to pointer.  */
+            source_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
+            release =  NX_TRUE;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if the source packet should be released.  */
+    if (release)
+    {
+
+        /* The rest of the chain was released by the owner already.  */
+        source_ptr -> nx_packet_next =  NX_NULL;
+        source_ptr -> nx_packet_last =  NX_NULL;
+
+        /* Release the source packet.  */
+        _nx_packet_release(source_ptr);
+    }
+
+#else /* !NX_ENABLE_PACKET_CLONE */
+    NX_PARAMETER_NOT_USED(buffer_start);
+    NX_PARAMETER_NOT_USED(buffer_size);
+    NX_PARAMETER_NOT_USED(context);
+#endif /* NX_ENABLE_PACKET_CLONE */
+}
@@ -0,0 +1,164 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_data_append_external                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function appends the specified data to the end of the          */
+/*    specified packet without copying it. A packet is allocated from     */
+/*    the specified pool and its data pointers are set to the             */
+/*    application buffer. The packet is linked to the end of the packet   */
+/*    chain.                                                              */
+/*                                                                        */
+/*    The application must not modify or free the buffer until the        */
+/*    release notify function is called. The notify function is called    */
+/*    when the packet is released, i.e. after the driver has transmitted  */
+/*    it and, for TCP, after the data has been acknowledged. It is        */
+/*    called from the context releasing the packet and must not block.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to packet to append   */
+/*                                            to                          */
+/*    data_start                            Pointer to start of the data  */
+/*    data_size                             Number of bytes to append     */
+/*    release_notify                        Buffer release notify         */
+/*                                            function                    */
+/*    context                               Context of notify function    */
+/*    pool_ptr                              Pool to allocate packet from  */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate data packet          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_data_append_external(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
+                                      VOID (*release_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context),
+                                      VOID *context, NX_PACKET_POOL *pool_ptr, ULONG wait_option)
+{
+#if defined(NX_ENABLE_PACKET_EXTERNAL_BUFFER) && !defined(NX_DISABLE_PACKET_CHAIN)
+
+UINT       status;                 /* Return status              */
+NX_PACKET *new_packet_ptr;         /* Packet of external buffer  */
+NX_PACKET *last_packet;            /* Last packet of the chain   */
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_PACKET_DATA_APPEND_EXTERNAL, packet_ptr, data_start, data_size, pool_ptr, NX_TRACE_PACKET_EVENTS, 0, 0);
+
+    /* Allocate a packet to reference the external buffer.  */
+    status =  _nx_packet_allocate(pool_ptr, &new_packet_ptr, 0, wait_option);
+
+    /* Determine if a packet was allocated.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Return the error status.  */
+        return(status);
+    }
+
+    /* Add debug information. */
+    NX_PACKET_DEBUG(__FILE__, __LINE__, new_packet_ptr);
+
+    /* Setup the data pointers of the packet to the external buffer.  */
+    new_packet_ptr -> nx_packet_data_start =    (UCHAR *)data_start;
+    new_packet_ptr -> nx_packet_data_end =      (UCHAR *)data_start + data_size;
+    new_packet_ptr -> nx_packet_prepend_ptr =   new_packet_ptr -> nx_packet_data_start;
+    new_packet_ptr -> nx_packet_append_ptr =    new_packet_ptr -> nx_packet_data_end;
+    new_packet_ptr -> nx_packet_length =        data_size;
+
+    /* Remember how to return the external buffer.  */
+    new_packet_ptr -> nx_packet_external_buffer_notify =   release_notify;
+    new_packet_ptr -> nx_packet_external_buffer_context =  context;
+
+    /* Find the last packet of the chain.  */
+    if (packet_ptr -> nx_packet_last)
+    {
+        last_packet =  packet_ptr -> nx_packet_last;
+    }
+    else
+    {
+        last_packet =  packet_ptr;
+    }
+
+    /* There typically won't be another packet, but just in case the logic is here for it!  */
+    while (last_packet -> nx_packet_next)
+    {
+        last_packet =  last_packet -> nx_packet_next;
+    }
+
+    /* Link the packet to the end of the chain.  */
+    last_packet -> nx_packet_next =  new_packet_ptr;
+    packet_ptr -> nx_packet_last =   new_packet_ptr;
+
+    /* Adjust the packet length.  */
+    packet_ptr -> nx_packet_length =  packet_ptr -> nx_packet_length + data_size;
+
+    /* Return successful status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_EXTERNAL_BUFFER || NX_DISABLE_PACKET_CHAIN */
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(data_start);
+    NX_PARAMETER_NOT_USED(data_size);
+    NX_PARAMETER_NOT_USED(release_notify);
+    NX_PARAMETER_NOT_USED(context);
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER && !NX_DISABLE_PACKET_CHAIN */
+}
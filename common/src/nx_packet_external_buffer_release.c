@@ -0,0 +1,111 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_external_buffer_release                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function detaches the external buffer from a packet that is    */
+/*    being released. The data pointers of the packet are restored to     */
+/*    the data area of the packet in the pool, and the application is     */
+/*    notified that the external buffer is no longer used.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Packet being released         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    release_notify                        Application buffer release    */
+/*                                            notify function             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_release                    Release data packet           */
+/*    _nx_packet_release_bulk               Release data packets in bulk  */
+/*    _nx_packet_cache_release              Release packet to cache       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_external_buffer_release(NX_PACKET *packet_ptr)
+{
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+
+VOID  (*release_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context);
+UCHAR *buffer_start;
+ULONG  buffer_size;
+VOID  *context;
+
+
+    /* Pickup the external buffer information.  */
+    release_notify =  packet_ptr -> nx_packet_external_buffer_notify;
+    context =         packet_ptr -> nx_packet_external_buffer_context;
+    buffer_start =    packet_ptr -> nx_packet_data_start;
+
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    buffer_size =     (ULONG)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_data_start);
+
+    /* Clear the external buffer information.  */
+    packet_ptr -> nx_packet_external_buffer_notify =   NX_NULL;
+    packet_ptr -> nx_packet_external_buffer_context =  NX_NULL;
+
+    /* Restore the data pointers to the payload area following the packet header,
+       the same way as the packet pool is created.  */
+    /*lint -e{929} -e{928} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    packet_ptr -> nx_packet_data_start =  (UCHAR *)packet_ptr +
+        (((sizeof(NX_PACKET) + NX_PACKET_ALIGNMENT - 1) / NX_PACKET_ALIGNMENT) * NX_PACKET_ALIGNMENT);
+    packet_ptr -> nx_packet_data_end =    packet_ptr -> nx_packet_data_start +
+        (packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_payload_size;
+
+    /* Notify the application the external buffer can be reused.  */
+    release_notify(buffer_start, buffer_size, context);
+
+#else /* !NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+    NX_PARAMETER_NOT_USED(packet_ptr);
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+}
@@ -0,0 +1,138 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_fields_reset                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function sets up the fields of a packet taken from a  */
+/*    pool so it looks like a new packet, with the prepend pointer at     */
+/*    the offset of the packet type.  Every path that hands a packet out  */
+/*    of a pool uses it.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to packet             */
+/*    packet_type                           Type of packet                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate a packet             */
+/*    _nx_packet_allocate_bulk              Allocate packets in bulk      */
+/*    _nx_packet_cache_allocate             Allocate packet from cache    */
+/*    _nx_packet_pool_bulk_return           Return packets to a pool      */
+/*    _nx_packet_release                    Release a packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_fields_reset(NX_PACKET *packet_ptr, ULONG packet_type)
+{
+
+    /* Setup various fields for this packet.  */
+    packet_ptr -> nx_packet_queue_next =   NX_NULL;
+#ifndef NX_DISABLE_PACKET_CHAIN
+    packet_ptr -> nx_packet_next =         NX_NULL;
+    packet_ptr -> nx_packet_last =         NX_NULL;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+    packet_ptr -> nx_packet_length =       0;
+    packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_data_start + packet_type;
+    packet_ptr -> nx_packet_append_ptr =   packet_ptr -> nx_packet_prepend_ptr;
+    packet_ptr -> nx_packet_address.nx_packet_interface_ptr = NX_NULL;
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    packet_ptr -> nx_packet_interface_capability_flag = 0;
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+#if defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD)
+    packet_ptr -> nx_packet_tcp_segment_size = 0;
+#endif /* defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD) */
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    packet_ptr -> nx_packet_tcp_coalesced = NX_FALSE;
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+    /* Set the TCP queue to the value that indicates it has been allocated.  */
+    /*lint -e{923} suppress cast of ULONG to pointer.  */
+    packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
+
+#ifdef FEATURE_NX_IPV6
+
+    /* Clear the option state. */
+    packet_ptr -> nx_packet_option_state = 0;
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_IPSEC_ENABLE
+
+    /* Clear the ipsec state. */
+    packet_ptr -> nx_packet_ipsec_state = 0;
+    packet_ptr -> nx_packet_ipsec_sa_ptr = NX_NULL;
+#endif /* NX_IPSEC_ENABLE */
+
+#ifndef NX_DISABLE_IPV4
+    /* Initialize the IP version field */
+    packet_ptr -> nx_packet_ip_version = NX_IP_VERSION_V4;
+#else
+    /* Clear the IP version.  */
+    packet_ptr -> nx_packet_ip_version = 0;
+#endif /* !NX_DISABLE_IPV4  */
+
+    /* Initialize the IP identification flag.  */
+    packet_ptr -> nx_packet_identical_copy = NX_FALSE;
+
+#ifdef NX_ENABLE_VLAN
+    /* Initialize the packet vlan priority */
+    packet_ptr -> nx_packet_vlan_priority = NX_VLAN_PRIORITY_INVALID;
+#endif /* NX_ENABLE_VLAN */
+
+    /* Initialize the IP header length. */
+    packet_ptr -> nx_packet_ip_header_length = 0;
+
+#ifdef NX_ENABLE_THREAD
+    packet_ptr -> nx_packet_type = 0;
+#endif /* NX_ENABLE_THREAD  */
+}
@@ -0,0 +1,201 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "tx_thread.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_bulk_return                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a list of free packets linked through         */
+/*    nx_packet_queue_next to their packet pool. Threads suspended on     */
+/*    the pool are given packets from the head of the list first, with    */
+/*    preemption held off until all of them are resumed. The remaining    */
+/*    packets are linked into the available list of the pool in one       */
+/*    critical section.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pool the packets belong to    */
+/*    head_ptr                              First packet of the list      */
+/*    tail_ptr                              Last packet of the list       */
+/*    packet_count                          Number of packets in the list */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_fields_reset               Set up fields of new packet   */
+/*    _tx_thread_system_resume              Resume suspended thread       */
+/*    _tx_thread_system_preempt_check       Check for preemption          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_release_bulk               Release packets in bulk       */
+/*    _nx_packet_cache_drain                Drain packet cache            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_pool_bulk_return(NX_PACKET_POOL *pool_ptr, NX_PACKET *head_ptr,
+                                  NX_PACKET *tail_ptr, ULONG packet_count)
+{
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD *thread_ptr;          /* Working thread pointer  */
+NX_PACKET *packet_ptr;          /* Working packet pointer  */
+UINT       resumed;             /* Thread resumed flag     */
+
+
+    /* No thread is resumed yet.  */
+    resumed =  NX_FALSE;
+
+    /* Disable interrupts to put the packets back in the packet pool.  */
+    TX_DISABLE
+
+    /* Give packets to the threads suspended on the pool first.  */
+    while ((packet_count) && (pool_ptr -> nx_packet_pool_suspension_list))
+    {
+
+        /* Pickup the first suspended thread.  */
+        thread_ptr =  pool_ptr -> nx_packet_pool_suspension_list;
+
+        /* See if this is the only suspended thread on the list.  */
+        if (thread_ptr == thread_ptr -> tx_thread_suspended_next)
+        {
+
+            /* Yes, the only suspended thread.  */
+
+            /* Update the head pointer.  */
+            pool_ptr -> nx_packet_pool_suspension_list =  NX_NULL;
+        }
+        else
+        {
+
+            /* At least one more thread is on the same expiration list.  */
+
+            /* Update the list head pointer.  */
+            pool_ptr -> nx_packet_pool_suspension_list =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Update the links of the adjacent threads.  */
+            (thread_ptr -> tx_thread_suspended_next) -> tx_thread_suspended_previous =
+                thread_ptr -> tx_thread_suspended_previous;
+            (thread_ptr -> tx_thread_suspended_previous) -> tx_thread_suspended_next =
+                thread_ptr -> tx_thread_suspended_next;
+        }
+
+        /* Decrement the suspension count.  */
+        pool_ptr -> nx_packet_pool_suspended_count--;
+
+        /* Clear cleanup routine to avoid timeout.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Determine if this is the first thread resumed.  */
+        if (resumed == NX_FALSE)
+        {
+
+            /* Yes, hold off preemption until all threads are resumed.  */
+            _tx_thread_preempt_disable++;
+            resumed =  NX_TRUE;
+        }
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Remove the first packet from the list.  */
+        packet_ptr =  head_ptr;
+        head_ptr =  head_ptr -> nx_packet_queue_next;
+        packet_count--;
+
+        /* Adjust this packet to look just like a new packet.  */
+        _nx_packet_fields_reset(packet_ptr, thread_ptr -> tx_thread_suspend_info);
+
+        /* Return this packet to the suspended thread waiting for it.  */
+        *((NX_PACKET **)thread_ptr -> tx_thread_additional_suspend_info) =  packet_ptr;
+
+        /* Put return status into the thread control block.  */
+        thread_ptr -> tx_thread_suspend_status =  NX_SUCCESS;
+
+        /* Resume thread.  */
+        _tx_thread_system_resume(thread_ptr);
+
+        /* Disable interrupts again.  */
+        TX_DISABLE
+    }
+
+    /* Determine if there are packets left.  */
+    if (packet_count)
+    {
+
+        /* Yes, link the packets to the head of the available list.  */
+        tail_ptr -> nx_packet_queue_next =  pool_ptr -> nx_packet_pool_available_list;
+        pool_ptr -> nx_packet_pool_available_list =  head_ptr;
+
+        /* Increment the count of available packets.  */
+        pool_ptr -> nx_packet_pool_available += packet_count;
+    }
+
+    /* Determine if any thread was resumed.  */
+    if (resumed)
+    {
+
+        /* Release the preempt disable.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+}
@@ -0,0 +1,152 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_cache_info_get                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the packet cache information of the         */
+/*    specified packet pool. The statistics include all packet caches     */
+/*    currently created on the pool as well as the caches already         */
+/*    deleted.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pool to get information from  */
+/*    cached_packets                        Destination for the number of */
+/*                                            packets held in caches      */
+/*    cache_hits                            Destination for number of     */
+/*                                            cache hits                  */
+/*    cache_misses                          Destination for number of     */
+/*                                            cache misses                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_cache_info_get(NX_PACKET_POOL *pool_ptr, ULONG *cached_packets,
+                                     ULONG *cache_hits, ULONG *cache_misses)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_CACHE *cache_ptr;     /* Working cache pointer   */
+ULONG            count;         /* Working cache count     */
+ULONG            packets;       /* Total cached packets    */
+ULONG            hits;          /* Total cache hits        */
+ULONG            misses;        /* Total cache misses      */
+
+
+    /* Disable interrupts to get packet cache information.  */
+    TX_DISABLE
+
+    /* Start with the statistics of the deleted caches.  */
+    packets =  0;
+    hits =     pool_ptr -> nx_packet_pool_cache_hits;
+    misses =   pool_ptr -> nx_packet_pool_cache_misses;
+
+    /* Loop through all caches created on this pool.  */
+    cache_ptr =  pool_ptr -> nx_packet_pool_cache_created_ptr;
+    for (count = pool_ptr -> nx_packet_pool_cache_created_count; count; count--)
+    {
+
+        /* Accumulate the information of this cache.  */
+        packets += cache_ptr -> nx_packet_cache_count;
+        hits +=    cache_ptr -> nx_packet_cache_hits;
+        misses +=  cache_ptr -> nx_packet_cache_misses;
+
+        /* Move to the next cache.  */
+        cache_ptr =  cache_ptr -> nx_packet_cache_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if cached packets is wanted.  */
+    if (cached_packets)
+    {
+
+        /* Return the number of packets held in the caches of this pool.  */
+        *cached_packets =  packets;
+    }
+
+    /* Determine if cache hits is wanted.  */
+    if (cache_hits)
+    {
+
+        /* Return the number of cache hits.  */
+        *cache_hits =  hits;
+    }
+
+    /* Determine if cache misses is wanted.  */
+    if (cache_misses)
+    {
+
+        /* Return the number of cache misses.  */
+        *cache_misses =  misses;
+    }
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(cached_packets);
+    NX_PARAMETER_NOT_USED(cache_hits);
+    NX_PARAMETER_NOT_USED(cache_misses);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
@@ -170,6 +170,18 @@ VOID           *rounded_pool_start;    /* Rounded stating address     */
         /*lint -e{929} -e{928} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
         ((NX_PACKET *)packet_ptr) -> nx_packet_data_end =    (UCHAR *)(packet_ptr + header_size + original_payload_size);
 
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+        /* Clear the external buffer notify function.  */
+        /*lint -e{929} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ((NX_PACKET *)packet_ptr) -> nx_packet_external_buffer_notify =  NX_NULL;
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+
+#ifdef NX_ENABLE_PACKET_CLONE
+        /* Clear the clone reference count.  */
+        /*lint -e{929} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ((NX_PACKET *)packet_ptr) -> nx_packet_clone_count =  0;
+#endif /* NX_ENABLE_PACKET_CLONE */
+
         /* Add debug information. */
         NX_PACKET_DEBUG(__FILE__, __LINE__, (NX_PACKET *)packet_ptr);
 
@@ -77,6 +77,13 @@ UINT  _nx_packet_pool_delete(NX_PACKET_POOL *pool_ptr)
 TX_INTERRUPT_SAVE_AREA
 
 TX_THREAD *thread_ptr;      /* Working thread pointer  */
+#ifdef NX_ENABLE_PACKET_CACHE
+NX_PACKET_CACHE *cache_ptr; /* Working cache pointer   */
+#endif /* NX_ENABLE_PACKET_CACHE */
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+NX_PACKET_POOL_GROUP *group_ptr; /* Working group pointer   */
+UINT       i;               /* Loop index              */
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
 
 
     /* Disable interrupts to remove the packet pool from the created list.  */
@@ -88,6 +95,54 @@ TX_THREAD *thread_ptr;      /* Working thread pointer  */
     /* Clear the packet pool ID to make it invalid.  */
     pool_ptr -> nx_packet_pool_id =  0;
 
+#ifdef NX_ENABLE_PACKET_CACHE
+    /* Invalidate all packet caches created on this pool.  */
+    while (pool_ptr -> nx_packet_pool_cache_created_count)
+    {
+
+        /* Pickup the cache pointer.  */
+        cache_ptr =  pool_ptr -> nx_packet_pool_cache_created_ptr;
+
+        /* Clear the packet cache ID and the packets held in the cache.  */
+        cache_ptr -> nx_packet_cache_id =     0;
+        cache_ptr -> nx_packet_cache_list =   NX_NULL;
+        cache_ptr -> nx_packet_cache_count =  0;
+
+        /* Move to the next cache.  */
+        pool_ptr -> nx_packet_pool_cache_created_ptr =  cache_ptr -> nx_packet_cache_created_next;
+        pool_ptr -> nx_packet_pool_cache_created_count--;
+    }
+    pool_ptr -> nx_packet_pool_cache_created_ptr =  NX_NULL;
+#endif /* NX_ENABLE_PACKET_CACHE */
+
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+    /* Remove this pool from its packet pool group.  */
+    group_ptr =  pool_ptr -> nx_packet_pool_group_ptr;
+    if (group_ptr)
+    {
+
+        /* Find the pool in the group.  */
+        for (i = 0; i < group_ptr -> nx_packet_pool_group_count; i++)
+        {
+            if (group_ptr -> nx_packet_pool_group_pools[i] == pool_ptr)
+            {
+                break;
+            }
+        }
+
+        /* Move the larger pools down to keep the list sorted.  */
+        for (; (i + 1) < group_ptr -> nx_packet_pool_group_count; i++)
+        {
+            group_ptr -> nx_packet_pool_group_pools[i] =  group_ptr -> nx_packet_pool_group_pools[i + 1];
+        }
+
+        /* Decrement the number of pools in the group.  */
+        group_ptr -> nx_packet_pool_group_count--;
+        group_ptr -> nx_packet_pool_group_pools[group_ptr -> nx_packet_pool_group_count] =  NX_NULL;
+        pool_ptr -> nx_packet_pool_group_ptr =  NX_NULL;
+    }
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+
     /* See if the packet pool only one on the list.  */
     if (pool_ptr == pool_ptr -> nx_packet_pool_created_next)
     {
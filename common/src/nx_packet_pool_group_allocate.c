@@ -0,0 +1,178 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_allocate                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a packet from the best-fit size class of    */
+/*    the specified packet pool group, which is the pool with the         */
+/*    smallest payload that holds both the packet type (header space)     */
+/*    and the requested data length. If no pool is large enough, the      */
+/*    largest pool is used and the caller has to chain packets.           */
+/*                                                                        */
+/*    If the best-fit pool is exhausted, the packet is taken from the     */
+/*    next larger pool that has an available packet. If all of them are   */
+/*    exhausted, the caller suspends on the best-fit pool according to    */
+/*    the wait option.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Packet pool group to allocate */
+/*                                            from                        */
+/*    packet_ptr                            Pointer to place allocated    */
+/*                                            packet pointer              */
+/*    packet_type                           Type of packet to allocate    */
+/*    packet_length                         Number of data bytes to hold  */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate a packet             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_tcp_packet_send_control           Send TCP control packet       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                     ULONG packet_type, ULONG packet_length, ULONG wait_option)
+{
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_POOL *pool_ptr;       /* Working pool pointer    */
+UINT            best;           /* Best-fit class index    */
+UINT            count;          /* Number of classes       */
+UINT            i;              /* Loop index              */
+UINT            status;         /* Return status           */
+
+
+    /* Set the return pointer to NULL initially.  */
+    *packet_ptr =  NX_NULL;
+
+    /* Pickup the number of size classes.  */
+    count =  group_ptr -> nx_packet_pool_group_count;
+
+    /* Check for an empty group.  */
+    if (count == 0)
+    {
+        return(NX_NO_PACKET);
+    }
+
+    /* Find the best-fit class.  Use the largest one if no class is large enough.  */
+    best =  count - 1;
+    for (i = 0; i < count; i++)
+    {
+        if ((group_ptr -> nx_packet_pool_group_pools[i]) -> nx_packet_pool_payload_size >= (packet_type + packet_length))
+        {
+            best =  i;
+            break;
+        }
+    }
+
+    /* Loop to allocate from the best-fit class, falling back to the larger classes.  */
+    for (i = best; i < count; i++)
+    {
+
+        /* Pickup the pool pointer.  */
+        pool_ptr =  group_ptr -> nx_packet_pool_group_pools[i];
+
+        /* Skip the exhausted pool.  */
+        if (pool_ptr -> nx_packet_pool_available == 0)
+        {
+            continue;
+        }
+
+        /* Allocate a packet without suspension.  */
+        status =  _nx_packet_allocate(pool_ptr, packet_ptr, packet_type, NX_NO_WAIT);
+
+        /* Determine if the packet is allocated.  */
+        if (status == NX_SUCCESS)
+        {
+
+            /* Determine if the packet is from a larger class.  */
+            if (i != best)
+            {
+
+                /* Disable interrupts to update the statistics.  */
+                TX_DISABLE
+
+                /* Increment the fallback count.  */
+                group_ptr -> nx_packet_pool_group_fallbacks++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+
+            return(NX_SUCCESS);
+        }
+
+        /* Check for an error other than an empty pool.  */
+        if (status != NX_NO_PACKET)
+        {
+            return(status);
+        }
+    }
+
+    /* All classes are exhausted, allocate from the best-fit class with the wait option.  */
+    return(_nx_packet_allocate(group_ptr -> nx_packet_pool_group_pools[best], packet_ptr, packet_type, wait_option));
+
+#else /* !NX_ENABLE_PACKET_POOL_GROUP */
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(packet_type);
+    NX_PARAMETER_NOT_USED(packet_length);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+}
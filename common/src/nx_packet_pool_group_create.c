@@ -0,0 +1,97 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_create                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates an empty packet pool group. Packet pools of   */
+/*    different payload sizes are added to the group afterwards, each     */
+/*    pool being one size class of the group.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Packet pool group control     */
+/*                                            block                       */
+/*    name_ptr                              Packet pool group string      */
+/*                                            pointer                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name_ptr)
+{
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+
+    /* Clear packet pool group fields. */
+    memset(group_ptr, 0, sizeof(NX_PACKET_POOL_GROUP));
+
+    /* Setup the basic packet pool group fields.  */
+    group_ptr -> nx_packet_pool_group_name =  name_ptr;
+
+    /* Setup the packet pool group ID to make it valid.  */
+    group_ptr -> nx_packet_pool_group_id =  NX_PACKET_POOL_GROUP_ID;
+
+    /* Return NX_SUCCESS.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_POOL_GROUP */
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+}
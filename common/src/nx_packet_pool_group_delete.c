@@ -0,0 +1,105 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_delete                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified packet pool group. The packet   */
+/*    pools of the group are not deleted, they are only removed from the  */
+/*    group.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Packet pool group to delete   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr)
+{
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+TX_INTERRUPT_SAVE_AREA
+
+UINT i;                         /* Loop index              */
+
+
+    /* Disable interrupts to remove the packet pools from the group.  */
+    TX_DISABLE
+
+    /* Clear the packet pool group ID to make it invalid.  */
+    group_ptr -> nx_packet_pool_group_id =  0;
+
+    /* Remove all packet pools from the group.  */
+    for (i = 0; i < group_ptr -> nx_packet_pool_group_count; i++)
+    {
+        (group_ptr -> nx_packet_pool_group_pools[i]) -> nx_packet_pool_group_ptr =  NX_NULL;
+        group_ptr -> nx_packet_pool_group_pools[i] =  NX_NULL;
+    }
+    group_ptr -> nx_packet_pool_group_count =  0;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return NX_SUCCESS.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_POOL_GROUP */
+    NX_PARAMETER_NOT_USED(group_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+}
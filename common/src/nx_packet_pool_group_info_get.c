@@ -0,0 +1,115 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_info_get                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information about the specified packet      */
+/*    pool group.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Packet pool group control     */
+/*                                            block                       */
+/*    pool_count                            Destination for the number of */
+/*                                            size classes                */
+/*    fallbacks                             Destination for the number of */
+/*                                            allocations served by a     */
+/*                                            larger class                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT *pool_count, ULONG *fallbacks)
+{
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the number of size classes is wanted.  */
+    if (pool_count)
+    {
+
+        /* Return the number of size classes.  */
+        *pool_count =  group_ptr -> nx_packet_pool_group_count;
+    }
+
+    /* Determine if the fallback count is wanted.  */
+    if (fallbacks)
+    {
+
+        /* Return the number of allocations served by a larger class.  */
+        *fallbacks =  group_ptr -> nx_packet_pool_group_fallbacks;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_POOL_GROUP */
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(pool_count);
+    NX_PARAMETER_NOT_USED(fallbacks);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+}
@@ -0,0 +1,132 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_pool_add                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a packet pool to the specified packet pool       */
+/*    group as a new size class. The pools of the group are kept sorted   */
+/*    by payload size, so pools can be added in any order. A packet pool  */
+/*    can only be added to one group.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Packet pool group control     */
+/*                                            block                       */
+/*    pool_ptr                              Packet pool to add            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_pool_add(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET_POOL *pool_ptr)
+{
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+TX_INTERRUPT_SAVE_AREA
+
+UINT i;                         /* Loop index              */
+
+
+    /* Disable interrupts to add the packet pool to the group.  */
+    TX_DISABLE
+
+    /* Check whether the packet pool is already in a group.  */
+    if (pool_ptr -> nx_packet_pool_group_ptr)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        return(NX_DUPLICATED_ENTRY);
+    }
+
+    /* Check whether the group is full.  */
+    if (group_ptr -> nx_packet_pool_group_count >= NX_PACKET_POOL_GROUP_MAX_CLASSES)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        return(NX_NO_MORE_ENTRIES);
+    }
+
+    /* Move the pools with larger payload size up to keep the list sorted.  */
+    i =  group_ptr -> nx_packet_pool_group_count;
+    while ((i > 0) &&
+           ((group_ptr -> nx_packet_pool_group_pools[i - 1]) -> nx_packet_pool_payload_size > pool_ptr -> nx_packet_pool_payload_size))
+    {
+        group_ptr -> nx_packet_pool_group_pools[i] =  group_ptr -> nx_packet_pool_group_pools[i - 1];
+        i--;
+    }
+
+    /* Insert the packet pool.  */
+    group_ptr -> nx_packet_pool_group_pools[i] =  pool_ptr;
+    group_ptr -> nx_packet_pool_group_count++;
+    pool_ptr -> nx_packet_pool_group_ptr =  group_ptr;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return NX_SUCCESS.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_POOL_GROUP */
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(pool_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
+}
@@ -55,6 +55,9 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_packet_fields_reset               Set up fields of new packet   */
+/*    _nx_packet_external_buffer_release    Release external buffer       */
+/*    _nx_packet_shared_release             Release shared packet         */
 /*    _tx_thread_system_resume              Resume suspended thread       */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -123,6 +126,28 @@ NX_PACKET      *next_packet;    /* Working block pointer   */
         /* Add debug information. */
         NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
 
+#ifdef NX_ENABLE_PACKET_CLONE
+        /* Determine if the data of the packet is referenced by clones.  */
+        if ((packet_ptr -> nx_packet_clone_count) && (_nx_packet_shared_release(packet_ptr)))
+        {
+
+            /* Yes, the packet is returned to the pool when the last clone is released.
+               Move to the next packet in the chain.  */
+            packet_ptr =  next_packet;
+            continue;
+        }
+#endif /* NX_ENABLE_PACKET_CLONE */
+
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+        /* Determine if the packet references an external buffer.  */
+        if (packet_ptr -> nx_packet_external_buffer_notify)
+        {
+
+            /* Yes, return the external buffer to the application.  */
+            _nx_packet_external_buffer_release(packet_ptr);
+        }
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+
         /* Disable interrupts to put this packet back in the packet pool.  */
         TX_DISABLE
 
@@ -175,42 +200,7 @@ NX_PACKET      *next_packet;    /* Working block pointer   */
             TX_RESTORE
 
             /* Adjust this packet to look just like a new packet.  */
-            packet_ptr -> nx_packet_queue_next  =  NX_NULL;
-#ifndef NX_DISABLE_PACKET_CHAIN
-            packet_ptr -> nx_packet_next        =  NX_NULL;
-            packet_ptr -> nx_packet_last        =  NX_NULL;
-#endif /* NX_DISABLE_PACKET_CHAIN */
-            packet_ptr -> nx_packet_length      =  0;
-            packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_data_start + (thread_ptr -> tx_thread_suspend_info);
-            packet_ptr -> nx_packet_append_ptr  =  packet_ptr -> nx_packet_prepend_ptr;
-            packet_ptr -> nx_packet_address.nx_packet_interface_ptr = NX_NULL;
-#ifdef NX_ENABLE_INTERFACE_CAPABILITY
-            packet_ptr -> nx_packet_interface_capability_flag = 0;
-#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
-            /* Set the TCP queue to the value that indicates it has been allocated.  */
-            /*lint -e{923} suppress cast of ULONG to pointer.  */
-            packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
-
-#ifdef FEATURE_NX_IPV6
-
-            /* Clear the option state. */
-            packet_ptr -> nx_packet_option_state = 0;
-#endif /* FEATURE_NX_IPV6 */
-
-#ifdef NX_IPSEC_ENABLE
-
-            /* Clear the ipsec state. */
-            packet_ptr -> nx_packet_ipsec_state = 0;
-#endif /* NX_IPSEC_ENABLE */
-
-            /* Clear the IP version.  */
-            packet_ptr -> nx_packet_ip_version  =  0;
-
-            /* Clear the IP identification flag.  */
-            packet_ptr -> nx_packet_identical_copy = NX_FALSE;
-
-            /* Initialize the IP header length. */
-            packet_ptr -> nx_packet_ip_header_length = 0;
+            _nx_packet_fields_reset(packet_ptr, thread_ptr -> tx_thread_suspend_info);
 
             /* Return this block pointer to the suspended thread waiting for
                a block.  */
@@ -0,0 +1,217 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_release_bulk                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases an array of packets, including all packets   */
+/*    chained to each of them, back to their packet pools. Consecutive    */
+/*    packets from the same pool are collected into one list and          */
+/*    returned to the pool with a single critical section. Threads        */
+/*    suspended on a pool are resumed once for the whole list.            */
+/*                                                                        */
+/*    If a packet that is not allocated is found, the packets before it   */
+/*    are released and an error is returned.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_array                          Array of packets to release   */
+/*    packet_count                          Number of packets in the      */
+/*                                            array                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_external_buffer_release    Release external buffer       */
+/*    _nx_packet_shared_release             Release shared packet         */
+/*    _nx_packet_pool_bulk_return           Return packets to their pool  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_packet_transmit_release_bulk      Transmit release in bulk      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_release_bulk(NX_PACKET **packet_array, UINT packet_count)
+{
+
+NX_PACKET_POOL *pool_ptr;       /* Pool of the current list    */
+NX_PACKET      *packet_ptr;     /* Working packet pointer      */
+NX_PACKET      *head_ptr;       /* First packet of the list    */
+NX_PACKET      *tail_ptr;       /* Last packet of the list     */
+ULONG           list_count;     /* Number of packets in list   */
+UINT            i;              /* Loop index                  */
+#ifndef NX_DISABLE_PACKET_CHAIN
+NX_PACKET      *next_packet;    /* Working block pointer       */
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_PACKET_RELEASE_BULK, packet_array, packet_count, 0, 0, NX_TRACE_PACKET_EVENTS, 0, 0);
+
+    /* Initialize the packet list.  */
+    pool_ptr =    NX_NULL;
+    head_ptr =    NX_NULL;
+    tail_ptr =    NX_NULL;
+    list_count =  0;
+
+    /* Loop to collect all packets in the array.  */
+    for (i = 0; i < packet_count; i++)
+    {
+
+        /* Pickup the packet pointer.  */
+        packet_ptr =  packet_array[i];
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+        /* Loop to free all packets chained together, not assuming they are
+           from the same pool.  */
+        while (packet_ptr)
+        {
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+            /* Check to see if the packet is releasable.  */
+            /*lint -e{923} suppress cast of ULONG to pointer.  */
+            if (packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED))
+            {
+
+                /* Return the packets collected so far.  */
+                if (list_count)
+                {
+                    _nx_packet_pool_bulk_return(pool_ptr, head_ptr, tail_ptr, list_count);
+                }
+
+#ifndef NX_DISABLE_PACKET_INFO
+                /* Pickup the pool pointer.  */
+                pool_ptr =  packet_ptr -> nx_packet_pool_owner;
+
+                /* Check for a good pool pointer...  error must be the packet!  */
+                if ((pool_ptr) && (pool_ptr -> nx_packet_pool_id == NX_PACKET_POOL_ID))
+                {
+
+                    /* Increment the packet pool invalid release error count.  */
+                    pool_ptr -> nx_packet_pool_invalid_releases++;
+                }
+#endif
+
+                /* Return an error indicating the packet could not be released.  */
+                return(NX_PTR_ERROR);
+            }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+            /* Pickup the next packet. */
+            next_packet =  packet_ptr -> nx_packet_next;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+            /* Add debug information. */
+            NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
+
+#ifdef NX_ENABLE_PACKET_CLONE
+            /* Determine if the data of the packet is referenced by clones.  */
+            if ((packet_ptr -> nx_packet_clone_count) && (_nx_packet_shared_release(packet_ptr)))
+            {
+
+                /* Yes, the packet is returned to the pool when the last clone is released.
+                   Move to the next packet in the chain.  */
+                packet_ptr =  next_packet;
+                continue;
+            }
+#endif /* NX_ENABLE_PACKET_CLONE */
+
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+            /* Determine if the packet references an external buffer.  */
+            if (packet_ptr -> nx_packet_external_buffer_notify)
+            {
+
+                /* Yes, return the external buffer to the application.  */
+                _nx_packet_external_buffer_release(packet_ptr);
+            }
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
+
+            /* Determine if this packet belongs to another pool.  */
+            if (packet_ptr -> nx_packet_pool_owner != pool_ptr)
+            {
+
+                /* Yes, return the packets collected so far.  */
+                if (list_count)
+                {
+                    _nx_packet_pool_bulk_return(pool_ptr, head_ptr, tail_ptr, list_count);
+                }
+
+                /* Start a new list for this pool.  */
+                pool_ptr =    packet_ptr -> nx_packet_pool_owner;
+                head_ptr =    NX_NULL;
+                tail_ptr =    packet_ptr;
+                list_count =  0;
+            }
+
+            /* Mark the packet as free.  */
+            /*lint -e{923} suppress cast of ULONG to pointer.  */
+            packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_FREE;
+
+            /* Add the packet to the head of the list.  */
+            packet_ptr -> nx_packet_queue_next =  head_ptr;
+            head_ptr =  packet_ptr;
+            list_count++;
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+            /* Move to the next packet in the chain.  */
+            packet_ptr =  next_packet;
+        }
+#endif /* NX_DISABLE_PACKET_CHAIN */
+    }
+
+    /* Return the last list of packets.  */
+    if (list_count)
+    {
+        _nx_packet_pool_bulk_return(pool_ptr, head_ptr, tail_ptr, list_count);
+    }
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+}
@@ -0,0 +1,111 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_shared_release                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called when the owner releases a packet whose      */
+/*    data may be referenced by clones. If clones still reference the     */
+/*    data, the packet is marked as shared and is returned to its pool    */
+/*    when the last clone reference is released.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Packet being released         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               Packet is kept for the clones */
+/*    NX_FALSE                              Packet can be released        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_release                    Release data packet           */
+/*    _nx_packet_release_bulk               Release data packets in bulk  */
+/*    _nx_packet_cache_release              Release packet to cache       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_shared_release(NX_PACKET *packet_ptr)
+{
+#ifdef NX_ENABLE_PACKET_CLONE
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts to check the reference count.  */
+    TX_DISABLE
+
+    /* Determine if the data of the packet is still referenced.  */
+    if (packet_ptr -> nx_packet_clone_count == 0)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* No, the packet can be released.  */
+        return(NX_FALSE);
+    }
+
+    /* Mark the packet as released by the owner.  */
+    /*lint -e{923} suppress cast of ULONG to pointer.  */
+    packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_SHARED;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* The last clone reference releases the packet.  */
+    return(NX_TRUE);
+
+#else /* !NX_ENABLE_PACKET_CLONE */
+    NX_PARAMETER_NOT_USED(packet_ptr);
+
+    return(NX_FALSE);
+
+#endif /* NX_ENABLE_PACKET_CLONE */
+}
@@ -0,0 +1,145 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_transmit_release_bulk                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases an array of transmitted packets, typically   */
+/*    all packets of the completed descriptors of a driver transmit       */
+/*    ring. Queued TCP data packets are marked as transmitted in a        */
+/*    single critical section and left for the TCP layer. All other       */
+/*    packets are moved to the front of the array and released in bulk.   */
+/*    The order of the packets in the array is not preserved.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_array                          Array of packets to release   */
+/*    packet_count                          Number of packets in the      */
+/*                                            array                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release_bulk               Release packets in bulk       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_transmit_release_bulk(NX_PACKET **packet_array, UINT packet_count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET *packet_ptr;          /* Working packet pointer      */
+UINT       release_count;       /* Number of packets to free   */
+UINT       i;                   /* Loop index                  */
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_PACKET_TRANSMIT_RELEASE_BULK, packet_array, packet_count, 0, 0, NX_TRACE_PACKET_EVENTS, 0, 0);
+
+    /* No packet to release yet.  */
+    release_count =  0;
+
+    /* Disable interrupts temporarily.  */
+    TX_DISABLE
+
+    /* Loop to check all packets in the array.  */
+    for (i = 0; i < packet_count; i++)
+    {
+
+        /* Pickup the packet pointer.  */
+        packet_ptr =  packet_array[i];
+
+        /* Add debug information. */
+        NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
+
+        /* Determine if the packet is a queued TCP data packet.  Such packets cannot be released
+           immediately, since they may need to be resent.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if ((packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED)) &&
+            (packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_FREE)))
+        {
+
+            /* Yes, this is indeed a TCP packet.  Just mark this with the NX_DRIVER_TX_DONE
+               value to let the TCP layer know it is no longer queued up.  */
+            /*lint -e{923} suppress cast of ULONG to pointer.  */
+            packet_ptr -> nx_packet_queue_next =  (NX_PACKET *)NX_DRIVER_TX_DONE;
+
+            /* Remove the IP header and adjust the length.  */
+            packet_ptr -> nx_packet_prepend_ptr += packet_ptr -> nx_packet_ip_header_length;
+            packet_ptr -> nx_packet_length -= packet_ptr -> nx_packet_ip_header_length;
+
+            /* Reset the IP header length. */
+            packet_ptr -> nx_packet_ip_header_length = 0;
+        }
+        else
+        {
+
+            /* Move the packet to the list to release.  */
+            packet_array[release_count++] =  packet_ptr;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if there are packets to release.  */
+    if (release_count == 0)
+    {
+
+        /* No, return success.  */
+        return(NX_SUCCESS);
+    }
+
+    /* Call the actual packet release function.  */
+    return(_nx_packet_release_bulk(packet_array, release_count));
+}
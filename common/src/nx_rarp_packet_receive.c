@@ -167,6 +167,11 @@ VOID   (*address_change_notify_internal)(NX_IP *, VOID *) = NX_NULL;
                IP address in the RARP response.  */
             packet_ptr -> nx_packet_address.nx_packet_interface_ptr -> nx_interface_ip_address =  *(message_ptr + 6);
 
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+            /* Invalidate the routes in the route cache.  */
+            ip_ptr -> nx_ip_route_cache_generation++;
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
+
             /* Loop through all the interfaces and check whether or not to continue periodic RARP requests. */
             for (i = 0; i < NX_MAX_PHYSICAL_INTERFACES; i++)
             {
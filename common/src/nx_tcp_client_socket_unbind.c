@@ -56,6 +56,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_tcp_client_bind_cleanup           Remove and cleanup bind req   */
+/*    _nx_tcp_connection_table_remove       Remove socket from connection */
+/*                                            table                       */
+/*    _nx_tcp_socket_ack_pending_remove     Remove socket from ACK list   */
 /*    _nx_tcp_socket_thread_resume          Resume thread suspended on    */
 /*                                            port                        */
 /*    _nx_tcp_socket_block_cleanup          Cleanup the socket block      */
@@ -153,6 +156,14 @@ NX_TCP_SOCKET *new_socket_ptr;
     /* Calculate the hash index in the TCP port array of the associated IP instance.  */
     index =  (UINT)((port + (port >> 8)) & NX_TCP_PORT_TABLE_MASK);
 
+    /* Remove the socket from the TCP connection table.  */
+    _nx_tcp_connection_table_remove(socket_ptr);
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Remove the socket from the pending ACK list.  */
+    _nx_tcp_socket_ack_pending_remove(socket_ptr);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
     /* Disable interrupts while we unlink the current socket.  */
     TX_DISABLE
 
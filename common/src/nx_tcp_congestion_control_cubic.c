@@ -0,0 +1,502 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_root               PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function computes the integer cube root of a 64-bit   */
+/*    value, rounded down. The root is computed one bit at a time from    */
+/*    the highest group of three bits of the value.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    value                                 Value to compute the root of  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    root                                  Cube root of the value        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_ack  CUBIC congestion control ACK  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static ULONG  _nx_tcp_congestion_control_cubic_root(ULONG64 value)
+{
+
+ULONG64 root = 0;
+ULONG64 bit;
+INT     shift;
+
+
+    for (shift = 63; shift >= 0; shift -= 3)
+    {
+
+        /* Try the next bit of the root.  (root + 1)^3 - root^3 = 3 * root * (root + 1) + 1.  */
+        root <<= 1;
+        bit = 3 * root * (root + 1) + 1;
+        if ((value >> shift) >= bit)
+        {
+            value -= bit << shift;
+            root++;
+        }
+    }
+
+    return((ULONG)root);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_initialize         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the CUBIC congestion control of a         */
+/*    connection. No window reduction has happened yet, so the first      */
+/*    congestion avoidance epoch starts from the current window.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    memset                                Clear the CUBIC state         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_congestion_control_set Set congestion control        */
+/*    _nx_tcp_socket_state_syn_received     Socket SYN RECEIVED state     */
+/*                                            processing                  */
+/*    _nx_tcp_socket_state_syn_sent         Socket SYN SENT state         */
+/*                                            processing                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_cubic_initialize(NX_TCP_SOCKET *socket_ptr)
+{
+
+    /* Clear the CUBIC state of the socket.  */
+    memset((void *)&(socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_cubic), 0, sizeof(NX_TCP_CUBIC));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_ack                PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function grows the congestion window of the CUBIC congestion   */
+/*    control when new data is acknowledged outside of fast recovery,     */
+/*    RFC 9438. Below the slow start threshold, the window grows as in    */
+/*    slow start. Otherwise the window follows the cubic function W(t) =  */
+/*    C * (t - K)^3 + W_max, with C = 0.4 and t the time since the start  */
+/*    of the congestion avoidance epoch, looking one round trip time      */
+/*    ahead. The window does not grow slower than the Reno estimate of    */
+/*    the same epoch.                                                     */
+/*                                                                        */
+/*    The window is in bytes, so that C * (t - K)^3 in segments is        */
+/*    computed as MSS * 4 * (t - K)^3 / 10^10, with t and K in            */
+/*    milliseconds.                                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    acked_bytes                           Number of bytes acknowledged  */
+/*    round_trip_time                       Round trip time measured      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_root Compute cube root             */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_cubic_ack(NX_TCP_SOCKET *socket_ptr, ULONG acked_bytes, ULONG round_trip_time)
+{
+
+NX_TCP_CUBIC *cubic_ptr;
+ULONG         mss;
+ULONG         window;
+ULONG         target;
+ULONG         increment;
+ULONG64       elapsed;
+ULONG64       offset;
+UINT          concave;
+
+
+    /* Setup a pointer to the CUBIC state.  */
+    cubic_ptr =  &(socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_cubic);
+
+    mss =  socket_ptr -> nx_tcp_socket_connect_mss;
+    window =  socket_ptr -> nx_tcp_socket_tx_window_congestion;
+
+    /* Keep the latest round trip time measured.  */
+    if (round_trip_time != NX_TCP_RTT_INVALID)
+    {
+        cubic_ptr -> nx_tcp_cubic_round_trip_time =  round_trip_time;
+    }
+
+    /* Determine if the socket is in slow start phase.  */
+    if (window < socket_ptr -> nx_tcp_socket_tx_slow_start_threshold)
+    {
+
+        /* cwnd += min (N, SMSS), where N is the number of ACKed bytes.  */
+        if (acked_bytes < mss)
+        {
+            socket_ptr -> nx_tcp_socket_tx_window_congestion += acked_bytes;
+        }
+        else
+        {
+            socket_ptr -> nx_tcp_socket_tx_window_congestion += mss;
+        }
+
+        return;
+    }
+
+    /* Determine if a congestion avoidance epoch is started.  */
+    if (cubic_ptr -> nx_tcp_cubic_epoch_valid == NX_FALSE)
+    {
+
+        /* No, start the epoch now.  */
+        cubic_ptr -> nx_tcp_cubic_epoch_valid =  NX_TRUE;
+        cubic_ptr -> nx_tcp_cubic_epoch_start =  tx_time_get();
+        cubic_ptr -> nx_tcp_cubic_reno_window =  window;
+
+        if (window < cubic_ptr -> nx_tcp_cubic_window_max)
+        {
+
+            /* K = cubic_root((W_max - cwnd) / C), in milliseconds.  */
+            cubic_ptr -> nx_tcp_cubic_k =  _nx_tcp_congestion_control_cubic_root((ULONG64)(cubic_ptr -> nx_tcp_cubic_window_max - window) *
+                                                                                 (ULONG64)2500000000 / mss);
+            cubic_ptr -> nx_tcp_cubic_origin =  cubic_ptr -> nx_tcp_cubic_window_max;
+        }
+        else
+        {
+
+            /* The window is already above W_max, grow from here.  */
+            cubic_ptr -> nx_tcp_cubic_k =  0;
+            cubic_ptr -> nx_tcp_cubic_origin =  window;
+        }
+    }
+
+    /* Compute the time since the start of the epoch plus one round trip time, in milliseconds.  */
+    elapsed =  (ULONG64)(tx_time_get() - cubic_ptr -> nx_tcp_cubic_epoch_start + cubic_ptr -> nx_tcp_cubic_round_trip_time) *
+        1000 / NX_IP_PERIODIC_RATE;
+
+    /* Compute |t - K|.  The window is below the origin before K is reached.  */
+    if (elapsed < cubic_ptr -> nx_tcp_cubic_k)
+    {
+        elapsed =  cubic_ptr -> nx_tcp_cubic_k - elapsed;
+        concave =  NX_TRUE;
+    }
+    else
+    {
+        elapsed =  elapsed - cubic_ptr -> nx_tcp_cubic_k;
+        concave =  NX_FALSE;
+    }
+    if (elapsed > NX_TCP_CUBIC_TIME_MAX)
+    {
+        elapsed =  NX_TCP_CUBIC_TIME_MAX;
+    }
+
+    /* Compute C * (t - K)^3 in bytes.  */
+    offset =  (elapsed * elapsed * elapsed / 1000) * mss * 4 / 10000000;
+    if (offset > NX_TCP_CONGESTION_WINDOW_MAX)
+    {
+        offset =  NX_TCP_CONGESTION_WINDOW_MAX;
+    }
+
+    /* Compute the target window W(t + RTT).  */
+    if (concave == NX_FALSE)
+    {
+        target =  cubic_ptr -> nx_tcp_cubic_origin + (ULONG)offset;
+    }
+    else if (cubic_ptr -> nx_tcp_cubic_origin > (ULONG)offset)
+    {
+        target =  cubic_ptr -> nx_tcp_cubic_origin - (ULONG)offset;
+    }
+    else
+    {
+        target =  window;
+    }
+
+    /* The target is at most 1.5 times of the window.  RFC 9438, Section 4.2.  */
+    if (target > window + (window >> 1))
+    {
+        target =  window + (window >> 1);
+    }
+
+    if (target > window)
+    {
+
+        /* cwnd += (target - cwnd) / cwnd for every segment acknowledged.  */
+        increment =  (ULONG)((ULONG64)(target - window) * acked_bytes / window);
+    }
+    else
+    {
+
+        /* Grow by a small amount while the target is reached.  */
+        increment =  socket_ptr -> nx_tcp_socket_connect_mss2 / (window * 100);
+    }
+
+    /* Update the Reno estimate, with alpha = 3 * (1 - beta) / (1 + beta) = 9 / 17 until it
+       reaches W_max, and 1 afterwards.  RFC 9438, Section 4.3.  */
+    if (cubic_ptr -> nx_tcp_cubic_reno_window < cubic_ptr -> nx_tcp_cubic_window_max)
+    {
+        cubic_ptr -> nx_tcp_cubic_reno_window +=  (ULONG)((ULONG64)mss * acked_bytes * 9 / ((ULONG64)window * 17));
+    }
+    else
+    {
+        cubic_ptr -> nx_tcp_cubic_reno_window +=  (ULONG)((ULONG64)mss * acked_bytes / window);
+    }
+
+    window +=  increment;
+
+    /* Use the Reno estimate if it is larger.  */
+    if (window < cubic_ptr -> nx_tcp_cubic_reno_window)
+    {
+        window =  cubic_ptr -> nx_tcp_cubic_reno_window;
+    }
+
+    if (window > NX_TCP_CONGESTION_WINDOW_MAX)
+    {
+        window =  NX_TCP_CONGESTION_WINDOW_MAX;
+    }
+
+    socket_ptr -> nx_tcp_socket_tx_window_congestion =  window;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_loss               PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces the congestion window of the CUBIC            */
+/*    congestion control when a loss is detected by duplicate ACKs, RFC   */
+/*    9438. The window before the reduction is saved as W_max, or less    */
+/*    with fast convergence when the window did not grow back to the      */
+/*    previous W_max. The slow start threshold and the congestion window  */
+/*    are then set to 0.7 times of the flight size.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_timeout                            */
+/*                                          CUBIC control timeout         */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_cubic_loss(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_TCP_CUBIC *cubic_ptr;
+ULONG         window;
+
+
+    /* Setup a pointer to the CUBIC state.  */
+    cubic_ptr =  &(socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_cubic);
+
+    /* A new epoch starts in the next congestion avoidance phase.  */
+    cubic_ptr -> nx_tcp_cubic_epoch_valid =  NX_FALSE;
+
+    /* Pickup the flight size.  */
+    window =  socket_ptr -> nx_tcp_socket_tx_outstanding_bytes;
+
+    /* Save W_max with fast convergence.  RFC 9438, Section 4.7.  */
+    if (window < cubic_ptr -> nx_tcp_cubic_window_max)
+    {
+        cubic_ptr -> nx_tcp_cubic_window_max =  (ULONG)((ULONG64)window * (10 + NX_TCP_CUBIC_BETA) / 20);
+    }
+    else
+    {
+        cubic_ptr -> nx_tcp_cubic_window_max =  window;
+    }
+
+    /* Reduce the window by beta.  */
+    window =  (ULONG)((ULONG64)window * NX_TCP_CUBIC_BETA / 10);
+
+    /* Make sure we have at least 2 * MSS */
+    if (window < (socket_ptr -> nx_tcp_socket_connect_mss << 1))
+    {
+        window =  socket_ptr -> nx_tcp_socket_connect_mss << 1;
+    }
+
+    socket_ptr -> nx_tcp_socket_tx_slow_start_threshold =  window;
+    socket_ptr -> nx_tcp_socket_tx_window_congestion =  window;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_timeout            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces the congestion window of the CUBIC            */
+/*    congestion control when the retransmission timer expires. W_max     */
+/*    and the slow start threshold are set as for a loss, and slow start  */
+/*    is entered with a congestion window of one segment. RFC 9438,       */
+/*    Section 4.8.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_cubic_loss CUBIC control loss            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_cubic_timeout(NX_TCP_SOCKET *socket_ptr)
+{
+
+    /* Set W_max and the slow start threshold.  */
+    _nx_tcp_congestion_control_cubic_loss(socket_ptr);
+
+    /* Set the current window to be MSS size. */
+    socket_ptr -> nx_tcp_socket_tx_window_congestion =  socket_ptr -> nx_tcp_socket_connect_mss;
+}
+
+
+/* Define the CUBIC congestion control module, RFC 9438.  */
+
+const NX_TCP_CONGESTION_CONTROL nx_tcp_congestion_control_cubic =
+{
+    "CUBIC",
+    _nx_tcp_congestion_control_cubic_initialize,
+    _nx_tcp_congestion_control_cubic_ack,
+    _nx_tcp_congestion_control_cubic_loss,
+    _nx_tcp_congestion_control_cubic_timeout,
+    _nx_tcp_congestion_control_newreno_window_get
+};
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
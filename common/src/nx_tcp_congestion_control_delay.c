@@ -0,0 +1,428 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_delay_initialize         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the delay-based congestion control of a   */
+/*    connection. The connection starts in the startup phase, with no     */
+/*    bandwidth or round trip time measured.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    memset                                Clear the delay-based state   */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_congestion_control_set Set congestion control        */
+/*    _nx_tcp_socket_state_syn_received     Socket SYN RECEIVED state     */
+/*                                            processing                  */
+/*    _nx_tcp_socket_state_syn_sent         Socket SYN SENT state         */
+/*                                            processing                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_delay_initialize(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_TCP_DELAY *delay_ptr;
+
+
+    /* Setup a pointer to the delay-based state.  */
+    delay_ptr =  &(socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_delay);
+
+    /* Clear the state and start the first round trip.  */
+    memset((void *)delay_ptr, 0, sizeof(NX_TCP_DELAY));
+    delay_ptr -> nx_tcp_delay_phase =  NX_TCP_DELAY_STARTUP;
+    delay_ptr -> nx_tcp_delay_round_start =  tx_time_get();
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_delay_ack                PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates the delay-based congestion control when new   */
+/*    data is acknowledged outside of fast recovery. The control is       */
+/*    modeled on BBR: each round trip time measured closes a round,       */
+/*    which gives a sample of the delivery rate and of the round trip     */
+/*    time. The maximum delivery rate and the minimum round trip time     */
+/*    estimate the bandwidth-delay product of the path.                   */
+/*                                                                        */
+/*    In the startup phase, the window doubles every round trip until     */
+/*    the delivery rate stops growing by 25% for three round trips. Then  */
+/*    the window is set to twice the bandwidth-delay product. When the    */
+/*    minimum round trip time is not refreshed for 10 seconds, the        */
+/*    window is drained for a short time to measure it again.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    acked_bytes                           Number of bytes acknowledged  */
+/*    round_trip_time                       Round trip time measured      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_delay_ack(NX_TCP_SOCKET *socket_ptr, ULONG acked_bytes, ULONG round_trip_time)
+{
+
+NX_TCP_DELAY *delay_ptr;
+ULONG         current_time;
+ULONG         elapsed;
+ULONG         rate;
+ULONG         window;
+ULONG64       target;
+
+
+    /* Setup a pointer to the delay-based state.  */
+    delay_ptr =  &(socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_delay);
+
+    /* Count the bytes delivered in this round trip.  */
+    delay_ptr -> nx_tcp_delay_round_bytes +=  acked_bytes;
+
+    /* Determine if a round trip is complete.  */
+    if (round_trip_time != NX_TCP_RTT_INVALID)
+    {
+
+        current_time =  tx_time_get();
+
+        /* A round trip shorter than the timer tick is counted as one tick.  */
+        if (round_trip_time == 0)
+        {
+            round_trip_time =  1;
+        }
+
+        /* Update the minimum round trip time.  */
+        if ((delay_ptr -> nx_tcp_delay_min_rtt == 0) || (round_trip_time <= delay_ptr -> nx_tcp_delay_min_rtt))
+        {
+            delay_ptr -> nx_tcp_delay_min_rtt =  round_trip_time;
+            delay_ptr -> nx_tcp_delay_min_rtt_time =  current_time;
+        }
+        else if ((current_time - delay_ptr -> nx_tcp_delay_min_rtt_time) > NX_TCP_DELAY_MIN_RTT_EXPIRE)
+        {
+
+            /* The minimum round trip time has expired, restart the measurement.  */
+            delay_ptr -> nx_tcp_delay_min_rtt =  round_trip_time;
+            delay_ptr -> nx_tcp_delay_min_rtt_time =  current_time;
+
+            /* Drain the queue of the path so the round trip time can be measured without it.  */
+            if (delay_ptr -> nx_tcp_delay_phase == NX_TCP_DELAY_STEADY)
+            {
+                delay_ptr -> nx_tcp_delay_phase =  NX_TCP_DELAY_PROBE_RTT;
+                delay_ptr -> nx_tcp_delay_probe_rtt_end =  current_time + NX_TCP_DELAY_PROBE_RTT_TIME;
+            }
+        }
+
+        /* Compute the delivery rate of the round trip.  */
+        elapsed =  current_time - delay_ptr -> nx_tcp_delay_round_start;
+        if (elapsed == 0)
+        {
+            elapsed =  1;
+        }
+        rate =  delay_ptr -> nx_tcp_delay_round_bytes / elapsed;
+
+        /* Start the next round trip.  */
+        delay_ptr -> nx_tcp_delay_round_bytes =  0;
+        delay_ptr -> nx_tcp_delay_round_start =  current_time;
+
+        /* Keep the maximum delivery rate.  The maximum decays by 1/8 every round trip, so that a
+           lower bandwidth of the path is followed.  */
+        delay_ptr -> nx_tcp_delay_bandwidth -=  (delay_ptr -> nx_tcp_delay_bandwidth >> 3);
+        if (rate > delay_ptr -> nx_tcp_delay_bandwidth)
+        {
+            delay_ptr -> nx_tcp_delay_bandwidth =  rate;
+        }
+
+        if (delay_ptr -> nx_tcp_delay_phase == NX_TCP_DELAY_STARTUP)
+        {
+
+            /* The path is full when the delivery rate does not grow by 25% for three round trips.  */
+            if (delay_ptr -> nx_tcp_delay_bandwidth >=
+                (delay_ptr -> nx_tcp_delay_full_bandwidth + (delay_ptr -> nx_tcp_delay_full_bandwidth >> 2)))
+            {
+                delay_ptr -> nx_tcp_delay_full_bandwidth =  delay_ptr -> nx_tcp_delay_bandwidth;
+                delay_ptr -> nx_tcp_delay_full_rounds =  0;
+            }
+            else
+            {
+                delay_ptr -> nx_tcp_delay_full_rounds++;
+                if (delay_ptr -> nx_tcp_delay_full_rounds >= NX_TCP_DELAY_FULL_ROUNDS)
+                {
+                    delay_ptr -> nx_tcp_delay_phase =  NX_TCP_DELAY_STEADY;
+                }
+            }
+        }
+        else if ((delay_ptr -> nx_tcp_delay_phase == NX_TCP_DELAY_PROBE_RTT) &&
+                 ((INT)(current_time - delay_ptr -> nx_tcp_delay_probe_rtt_end) >= 0))
+        {
+
+            /* The round trip time is measured, back to the steady phase.  */
+            delay_ptr -> nx_tcp_delay_phase =  NX_TCP_DELAY_STEADY;
+        }
+    }
+
+    window =  socket_ptr -> nx_tcp_socket_tx_window_congestion;
+
+    if (delay_ptr -> nx_tcp_delay_phase == NX_TCP_DELAY_STARTUP)
+    {
+
+        /* Grow the window by the bytes acknowledged, doubling it every round trip.  */
+        window +=  acked_bytes;
+    }
+    else
+    {
+
+        /* The target window is twice the bandwidth-delay product, and at least 4 * MSS.  */
+        target =  (ULONG64)delay_ptr -> nx_tcp_delay_bandwidth * delay_ptr -> nx_tcp_delay_min_rtt * 2;
+        if (target > NX_TCP_CONGESTION_WINDOW_MAX)
+        {
+            target =  NX_TCP_CONGESTION_WINDOW_MAX;
+        }
+        if (target < (socket_ptr -> nx_tcp_socket_connect_mss << 2))
+        {
+            target =  socket_ptr -> nx_tcp_socket_connect_mss << 2;
+        }
+
+        /* Grow the window up to the target, or cut it down to the target.  */
+        if (window < (ULONG)target)
+        {
+            window +=  acked_bytes;
+        }
+        if (window > (ULONG)target)
+        {
+            window =  (ULONG)target;
+        }
+    }
+
+    if (window > NX_TCP_CONGESTION_WINDOW_MAX)
+    {
+        window =  NX_TCP_CONGESTION_WINDOW_MAX;
+    }
+
+    socket_ptr -> nx_tcp_socket_tx_window_congestion =  window;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_delay_loss               PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces the congestion window of the delay-based      */
+/*    congestion control when a loss is detected by duplicate ACKs. The   */
+/*    window is set by the path model rather than by losses, so the       */
+/*    reduction is mild: the slow start threshold and the congestion      */
+/*    window are set to 3/4 of the flight size. A loss in the startup     */
+/*    phase also means the path is full.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_delay_loss(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_TCP_DELAY *delay_ptr;
+ULONG         window;
+
+
+    /* Setup a pointer to the delay-based state.  */
+    delay_ptr =  &(socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_delay);
+
+    /* Leave the startup phase.  */
+    if (delay_ptr -> nx_tcp_delay_phase == NX_TCP_DELAY_STARTUP)
+    {
+        delay_ptr -> nx_tcp_delay_phase =  NX_TCP_DELAY_STEADY;
+    }
+
+    /* Reduce the window to 3/4 of the flight size.  */
+    window =  socket_ptr -> nx_tcp_socket_tx_outstanding_bytes;
+    window -=  (window >> 2);
+
+    /* Make sure we have at least 2 * MSS */
+    if (window < (socket_ptr -> nx_tcp_socket_connect_mss << 1))
+    {
+        window =  socket_ptr -> nx_tcp_socket_connect_mss << 1;
+    }
+
+    socket_ptr -> nx_tcp_socket_tx_slow_start_threshold =  window;
+    socket_ptr -> nx_tcp_socket_tx_window_congestion =  window;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_delay_window_get         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the congestion window of the delay-based      */
+/*    congestion control. While the minimum round trip time is probed,    */
+/*    at most 4 * MSS is in flight.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    window                                Congestion window in bytes    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_send_internal          Send TCP data                 */
+/*    _nx_tcp_socket_state_transmit_check   Check for transmit suspension */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_congestion_control_delay_window_get(NX_TCP_SOCKET *socket_ptr)
+{
+
+ULONG window;
+
+
+    window =  socket_ptr -> nx_tcp_socket_tx_window_congestion;
+
+    /* Limit the data in flight while the minimum round trip time is probed.  */
+    if ((socket_ptr -> nx_tcp_socket_congestion_state.nx_tcp_socket_delay.nx_tcp_delay_phase == NX_TCP_DELAY_PROBE_RTT) &&
+        (window > (socket_ptr -> nx_tcp_socket_connect_mss << 2)))
+    {
+        window =  socket_ptr -> nx_tcp_socket_connect_mss << 2;
+    }
+
+    return(window);
+}
+
+
+/* Define the delay-based congestion control module.  The retransmission timeout is handled
+   as by NewReno, the path model is kept.  */
+
+const NX_TCP_CONGESTION_CONTROL nx_tcp_congestion_control_delay =
+{
+    "Delay",
+    _nx_tcp_congestion_control_delay_initialize,
+    _nx_tcp_congestion_control_delay_ack,
+    _nx_tcp_congestion_control_delay_loss,
+    _nx_tcp_congestion_control_newreno_timeout,
+    _nx_tcp_congestion_control_delay_window_get
+};
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
@@ -0,0 +1,357 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_newreno_initialize       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the NewReno congestion control of a       */
+/*    connection. NewReno keeps no state besides the congestion window    */
+/*    and the slow start threshold, which are set up by the caller.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_syn_received     Socket SYN RECEIVED state     */
+/*                                            processing                  */
+/*    _nx_tcp_socket_state_syn_sent         Socket SYN SENT state         */
+/*                                            processing                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_newreno_initialize(NX_TCP_SOCKET *socket_ptr)
+{
+
+    NX_PARAMETER_NOT_USED(socket_ptr);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_newreno_ack              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function grows the congestion window of the NewReno            */
+/*    congestion control when new data is acknowledged outside of fast    */
+/*    recovery. In slow start phase, the window is incremented for every  */
+/*    ACK. In congestion avoidance phase, the window is incremented for   */
+/*    every RTT. Section 3.1, Page 4-7, RFC5681.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    acked_bytes                           Number of bytes acknowledged  */
+/*    round_trip_time                       Round trip time measured      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_newreno_ack(NX_TCP_SOCKET *socket_ptr, ULONG acked_bytes, ULONG round_trip_time)
+{
+
+ULONG temp;
+
+
+    NX_PARAMETER_NOT_USED(round_trip_time);
+
+    if (socket_ptr -> nx_tcp_socket_tx_window_congestion >= socket_ptr -> nx_tcp_socket_tx_slow_start_threshold)
+    {
+
+        /* In Congestion avoidance phase, for every ACK it receives, increase the window size using the
+           following approximation:
+           cwnd = cwnd + MSS * MSS / cwnd;  */
+        temp = socket_ptr -> nx_tcp_socket_connect_mss2 / socket_ptr -> nx_tcp_socket_tx_window_congestion;
+
+        /* If the above formula yields 0, the result SHOULD be rounded up to 1 byte.  */
+        if (temp == 0)
+        {
+            temp = 1;
+        }
+        socket_ptr -> nx_tcp_socket_tx_window_congestion = socket_ptr -> nx_tcp_socket_tx_window_congestion + temp;
+    }
+    else
+    {
+
+        /* In Slow start phase:
+           cwnd += min (N, SMSS),
+           where N is the number of ACKed bytes. */
+        if (acked_bytes < socket_ptr -> nx_tcp_socket_connect_mss)
+        {
+
+            /* In Slow start phase. Increase the cwnd by acked bytes.*/
+            socket_ptr -> nx_tcp_socket_tx_window_congestion += acked_bytes;
+        }
+        else
+        {
+
+            /* In Slow start phase. Increase the cwnd by full MSS for every ack.*/
+            socket_ptr -> nx_tcp_socket_tx_window_congestion += socket_ptr -> nx_tcp_socket_connect_mss;
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_newreno_loss             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces the congestion window of the NewReno          */
+/*    congestion control when a loss is detected by duplicate ACKs. The   */
+/*    slow start threshold is set to half of the flight size, and the     */
+/*    congestion window to the slow start threshold. The caller then      */
+/*    inflates the window by the three segments that have left the        */
+/*    network. Section 3.2, Page 9, RFC5681.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_newreno_loss(NX_TCP_SOCKET *socket_ptr)
+{
+
+ULONG window;
+
+
+    /* Compute the flight size / 2 value. */
+    window = socket_ptr -> nx_tcp_socket_tx_outstanding_bytes >> 1;
+
+    /* Make sure we have at least 2 * MSS */
+    if (window < (socket_ptr -> nx_tcp_socket_connect_mss << 1))
+    {
+        window = socket_ptr -> nx_tcp_socket_connect_mss << 1;
+    }
+
+    /* Set the slow_start_threshold */
+    socket_ptr -> nx_tcp_socket_tx_slow_start_threshold = window;
+
+    /* Set the current window to the slow start threshold. */
+    socket_ptr -> nx_tcp_socket_tx_window_congestion = window;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_newreno_timeout          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces the congestion window of the NewReno          */
+/*    congestion control when the retransmission timer expires. The slow  */
+/*    start threshold is set to half of the flight size, and slow start   */
+/*    is entered with a congestion window of one segment. Section 3.1,    */
+/*    Page 8, RFC5681.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_congestion_control_newreno_timeout(NX_TCP_SOCKET *socket_ptr)
+{
+
+ULONG window;
+
+
+    /* Timed out on an outgoing packet.  Enter slow start mode. */
+    /* Compute the flight size / 2 value. */
+    window = socket_ptr -> nx_tcp_socket_tx_outstanding_bytes >> 1;
+
+    /* Make sure we have at least 2 * MSS */
+    if (window < (socket_ptr -> nx_tcp_socket_connect_mss << 1))
+    {
+        window = socket_ptr -> nx_tcp_socket_connect_mss << 1;
+    }
+
+    /* Set the slow_start_threshold */
+    socket_ptr -> nx_tcp_socket_tx_slow_start_threshold = window;
+
+    /* Set the current window to be MSS size. */
+    socket_ptr -> nx_tcp_socket_tx_window_congestion = socket_ptr -> nx_tcp_socket_connect_mss;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_congestion_control_newreno_window_get       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the congestion window of the socket. The      */
+/*    window is used as is by the NewReno and the CUBIC congestion        */
+/*    controls.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    window                                Congestion window in bytes    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_send_internal          Send TCP data                 */
+/*    _nx_tcp_socket_state_transmit_check   Check for transmit suspension */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_congestion_control_newreno_window_get(NX_TCP_SOCKET *socket_ptr)
+{
+
+    return(socket_ptr -> nx_tcp_socket_tx_window_congestion);
+}
+
+
+/* Define the NewReno congestion control module, RFC 5681 and RFC 6582.  This is the default
+   congestion control of a TCP socket.  */
+
+const NX_TCP_CONGESTION_CONTROL nx_tcp_congestion_control_newreno =
+{
+    "NewReno",
+    _nx_tcp_congestion_control_newreno_initialize,
+    _nx_tcp_congestion_control_newreno_ack,
+    _nx_tcp_congestion_control_newreno_loss,
+    _nx_tcp_congestion_control_newreno_timeout,
+    _nx_tcp_congestion_control_newreno_window_get
+};
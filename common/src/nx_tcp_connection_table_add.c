@@ -0,0 +1,152 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_connection_table_add                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the socket to the TCP connection table, by the   */
+/*    local port, the peer port and the peer address of its connection.   */
+/*    If the socket is already in the table with a previous connection,   */
+/*    it is moved to the table entry of the current connection.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    socket_ptr                            Pointer to socket             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_connection_table_index        Compute connection table      */
+/*                                            index                       */
+/*    _nx_tcp_connection_table_remove       Remove socket from connection */
+/*                                            table                       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_connection_table_enable       Enable TCP connection table   */
+/*    _nx_tcp_packet_process                Process incoming packet       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_connection_table_add(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr)
+{
+
+UINT           index;
+ULONG         *peer_ip =  NX_NULL;
+NX_TCP_SOCKET *head_ptr;
+
+
+    /* Determine if the connection table is enabled.  */
+    if (ip_ptr -> nx_ip_tcp_connection_table == NX_NULL)
+    {
+        return;
+    }
+
+#ifndef NX_DISABLE_IPV4
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        peer_ip =  &(socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+        peer_ip =  socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Calculate the index in the connection table.  */
+    index =  _nx_tcp_connection_table_index(ip_ptr, socket_ptr -> nx_tcp_socket_port,
+                                            socket_ptr -> nx_tcp_socket_connect_port, peer_ip,
+                                            socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version);
+
+    /* Determine if the socket is already in the table.  */
+    if (socket_ptr -> nx_tcp_socket_connection_next)
+    {
+
+        /* Determine if the socket is in the right entry.  */
+        if (socket_ptr -> nx_tcp_socket_connection_index == index)
+        {
+            return;
+        }
+
+        /* No, the socket is still in the entry of a previous connection.  Remove it.  */
+        _nx_tcp_connection_table_remove(socket_ptr);
+    }
+
+    /* Pickup the head of the table entry.  */
+    head_ptr =  ip_ptr -> nx_ip_tcp_connection_table[index];
+
+    /* Determine if there are other sockets in this entry.  */
+    if (head_ptr)
+    {
+
+        /* Yes, there are one or more sockets in this entry.  Place the socket
+           in front of the head, which makes it the last socket of the list.  */
+        socket_ptr -> nx_tcp_socket_connection_next =      head_ptr;
+        socket_ptr -> nx_tcp_socket_connection_previous =  head_ptr -> nx_tcp_socket_connection_previous;
+        (head_ptr -> nx_tcp_socket_connection_previous) -> nx_tcp_socket_connection_next =  socket_ptr;
+        head_ptr -> nx_tcp_socket_connection_previous =    socket_ptr;
+    }
+    else
+    {
+
+        /* Nothing is in this entry, just setup the socket list.  */
+        socket_ptr -> nx_tcp_socket_connection_next =      socket_ptr;
+        socket_ptr -> nx_tcp_socket_connection_previous =  socket_ptr;
+    }
+
+    /* Make the socket the head of the entry, as the next packet is most likely
+       for the same connection.  */
+    ip_ptr -> nx_ip_tcp_connection_table[index] =  socket_ptr;
+
+    /* Remember the entry of the socket.  */
+    socket_ptr -> nx_tcp_socket_connection_index =  index;
+}
@@ -0,0 +1,141 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_connection_table_enable                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables the TCP connection table of the IP instance   */
+/*    with the supplied memory. Packets of existing connections are       */
+/*    looked up in this table by local port, peer port and peer address,  */
+/*    instead of searching all sockets bound to the same port. The        */
+/*    number of table entries is rounded down to a power of two.          */
+/*                                                                        */
+/*    If the table is already enabled, the sockets in the previous table  */
+/*    are moved to the new table, so the table can be resized at run      */
+/*    time. The previous table memory is not used after this function     */
+/*    returns.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    table_memory                          Pointer to table memory       */
+/*    table_size                            Size of table memory in bytes */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_tcp_connection_table_add          Add socket to connection      */
+/*                                            table                       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_connection_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size)
+{
+
+ULONG          i;
+ULONG          entries;
+NX_TCP_SOCKET *socket_ptr;
+
+
+    /* Determine how many entries fit in the table memory.  The number of entries
+       must be a power of two, so subtracting one gives us the mask.  */
+    entries =  1;
+    while ((entries << 1) <= (table_size / sizeof(NX_TCP_SOCKET *)))
+    {
+        entries =  entries << 1;
+    }
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_CONNECTION_TABLE_ENABLE, ip_ptr, table_memory, table_size, entries, NX_TRACE_TCP_EVENTS, 0, 0);
+
+    /* Obtain the IP mutex so we can setup the table.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Clear the table.  */
+    memset(table_memory, 0, entries * sizeof(NX_TCP_SOCKET *));
+
+    /* Setup the table in the IP instance.  */
+    ip_ptr -> nx_ip_tcp_connection_table =       (NX_TCP_SOCKET **)table_memory;
+    ip_ptr -> nx_ip_tcp_connection_table_size =  entries;
+
+    /* Pickup the head of the created sockets list.  */
+    socket_ptr =  ip_ptr -> nx_ip_tcp_created_sockets_ptr;
+
+    /* Loop through the created sockets to move the sockets of the previous table
+       to the new table.  */
+    for (i = 0; i < ip_ptr -> nx_ip_tcp_created_sockets_count; i++)
+    {
+
+        /* Determine if the socket is in the previous table.  */
+        if (socket_ptr -> nx_tcp_socket_connection_next)
+        {
+
+            /* Yes, the previous table is gone, so just clear the links of the socket.  */
+            socket_ptr -> nx_tcp_socket_connection_next =      NX_NULL;
+            socket_ptr -> nx_tcp_socket_connection_previous =  NX_NULL;
+
+            /* Add the socket to the new table.  */
+            _nx_tcp_connection_table_add(ip_ptr, socket_ptr);
+        }
+
+        /* Move to the next created socket.  */
+        socket_ptr =  socket_ptr -> nx_tcp_socket_created_next;
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+}
@@ -0,0 +1,161 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_connection_table_find                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function searches the TCP connection table for the socket of   */
+/*    the connection with the specified local port, peer port and peer    */
+/*    address. The socket found is moved to the head of its table entry.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    port                                  Local port                    */
+/*    peer_port                             Peer port                     */
+/*    peer_ip                               Pointer to peer address       */
+/*    ip_version                            IP version of peer address    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    socket_ptr                            Pointer to the socket found,  */
+/*                                            NX_NULL if not found        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_connection_table_index        Compute connection table      */
+/*                                            index                       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                Process incoming packet       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_TCP_SOCKET  *_nx_tcp_connection_table_find(NX_IP *ip_ptr, UINT port, UINT peer_port, ULONG *peer_ip, ULONG ip_version)
+{
+
+UINT           index;
+UINT           find_a_match;
+NX_TCP_SOCKET *socket_ptr;
+
+
+    /* Determine if the connection table is enabled.  */
+    if (ip_ptr -> nx_ip_tcp_connection_table == NX_NULL)
+    {
+        return(NX_NULL);
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    /* Increment the number of connection table lookups.  */
+    ip_ptr -> nx_ip_tcp_connection_table_lookups++;
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* Calculate the index in the connection table.  */
+    index =  _nx_tcp_connection_table_index(ip_ptr, port, peer_port, peer_ip, ip_version);
+
+    /* Pickup the head of the table entry.  */
+    socket_ptr =  ip_ptr -> nx_ip_tcp_connection_table[index];
+
+    /* Determine if there are any sockets in this entry.  */
+    if (socket_ptr)
+    {
+
+        /* Yes, loop to examine the sockets of this entry.  */
+        do
+        {
+
+            /* Determine if the ports and the IP version match.  */
+            if ((socket_ptr -> nx_tcp_socket_port == port) &&
+                (socket_ptr -> nx_tcp_socket_connect_port == peer_port) &&
+                (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == ip_version))
+            {
+
+                find_a_match =  NX_FALSE;
+
+#ifndef NX_DISABLE_IPV4
+                if ((ip_version == NX_IP_VERSION_V4) &&
+                    (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4 == *peer_ip))
+                {
+                    find_a_match =  NX_TRUE;
+                }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+                if ((ip_version == NX_IP_VERSION_V6) &&
+                    (CHECK_IPV6_ADDRESSES_SAME(socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6, peer_ip)))
+                {
+                    find_a_match =  NX_TRUE;
+                }
+#endif /* FEATURE_NX_IPV6 */
+
+                if (find_a_match)
+                {
+
+                    /* Yes, we have a match!  Move the head of the entry to this socket.  */
+                    ip_ptr -> nx_ip_tcp_connection_table[index] =  socket_ptr;
+
+#ifndef NX_DISABLE_TCP_INFO
+                    /* Increment the number of connection table hits.  */
+                    ip_ptr -> nx_ip_tcp_connection_table_hits++;
+#endif /* NX_DISABLE_TCP_INFO */
+
+                    /* Return the socket found.  */
+                    return(socket_ptr);
+                }
+            }
+
+            /* Move to the next socket in the entry.  */
+            socket_ptr =  socket_ptr -> nx_tcp_socket_connection_next;
+        } while (socket_ptr != ip_ptr -> nx_ip_tcp_connection_table[index]);
+    }
+
+    /* The connection is not in the table.  */
+    return(NX_NULL);
+}
@@ -0,0 +1,111 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_connection_table_index                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the index of a connection in the TCP         */
+/*    connection table from the local port, the peer port and the peer    */
+/*    address.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    port                                  Local port                    */
+/*    peer_port                             Peer port                     */
+/*    peer_ip                               Pointer to peer address       */
+/*    ip_version                            IP version of peer address    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                                 Index of the table entry      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_connection_table_add          Add socket to connection      */
+/*                                            table                       */
+/*    _nx_tcp_connection_table_find         Find connection in connection */
+/*                                            table                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_connection_table_index(NX_IP *ip_ptr, UINT port, UINT peer_port, ULONG *peer_ip, ULONG ip_version)
+{
+
+ULONG hash;
+
+
+    /* Combine the local port and the peer port.  */
+    hash =  ((ULONG)port << NX_SHIFT_BY_16) | (ULONG)peer_port;
+
+#ifndef NX_DISABLE_IPV4
+    if (ip_version == NX_IP_VERSION_V4)
+    {
+
+        /* Combine the IPv4 peer address.  */
+        hash ^=  peer_ip[0];
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (ip_version == NX_IP_VERSION_V6)
+    {
+
+        /* Combine all words of the IPv6 peer address.  */
+        hash ^=  peer_ip[0] ^ peer_ip[1] ^ peer_ip[2] ^ peer_ip[3];
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Fold the upper bits into the lower bits used by the index.  */
+    hash ^=  (hash >> NX_SHIFT_BY_16);
+    hash ^=  (hash >> 8);
+
+    /* Return the index of the table entry.  */
+    return((UINT)(hash & (ip_ptr -> nx_ip_tcp_connection_table_size - 1)));
+}
@@ -0,0 +1,187 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_connection_table_info_get                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the occupancy and the statistics of the     */
+/*    TCP connection table of the specified IP instance.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to the IP instance    */
+/*    table_size                            Destination for number of     */
+/*                                            table entries               */
+/*    table_connections                     Destination for number of     */
+/*                                            connections in the table    */
+/*    table_entries_used                    Destination for number of     */
+/*                                            entries used                */
+/*    table_longest_chain                   Destination for number of     */
+/*                                            connections in the longest  */
+/*                                            entry                       */
+/*    table_lookups                         Destination for number of     */
+/*                                            lookups                     */
+/*    table_hits                            Destination for number of     */
+/*                                            lookups found a connection  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection             */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_connection_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_connections,
+                                        ULONG *table_entries_used, ULONG *table_longest_chain,
+                                        ULONG *table_lookups, ULONG *table_hits)
+{
+
+ULONG          i;
+ULONG          chain;
+ULONG          connections;
+ULONG          entries_used;
+ULONG          longest_chain;
+NX_TCP_SOCKET *socket_ptr;
+
+
+    /* Obtain the IP mutex so we can examine the table.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Initialize the counters.  */
+    connections =    0;
+    entries_used =   0;
+    longest_chain =  0;
+
+    /* Loop through the table entries.  */
+    for (i = 0; i < ip_ptr -> nx_ip_tcp_connection_table_size; i++)
+    {
+
+        /* Pickup the head of the entry.  */
+        socket_ptr =  ip_ptr -> nx_ip_tcp_connection_table[i];
+
+        /* Determine if the entry is used.  */
+        if (socket_ptr)
+        {
+
+            /* Count the sockets in this entry.  */
+            chain =  0;
+            do
+            {
+                chain++;
+                socket_ptr =  socket_ptr -> nx_tcp_socket_connection_next;
+            } while (socket_ptr != ip_ptr -> nx_ip_tcp_connection_table[i]);
+
+            /* Update the counters.  */
+            entries_used++;
+            connections =  connections + chain;
+            if (chain > longest_chain)
+            {
+                longest_chain =  chain;
+            }
+        }
+    }
+
+    /* Determine if table size is wanted.  */
+    if (table_size)
+    {
+
+        /* Return the number of table entries.  */
+        *table_size =  ip_ptr -> nx_ip_tcp_connection_table_size;
+    }
+
+    /* Determine if table connections is wanted.  */
+    if (table_connections)
+    {
+
+        /* Return the number of connections in the table.  */
+        *table_connections =  connections;
+    }
+
+    /* Determine if table entries used is wanted.  */
+    if (table_entries_used)
+    {
+
+        /* Return the number of entries used.  */
+        *table_entries_used =  entries_used;
+    }
+
+    /* Determine if table longest chain is wanted.  */
+    if (table_longest_chain)
+    {
+
+        /* Return the number of connections in the longest entry.  */
+        *table_longest_chain =  longest_chain;
+    }
+
+    /* Determine if table lookups is wanted.  */
+    if (table_lookups)
+    {
+
+        /* Return the number of lookups.  */
+        *table_lookups =  ip_ptr -> nx_ip_tcp_connection_table_lookups;
+    }
+
+    /* Determine if table hits is wanted.  */
+    if (table_hits)
+    {
+
+        /* Return the number of lookups found a connection.  */
+        *table_hits =  ip_ptr -> nx_ip_tcp_connection_table_hits;
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion status.  */
+    return(NX_SUCCESS);
+}
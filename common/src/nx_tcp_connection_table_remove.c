@@ -0,0 +1,118 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_connection_table_remove                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the socket from the TCP connection table of   */
+/*    its IP instance, if the socket is in the table.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to socket             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_client_socket_unbind          Socket unbind processing      */
+/*    _nx_tcp_connection_table_add          Add socket to connection      */
+/*                                            table                       */
+/*    _nx_tcp_server_socket_unaccept        Socket unaccept processing    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_connection_table_remove(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_IP *ip_ptr;
+ULONG  index;
+
+
+    /* Determine if the socket is in the connection table.  */
+    if (socket_ptr -> nx_tcp_socket_connection_next == NX_NULL)
+    {
+        return;
+    }
+
+    /* Setup the IP instance pointer and the index of the table entry.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+    index =   socket_ptr -> nx_tcp_socket_connection_index;
+
+    /* Determine if this is the only socket in the entry.  */
+    if (socket_ptr -> nx_tcp_socket_connection_next == socket_ptr)
+    {
+
+        /* Yes, this is the only socket in the entry.  */
+        ip_ptr -> nx_ip_tcp_connection_table[index] =  NX_NULL;
+    }
+    else
+    {
+
+        /* Otherwise, unlink the socket from the entry.  */
+        (socket_ptr -> nx_tcp_socket_connection_next) -> nx_tcp_socket_connection_previous =
+            socket_ptr -> nx_tcp_socket_connection_previous;
+        (socket_ptr -> nx_tcp_socket_connection_previous) -> nx_tcp_socket_connection_next =
+            socket_ptr -> nx_tcp_socket_connection_next;
+
+        /* Determine if the head of the entry needs to be moved.  */
+        if (ip_ptr -> nx_ip_tcp_connection_table[index] == socket_ptr)
+        {
+
+            /* Yes, move the head to the next socket.  */
+            ip_ptr -> nx_ip_tcp_connection_table[index] =  socket_ptr -> nx_tcp_socket_connection_next;
+        }
+    }
+
+    /* Clear the links of the socket.  */
+    socket_ptr -> nx_tcp_socket_connection_next =      NX_NULL;
+    socket_ptr -> nx_tcp_socket_connection_previous =  NX_NULL;
+}
@@ -55,6 +55,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_timer_create                       Create fast TCP timer         */
+/*    _nx_tcp_pacing_timer_create           Create TCP pacing timer       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -115,6 +116,21 @@ struct NX_TCP_LISTEN_STRUCT *listen_ptr;
     /* Set the TCP deferred cleanup check function.  */
     ip_ptr -> nx_tcp_deferred_cleanup_check =  _nx_tcp_deferred_cleanup_check;
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    /* Set the function to process the TCP packets held for coalescing.  */
+    ip_ptr -> nx_ip_tcp_coalesce_flush =  _nx_tcp_packet_coalesce_flush;
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Set the function to send the ACKs held while a batch of packets is processed.  */
+    ip_ptr -> nx_ip_tcp_ack_pending_flush =  _nx_tcp_socket_ack_pending_flush;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
+#ifdef NX_ENABLE_TCP_PACING
+    /* Set the function to release the paced sockets when the pacing timer expires.  */
+    ip_ptr -> nx_ip_tcp_pacing_process =  _nx_tcp_pacing_process;
+#endif /* NX_ENABLE_TCP_PACING */
+
     /* Setup base timer variables.  */
     _nx_tcp_fast_timer_rate =       (NX_IP_PERIODIC_RATE + (NX_TCP_FAST_TIMER_RATE - 1)) / NX_TCP_FAST_TIMER_RATE;
     _nx_tcp_ack_timer_rate =        (NX_IP_PERIODIC_RATE + (NX_TCP_ACK_TIMER_RATE - 1)) / NX_TCP_ACK_TIMER_RATE;
@@ -127,6 +143,27 @@ struct NX_TCP_LISTEN_STRUCT *listen_ptr;
 
     _nx_ip_fast_periodic_timer_create(ip_ptr);
 
+#ifdef NX_ENABLE_TCP_PACING
+    /* Create the timer that releases the paced sockets.  */
+    _nx_tcp_pacing_timer_create(ip_ptr);
+#endif /* NX_ENABLE_TCP_PACING */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Pick the secret key of the Fast Open cookies of this server.  */
+    ip_ptr -> nx_ip_tcp_fast_open_key[0] =  (((ULONG)NX_RAND()) << NX_SHIFT_BY_16) & 0xFFFFFFFF;
+    ip_ptr -> nx_ip_tcp_fast_open_key[0] |= (ULONG)NX_RAND();
+    ip_ptr -> nx_ip_tcp_fast_open_key[1] =  (((ULONG)NX_RAND()) << NX_SHIFT_BY_16) & 0xFFFFFFFF;
+    ip_ptr -> nx_ip_tcp_fast_open_key[1] |= (ULONG)NX_RAND();
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+    /* Pick the secret key of the SYN cookies of this server.  */
+    ip_ptr -> nx_ip_tcp_syn_cookie_key[0] =  (((ULONG)NX_RAND()) << NX_SHIFT_BY_16) & 0xFFFFFFFF;
+    ip_ptr -> nx_ip_tcp_syn_cookie_key[0] |= (ULONG)NX_RAND();
+    ip_ptr -> nx_ip_tcp_syn_cookie_key[1] =  (((ULONG)NX_RAND()) << NX_SHIFT_BY_16) & 0xFFFFFFFF;
+    ip_ptr -> nx_ip_tcp_syn_cookie_key[1] |= (ULONG)NX_RAND();
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
     /* Set the TCP packet receive function in the IP structure to indicate
        we are ready to receive TCP packets.  */
     ip_ptr -> nx_ip_tcp_packet_receive =  _nx_tcp_packet_receive;
@@ -0,0 +1,118 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cache_find                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function searches the Fast Open cookie cache of the   */
+/*    IP instance for the cookie of a server.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    server_ip                             Address of server             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    entry_ptr                             Cache entry of the server,    */
+/*                                            NX_NULL if not found        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cache_update        Update Fast Open cookie cache */
+/*    _nx_tcp_fast_open_option_build        Build Fast Open option        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+NX_TCP_FAST_OPEN_ENTRY  *_nx_tcp_fast_open_cache_find(NX_IP *ip_ptr, NXD_ADDRESS *server_ip)
+{
+
+NX_TCP_FAST_OPEN_ENTRY *entry_ptr;
+UINT                    i;
+
+
+    /* Loop through the entries in use.  */
+    for (i = 0; i < NX_TCP_FAST_OPEN_CACHE_SIZE; i++)
+    {
+
+        entry_ptr =  &(ip_ptr -> nx_ip_tcp_fast_open_cache[i]);
+
+        if ((entry_ptr -> nx_tcp_fast_open_entry_cookie_length == 0) ||
+            (entry_ptr -> nx_tcp_fast_open_entry_address.nxd_ip_version != server_ip -> nxd_ip_version))
+        {
+            continue;
+        }
+
+#ifndef NX_DISABLE_IPV4
+        if ((server_ip -> nxd_ip_version == NX_IP_VERSION_V4) &&
+            (entry_ptr -> nx_tcp_fast_open_entry_address.nxd_ip_address.v4 == server_ip -> nxd_ip_address.v4))
+        {
+            return(entry_ptr);
+        }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+        if ((server_ip -> nxd_ip_version == NX_IP_VERSION_V6) &&
+            (CHECK_IPV6_ADDRESSES_SAME(entry_ptr -> nx_tcp_fast_open_entry_address.nxd_ip_address.v6,
+                                       server_ip -> nxd_ip_address.v6)))
+        {
+            return(entry_ptr);
+        }
+#endif /* FEATURE_NX_IPV6 */
+    }
+
+    /* The cookie of the server is not known.  */
+    return(NX_NULL);
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
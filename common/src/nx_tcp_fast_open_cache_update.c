@@ -0,0 +1,103 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cache_update                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function saves the Fast Open cookie a server returned */
+/*    in the SYN+ACK, along with the MSS of the server, in the cookie     */
+/*    cache of the IP instance.  The entry of the server is updated if    */
+/*    present, otherwise the entries are replaced in turn.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to client socket      */
+/*    cookie                                Cookie of the server          */
+/*    cookie_length                         Length of cookie              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cache_find          Find cookie of server         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_fast_open_cache_update(NX_TCP_SOCKET *socket_ptr, UCHAR *cookie, UINT cookie_length)
+{
+
+NX_IP                  *ip_ptr;
+NX_TCP_FAST_OPEN_ENTRY *entry_ptr;
+
+
+    /* Setup the IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* Find the entry of the server.  */
+    entry_ptr =  _nx_tcp_fast_open_cache_find(ip_ptr, &(socket_ptr -> nx_tcp_socket_connect_ip));
+
+    if (entry_ptr == NX_NULL)
+    {
+
+        /* Replace the next entry.  */
+        entry_ptr =  &(ip_ptr -> nx_ip_tcp_fast_open_cache[ip_ptr -> nx_ip_tcp_fast_open_cache_next]);
+        ip_ptr -> nx_ip_tcp_fast_open_cache_next =  (ip_ptr -> nx_ip_tcp_fast_open_cache_next + 1) % NX_TCP_FAST_OPEN_CACHE_SIZE;
+
+        entry_ptr -> nx_tcp_fast_open_entry_address =  socket_ptr -> nx_tcp_socket_connect_ip;
+    }
+
+    /* Save the cookie, and the MSS of the server that limits the data of the next SYN.  */
+    memcpy(entry_ptr -> nx_tcp_fast_open_entry_cookie, cookie, cookie_length); /* Use case of memcpy is verified. */
+    entry_ptr -> nx_tcp_fast_open_entry_cookie_length =  cookie_length;
+    entry_ptr -> nx_tcp_fast_open_entry_mss =  socket_ptr -> nx_tcp_socket_peer_mss;
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
@@ -0,0 +1,173 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_fast_open_mix                               PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function mixes one word into a hash value, with the   */
+/*    finalizer of MurmurHash3.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hash                                  Hash value                    */
+/*    value                                 Word to mix in                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    hash                                  New hash value                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cookie_generate     Generate Fast Open cookie     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static ULONG  _nx_tcp_fast_open_mix(ULONG hash, ULONG value)
+{
+
+    hash ^= value;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return(hash);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cookie_generate                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function generates the Fast Open cookie of a client,  */
+/*    RFC 7413, Section 4.1.2.  The cookie is a keyed hash of the address */
+/*    of the client with the secret of the IP instance, so a server only  */
+/*    verifies a cookie by generating it again and keeps no state.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    client_ip                             Address of client             */
+/*    cookie                                Cookie of the client,         */
+/*                                            NX_TCP_FAST_OPEN_COOKIE_SIZE*/
+/*                                            bytes                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_fast_open_mix                 Mix word into hash            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_open_option_build        Build Fast Open option        */
+/*    _nx_tcp_socket_fast_open_receive      Receive data of SYN           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_fast_open_cookie_generate(NX_IP *ip_ptr, NXD_ADDRESS *client_ip, UCHAR *cookie)
+{
+
+ULONG hash_0;
+ULONG hash_1;
+UINT  i;
+
+
+    /* Start from the secret of the IP instance.  */
+    hash_0 =  ip_ptr -> nx_ip_tcp_fast_open_key[0];
+    hash_1 =  ip_ptr -> nx_ip_tcp_fast_open_key[1];
+
+#ifndef NX_DISABLE_IPV4
+    if (client_ip -> nxd_ip_version == NX_IP_VERSION_V4)
+    {
+
+        /* Mix in the IPv4 address.  */
+        hash_0 =  _nx_tcp_fast_open_mix(hash_0, client_ip -> nxd_ip_address.v4);
+        hash_1 =  _nx_tcp_fast_open_mix(hash_1, hash_0 ^ client_ip -> nxd_ip_address.v4);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (client_ip -> nxd_ip_version == NX_IP_VERSION_V6)
+    {
+
+        /* Mix in the words of the IPv6 address.  */
+        for (i = 0; i < 4; i++)
+        {
+            hash_0 =  _nx_tcp_fast_open_mix(hash_0, client_ip -> nxd_ip_address.v6[i]);
+            hash_1 =  _nx_tcp_fast_open_mix(hash_1, hash_0 ^ client_ip -> nxd_ip_address.v6[i]);
+        }
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Store the cookie in network byte order.  */
+    for (i = 0; i < 4; i++)
+    {
+        cookie[i] =      (UCHAR)(hash_0 >> (24 - (i << 3)));
+        cookie[i + 4] =  (UCHAR)(hash_1 >> (24 - (i << 3)));
+    }
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
@@ -0,0 +1,160 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_fast_open_option_build                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function builds the Fast Open option of a SYN, RFC    */
+/*    7413, Section 4.1.1.  A client presents the cookie of the server if */
+/*    it is known, and sets the bytes of initial data the SYN carries.    */
+/*    Otherwise it requests a cookie.  A server returns the cookie of the */
+/*    client in the SYN+ACK.  The option is padded with NOPs to a whole   */
+/*    number of words, and omitted if it does not fit.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to socket             */
+/*    control_bits                          TCP control bits of the SYN   */
+/*    option_ptr                            Pointer to option words       */
+/*    option_words_max                      Option words available        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    option_words                          Number of option words built  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cache_find          Find cookie of server         */
+/*    _nx_tcp_fast_open_cookie_generate     Generate cookie of client     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_send_control           Send TCP control packet       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_fast_open_option_build(NX_TCP_SOCKET *socket_ptr, ULONG control_bits, ULONG *option_ptr, ULONG option_words_max)
+{
+
+NX_TCP_FAST_OPEN_ENTRY *entry_ptr = NX_NULL;
+NX_PACKET              *packet_ptr;
+UCHAR                   cookie[NX_TCP_FAST_OPEN_COOKIE_SIZE_MAX];
+UINT                    cookie_length = 0;
+ULONG                   option_words;
+ULONG                   data_length;
+UINT                    i;
+
+
+    /* By default, the SYN carries no data.  */
+    socket_ptr -> nx_tcp_socket_fast_open_length =  0;
+
+    if (control_bits & NX_TCP_ACK_BIT)
+    {
+
+        /* The SYN+ACK of a server returns the cookie of the client.  */
+        if (socket_ptr -> nx_tcp_socket_client_type)
+        {
+            return(0);
+        }
+
+        _nx_tcp_fast_open_cookie_generate(socket_ptr -> nx_tcp_socket_ip_ptr, &(socket_ptr -> nx_tcp_socket_connect_ip), cookie);
+        cookie_length =  NX_TCP_FAST_OPEN_COOKIE_SIZE;
+    }
+    else
+    {
+
+        /* The SYN of a client presents the cookie of the server if it is known.  */
+        entry_ptr =  _nx_tcp_fast_open_cache_find(socket_ptr -> nx_tcp_socket_ip_ptr, &(socket_ptr -> nx_tcp_socket_connect_ip));
+
+        if (entry_ptr)
+        {
+            cookie_length =  entry_ptr -> nx_tcp_fast_open_entry_cookie_length;
+            memcpy(cookie, entry_ptr -> nx_tcp_fast_open_entry_cookie, cookie_length); /* Use case of memcpy is verified. */
+        }
+    }
+
+    /* Compute the option words, NOP, NOP, kind and length, followed by the cookie.  */
+    option_words =  (ULONG)((cookie_length + 4 + 3) >> 2);
+    if (option_words > option_words_max)
+    {
+
+        /* The option does not fit with the other options of the SYN.  */
+        return(0);
+    }
+
+    /* Build the option in network byte order, padding the end with NOPs.  */
+    option_ptr[0] =  NX_TCP_FAST_OPEN_OPTION + cookie_length;
+    for (i = 0; i < ((option_words - 1) << 2); i++)
+    {
+        if ((i & 3) == 0)
+        {
+            option_ptr[(i >> 2) + 1] =  0;
+        }
+
+        option_ptr[(i >> 2) + 1] |=  ((ULONG)((i < cookie_length) ? cookie[i] : NX_TCP_NOP_KIND)) << (24 - ((i & 3) << 3));
+    }
+
+    /* Determine if the SYN of a client carries the initial data.  */
+    packet_ptr =  socket_ptr -> nx_tcp_socket_fast_open_packet;
+    if ((entry_ptr) && (packet_ptr))
+    {
+
+        /* The data comes from the first buffer of the packet, up to the MSS of the server.  */
+        /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+        data_length =  (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+
+        if (data_length > entry_ptr -> nx_tcp_fast_open_entry_mss)
+        {
+            data_length =  entry_ptr -> nx_tcp_fast_open_entry_mss;
+        }
+
+        socket_ptr -> nx_tcp_socket_fast_open_length =  data_length;
+    }
+
+    /* Return the number of option words.  */
+    return(option_words);
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
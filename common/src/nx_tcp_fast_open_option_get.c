@@ -0,0 +1,171 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_fast_open_option_get                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function searches for the Fast Open option, RFC 7413. */
+/*    If found, first check the option length, if option length is not    */
+/*    valid, it returns NX_FALSE to the caller, else it returns the       */
+/*    cookie of the option and NX_TRUE to the caller.  An option without  */
+/*    a cookie is a cookie request, and a cookie of an unsupported size   */
+/*    is ignored.  Otherwise, the option is not found and NX_TRUE is      */
+/*    returned.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    option_ptr                            Pointer to option area        */
+/*    option_area_size                      Size of option area           */
+/*    fast_open_found                       Fast Open option found flag   */
+/*    cookie                                Pointer to cookie             */
+/*    cookie_length                         Length of cookie              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_FALSE                              TCP option is invalid         */
+/*    NX_TRUE                               TCP option is valid           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_fast_open_option_get(UCHAR *option_ptr, ULONG option_area_size, UINT *fast_open_found,
+                                   UCHAR **cookie, UINT *cookie_length)
+{
+
+ULONG option_length;
+
+
+    /* Set the option as not found, in case the segment does not contain the Fast Open option. */
+    *fast_open_found = NX_FALSE;
+    *cookie = NX_NULL;
+    *cookie_length = 0;
+
+    /* Loop through the option area looking for the Fast Open option.  */
+    while (option_area_size >= 2)
+    {
+
+        /* Is the current character the Fast Open type?  */
+        if (*option_ptr == NX_TCP_FAST_OPEN_KIND)
+        {
+
+            /* Yes, we found it!  */
+            option_length = *(option_ptr + 1);
+
+            /* Check the option length, if the option does not fit in the option area, return NX_FALSE.  */
+            if ((option_length < 2) || (option_length > option_area_size))
+            {
+                return(NX_FALSE);
+            }
+
+            *fast_open_found = NX_TRUE;
+
+            /* Pickup the cookie if its size is supported.  */
+            if ((option_length - 2 >= NX_TCP_FAST_OPEN_COOKIE_SIZE_MIN) &&
+                (option_length - 2 <= NX_TCP_FAST_OPEN_COOKIE_SIZE_MAX))
+            {
+                *cookie = option_ptr + 2;
+                *cookie_length = (UINT)(option_length - 2);
+            }
+
+            break;
+        }
+
+        /* Otherwise, process relative to the option type.  */
+
+        /* Check for end of list.  */
+        if (*option_ptr == NX_TCP_EOL_KIND)
+        {
+
+            /* Yes, end of list, get out!  */
+            break;
+        }
+
+        /* Check for NOP.  */
+        if (*option_ptr == NX_TCP_NOP_KIND)
+        {
+            /* One character option!  Skip this option and move to the next entry. */
+            option_ptr++;
+
+            option_area_size--;
+        }
+        else
+        {
+
+            /* Derive the option length.  */
+            option_length = *(option_ptr + 1);
+
+            if (option_length == 0)
+            {
+                /* Illegal option length. */
+                return(NX_FALSE);
+            }
+
+            /* Move the option pointer forward.  */
+            option_ptr =  option_ptr + option_length;
+
+            /* Determine if this is greater than the option area size.  */
+            if (option_length > option_area_size)
+            {
+                return(NX_FALSE);
+            }
+            else
+            {
+                option_area_size =  option_area_size - option_length;
+            }
+        }
+    }
+
+    /* Return.  */
+    return(NX_TRUE);
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
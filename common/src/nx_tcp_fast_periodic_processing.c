@@ -51,6 +51,9 @@
 /*    for re-transmitting packets that have not been ACKed by the other   */
 /*    side of the connection.                                             */
 /*                                                                        */
+/*    If NX_ENABLE_TCP_TIMER_WHEEL is defined, only the sockets whose     */
+/*    timer expires at this tick of the fast timer wheel are processed.   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_ptr                                Pointer to IP control block   */
@@ -66,6 +69,10 @@
 /*    _nx_tcp_socket_connection_reset       Reset connection on timeout   */
 /*    _nx_tcp_socket_block_cleanup          Cleanup the socket block      */
 /*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
+/*    _nx_tcp_timer_wheel_advance           Advance timer wheel           */
+/*    _nx_tcp_timer_wheel_remove            Remove timer from wheel       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -84,13 +91,33 @@ VOID  _nx_tcp_fast_periodic_processing(NX_IP *ip_ptr)
 {
 
 NX_TCP_SOCKET *socket_ptr;
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+NX_TCP_TIMER  *timer_ptr;
+#else
 ULONG          sockets;
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 ULONG          timer_rate;
 
 
     /* Pickup this timer's periodic rate.  */
     timer_rate =  _nx_tcp_fast_timer_rate;
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Advance the fast timer wheel.  The timers of the sockets with an expiring
+       timeout are moved to the expired list.  */
+    _nx_tcp_timer_wheel_advance(&(ip_ptr -> nx_ip_tcp_fast_timer_wheel));
+
+    /* Loop through the expired timers.  */
+    while (ip_ptr -> nx_ip_tcp_fast_timer_wheel.nx_tcp_timer_wheel_expired)
+    {
+
+        /* Pickup the socket of the first expired timer.  */
+        timer_ptr =   ip_ptr -> nx_ip_tcp_fast_timer_wheel.nx_tcp_timer_wheel_expired;
+        socket_ptr =  timer_ptr -> nx_tcp_timer_socket;
+
+        /* Bring the timeouts of the socket up to the previous tick.  */
+        _nx_tcp_socket_timer_sync(socket_ptr);
+#else
     /* Pickup the number of created TCP sockets.  */
     sockets =  ip_ptr -> nx_ip_tcp_created_sockets_count;
 
@@ -100,6 +127,7 @@ ULONG          timer_rate;
     /* Loop through the created sockets.  */
     while (sockets--)
     {
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 
         /* Determine if the socket is in an established or disconnect state and has delayed sending an ACK
            from a previous receive packet event.  */
@@ -112,6 +140,12 @@ ULONG          timer_rate;
             if (socket_ptr -> nx_tcp_socket_delayed_ack_timeout <= timer_rate)
             {
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+                /* The application did not answer the data in time, the connection is
+                   no longer interactive.  */
+                socket_ptr -> nx_tcp_socket_ack_interactive =  NX_FALSE;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
                 /* Send the delayed ACK, which also resets the ACK timeout.  */
                 _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
             }
@@ -173,6 +207,12 @@ ULONG          timer_rate;
                 /* Update the transmit sequence that entered fast transmit. */
                 socket_ptr -> nx_tcp_socket_tx_sequence_recover = socket_ptr -> nx_tcp_socket_tx_sequence - 1;
 
+#ifdef NX_ENABLE_TCP_SACK
+                /* The receiver may have discarded the SACKed data, so the scoreboard is cleared
+                   on the retransmission timeout.  RFC 2018, Section 8.  */
+                socket_ptr -> nx_tcp_socket_sack_scoreboard_count = 0;
+#endif /* NX_ENABLE_TCP_SACK */
+
                 /* Retransmit the packet. */
                 _nx_tcp_socket_retransmit(ip_ptr, socket_ptr, NX_FALSE);
 
@@ -206,8 +246,17 @@ ULONG          timer_rate;
             }
         }
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+        /* The timeouts of the socket are now up to date with this tick.  */
+        _nx_tcp_timer_wheel_remove(timer_ptr);
+        timer_ptr -> nx_tcp_timer_updated =  ip_ptr -> nx_ip_tcp_fast_timer_wheel.nx_tcp_timer_wheel_tick;
+
+        /* Place the timers of the socket at their next expiration.  */
+        _nx_tcp_socket_timer_schedule(socket_ptr);
+#else
         /* Move to the next TCP socket.  */
         socket_ptr =  socket_ptr -> nx_tcp_socket_created_next;
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
     }
 }
 
@@ -0,0 +1,123 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_PACING
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_pacing_process                              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the IP helper thread when the pacing     */
+/*    timer expires. The threads suspended on the sockets waiting for the */
+/*    timer are checked again, and the application is notified of a      */
+/*    socket that may send again when no thread is suspended on it.       */
+/*    Sockets that still hold data back arm the timer again.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_socket_pacing_check           Check pacing of the socket    */
+/*    _nx_tcp_socket_state_transmit_check   Resume suspended senders      */
+/*    (nx_tcp_socket_window_update_notify)  Application notify function   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_thread_entry                   IP helper thread              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_pacing_process(NX_IP *ip_ptr)
+{
+
+NX_TCP_SOCKET *socket_ptr;
+ULONG          sockets;
+
+
+    /* The pacing timer has expired.  */
+    ip_ptr -> nx_ip_tcp_pacing_timer_armed =  NX_FALSE;
+
+    /* Pickup the number of created TCP sockets.  */
+    sockets =  ip_ptr -> nx_ip_tcp_created_sockets_count;
+
+    /* Pickup the first socket.  */
+    socket_ptr =  ip_ptr -> nx_ip_tcp_created_sockets_ptr;
+
+    /* Loop through the created sockets.  */
+    while (sockets--)
+    {
+
+        /* Determine if the socket waits for the pacing timer.  */
+        if (socket_ptr -> nx_tcp_socket_pacing_waiting)
+        {
+
+            socket_ptr -> nx_tcp_socket_pacing_waiting =  NX_FALSE;
+
+            /* Determine if a thread is suspended sending data.  */
+            if (socket_ptr -> nx_tcp_socket_transmit_suspension_list)
+            {
+
+                /* Yes, resume it if the window and the pacing allow data to be sent.  */
+                _nx_tcp_socket_state_transmit_check(socket_ptr);
+            }
+            else if ((_nx_tcp_socket_pacing_check(socket_ptr) == NX_TRUE) &&
+                     (socket_ptr -> nx_tcp_socket_window_update_notify))
+            {
+
+                /* Notify the application that data may be sent again.  */
+                (socket_ptr -> nx_tcp_socket_window_update_notify)(socket_ptr);
+            }
+        }
+
+        /* Move to the next TCP socket.  */
+        socket_ptr =  socket_ptr -> nx_tcp_socket_created_next;
+    }
+}
+#endif /* NX_ENABLE_TCP_PACING */
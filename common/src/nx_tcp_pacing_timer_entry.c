@@ -0,0 +1,149 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+#include "tx_timer.h"
+
+#ifdef NX_ENABLE_TCP_PACING
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_pacing_timer_entry                          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function handles waking up the IP helper thread when data of  */
+/*    a paced TCP socket may be sent.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_address                            IP address in a ULONG         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_set                    Set event flags to wakeup     */
+/*                                            IP helper thread            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX system timer thread                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_tcp_pacing_timer_entry(ULONG ip_address)
+{
+
+NX_IP *ip_ptr;
+
+
+    /* Setup IP pointer.  */
+    NX_TIMER_EXTENSION_PTR_GET(ip_ptr, NX_IP, ip_address)
+
+    /* Wakeup this IP's helper thread.  */
+    tx_event_flags_set(&(ip_ptr -> nx_ip_events), NX_IP_TCP_PACING_EVENT, TX_OR);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_pacing_timer_create                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates the one-shot timer that releases paced TCP    */
+/*    sockets. The timer is not driven by the TCP periodic timers, it is  */
+/*    armed with one timer tick resolution for the earliest socket.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer into IP instance.     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_timer_create                       Create pacing timer           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_enable                        Enable TCP                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_tcp_pacing_timer_create(NX_IP *ip_ptr)
+{
+
+    if (ip_ptr -> nx_ip_tcp_pacing_timer_created)
+    {
+        return;
+    }
+
+    /* Create the pacing timer.  It is activated when a paced socket holds data back.  */
+    /*lint -e{923} suppress cast of pointer to ULONG.  */
+    tx_timer_create(&(ip_ptr -> nx_ip_tcp_pacing_timer), ip_ptr -> nx_ip_name,
+                    _nx_tcp_pacing_timer_entry, (ULONG)(ALIGN_TYPE)ip_ptr,
+                    1, 0, TX_NO_ACTIVATE);
+
+    NX_TIMER_EXTENSION_PTR_SET(&(ip_ptr -> nx_ip_tcp_pacing_timer), ip_ptr)
+
+    ip_ptr -> nx_ip_tcp_pacing_timer_armed =  NX_FALSE;
+
+    /* Set the flag to indicate that the pacing timer has been created. */
+    ip_ptr -> nx_ip_tcp_pacing_timer_created = 1;
+}
+#endif /* NX_ENABLE_TCP_PACING */
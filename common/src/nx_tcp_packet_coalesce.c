@@ -0,0 +1,524 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+#include "nx_tcp.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce_check                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function checks whether a received TCP packet can be  */
+/*    coalesced. Only data segments with no control bit other than ACK    */
+/*    and PSH are coalesced. The checksum of the segment is verified      */
+/*    here, since it can not be verified after the segment is coalesced.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to packet             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               Packet can be coalesced       */
+/*    NX_FALSE                              Packet is processed as is     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_checksum_compute               Calculate TCP checksum        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce               Coalesce TCP packet           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_tcp_packet_coalesce_check(NX_PACKET *packet_ptr)
+{
+
+ULONG         header_word_3;
+ULONG         header_length;
+ULONG         checksum;
+ULONG        *source_ip = NX_NULL;
+ULONG        *dest_ip = NX_NULL;
+NX_INTERFACE *interface_ptr = NX_NULL;
+#if defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY)
+UINT          compute_checksum = 1;
+#endif /* defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) */
+
+
+    /* Pickup the length of the TCP header.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    header_word_3 =  ((NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    header_length =  (header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+
+    /* The TCP header must be in the first packet, and data must follow it.  */
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    if ((header_length < sizeof(NX_TCP_HEADER)) ||
+        ((ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) < header_length) ||
+        (packet_ptr -> nx_packet_length <= header_length))
+    {
+        return(NX_FALSE);
+    }
+
+    /* Only ACK and PSH may be set.  */
+    if ((header_word_3 & (NX_TCP_URG_BIT | NX_TCP_ACK_BIT | NX_TCP_RST_BIT | NX_TCP_SYN_BIT | NX_TCP_FIN_BIT)) != NX_TCP_ACK_BIT)
+    {
+        return(NX_FALSE);
+    }
+
+#ifdef NX_IPSEC_ENABLE
+    /* IPsec packets are not coalesced.  */
+    if (packet_ptr -> nx_packet_ipsec_sa_ptr != NX_NULL)
+    {
+        return(NX_FALSE);
+    }
+#endif /* NX_IPSEC_ENABLE */
+
+#ifndef NX_DISABLE_IPV4
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+    {
+
+    NX_IPV4_HEADER *ip_header_ptr;
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ip_header_ptr = (NX_IPV4_HEADER *)packet_ptr -> nx_packet_ip_header;
+        source_ip = &ip_header_ptr -> nx_ip_header_source_ip;
+        dest_ip = &ip_header_ptr -> nx_ip_header_destination_ip;
+        interface_ptr = packet_ptr -> nx_packet_address.nx_packet_interface_ptr;
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
+    {
+
+    NX_IPV6_HEADER *ipv6_header;
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ipv6_header = (NX_IPV6_HEADER *)packet_ptr -> nx_packet_ip_header;
+        source_ip = &ipv6_header -> nx_ip_header_source_ip[0];
+        dest_ip = &ipv6_header -> nx_ip_header_destination_ip[0];
+        interface_ptr = packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr -> nxd_ipv6_address_attached;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    if (interface_ptr == NX_NULL)
+    {
+        return(NX_FALSE);
+    }
+
+#ifdef NX_DISABLE_TCP_RX_CHECKSUM
+    compute_checksum = 0;
+#endif /* NX_DISABLE_TCP_RX_CHECKSUM */
+
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    /* Packets from the interface with receive offload are already coalesced.  */
+    if (interface_ptr -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_RECEIVE_OFFLOAD)
+    {
+        return(NX_FALSE);
+    }
+
+    if (interface_ptr -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_RX_CHECKSUM)
+    {
+        compute_checksum = 0;
+    }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+#if defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY)
+    if (compute_checksum)
+#endif /* defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) */
+    {
+        checksum = _nx_ip_checksum_compute(packet_ptr, NX_PROTOCOL_TCP,
+                                           (UINT)packet_ptr -> nx_packet_length,
+                                           source_ip, dest_ip);
+        checksum = NX_LOWER_16_MASK & ~checksum;
+
+        /* Leave the checksum error to TCP processing.  */
+        if (checksum != 0)
+        {
+            return(NX_FALSE);
+        }
+    }
+
+    return(NX_TRUE);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce_flow_match                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function checks whether two received TCP packets      */
+/*    belong to the same connection.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    held_ptr                              Pointer to held packet        */
+/*    packet_ptr                            Pointer to received packet    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               Same connection               */
+/*    NX_FALSE                              Different connections         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce               Coalesce TCP packet           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_tcp_packet_coalesce_flow_match(NX_PACKET *held_ptr, NX_PACKET *packet_ptr)
+{
+
+    /* Compare the ports.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    if ((held_ptr -> nx_packet_ip_version != packet_ptr -> nx_packet_ip_version) ||
+        (((NX_TCP_HEADER *)held_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_0 !=
+         ((NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_0))
+    {
+        return(NX_FALSE);
+    }
+
+#ifndef NX_DISABLE_IPV4
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+    {
+
+    NX_IPV4_HEADER *held_header_ptr;
+    NX_IPV4_HEADER *ip_header_ptr;
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        held_header_ptr = (NX_IPV4_HEADER *)held_ptr -> nx_packet_ip_header;
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ip_header_ptr = (NX_IPV4_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+        return((held_header_ptr -> nx_ip_header_source_ip == ip_header_ptr -> nx_ip_header_source_ip) &&
+               (held_header_ptr -> nx_ip_header_destination_ip == ip_header_ptr -> nx_ip_header_destination_ip));
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
+    {
+
+    NX_IPV6_HEADER *held_header_ptr;
+    NX_IPV6_HEADER *ipv6_header;
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        held_header_ptr = (NX_IPV6_HEADER *)held_ptr -> nx_packet_ip_header;
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ipv6_header = (NX_IPV6_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+        return(CHECK_IPV6_ADDRESSES_SAME(held_header_ptr -> nx_ip_header_source_ip, ipv6_header -> nx_ip_header_source_ip) &&
+               CHECK_IPV6_ADDRESSES_SAME(held_header_ptr -> nx_ip_header_destination_ip, ipv6_header -> nx_ip_header_destination_ip));
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    return(NX_FALSE);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function coalesces a received TCP packet with the     */
+/*    packet held for the same connection, when the packet holds the      */
+/*    next in-order segment. The segment is linked behind the held        */
+/*    packet without its TCP header. Otherwise the held packet is passed  */
+/*    to TCP processing, and the received packet is held for the          */
+/*    following segments or passed to TCP processing as well.             */
+/*                                                                        */
+/*    A coalesced packet only contains full size segments, except for     */
+/*    the last one. Only packets held here have nx_packet_tcp_coalesced   */
+/*    set, which tells TCP processing that the checksums are verified.    */
+/*    Their nx_packet_tcp_segment_size is the size of the first segment,  */
+/*    and the window is the one of the last segment. The PSH bit is set   */
+/*    if any segment has it, since NetX sets it on every data segment     */
+/*    and does not delay data without it.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to packet             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce_check         Check packet can be coalesced */
+/*    _nx_tcp_packet_coalesce_flow_match    Check packets connection      */
+/*    _nx_tcp_packet_process                Process TCP packet            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_receive                Receive TCP packet            */
+/*    _nx_tcp_queue_process                 Process TCP packet queue      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_packet_coalesce(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_PACKET     *held_ptr;
+NX_PACKET     *previous_ptr;
+NX_TCP_HEADER *header_ptr;
+NX_TCP_HEADER *held_header_ptr;
+ULONG          header_word_3;
+ULONG          held_word_3;
+ULONG          header_length;
+ULONG          data_length;
+ULONG          held_data_length;
+ULONG          sequence;
+ULONG          held_sequence;
+UINT           coalesce;
+
+
+    /* Add debug information. */
+    NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
+
+    /* The TCP header must be in the first packet.  */
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    if ((ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) < sizeof(NX_TCP_HEADER))
+    {
+
+        /* TCP processing drops the packet.  */
+        _nx_tcp_packet_process(ip_ptr, packet_ptr);
+        return;
+    }
+
+    /* Check whether the packet can be coalesced.  */
+    coalesce =  _nx_tcp_packet_coalesce_check(packet_ptr);
+
+    /* Find the packet held for the same connection.  */
+    previous_ptr =  NX_NULL;
+    held_ptr =  ip_ptr -> nx_ip_tcp_coalesce_head;
+    while (held_ptr)
+    {
+        if (_nx_tcp_packet_coalesce_flow_match(held_ptr, packet_ptr))
+        {
+            break;
+        }
+
+        previous_ptr =  held_ptr;
+        held_ptr =  held_ptr -> nx_packet_queue_next;
+    }
+
+    if (held_ptr)
+    {
+
+        if (coalesce)
+        {
+
+            /* Pickup the TCP headers.  */
+            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+            header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+            held_header_ptr =  (NX_TCP_HEADER *)held_ptr -> nx_packet_prepend_ptr;
+
+            header_word_3 =  header_ptr -> nx_tcp_header_word_3;
+            NX_CHANGE_ULONG_ENDIAN(header_word_3);
+            held_word_3 =  held_header_ptr -> nx_tcp_header_word_3;
+            NX_CHANGE_ULONG_ENDIAN(held_word_3);
+            sequence =  header_ptr -> nx_tcp_sequence_number;
+            NX_CHANGE_ULONG_ENDIAN(sequence);
+            held_sequence =  held_header_ptr -> nx_tcp_sequence_number;
+            NX_CHANGE_ULONG_ENDIAN(held_sequence);
+
+            header_length =  (header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+            data_length =  packet_ptr -> nx_packet_length - header_length;
+            held_data_length =  held_ptr -> nx_packet_length - header_length;
+
+            /* The segment must follow the held data, with the same header length, control bits,
+               acknowledgment number and options.  The held packet must end with a full size
+               segment and have room for the data.  */
+            if ((((held_word_3 ^ header_word_3) & ~(NX_TCP_PSH_BIT | NX_LOWER_16_MASK)) == 0) &&
+                (sequence == held_sequence + held_data_length) &&
+                (header_ptr -> nx_tcp_acknowledgment_number == held_header_ptr -> nx_tcp_acknowledgment_number) &&
+                (data_length <= held_ptr -> nx_packet_tcp_segment_size) &&
+                ((held_data_length % held_ptr -> nx_packet_tcp_segment_size) == 0) &&
+                ((held_data_length + data_length) <= NX_TCP_COALESCE_SIZE_MAX) &&
+                (memcmp(held_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER),
+                        packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER),
+                        header_length - sizeof(NX_TCP_HEADER)) == 0))
+            {
+
+                /* Take the window and the PSH bit of the segment.  */
+                held_word_3 =  (held_word_3 & ~NX_LOWER_16_MASK) | (header_word_3 & (NX_TCP_PSH_BIT | NX_LOWER_16_MASK));
+                NX_CHANGE_ULONG_ENDIAN(held_word_3);
+                held_header_ptr -> nx_tcp_header_word_3 =  held_word_3;
+
+                /* Remove the TCP header of the segment.  */
+                packet_ptr -> nx_packet_prepend_ptr +=  header_length;
+                packet_ptr -> nx_packet_length -=  header_length;
+
+                /* Link the segment to the held packet.  */
+                if (held_ptr -> nx_packet_last)
+                {
+                    (held_ptr -> nx_packet_last) -> nx_packet_next =  packet_ptr;
+                }
+                else
+                {
+                    held_ptr -> nx_packet_next =  packet_ptr;
+                }
+                if (packet_ptr -> nx_packet_last)
+                {
+                    held_ptr -> nx_packet_last =  packet_ptr -> nx_packet_last;
+                }
+                else
+                {
+                    held_ptr -> nx_packet_last =  packet_ptr;
+                }
+
+                /* Accumulate the new length into the held packet. */
+                held_ptr -> nx_packet_length +=  packet_ptr -> nx_packet_length;
+
+                return;
+            }
+        }
+
+        /* Remove the held packet from the list.  */
+        if (previous_ptr)
+        {
+            previous_ptr -> nx_packet_queue_next =  held_ptr -> nx_packet_queue_next;
+        }
+        else
+        {
+            ip_ptr -> nx_ip_tcp_coalesce_head =  held_ptr -> nx_packet_queue_next;
+        }
+        if (ip_ptr -> nx_ip_tcp_coalesce_tail == held_ptr)
+        {
+            ip_ptr -> nx_ip_tcp_coalesce_tail =  previous_ptr;
+        }
+        ip_ptr -> nx_ip_tcp_coalesce_count--;
+        held_ptr -> nx_packet_queue_next =  NX_NULL;
+
+        /* Process the held data before the packet.  */
+        _nx_tcp_packet_process(ip_ptr, held_ptr);
+    }
+
+    if (!coalesce)
+    {
+
+        /* Process the packet as is.  */
+        _nx_tcp_packet_process(ip_ptr, packet_ptr);
+        return;
+    }
+
+    /* Determine if the list is full.  */
+    if (ip_ptr -> nx_ip_tcp_coalesce_count >= NX_TCP_COALESCE_FLOWS)
+    {
+
+        /* Yes, process the oldest packet.  */
+        held_ptr =  ip_ptr -> nx_ip_tcp_coalesce_head;
+        ip_ptr -> nx_ip_tcp_coalesce_head =  held_ptr -> nx_packet_queue_next;
+        if (ip_ptr -> nx_ip_tcp_coalesce_head == NX_NULL)
+        {
+            ip_ptr -> nx_ip_tcp_coalesce_tail =  NX_NULL;
+        }
+        ip_ptr -> nx_ip_tcp_coalesce_count--;
+        held_ptr -> nx_packet_queue_next =  NX_NULL;
+
+        _nx_tcp_packet_process(ip_ptr, held_ptr);
+    }
+
+    /* The segment size is the data size of the first segment.  */
+    header_word_3 =  ((NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    packet_ptr -> nx_packet_tcp_segment_size =  packet_ptr -> nx_packet_length -
+        (header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+
+    /* Mark the packet as coalesced, its checksum is verified.  */
+    packet_ptr -> nx_packet_tcp_coalesced =  NX_TRUE;
+
+    /* Hold the packet at the end of the list.  */
+    packet_ptr -> nx_packet_queue_next =  NX_NULL;
+    if (ip_ptr -> nx_ip_tcp_coalesce_tail)
+    {
+        (ip_ptr -> nx_ip_tcp_coalesce_tail) -> nx_packet_queue_next =  packet_ptr;
+    }
+    else
+    {
+        ip_ptr -> nx_ip_tcp_coalesce_head =  packet_ptr;
+    }
+    ip_ptr -> nx_ip_tcp_coalesce_tail =  packet_ptr;
+    ip_ptr -> nx_ip_tcp_coalesce_count++;
+}
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
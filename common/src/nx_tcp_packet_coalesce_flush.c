@@ -0,0 +1,95 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_packet_coalesce_flush                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function passes all TCP packets held for coalescing   */
+/*    to TCP processing, in the order they were received.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_packet_process                Process TCP packet            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_thread_entry                   IP helper thread processing   */
+/*    _nx_tcp_queue_process                 Process TCP packet queue      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_packet_coalesce_flush(NX_IP *ip_ptr)
+{
+
+NX_PACKET *packet_ptr;
+
+
+    /* Walk through the list of held packets and process them one by one.  */
+    while (ip_ptr -> nx_ip_tcp_coalesce_head)
+    {
+
+        /* Remove the first packet from the list.  */
+        packet_ptr =  ip_ptr -> nx_ip_tcp_coalesce_head;
+        ip_ptr -> nx_ip_tcp_coalesce_head =  packet_ptr -> nx_packet_queue_next;
+        packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+        /* Process the packet.  */
+        _nx_tcp_packet_process(ip_ptr, packet_ptr);
+    }
+
+    /* The list is empty.  */
+    ip_ptr -> nx_ip_tcp_coalesce_tail =  NX_NULL;
+    ip_ptr -> nx_ip_tcp_coalesce_count =  0;
+}
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
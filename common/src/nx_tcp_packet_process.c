@@ -72,11 +72,26 @@
 /*                                                                        */
 /*    _nx_packet_release                    Packet release function       */
 /*    _nx_ip_checksum_compute               Calculate TCP packet checksum */
+/*    _nx_tcp_connection_table_add          Add socket to connection      */
+/*                                            table                       */
+/*    _nx_tcp_connection_table_find         Find connection in connection */
+/*                                            table                       */
 /*    _nx_tcp_mss_option_get                Get peer MSS option           */
 /*    _nx_tcp_no_connection_reset           Reset on no connection        */
 /*    _nx_tcp_packet_send_syn               Send SYN message              */
+/*    _nx_tcp_sack_permitted_option_get     Get SACK-permitted option     */
+/*    _nx_tcp_timestamp_option_get          Get timestamps option         */
+/*    _nx_tcp_fast_open_option_get          Get Fast Open option          */
+/*    _nx_tcp_fast_open_cache_update        Save Fast Open cookie         */
+/*    _nx_tcp_socket_fast_open_receive      Queue data of Fast Open SYN   */
+/*    _nx_tcp_socket_syn_cookie_establish   Establish from SYN cookie     */
+/*    _nx_tcp_syn_cookie_check              Check SYN cookie              */
+/*    _nx_tcp_syn_cookie_send               Send SYN cookie               */
+/*    _nx_tcp_socket_rtt_update             Update round trip time        */
 /*    _nx_tcp_socket_packet_process         Socket specific packet        */
 /*                                            processing routine          */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
 /*    (nx_tcp_listen_callback)              Application listen callback   */
 /*                                            function                    */
 /*                                                                        */
@@ -84,6 +99,8 @@
 /*                                                                        */
 /*    _nx_tcp_queue_process                 Process TCP packet queue      */
 /*    _nx_tcp_packet_receive                Receive packet processing     */
+/*    _nx_tcp_packet_coalesce               Coalesce TCP packet           */
+/*    _nx_tcp_packet_coalesce_flush         Process held TCP packets      */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -106,6 +123,7 @@ ULONG                       *source_ip = NX_NULL;
 ULONG                       *dest_ip = NX_NULL;
 UINT                         source_port;
 NX_TCP_SOCKET               *socket_ptr;
+NX_TCP_SOCKET               *search_ptr;
 NX_TCP_HEADER               *tcp_header_ptr;
 struct NX_TCP_LISTEN_STRUCT *listen_ptr;
 VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port);
@@ -116,9 +134,9 @@ ULONG                        option_words;
 ULONG                        mss = 0;
 ULONG                        checksum;
 NX_INTERFACE                *interface_ptr = NX_NULL;
-#if defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+#if defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD)
 UINT                         compute_checksum = 1;
-#endif /* defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+#endif /* defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD) */
 ULONG                        queued_count;
 NX_PACKET                   *queued_ptr;
 NX_PACKET                   *queued_prev_ptr;
@@ -130,6 +148,23 @@ UINT                         status;
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
 ULONG                        rwin_scale = 0xFF;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+#ifdef NX_ENABLE_TCP_SACK
+UINT                         sack_permitted = NX_FALSE;
+#endif /* NX_ENABLE_TCP_SACK */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+UINT                         timestamp_found = NX_FALSE;
+ULONG                        timestamp_value = 0;
+ULONG                        timestamp_echo = 0;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+UINT                         fast_open_found = NX_FALSE;
+UCHAR                       *fast_open_cookie = NX_NULL;
+UINT                         fast_open_cookie_length = 0;
+UINT                         fast_open_queued = NX_FALSE;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+ULONG                        syn_cookie_mss = 0;
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
 
 #ifdef NX_DISABLE_TCP_RX_CHECKSUM
     compute_checksum = 0;
@@ -192,9 +227,17 @@ ULONG                        rwin_scale = 0xFF;
     }
 #endif /* NX_IPSEC_ENABLE */
 
-#if defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    /* The checksums of the coalesced segments are already verified.  */
+    if (packet_ptr -> nx_packet_tcp_coalesced)
+    {
+        compute_checksum = 0;
+    }
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+#if defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD)
     if (compute_checksum)
-#endif /* defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+#endif /* defined(NX_DISABLE_TCP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD) */
     {
         checksum = _nx_ip_checksum_compute(packet_ptr, NX_PROTOCOL_TCP,
                                            (UINT)packet_ptr -> nx_packet_length,
@@ -319,6 +362,51 @@ ULONG                        rwin_scale = 0xFF;
             is_valid_option_flag = NX_FALSE;
         }
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+
+#ifdef NX_ENABLE_TCP_SACK
+        /* The SACK-permitted option is only sent in a SYN segment.  */
+        if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT)
+        {
+            status = _nx_tcp_sack_permitted_option_get((packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER)), option_words * (ULONG)sizeof(ULONG), &sack_permitted);
+
+            /* Check the status. if status is NX_FALSE, means Option Length is invalid.  */
+            if (status == NX_FALSE)
+            {
+                is_valid_option_flag = NX_FALSE;
+            }
+        }
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+        /* The timestamps option is negotiated in the SYN segments.  The option of other segments
+           is processed with the socket.  */
+        if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT)
+        {
+            status = _nx_tcp_timestamp_option_get((packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER)), option_words * (ULONG)sizeof(ULONG),
+                                                  &timestamp_found, &timestamp_value, &timestamp_echo);
+
+            /* Check the status. if status is NX_FALSE, means Option Length is invalid.  */
+            if (status == NX_FALSE)
+            {
+                is_valid_option_flag = NX_FALSE;
+            }
+        }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+        /* The Fast Open option is only sent in a SYN segment.  */
+        if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT)
+        {
+            status = _nx_tcp_fast_open_option_get((packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER)), option_words * (ULONG)sizeof(ULONG),
+                                                  &fast_open_found, &fast_open_cookie, &fast_open_cookie_length);
+
+            /* Check the status. if status is NX_FALSE, means Option Length is invalid.  */
+            if (status == NX_FALSE)
+            {
+                is_valid_option_flag = NX_FALSE;
+            }
+        }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
     }
 
     /* Pickup the destination TCP port.  */
@@ -327,109 +415,180 @@ ULONG                        rwin_scale = 0xFF;
     /* Pickup the source TCP port.  */
     source_port =  (UINT)(tcp_header_ptr -> nx_tcp_header_word_0 >> NX_SHIFT_BY_16);
 
-    /* Calculate the hash index in the TCP port array of the associated IP instance.  */
-    index =  (UINT)((port + (port >> 8)) & NX_TCP_PORT_TABLE_MASK);
+    /* Search the TCP connection table for the particular connection.  */
+    socket_ptr =  _nx_tcp_connection_table_find(ip_ptr, port, source_port, source_ip, packet_ptr -> nx_packet_ip_version);
 
-    /* Search the bound sockets in this index for the particular port.  */
-    socket_ptr =  ip_ptr -> nx_ip_tcp_port_table[index];
-
-    /* Determine if there are any sockets bound on this port index.  */
-    if (socket_ptr)
+    /* Determine if the connection is not in the connection table.  */
+    if (socket_ptr == NX_NULL)
     {
 
-    INT find_a_match;
+        /* Calculate the hash index in the TCP port array of the associated IP instance.  */
+        index =  (UINT)((port + (port >> 8)) & NX_TCP_PORT_TABLE_MASK);
 
-        /*  Yes, loop to examine the list of bound ports on this index.  */
-        do
+        /* Search the bound sockets in this index for the particular port.  */
+        search_ptr =  ip_ptr -> nx_ip_tcp_port_table[index];
+
+        /* Determine if there are any sockets bound on this port index.  */
+        if (search_ptr)
         {
 
-            find_a_match = 0;
+        INT find_a_match;
 
-            /* Determine if the port has been found.  */
-            if ((socket_ptr -> nx_tcp_socket_port == port) &&
-                (socket_ptr -> nx_tcp_socket_connect_port == source_port))
+            /*  Yes, loop to examine the list of bound ports on this index.  */
+            do
             {
 
-                /* Make sure they are the same IP protocol */
-                if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == packet_ptr -> nx_packet_ip_version)
+                find_a_match = 0;
+
+                /* Determine if the port has been found.  */
+                if ((search_ptr -> nx_tcp_socket_port == port) &&
+                    (search_ptr -> nx_tcp_socket_connect_port == source_port))
                 {
 
-#ifndef NX_DISABLE_IPV4
-                    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+                    /* Make sure they are the same IP protocol */
+                    if (search_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == packet_ptr -> nx_packet_ip_version)
                     {
 
-                        if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4 == *source_ip)
+#ifndef NX_DISABLE_IPV4
+                        if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
                         {
-                            find_a_match = 1;
+
+                            if (search_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4 == *source_ip)
+                            {
+                                find_a_match = 1;
+                            }
                         }
-                    }
 #endif /* !NX_DISABLE_IPV4  */
 
 #ifdef FEATURE_NX_IPV6
-                    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
-                    {
-                        if (CHECK_IPV6_ADDRESSES_SAME(socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6, source_ip))
+                        if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
                         {
-                            find_a_match = 1;
+                            if (CHECK_IPV6_ADDRESSES_SAME(search_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6, source_ip))
+                            {
+                                find_a_match = 1;
+                            }
                         }
-                    }
 #endif /* FEATURE_NX_IPV6 */
-                }
+                    }
 
-                if (find_a_match)
-                {
+                    if (find_a_match)
+                    {
 
-                    /* Yes, we have a match!  */
+                        /* Yes, we have a match!  */
+                        socket_ptr =  search_ptr;
 
-                    /* Determine if we need to update the tcp port head pointer.  This should
-                       only be done if the found socket pointer is not the head pointer and
-                       the mutex for this IP instance is available.  */
+                        /* Determine if we need to update the tcp port head pointer.  This should
+                           only be done if the found socket pointer is not the head pointer and
+                           the mutex for this IP instance is available.  */
 
-                    /* Move the port head pointer to this socket.  */
-                    ip_ptr -> nx_ip_tcp_port_table[index] = socket_ptr;
+                        /* Move the port head pointer to this socket.  */
+                        ip_ptr -> nx_ip_tcp_port_table[index] = socket_ptr;
 
-                    /* If this packet contains SYN */
-                    if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT)
-                    {
+                        /* Add the socket to the connection table, so the following packets of
+                           this connection are found without searching the bound sockets.  */
+                        _nx_tcp_connection_table_add(ip_ptr, socket_ptr);
 
-                        /* Record the MSS value if it is present and the   Otherwise use 536, as
-                           outlined in RFC 1122 section 4.2.2.6. */
-                        socket_ptr -> nx_tcp_socket_peer_mss = mss;
+                        /* Get out of the search loop.  */
+                        break;
+                    }
+                }
 
-                        if ((mss > socket_ptr -> nx_tcp_socket_mss) && socket_ptr -> nx_tcp_socket_mss)
-                        {
-                            socket_ptr -> nx_tcp_socket_connect_mss  = socket_ptr -> nx_tcp_socket_mss;
-                        }
-                        else if ((socket_ptr -> nx_tcp_socket_state != NX_TCP_SYN_SENT) ||
-                                 (socket_ptr -> nx_tcp_socket_connect_mss > mss))
-                        {
-                            socket_ptr -> nx_tcp_socket_connect_mss  = mss;
-                        }
+                /* Move to the next entry in the bound index.  */
+                search_ptr =  search_ptr -> nx_tcp_socket_bound_next;
+            } while (search_ptr != ip_ptr -> nx_ip_tcp_port_table[index]);
+        }
+    }
+
+    /* Determine if there is an existing TCP connection.  */
+    if (socket_ptr)
+    {
+
+        /* If this packet contains SYN */
+        if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT)
+        {
+
+            /* Record the MSS value if it is present and the   Otherwise use 536, as
+               outlined in RFC 1122 section 4.2.2.6. */
+            socket_ptr -> nx_tcp_socket_peer_mss = mss;
+
+            if ((mss > socket_ptr -> nx_tcp_socket_mss) && socket_ptr -> nx_tcp_socket_mss)
+            {
+                socket_ptr -> nx_tcp_socket_connect_mss  = socket_ptr -> nx_tcp_socket_mss;
+            }
+            else if ((socket_ptr -> nx_tcp_socket_state != NX_TCP_SYN_SENT) ||
+                     (socket_ptr -> nx_tcp_socket_connect_mss > mss))
+            {
+                socket_ptr -> nx_tcp_socket_connect_mss  = mss;
+            }
 
-                        /* Compute the SMSS * SMSS value, so later TCP module doesn't need to redo the multiplication. */
-                        socket_ptr -> nx_tcp_socket_connect_mss2 =
-                            socket_ptr -> nx_tcp_socket_connect_mss * socket_ptr -> nx_tcp_socket_connect_mss;
+            /* Compute the SMSS * SMSS value, so later TCP module doesn't need to redo the multiplication. */
+            socket_ptr -> nx_tcp_socket_connect_mss2 =
+                socket_ptr -> nx_tcp_socket_connect_mss * socket_ptr -> nx_tcp_socket_connect_mss;
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
-                        /*
-                           Simply record the peer's window scale value. When we move to the
-                           ESTABLISHED state, we will set the peer window scale to 0 if the
-                           peer does not support this feature.
-                         */
-                        socket_ptr -> nx_tcp_snd_win_scale_value = rwin_scale;
+            /*
+               Simply record the peer's window scale value. When we move to the
+               ESTABLISHED state, we will set the peer window scale to 0 if the
+               peer does not support this feature.
+             */
+            socket_ptr -> nx_tcp_snd_win_scale_value = rwin_scale;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
-                    }
 
-                    /* Process the packet within an existing TCP connection.  */
-                    _nx_tcp_socket_packet_process(socket_ptr, packet_ptr);
+#ifdef NX_ENABLE_TCP_SACK
+            /* SACK is used only if both sides sent the SACK-permitted option.  */
+            if (socket_ptr -> nx_tcp_socket_state == NX_TCP_SYN_SENT)
+            {
+                socket_ptr -> nx_tcp_socket_sack_permitted = sack_permitted;
+            }
+#endif /* NX_ENABLE_TCP_SACK */
 
-                    /* Get out of the search loop and this function!  */
-                    return;
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+            /* Timestamps are used only if both sides sent the option.  */
+            if (socket_ptr -> nx_tcp_socket_state == NX_TCP_SYN_SENT)
+            {
+                socket_ptr -> nx_tcp_socket_timestamp_permitted = timestamp_found;
+
+                if (timestamp_found)
+                {
+
+                    /* Remember the timestamp of the peer to echo it.  */
+                    socket_ptr -> nx_tcp_socket_timestamp_recent = timestamp_value;
+                    socket_ptr -> nx_tcp_socket_timestamp_recent_time = NX_TCP_TIMESTAMP_GET();
+
+                    /* The SYN+ACK echoes the timestamp of our SYN, take the first round trip time sample.  */
+                    if ((timestamp_echo != 0) && (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) &&
+                        ((NX_TCP_TIMESTAMP_GET() - timestamp_echo) <= (NX_TCP_RTO_MAX / 1000)))
+                    {
+                        _nx_tcp_socket_rtt_update(socket_ptr, (NX_TCP_TIMESTAMP_GET() - timestamp_echo) * 1000);
+                    }
                 }
             }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+            /* Save the cookie the server returned for the next connections of the client.  */
+            if ((socket_ptr -> nx_tcp_socket_state == NX_TCP_SYN_SENT) && (socket_ptr -> nx_tcp_socket_fast_open_option) &&
+                (fast_open_cookie_length) && (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT))
+            {
+                _nx_tcp_fast_open_cache_update(socket_ptr, fast_open_cookie, fast_open_cookie_length);
+            }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+        }
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+        /* Bring the socket timeouts up to date before they are changed.  */
+        _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 
-            /* Move to the next entry in the bound index.  */
-            socket_ptr =  socket_ptr -> nx_tcp_socket_bound_next;
-        } while (socket_ptr != ip_ptr -> nx_ip_tcp_port_table[index]);
+        /* Process the packet within an existing TCP connection.  */
+        _nx_tcp_socket_packet_process(socket_ptr, packet_ptr);
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+        /* Schedule the socket timeouts on the timer wheel.  */
+        _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
+        /* Get out of this function!  */
+        return;
     }
 
     /* At this point, we know there is not an existing TCP connection.  */
@@ -454,6 +613,21 @@ ULONG                        rwin_scale = 0xFF;
         return;
     }
 
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+    /* Determine if an ACK completes a connection request answered with a SYN cookie.  */
+    if (((tcp_header_ptr -> nx_tcp_header_word_3 & (NX_TCP_SYN_BIT | NX_TCP_RST_BIT | NX_TCP_ACK_BIT)) == NX_TCP_ACK_BIT) &&
+        (ip_ptr -> nx_ip_tcp_active_listen_requests))
+    {
+
+        /* Pickup the MSS of the client from the cookie.  */
+        syn_cookie_mss = _nx_tcp_syn_cookie_check(ip_ptr, packet_ptr, tcp_header_ptr);
+        if (syn_cookie_mss)
+        {
+            mss = syn_cookie_mss;
+        }
+    }
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
 #ifdef NX_ENABLE_TCP_MSS_CHECK
     /* Optionally check for a user specified minimum MSS. The user application may choose to
        define a minimum MSS value, and reject a TCP connection if peer MSS value does not
@@ -479,7 +653,11 @@ ULONG                        rwin_scale = 0xFF;
     /* Handle new connection requests without ACK bit in NX_TCP_SYN_RECEIVED state.
        NX_TCP_SYN_RECEIVED state is equal of LISTEN state of RFC.
        RFC793, Section3.9, Page65. */
-    if ((!(tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT)) &&
+    if (((!(tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT))
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+         || (syn_cookie_mss)
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+        ) &&
         (ip_ptr -> nx_ip_tcp_active_listen_requests))
     {
 
@@ -573,9 +751,9 @@ ULONG                        rwin_scale = 0xFF;
         }
 #endif /* FEATURE_NX_IPV6*/
 
-        /* Search all ports in listen mode for a match. */
-        listen_ptr =  ip_ptr -> nx_ip_tcp_active_listen_requests;
-        do
+        /* Search the ports in listen mode in the listen table entry for a match. */
+        listen_ptr =  ip_ptr -> nx_ip_tcp_listen_table[(port + (port >> 8)) & NX_TCP_LISTEN_TABLE_MASK];
+        while (listen_ptr)
         {
 
             /* Determine if this port is in a listen mode.  */
@@ -587,7 +765,11 @@ ULONG                        rwin_scale = 0xFF;
                    The incoming RST packet is related to a previous connection request.
                    Fourth other text or control. RFC793, Section3.9, Page66. */
                 if ((!(tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT)) &&
-                    (!(tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_RST_BIT)))
+                    (!(tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_RST_BIT))
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+                    && (!syn_cookie_mss)
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+                   )
                 {
 
 #ifndef NX_DISABLE_TCP_INFO
@@ -710,6 +892,23 @@ ULONG                        rwin_scale = 0xFF;
                     socket_ptr -> nx_tcp_snd_win_scale_value = rwin_scale;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
+#ifdef NX_ENABLE_TCP_SACK
+                    /* Record whether the peer permits SACK, the SYN+ACK echoes the option.  */
+                    socket_ptr -> nx_tcp_socket_sack_permitted = sack_permitted;
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+                    /* Record whether the peer uses timestamps, and its timestamp to echo in the SYN+ACK.  */
+                    socket_ptr -> nx_tcp_socket_timestamp_permitted = timestamp_found;
+                    socket_ptr -> nx_tcp_socket_timestamp_recent = timestamp_value;
+                    socket_ptr -> nx_tcp_socket_timestamp_recent_time = NX_TCP_TIMESTAMP_GET();
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+                    /* Return the cookie of the client in the SYN+ACK if it sent the Fast Open option.  */
+                    socket_ptr -> nx_tcp_socket_fast_open_option = fast_open_found;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
                     /* Set the initial slow start threshold to be the advertised window size. */
                     socket_ptr -> nx_tcp_socket_tx_slow_start_threshold = socket_ptr -> nx_tcp_socket_tx_window_advertised;
 
@@ -749,8 +948,29 @@ ULONG                        rwin_scale = 0xFF;
                     /* Pickup the listen callback function.  */
                     listen_callback = listen_ptr -> nx_tcp_listen_callback;
 
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+                    /* Determine if the ACK completes a handshake started with a SYN cookie.  */
+                    if (syn_cookie_mss)
+                    {
+
+                        /* Establish the connection, the ACK is processed by the socket.  */
+                        _nx_tcp_socket_syn_cookie_establish(socket_ptr, packet_ptr);
+
+                        /* Determine if there is a listen callback function.  */
+                        if (listen_callback)
+                        {
+                            /* Call the user's listen callback function.  */
+                            (listen_callback)(socket_ptr, port);
+                        }
+
+                        return;
+                    }
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
+#ifndef NX_ENABLE_TCP_FAST_OPEN
                     /* Release the incoming packet.  */
                     _nx_packet_release(packet_ptr);
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 
                     /* Determine if an accept call with suspension has already been made
                        for this socket.  If so, the SYN message needs to be sent from
@@ -767,6 +987,11 @@ ULONG                        rwin_scale = 0xFF;
                            Simply send the SYN now and keep the thread suspended until the
                            other side completes the connection.  */
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+                        /* Bring the socket timeouts up to date before they are changed.  */
+                        _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
                         /* Send the SYN message, but increment the ACK first.  */
                         socket_ptr -> nx_tcp_socket_rx_sequence++;
 
@@ -777,9 +1002,31 @@ ULONG                        rwin_scale = 0xFF;
                         socket_ptr -> nx_tcp_socket_timeout =          socket_ptr -> nx_tcp_socket_timeout_rate;
                         socket_ptr -> nx_tcp_socket_timeout_retries =  0;
 
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+                        /* Queue the data of the SYN if the client presented a valid cookie, so the
+                           SYN+ACK acknowledges it.  RFC 7413, Section 4.2.2.  */
+                        if (fast_open_cookie_length)
+                        {
+                            fast_open_queued = _nx_tcp_socket_fast_open_receive(socket_ptr, packet_ptr, fast_open_cookie, fast_open_cookie_length);
+                        }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
                         /* Send the SYN+ACK message.  */
                         _nx_tcp_packet_send_syn(socket_ptr, (socket_ptr -> nx_tcp_socket_tx_sequence - 1));
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+                        /* Schedule the socket timeouts on the timer wheel.  */
+                        _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+                    }
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+                    /* Release the incoming packet unless its data was queued on the socket.  */
+                    if (!fast_open_queued)
+                    {
+                        _nx_packet_release(packet_ptr);
                     }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 
                     /* Determine if there is a listen callback function.  */
                     if (listen_callback)
@@ -962,6 +1209,34 @@ ULONG                        rwin_scale = 0xFF;
                         return;
                     }
 
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+                    if (syn_cookie_mss)
+                    {
+
+                        /* Queue the ACK of a valid cookie as a connection request.  The checksum and
+                           urgent pointer word, already verified, keeps the MSS of the cookie for the
+                           relisten service.  */
+                        tcp_header_ptr -> nx_tcp_header_word_4 = syn_cookie_mss;
+                    }
+                    else if (listen_ptr -> nx_tcp_listen_queue_current >= listen_ptr -> nx_tcp_listen_queue_maximum)
+                    {
+
+                        /* The listen queue is full, answer with a SYN cookie in place of dropping
+                           the oldest connection request.  */
+                        _nx_tcp_syn_cookie_send(ip_ptr, packet_ptr, tcp_header_ptr, mss);
+
+#ifndef NX_DISABLE_TCP_INFO
+                        /* Increment the SYN cookies sent count.  */
+                        ip_ptr -> nx_ip_tcp_syn_cookies_sent++;
+#endif /* NX_DISABLE_TCP_INFO */
+
+                        /* Release the packet, nothing is kept for the request.  */
+                        _nx_packet_release(packet_ptr);
+
+                        return;
+                    }
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
                     /* Set the next pointer of the packet to NULL.  */
                     packet_ptr -> nx_packet_queue_next = NX_NULL;
 
@@ -1033,8 +1308,8 @@ ULONG                        rwin_scale = 0xFF;
             }
 
             /* Move to the next listen request.  */
-            listen_ptr = listen_ptr -> nx_tcp_listen_next;
-        } while (listen_ptr != ip_ptr -> nx_ip_tcp_active_listen_requests);
+            listen_ptr = listen_ptr -> nx_tcp_listen_hash_next;
+        }
     }
 
 #ifndef NX_DISABLE_TCP_INFO
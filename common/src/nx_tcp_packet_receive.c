@@ -62,6 +62,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_tcp_packet_process                Process TCP packet            */
+/*    _nx_tcp_packet_coalesce               Coalesce TCP packet           */
 /*    tx_event_flags_set                    Set event flags for IP helper */
 /*                                            thread                      */
 /*                                                                        */
@@ -150,6 +151,18 @@ TX_INTERRUPT_SAVE_AREA
     else
     {
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+        /* Determine if the IP helper thread is processing the deferred receive queue.  */
+        if (ip_ptr -> nx_ip_tcp_coalesce_active)
+        {
+
+            /* Yes, coalesce the packet with the following segments of the connection.  The
+               held packets are processed when the queue is empty.  */
+            _nx_tcp_packet_coalesce(ip_ptr, packet_ptr);
+            return;
+        }
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
         /* The IP message was deferred, so this routine is called from the IP helper
            thread and thus may call the TCP processing directly.  */
         _nx_tcp_packet_process(ip_ptr, packet_ptr);
@@ -66,6 +66,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_allocate                   Allocate a packet             */
+/*    _nx_tcp_sack_option_build             Build SACK option             */
+/*    _nx_tcp_timestamp_option_build        Build timestamps option       */
+/*    _nx_tcp_fast_open_option_build        Build Fast Open option        */
 /*    _nx_ip_checksum_compute               Calculate TCP checksum        */
 /*    _nx_ip_packet_send                    Send IPv4 packet              */
 /*    _nx_ipv6_packet_send                  Send IPv6 packet              */
@@ -105,6 +108,11 @@ UINT           compute_checksum = 1;
 #endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
 ULONG          header_size;
 ULONG          window_size;
+#if defined(NX_ENABLE_TCP_SACK) || defined(NX_ENABLE_TCP_TIMESTAMPS) || defined(NX_ENABLE_TCP_FAST_OPEN)
+ULONG          option_words[NX_TCP_OPTION_SIZE_MAX / sizeof(ULONG)];
+ULONG          option_words_count = 0;
+ULONG          i;
+#endif /* NX_ENABLE_TCP_SACK || NX_ENABLE_TCP_TIMESTAMPS || NX_ENABLE_TCP_FAST_OPEN */
 
 #ifdef NX_DISABLE_TCP_TX_CHECKSUM
     compute_checksum = 0;
@@ -142,11 +150,86 @@ ULONG          window_size;
     }
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Determine if timestamps are used on the connection.  A reset does not carry the option.  */
+    if ((socket_ptr -> nx_tcp_socket_timestamp_permitted) &&
+        (!(control_bits & (NX_TCP_SYN_BIT | NX_TCP_RST_BIT))))
+    {
+
+        /* The timestamps come first, so they stay aligned on words.  */
+        _nx_tcp_timestamp_option_build(socket_ptr, &option_words[option_words_count]);
+        option_words_count += NX_TCP_TIMESTAMP_OPTION_SIZE / sizeof(ULONG);
+    }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_SACK
+    /* Determine if SACK is permitted on the connection.  */
+    if (socket_ptr -> nx_tcp_socket_sack_permitted)
+    {
+
+        if (control_bits & NX_TCP_SYN_BIT)
+        {
+
+            /* Offer SACK in the SYN.  RFC 2018, Section 2.  */
+            if (option_word_2 == NX_TCP_OPTION_END)
+            {
+
+                /* Replace the padding of the options.  */
+                option_word_2 = NX_TCP_SACK_PERMITTED_OPTION;
+            }
+            else
+            {
+
+                /* Move the window scale option behind a NOP, so the end of option list
+                   does not hide the SACK-permitted option that follows.  */
+                option_word_2 = (((ULONG)NX_TCP_NOP_KIND) << 24) | (option_word_2 >> 8);
+                option_words[option_words_count++] = NX_TCP_SACK_PERMITTED_OPTION;
+            }
+        }
+        else if ((control_bits == NX_TCP_ACK_BIT) && (data == NX_NULL))
+        {
+
+            /* Report the out-of-order data in the ACK.  RFC 2018, Section 4.  */
+            option_words_count += _nx_tcp_sack_option_build(socket_ptr, &option_words[option_words_count]);
+        }
+    }
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Offer timestamps in the SYN, following the other options.  RFC 7323, Section 3.2.  */
+    if ((socket_ptr -> nx_tcp_socket_timestamp_permitted) && (control_bits & NX_TCP_SYN_BIT))
+    {
+        _nx_tcp_timestamp_option_build(socket_ptr, &option_words[option_words_count]);
+        option_words_count += NX_TCP_TIMESTAMP_OPTION_SIZE / sizeof(ULONG);
+    }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Append the Fast Open option to the SYN, after the other options.  RFC 7413, Section 4.1.1.  */
+    if ((socket_ptr -> nx_tcp_socket_fast_open_option) && (control_bits & NX_TCP_SYN_BIT))
+    {
+        option_words_count += _nx_tcp_fast_open_option_build(socket_ptr, control_bits, &option_words[option_words_count],
+                                                             ((NX_TCP_OPTION_SIZE_MAX - NX_TCP_SYN_OPTION_SIZE) / sizeof(ULONG)) - option_words_count);
+    }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+#if defined(NX_ENABLE_TCP_SACK) || defined(NX_ENABLE_TCP_TIMESTAMPS) || defined(NX_ENABLE_TCP_FAST_OPEN)
+    /* Add the option words to the header size.  */
+    header_size += option_words_count << NX_TCP_HEADER_SHIFT;
+#endif /* NX_ENABLE_TCP_SACK || NX_ENABLE_TCP_TIMESTAMPS || NX_ENABLE_TCP_FAST_OPEN */
+
 #ifdef NX_IPSEC_ENABLE
     /* Get data offset from socket directly. */
     data_offset = socket_ptr -> nx_tcp_socket_egress_sa_data_offset;
 #endif /* NX_IPSEC_ENABLE */
 
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+    /* Allocate from the smallest size class of the packet pool group that holds the max TCP header first.  */
+    if ((ip_ptr -> nx_ip_packet_pool_group == NX_NULL) ||
+        (_nx_packet_pool_group_allocate(ip_ptr -> nx_ip_packet_pool_group, &packet_ptr, NX_IP_PACKET + data_offset,
+                                        NX_TCP_CONTROL_SIZE, NX_NO_WAIT) != NX_SUCCESS))
+    {
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
 #ifdef NX_ENABLE_DUAL_PACKET_POOL
     /* Allocate from auxiliary packet pool first. */
     if (_nx_packet_allocate(ip_ptr -> nx_ip_auxiliary_packet_pool, &packet_ptr, NX_IP_PACKET + data_offset, NX_NO_WAIT))
@@ -173,6 +256,9 @@ ULONG          window_size;
         }
     }
 #endif /* NX_ENABLE_DUAL_PACKET_POOL */
+#ifdef NX_ENABLE_PACKET_POOL_GROUP
+    }
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
 
 #ifdef NX_ENABLE_VLAN
     if (socket_ptr -> nx_tcp_socket_vlan_priority != NX_VLAN_PRIORITY_INVALID)
@@ -181,8 +267,8 @@ ULONG          window_size;
     }
 #endif /* NX_ENABLE_VLAN */
 
-    /* Check to see if the packet has enough room to fill with the max TCP header (SYN + probe data).  */
-    if ((UINT)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_prepend_ptr) < (NX_TCP_SYN_SIZE + 1))
+    /* Check to see if the packet has enough room to fill with the max TCP header.  */
+    if ((UINT)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_prepend_ptr) < NX_TCP_CONTROL_SIZE)
     {
 
         /* Error getting packet, so just get out!  */
@@ -239,15 +325,6 @@ ULONG          window_size;
     NX_CHANGE_ULONG_ENDIAN(tcp_header_ptr -> nx_tcp_header_word_3);
     NX_CHANGE_ULONG_ENDIAN(tcp_header_ptr -> nx_tcp_header_word_4);
 
-    /* Check whether or not data is set. */
-    if (data)
-    {
-
-        /* Zero window probe data exist. */
-        *packet_ptr -> nx_packet_append_ptr++ = *data;
-        packet_ptr -> nx_packet_length++;
-    }
-
     /* Whether it is a SYN packet. */
     if (control_bits & NX_TCP_SYN_BIT)
     {
@@ -267,6 +344,51 @@ ULONG          window_size;
         packet_ptr -> nx_packet_length += (ULONG)(sizeof(ULONG) << 1);
     }
 
+#if defined(NX_ENABLE_TCP_SACK) || defined(NX_ENABLE_TCP_TIMESTAMPS) || defined(NX_ENABLE_TCP_FAST_OPEN)
+    /* Append the option words.  */
+    for (i = 0; i < option_words_count; i++)
+    {
+
+        /* Swap the option word to network byte order.  */
+        NX_CHANGE_ULONG_ENDIAN(option_words[i]);
+
+        /*lint --e{927} --e{826} suppress cast of pointer to pointer, since it is necessary  */
+        *((ULONG *)packet_ptr -> nx_packet_append_ptr) = option_words[i];
+
+        /* Adjust packet information. */
+        packet_ptr -> nx_packet_append_ptr += sizeof(ULONG);
+        packet_ptr -> nx_packet_length += (ULONG)sizeof(ULONG);
+    }
+#endif /* NX_ENABLE_TCP_SACK || NX_ENABLE_TCP_TIMESTAMPS || NX_ENABLE_TCP_FAST_OPEN */
+
+    /* Check whether or not data is set.  The data follows the options. */
+    if (data)
+    {
+
+        /* Zero window probe data exist. */
+        *packet_ptr -> nx_packet_append_ptr++ = *data;
+        packet_ptr -> nx_packet_length++;
+    }
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Determine if the SYN of a client carries the initial data.  */
+    if ((control_bits == NX_TCP_SYN_BIT) && (socket_ptr -> nx_tcp_socket_fast_open_length))
+    {
+
+        /* The data is limited by the room left in the control packet.  */
+        /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+        if (socket_ptr -> nx_tcp_socket_fast_open_length > (ULONG)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_append_ptr))
+        {
+            socket_ptr -> nx_tcp_socket_fast_open_length =  (ULONG)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_append_ptr);
+        }
+
+        memcpy(packet_ptr -> nx_packet_append_ptr, /* Use case of memcpy is verified. */
+               socket_ptr -> nx_tcp_socket_fast_open_packet -> nx_packet_prepend_ptr, socket_ptr -> nx_tcp_socket_fast_open_length);
+        packet_ptr -> nx_packet_append_ptr += socket_ptr -> nx_tcp_socket_fast_open_length;
+        packet_ptr -> nx_packet_length += socket_ptr -> nx_tcp_socket_fast_open_length;
+    }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
     if (socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM)
     {
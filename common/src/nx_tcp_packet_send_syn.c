@@ -97,6 +97,7 @@ ULONG        option_word_2;
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
 UINT         include_window_scaling = NX_FALSE;
 UINT         scale_factor;
+ULONG        window_size;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 ULONG        mss = 0;
 
@@ -294,10 +295,21 @@ ULONG        mss = 0;
         option_word_2 = NX_TCP_RWIN_OPTION;
 
         /* Compute the window scaling factor */
+        window_size = socket_ptr -> nx_tcp_socket_rx_window_current;
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+        /* The scale is fixed for the connection, offer the scale of the largest window
+           autotuning may grow the window to.  */
+        if (socket_ptr -> nx_tcp_socket_rx_autotune_maximum > window_size)
+        {
+            window_size = socket_ptr -> nx_tcp_socket_rx_autotune_maximum;
+        }
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
         for (scale_factor = 0; scale_factor < 15; scale_factor++)
         {
 
-            if ((socket_ptr -> nx_tcp_socket_rx_window_current >> scale_factor) < 65536)
+            if ((window_size >> scale_factor) < 65536)
             {
                 break;
             }
@@ -318,6 +330,22 @@ ULONG        mss = 0;
     }
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
+#ifdef NX_ENABLE_TCP_SACK
+    /* Offer SACK if we initiate the SYN.  The SYN+ACK only includes the option if the peer offered it.  */
+    if (socket_ptr -> nx_tcp_socket_state == NX_TCP_SYN_SENT)
+    {
+        socket_ptr -> nx_tcp_socket_sack_permitted = NX_TRUE;
+    }
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Offer timestamps if we initiate the SYN.  The SYN+ACK only includes the option if the peer offered it.  */
+    if (socket_ptr -> nx_tcp_socket_state == NX_TCP_SYN_SENT)
+    {
+        socket_ptr -> nx_tcp_socket_timestamp_permitted = NX_TRUE;
+    }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
     /* Send SYN or SYN+ACK packet according to socket state. */
     if (socket_ptr -> nx_tcp_socket_state == NX_TCP_SYN_SENT)
     {
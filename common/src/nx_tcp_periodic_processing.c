@@ -50,6 +50,10 @@
 /*    Note this requires that NX_ENABLE_TCP_KEEPALIVE is enabled when the */
 /*    NetX library is built.                                              */
 /*                                                                        */
+/*    If NX_ENABLE_TCP_TIMER_WHEEL is defined, only the sockets whose     */
+/*    keepalive timer expires at this tick of the keepalive timer wheel   */
+/*    are processed.                                                      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_ptr                                Pointer to IP control block   */
@@ -62,6 +66,10 @@
 /*                                                                        */
 /*    _nx_tcp_packet_send_ack               Send ACK probe message        */
 /*    _nx_tcp_socket_connection_reset       Reset the connection          */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
+/*    _nx_tcp_timer_wheel_advance           Advance timer wheel           */
+/*    _nx_tcp_timer_wheel_remove            Remove timer from wheel       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -81,10 +89,33 @@ VOID  _nx_tcp_periodic_processing(NX_IP *ip_ptr)
 
 #ifdef NX_ENABLE_TCP_KEEPALIVE
 NX_TCP_SOCKET *socket_ptr;
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+NX_TCP_TIMER  *timer_ptr;
+#else
 ULONG          sockets;
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 UINT           keepalive_enabled = NX_FALSE;
 
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Advance the keepalive timer wheel.  The timers of the sockets with an expiring
+       keepalive timeout are moved to the expired list.  */
+    _nx_tcp_timer_wheel_advance(&(ip_ptr -> nx_ip_tcp_keepalive_timer_wheel));
+
+    /* Loop through the expired timers.  */
+    while (ip_ptr -> nx_ip_tcp_keepalive_timer_wheel.nx_tcp_timer_wheel_expired)
+    {
+
+        /* Pickup the socket of the first expired timer.  */
+        timer_ptr =   ip_ptr -> nx_ip_tcp_keepalive_timer_wheel.nx_tcp_timer_wheel_expired;
+        socket_ptr =  timer_ptr -> nx_tcp_timer_socket;
+
+        /* Bring the timeouts of the socket up to the previous tick.  */
+        _nx_tcp_socket_timer_sync(socket_ptr);
+
+        /* Get the keepalive status of the socket. */
+        keepalive_enabled = socket_ptr -> nx_tcp_socket_keepalive_enabled;
+#else
     /* Pickup the number of created TCP sockets.  */
     sockets =  ip_ptr -> nx_ip_tcp_created_sockets_count;
 
@@ -101,6 +132,7 @@ UINT           keepalive_enabled = NX_FALSE;
     /* Loop through the created sockets.  */
     while ((sockets--) && socket_ptr)
     {
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
 
         /* Is keep alive enabled on this socket? */
         if (keepalive_enabled)
@@ -144,11 +176,20 @@ UINT           keepalive_enabled = NX_FALSE;
             }
         }
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+        /* The keepalive timeout of the socket is now up to date with this tick.  */
+        _nx_tcp_timer_wheel_remove(timer_ptr);
+        timer_ptr -> nx_tcp_timer_updated =  ip_ptr -> nx_ip_tcp_keepalive_timer_wheel.nx_tcp_timer_wheel_tick;
+
+        /* Place the timers of the socket at their next expiration.  */
+        _nx_tcp_socket_timer_schedule(socket_ptr);
+#else
         /* Move to the next TCP socket.  */
         socket_ptr =  socket_ptr -> nx_tcp_socket_created_next;
 
         /* Get the socket's keep alive status. */
         keepalive_enabled = socket_ptr -> nx_tcp_socket_keepalive_enabled;
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
     }
 #else
     NX_PARAMETER_NOT_USED(ip_ptr);
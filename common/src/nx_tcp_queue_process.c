@@ -54,6 +54,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_tcp_packet_process                Process TCP packet            */
+/*    _nx_tcp_packet_coalesce               Coalesce TCP packet           */
+/*    _nx_tcp_packet_coalesce_flush         Process held TCP packets      */
+/*    _nx_tcp_socket_ack_pending_flush      Send held TCP ACKs            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -89,6 +92,11 @@ NX_PACKET *packet_ptr;
     /* Restore interrupts.  */
     TX_RESTORE
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Hold the ACKs while the queue is processed.  */
+    ip_ptr -> nx_ip_tcp_ack_pending_active =  NX_TRUE;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
     /* Walk through the entire TCP message queue and process packets
        one by one.  */
     while (queue_head)
@@ -103,8 +111,24 @@ NX_PACKET *packet_ptr;
         /* Add debug information. */
         NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+        /* Coalesce the packet with the following segments of the connection.  */
+        _nx_tcp_packet_coalesce(ip_ptr, packet_ptr);
+#else
         /* Process the packet.  */
         _nx_tcp_packet_process(ip_ptr, packet_ptr);
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
     }
+
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    /* Process the coalesced packets.  */
+    _nx_tcp_packet_coalesce_flush(ip_ptr);
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Send one ACK for each socket that received packets.  */
+    ip_ptr -> nx_ip_tcp_ack_pending_active =  NX_FALSE;
+    _nx_tcp_socket_ack_pending_flush(ip_ptr);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
 }
 
@@ -0,0 +1,213 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_SACK
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_sack_option_build                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function builds the SACK option reporting the out-    */
+/*    of-order data on the receive queue of the socket. Contiguous        */
+/*    packets are reported in one block. The block holding the most       */
+/*    recently received out-of-order data is reported first, followed by  */
+/*    the other blocks in sequence order, as described in RFC 2018,       */
+/*    Section 4.                                                          */
+/*                                                                        */
+/*    The option words are built in host byte order. If there is no out-  */
+/*    of-order data, no option is built.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to socket             */
+/*    option_ptr                            Pointer to option words       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    words                                 Number of option words built  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_send_control           Send TCP control packet       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_sack_option_build(NX_TCP_SOCKET *socket_ptr, ULONG *option_ptr)
+{
+
+NX_PACKET     *search_ptr;
+NX_TCP_HEADER *search_header_ptr;
+ULONG          header_length;
+ULONG          packet_begin_sequence = 0;
+ULONG          packet_end_sequence = 0;
+ULONG          block_begin_sequence;
+ULONG          block_end_sequence;
+ULONG          blocks[NX_TCP_SACK_BLOCKS_MAX << 1];
+UINT           block_count = 0;
+UINT           recent_found = NX_FALSE;
+UINT           i;
+ULONG          words = 1;
+ULONG          words_max = 1 + (NX_TCP_SACK_BLOCKS_MAX << 1);
+
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Fewer blocks fit in the option area with the timestamps option.  */
+    if (socket_ptr -> nx_tcp_socket_timestamp_permitted)
+    {
+        words_max =  1 + (NX_TCP_SACK_TIMESTAMP_BLOCKS_MAX << 1);
+    }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+    /* Start with an empty block at the receive sequence.  Packets that are
+       already in sequence are merged into it, and not reported.  */
+    block_begin_sequence =  socket_ptr -> nx_tcp_socket_rx_sequence;
+    block_end_sequence =    block_begin_sequence;
+
+    /* Loop through the receive queue, which is sorted by sequence number.  */
+    for (search_ptr = socket_ptr -> nx_tcp_socket_receive_queue_head; ;
+         search_ptr = search_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next)
+    {
+
+        /* Determine if we are at the end of the queue.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if (search_ptr == (NX_PACKET *)NX_PACKET_ENQUEUED)
+        {
+            search_ptr =  NX_NULL;
+        }
+
+        if (search_ptr)
+        {
+
+            /* Setup a pointer to header of this packet in the receive list.  */
+            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+            search_header_ptr =  (NX_TCP_HEADER *)search_ptr -> nx_packet_prepend_ptr;
+
+            /* Calculate the header size for this packet.  */
+            header_length =  (search_header_ptr -> nx_tcp_header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+
+            packet_begin_sequence =  search_header_ptr -> nx_tcp_sequence_number;
+            packet_end_sequence =    packet_begin_sequence + search_ptr -> nx_packet_length - header_length;
+
+            /* Is the packet contiguous with the current block?  */
+            if ((INT)(packet_begin_sequence - block_end_sequence) <= 0)
+            {
+
+                /* Yes, extend the block.  */
+                if ((INT)(packet_end_sequence - block_end_sequence) > 0)
+                {
+                    block_end_sequence =  packet_end_sequence;
+                }
+
+                continue;
+            }
+        }
+
+        /* The current block ends.  Determine if it holds out-of-order data.  */
+        if (block_end_sequence != block_begin_sequence)
+        {
+
+            /* Determine if the block holds the most recently received data.  */
+            if ((recent_found == NX_FALSE) &&
+                ((INT)(socket_ptr -> nx_tcp_socket_sack_recent_sequence - block_begin_sequence) >= 0) &&
+                ((INT)(socket_ptr -> nx_tcp_socket_sack_recent_sequence - block_end_sequence) < 0))
+            {
+
+                /* Yes, it is reported first.  */
+                option_ptr[1] =  block_begin_sequence;
+                option_ptr[2] =  block_end_sequence;
+                recent_found =   NX_TRUE;
+            }
+            else if (block_count < NX_TCP_SACK_BLOCKS_MAX)
+            {
+
+                /* Keep the block.  */
+                blocks[block_count << 1] =        block_begin_sequence;
+                blocks[(block_count << 1) + 1] =  block_end_sequence;
+                block_count++;
+            }
+        }
+
+        /* Determine if the end of the queue is reached.  */
+        if (search_ptr == NX_NULL)
+        {
+            break;
+        }
+
+        /* Start a new block with this packet.  */
+        block_begin_sequence =  packet_begin_sequence;
+        block_end_sequence =    packet_end_sequence;
+    }
+
+    /* Skip the block reported first.  */
+    if (recent_found)
+    {
+        words =  3;
+    }
+
+    /* Append the other blocks, as many as fit in the option.  */
+    for (i = 0; (i < block_count) && (words < words_max); i++)
+    {
+        option_ptr[words++] =  blocks[i << 1];
+        option_ptr[words++] =  blocks[(i << 1) + 1];
+    }
+
+    /* Determine if there is any block.  */
+    if (words == 1)
+    {
+
+        /* No, there is no out-of-order data to report.  */
+        return(0);
+    }
+
+    /* Build the option kind and length, in front of the blocks.  */
+    option_ptr[0] =  NX_TCP_SACK_OPTION | (2 + ((words - 1) * (ULONG)sizeof(ULONG)));
+
+    /* Return the number of option words.  */
+    return(words);
+}
+#endif /* NX_ENABLE_TCP_SACK */
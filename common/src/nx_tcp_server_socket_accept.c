@@ -59,6 +59,8 @@
 /*                                                                        */
 /*    _nx_tcp_packet_send_syn               Send SYN message              */
 /*    _nx_tcp_socket_thread_suspend         Suspend thread for connection */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
 /*    tx_mutex_get                          Obtain a protection mutex     */
 /*    tx_mutex_put                          Release a protection mutex    */
 /*    NX_RAND                               Random number for sequence    */
@@ -121,6 +123,11 @@ NX_IP *ip_ptr;
             socket_ptr -> nx_tcp_socket_tx_sequence =  socket_ptr -> nx_tcp_socket_tx_sequence + ((ULONG)(((ULONG)0x10000))) + ((ULONG)NX_RAND());
         }
 
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+        /* Start the receive window of the connection from the initial window.  */
+        _nx_tcp_socket_window_autotune_reset(socket_ptr);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
         /* Ensure the rx window size logic is reset.  */
         socket_ptr -> nx_tcp_socket_rx_window_current =    socket_ptr -> nx_tcp_socket_rx_window_default;
         socket_ptr -> nx_tcp_socket_rx_window_last_sent =  socket_ptr -> nx_tcp_socket_rx_window_default;
@@ -142,6 +149,11 @@ NX_IP *ip_ptr;
         if (socket_ptr -> nx_tcp_socket_bound_next)
         {
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+            /* Bring the socket timeouts up to date before they are changed.  */
+            _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
             /* Send a SYN message back to establish the connection, but increment the ACK first.  */
             socket_ptr -> nx_tcp_socket_rx_sequence++;
 
@@ -153,6 +165,11 @@ NX_IP *ip_ptr;
             socket_ptr -> nx_tcp_socket_timeout =          socket_ptr -> nx_tcp_socket_timeout_rate;
             socket_ptr -> nx_tcp_socket_timeout_retries =  0;
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+            /* Schedule the socket timeouts on the timer wheel.  */
+            _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
             /* CLEANUP: Clean up any existing socket data before making a new connection. */
             socket_ptr -> nx_tcp_socket_tx_window_congestion = 0;
             socket_ptr -> nx_tcp_socket_tx_outstanding_bytes = 0;
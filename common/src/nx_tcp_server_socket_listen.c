@@ -85,6 +85,7 @@ UINT  _nx_tcp_server_socket_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *sock
 
 struct NX_TCP_LISTEN_STRUCT *listen_ptr;
 struct NX_TCP_LISTEN_STRUCT *tail_ptr;
+UINT                         index;
 #ifdef NX_NAT_ENABLE
 UINT                         bound;
 #endif
@@ -122,32 +123,30 @@ UINT                         bound;
     /* Clean connected interface. */
     socket_ptr -> nx_tcp_socket_connect_interface = NX_NULL;
 
-    /* Search through the active listen requests to see if there is already
-       one active.  */
-    listen_ptr =  ip_ptr -> nx_ip_tcp_active_listen_requests;
-    if (listen_ptr)
+    /* Calculate the hash index in the TCP listen table.  */
+    index =  (UINT)((port + (port >> 8)) & NX_TCP_LISTEN_TABLE_MASK);
+
+    /* Search through the active listen requests of this hash entry to see if
+       there is already one active.  */
+    listen_ptr =  ip_ptr -> nx_ip_tcp_listen_table[index];
+    while (listen_ptr)
     {
 
-        /* Search the active listen requests for this port.  */
-        do
+        /* Determine if there is another listen request for the same port.  */
+        if (listen_ptr -> nx_tcp_listen_port == port)
         {
 
-            /* Determine if there is another listen request for the same port.  */
-            if (listen_ptr -> nx_tcp_listen_port == port)
-            {
-
-                /* This is a duplicate request, return an error.  */
+            /* This is a duplicate request, return an error.  */
 
-                /* Release the protection.  */
-                tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+            /* Release the protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
-                /* Return the error code.  */
-                return(NX_DUPLICATE_LISTEN);
-            }
+            /* Return the error code.  */
+            return(NX_DUPLICATE_LISTEN);
+        }
 
-            /* Move to the next listen request.  */
-            listen_ptr =  listen_ptr -> nx_tcp_listen_next;
-        } while (listen_ptr != ip_ptr -> nx_ip_tcp_active_listen_requests);
+        /* Move to the next listen request.  */
+        listen_ptr =  listen_ptr -> nx_tcp_listen_hash_next;
     }
 
 #ifdef NX_NAT_ENABLE
@@ -235,6 +234,10 @@ UINT                         bound;
         listen_ptr -> nx_tcp_listen_next =            listen_ptr;
     }
 
+    /* Link the listen request at the head of its entry in the listen table.  */
+    listen_ptr -> nx_tcp_listen_hash_next =  ip_ptr -> nx_ip_tcp_listen_table[index];
+    ip_ptr -> nx_ip_tcp_listen_table[index] =  listen_ptr;
+
 #ifdef NX_ENABLE_TCPIP_OFFLOAD
     /* Listen to TCP/IP offload interfaces.  */
     if (_nx_tcp_server_socket_driver_listen(ip_ptr, port, socket_ptr))
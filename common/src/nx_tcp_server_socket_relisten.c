@@ -66,6 +66,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_release                    Release packet                */
+/*    _nx_tcp_sack_permitted_option_get     Get SACK-permitted option     */
+/*    _nx_tcp_timestamp_option_get          Get timestamps option         */
+/*    _nx_tcp_socket_syn_cookie_establish   Establish from SYN cookie     */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*                                                                        */
@@ -102,6 +105,14 @@ NX_IPV4_HEADER              *ipv4_header_ptr;
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
 ULONG                        rwin_scale = 0;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+#ifdef NX_ENABLE_TCP_SACK
+UINT                         sack_permitted = NX_FALSE;
+#endif /* NX_ENABLE_TCP_SACK */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+UINT                         timestamp_found = NX_FALSE;
+ULONG                        timestamp_value = 0;
+ULONG                        timestamp_echo = 0;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
 VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port);
 
 
@@ -135,9 +146,9 @@ VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT
         return(NX_ALREADY_BOUND);
     }
 
-    /* Search through the active listen requests to see if there is already
-       one active.  */
-    listen_ptr =  ip_ptr -> nx_ip_tcp_active_listen_requests;
+    /* Search through the active listen requests in the listen table entry of
+       this port to see if there is already one active.  */
+    listen_ptr =  ip_ptr -> nx_ip_tcp_listen_table[(port + (port >> 8)) & NX_TCP_LISTEN_TABLE_MASK];
     if (listen_ptr)
     {
 
@@ -236,9 +247,27 @@ VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
                             _nx_tcp_window_scaling_option_get((packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER)), option_words * (ULONG)sizeof(ULONG), &rwin_scale);
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+
+#ifdef NX_ENABLE_TCP_SACK
+                            _nx_tcp_sack_permitted_option_get((packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER)), option_words * (ULONG)sizeof(ULONG), &sack_permitted);
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+                            _nx_tcp_timestamp_option_get((packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER)), option_words * (ULONG)sizeof(ULONG),
+                                                         &timestamp_found, &timestamp_value, &timestamp_echo);
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
                         }
                     }
 
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+                    /* An ACK is only queued after it validated a SYN cookie, the MSS of the cookie
+                       was kept in the header.  */
+                    if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT)
+                    {
+                        mss = tcp_header_ptr -> nx_tcp_header_word_4;
+                    }
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
                     /* Set the default MSS if the MSS value was not found.  */
                     /*lint -e{644} suppress variable might not be initialized, since "mss" was initialized in _nx_tcp_mss_option_get. */
                     if (mss == 0)
@@ -351,6 +380,18 @@ VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT
                     socket_ptr -> nx_tcp_snd_win_scale_value = rwin_scale;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
+#ifdef NX_ENABLE_TCP_SACK
+                    /* Record whether the peer permits SACK.  */
+                    socket_ptr -> nx_tcp_socket_sack_permitted = sack_permitted;
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+                    /* Record whether the peer uses timestamps, and its timestamp to echo.  */
+                    socket_ptr -> nx_tcp_socket_timestamp_permitted = timestamp_found;
+                    socket_ptr -> nx_tcp_socket_timestamp_recent = timestamp_value;
+                    socket_ptr -> nx_tcp_socket_timestamp_recent_time = NX_TCP_TIMESTAMP_GET();
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
                     /* If trace is enabled, insert this event into the trace buffer.  */
                     NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_STATE_CHANGE, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, NX_TCP_LISTEN_STATE, NX_TRACE_INTERNAL_EVENTS, 0, 0);
 
@@ -387,6 +428,31 @@ VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT
                     /* Pickup the listen callback routine.  */
                     listen_callback =  listen_ptr -> nx_tcp_listen_callback;
 
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+                    /* Determine if the queued request completes a handshake started with a SYN cookie.  */
+                    if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT)
+                    {
+
+                        /* Establish the connection, the ACK is processed by the socket.  */
+                        _nx_tcp_socket_syn_cookie_establish(socket_ptr, packet_ptr);
+
+                        /* Release protection.  */
+                        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+                        /* Determine if there is a listen callback function.  */
+                        if (listen_callback)
+                        {
+
+                            /* Call the user's listen callback function.  */
+                            (listen_callback)(socket_ptr, port);
+                        }
+
+                        /* Return a connection pending status, the connection is already
+                           established.  */
+                        return(NX_CONNECTION_PENDING);
+                    }
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
+
                     /* Release protection.  */
                     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -409,8 +475,8 @@ VOID                         (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT
             }
 
             /* Move to the next listen request.  */
-            listen_ptr =  listen_ptr -> nx_tcp_listen_next;
-        } while (listen_ptr != ip_ptr -> nx_ip_tcp_active_listen_requests);
+            listen_ptr =  listen_ptr -> nx_tcp_listen_hash_next;
+        } while (listen_ptr);
     }
 
 
@@ -55,6 +55,9 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_tcp_connection_table_remove       Remove socket from connection */
+/*                                            table                       */
+/*    _nx_tcp_socket_ack_pending_remove     Remove socket from ACK list   */
 /*    _nx_tcp_socket_receive_queue_flush    Release all receive packets   */
 /*    tx_mutex_get                          Obtain a protection mutex     */
 /*    tx_mutex_put                          Release a protection mutex    */
@@ -140,6 +143,14 @@ UINT                         port;
     /* Calculate the hash index in the TCP port array of the associated IP instance.  */
     index =  (UINT)((port + (port >> 8)) & NX_TCP_PORT_TABLE_MASK);
 
+    /* Remove the socket from the TCP connection table.  */
+    _nx_tcp_connection_table_remove(socket_ptr);
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Remove the socket from the pending ACK list.  */
+    _nx_tcp_socket_ack_pending_remove(socket_ptr);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
     /* Determine if this is the only socket bound on this port list.  */
     if (socket_ptr -> nx_tcp_socket_bound_next == socket_ptr)
     {
@@ -168,6 +168,7 @@ NX_PACKET                   *packet_ptr;
 NX_PACKET                   *next_packet_ptr;
 ULONG                        queue_count;
 struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+struct NX_TCP_LISTEN_STRUCT **hash_ptr;
 
 
     /* If trace is enabled, insert this event into the trace buffer.  */
@@ -176,123 +177,124 @@ struct NX_TCP_LISTEN_STRUCT *listen_ptr;
     /* Obtain the IP protection.  */
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
-    /* Search through the active listen requests to see if we can find
-       one for this port.  */
-    listen_ptr =  ip_ptr -> nx_ip_tcp_active_listen_requests;
-    if (listen_ptr)
+    /* Search through the active listen requests of this hash entry to see if
+       we can find one for this port.  */
+    hash_ptr =  &(ip_ptr -> nx_ip_tcp_listen_table[(port + (port >> 8)) & NX_TCP_LISTEN_TABLE_MASK]);
+    while (*hash_ptr)
     {
 
-        /* Search the active listen requests for this port.  */
-        do
+        /* Pickup the listen request.  */
+        listen_ptr =  *hash_ptr;
+
+        /* Determine if there is a listen request for the specified port.  */
+        if (listen_ptr -> nx_tcp_listen_port == port)
         {
 
-            /* Determine if there is a listen request for the specified port.  */
-            if (listen_ptr -> nx_tcp_listen_port == port)
+            /* Pickup the socket for the listen request.  */
+            socket_ptr =  listen_ptr -> nx_tcp_listen_socket_ptr;
+
+            /* Determine if there was a socket dedicated for listening.  */
+            if (socket_ptr)
             {
 
-                /* Pickup the socket for the listen request.  */
-                socket_ptr =  listen_ptr -> nx_tcp_listen_socket_ptr;
+                /* If trace is enabled, insert this event into the trace buffer.  */
+                NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_STATE_CHANGE, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, NX_TCP_CLOSED, NX_TRACE_INTERNAL_EVENTS, 0, 0);
 
-                /* Determine if there was a socket dedicated for listening.  */
-                if (socket_ptr)
+                /* Yes, clear any connection suspension on this socket.  */
+                if (socket_ptr -> nx_tcp_socket_state != NX_TCP_LISTEN_STATE)
                 {
 
-                    /* If trace is enabled, insert this event into the trace buffer.  */
-                    NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_STATE_CHANGE, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, NX_TCP_CLOSED, NX_TRACE_INTERNAL_EVENTS, 0, 0);
-
-                    /* Yes, clear any connection suspension on this socket.  */
-                    if (socket_ptr -> nx_tcp_socket_state != NX_TCP_LISTEN_STATE)
-                    {
+                    /* Release protection.  */
+                    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
-                        /* Release protection.  */
-                        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
-
-                        /* Return error code.  */
-                        return(NX_NOT_LISTEN_STATE);
-                    }
+                    /* Return error code.  */
+                    return(NX_NOT_LISTEN_STATE);
+                }
 
-                    /* Change the state of the socket back to closed.  */
-                    socket_ptr -> nx_tcp_socket_state = NX_TCP_CLOSED;
+                /* Change the state of the socket back to closed.  */
+                socket_ptr -> nx_tcp_socket_state = NX_TCP_CLOSED;
 
-                    /* Clear the socket pointer in the listen structure.  */
-                    listen_ptr -> nx_tcp_listen_socket_ptr =  NX_NULL;
-                }
-                else
-                {
+                /* Clear the socket pointer in the listen structure.  */
+                listen_ptr -> nx_tcp_listen_socket_ptr =  NX_NULL;
+            }
+            else
+            {
 
-                    /* Check for queued connection requests, if found, release
-                       them all.  */
-                    queue_count =  listen_ptr -> nx_tcp_listen_queue_current;
-                    packet_ptr =   listen_ptr -> nx_tcp_listen_queue_head;
+                /* Check for queued connection requests, if found, release
+                   them all.  */
+                queue_count =  listen_ptr -> nx_tcp_listen_queue_current;
+                packet_ptr =   listen_ptr -> nx_tcp_listen_queue_head;
 
-                    /* Clear the listen connection queue pointers.  */
-                    listen_ptr -> nx_tcp_listen_queue_head =  NX_NULL;
-                    listen_ptr -> nx_tcp_listen_queue_tail =  NX_NULL;
+                /* Clear the listen connection queue pointers.  */
+                listen_ptr -> nx_tcp_listen_queue_head =  NX_NULL;
+                listen_ptr -> nx_tcp_listen_queue_tail =  NX_NULL;
 
-                    /* Clear the listen connection count as well.  */
-                    listen_ptr -> nx_tcp_listen_queue_current =  0;
+                /* Clear the listen connection count as well.  */
+                listen_ptr -> nx_tcp_listen_queue_current =  0;
 
-                    /* Loop through and release the packets representing queued
-                       connections.  */
-                    while (queue_count--)
-                    {
+                /* Loop through and release the packets representing queued
+                   connections.  */
+                while (queue_count--)
+                {
 
-                        /* Save the next pointer.  */
-                        next_packet_ptr =  packet_ptr -> nx_packet_queue_next;
+                    /* Save the next pointer.  */
+                    next_packet_ptr =  packet_ptr -> nx_packet_queue_next;
 
-                        /* Release the packet.  */
-                        _nx_packet_release(packet_ptr);
+                    /* Release the packet.  */
+                    _nx_packet_release(packet_ptr);
 
-                        /* Move to the next packet.  */
-                        packet_ptr =  next_packet_ptr;
-                    }
+                    /* Move to the next packet.  */
+                    packet_ptr =  next_packet_ptr;
                 }
+            }
 
-                /* Unlink the listen structure from the active listen requests.  */
+            /* Unlink the listen structure from the active listen requests.  */
 
-                /* See if the listen structure is the only one on the list.  */
-                if (listen_ptr == listen_ptr -> nx_tcp_listen_next)
-                {
+            /* See if the listen structure is the only one on the list.  */
+            if (listen_ptr == listen_ptr -> nx_tcp_listen_next)
+            {
 
-                    /* Only active listen, just set the active list to NULL.  */
-                    ip_ptr -> nx_ip_tcp_active_listen_requests =  NX_NULL;
-                }
-                else
-                {
+                /* Only active listen, just set the active list to NULL.  */
+                ip_ptr -> nx_ip_tcp_active_listen_requests =  NX_NULL;
+            }
+            else
+            {
 
-                    /* Link-up the neighbors.  */
-                    (listen_ptr -> nx_tcp_listen_next) -> nx_tcp_listen_previous =
-                        listen_ptr -> nx_tcp_listen_previous;
-                    (listen_ptr -> nx_tcp_listen_previous) -> nx_tcp_listen_next =
-                        listen_ptr -> nx_tcp_listen_next;
+                /* Link-up the neighbors.  */
+                (listen_ptr -> nx_tcp_listen_next) -> nx_tcp_listen_previous =
+                    listen_ptr -> nx_tcp_listen_previous;
+                (listen_ptr -> nx_tcp_listen_previous) -> nx_tcp_listen_next =
+                    listen_ptr -> nx_tcp_listen_next;
 
-                    /* See if we have to update the active list head pointer.  */
-                    if (ip_ptr -> nx_ip_tcp_active_listen_requests == listen_ptr)
-                    {
+                /* See if we have to update the active list head pointer.  */
+                if (ip_ptr -> nx_ip_tcp_active_listen_requests == listen_ptr)
+                {
 
-                        /* Yes, move the head pointer to the next link. */
-                        ip_ptr -> nx_ip_tcp_active_listen_requests =  listen_ptr -> nx_tcp_listen_next;
-                    }
+                    /* Yes, move the head pointer to the next link. */
+                    ip_ptr -> nx_ip_tcp_active_listen_requests =  listen_ptr -> nx_tcp_listen_next;
                 }
+            }
+
+            /* Unlink the listen structure from its entry in the listen table.  */
+            *hash_ptr =  listen_ptr -> nx_tcp_listen_hash_next;
 
-                /* Add the listen request back to the available list.  */
-                listen_ptr -> nx_tcp_listen_next =  ip_ptr -> nx_ip_tcp_available_listen_requests;
-                ip_ptr -> nx_ip_tcp_available_listen_requests =  listen_ptr;
+            /* Add the listen request back to the available list.  */
+            listen_ptr -> nx_tcp_listen_next =  ip_ptr -> nx_ip_tcp_available_listen_requests;
+            ip_ptr -> nx_ip_tcp_available_listen_requests =  listen_ptr;
 
 #ifdef NX_ENABLE_TCPIP_OFFLOAD
-                _nx_tcp_server_socket_driver_unlisten(ip_ptr, socket_ptr, port);
+            _nx_tcp_server_socket_driver_unlisten(ip_ptr, socket_ptr, port);
 #endif /* NX_ENABLE_TCPIP_OFFLOAD */
 
-                /* Release the protection.  */
-                tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+            /* Release the protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
-                /* Return success!  */
-                return(NX_SUCCESS);
-            }
+            /* Return success!  */
+            return(NX_SUCCESS);
+        }
 
-            /* Move to the next listen request.  */
-            listen_ptr =  listen_ptr -> nx_tcp_listen_next;
-        } while (listen_ptr != ip_ptr -> nx_ip_tcp_active_listen_requests);
+        /* Move to the next listen request of this hash entry.  */
+        hash_ptr =  &(listen_ptr -> nx_tcp_listen_hash_next);
     }
 
     /* Unsuccessful listen request, release the protection.  */
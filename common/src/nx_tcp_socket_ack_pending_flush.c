@@ -0,0 +1,114 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_ack_pending_flush                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends the ACKs held while the IP helper thread        */
+/*    processed a batch of received packets. One ACK is sent for each     */
+/*    socket on the list, unless the ACK has already been sent with data  */
+/*    or with another segment in the meantime.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_packet_send_ack               Send ACK                      */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_thread_entry                   IP helper thread              */
+/*    _nx_tcp_queue_process                 Process TCP packet queue      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_ack_pending_flush(NX_IP *ip_ptr)
+{
+
+NX_TCP_SOCKET *socket_ptr;
+
+
+    /* Loop through the sockets with an ACK pending.  */
+    while (ip_ptr -> nx_ip_tcp_ack_pending_head)
+    {
+
+        /* Remove the first socket from the list.  */
+        socket_ptr =  ip_ptr -> nx_ip_tcp_ack_pending_head;
+        ip_ptr -> nx_ip_tcp_ack_pending_head =  socket_ptr -> nx_tcp_socket_ack_pending_next;
+        socket_ptr -> nx_tcp_socket_ack_pending_next =  NX_NULL;
+        socket_ptr -> nx_tcp_socket_ack_pending =  NX_FALSE;
+
+        /* Determine if the connection is still open and the received data or the window
+           update is not acknowledged yet.  */
+        if ((socket_ptr -> nx_tcp_socket_state >= NX_TCP_ESTABLISHED) &&
+            ((socket_ptr -> nx_tcp_socket_rx_sequence != socket_ptr -> nx_tcp_socket_rx_sequence_acked) ||
+             (socket_ptr -> nx_tcp_socket_rx_window_last_sent < socket_ptr -> nx_tcp_socket_rx_window_current)))
+        {
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+            /* Bring the socket timeouts up to date before they are changed.  */
+            _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
+            /* Send one ACK for all the packets received.  */
+            _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+            /* Schedule the socket timeouts on the timer wheel.  */
+            _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+        }
+    }
+}
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
@@ -0,0 +1,109 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_ack_pending_remove                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the socket from the list of sockets with an   */
+/*    ACK held for the current batch of received packets, so the list     */
+/*    never refers to a socket that is closed or deleted.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to socket             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_client_socket_unbind          Client socket unbind          */
+/*    _nx_tcp_server_socket_unaccept        Server socket unaccept        */
+/*    _nx_tcp_socket_block_cleanup          Clean up socket               */
+/*    _nx_tcp_socket_delete                 Delete socket                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_ack_pending_remove(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_TCP_SOCKET **link_ptr;
+
+
+    /* Determine if the socket is on the pending ACK list.  */
+    if (!socket_ptr -> nx_tcp_socket_ack_pending)
+    {
+        return;
+    }
+
+    /* Search the list for the link to the socket.  */
+    link_ptr =  &((socket_ptr -> nx_tcp_socket_ip_ptr) -> nx_ip_tcp_ack_pending_head);
+    while (*link_ptr)
+    {
+
+        /* Determine if this is the socket.  */
+        if (*link_ptr == socket_ptr)
+        {
+
+            /* Yes, unlink the socket.  */
+            *link_ptr =  socket_ptr -> nx_tcp_socket_ack_pending_next;
+            break;
+        }
+
+        /* Move to the next socket.  */
+        link_ptr =  &((*link_ptr) -> nx_tcp_socket_ack_pending_next);
+    }
+
+    /* The socket is no longer on the list.  */
+    socket_ptr -> nx_tcp_socket_ack_pending_next =  NX_NULL;
+    socket_ptr -> nx_tcp_socket_ack_pending =  NX_FALSE;
+}
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
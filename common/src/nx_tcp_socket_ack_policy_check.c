@@ -0,0 +1,123 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_ack_policy_check                     PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies the ACK policy of the socket to in-sequence   */
+/*    data just received, and determines if an ACK is sent right away.    */
+/*    The quick-ACK mode is entered after an idle period longer than the  */
+/*    retransmission timeout, unless the connection is interactive.       */
+/*    Otherwise an ACK is sent once the data not yet acknowledged reaches */
+/*    the configured number of full size segments.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               Send an ACK now               */
+/*    NX_FALSE                              Delay the ACK                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_data_check       Socket state data processing  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_ack_policy_check(NX_TCP_SOCKET *socket_ptr)
+{
+
+ULONG current_time;
+ULONG unacked_bytes;
+
+
+    /* Pickup the current time.  */
+    current_time =  tx_time_get();
+
+    /* Determine if the connection has been idle for longer than the retransmission timeout.  */
+    if ((!socket_ptr -> nx_tcp_socket_ack_interactive) &&
+        ((current_time - socket_ptr -> nx_tcp_socket_ack_receive_time) > socket_ptr -> nx_tcp_socket_timeout_rate))
+    {
+
+        /* Yes, the sender restarts from a small congestion window.  Enter the quick-ACK mode
+           so that the window opens without waiting for the delayed ACKs.  */
+        socket_ptr -> nx_tcp_socket_quick_ack_count =  socket_ptr -> nx_tcp_socket_quick_ack_segments;
+    }
+
+    /* Remember when the data is received.  */
+    socket_ptr -> nx_tcp_socket_ack_receive_time =  current_time;
+
+    /* Determine if the socket is in the quick-ACK mode.  */
+    if (socket_ptr -> nx_tcp_socket_quick_ack_count)
+    {
+
+        /* Yes, acknowledge the data now.  */
+        socket_ptr -> nx_tcp_socket_quick_ack_count--;
+        return(NX_TRUE);
+    }
+
+    /* Calculate the data not acknowledged yet.  The count restarts whenever an ACK is sent,
+       including the ACKs sent with data.  */
+    unacked_bytes =  socket_ptr -> nx_tcp_socket_rx_sequence - socket_ptr -> nx_tcp_socket_rx_sequence_acked;
+
+    /* Determine if enough full size segments are received.  */
+    if (unacked_bytes >= (socket_ptr -> nx_tcp_socket_ack_segments * socket_ptr -> nx_tcp_socket_connect_mss))
+    {
+
+        /* Yes, acknowledge the data now.  */
+        return(NX_TRUE);
+    }
+
+    /* Leave the ACK to the following data or to the delayed ACK timer.  */
+    return(NX_FALSE);
+}
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
@@ -0,0 +1,115 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_ack_policy_set                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the ACK policy of the socket. In-sequence data is*/
+/*    acknowledged once ack_segments full size segments are not yet       */
+/*    acknowledged. After an idle period or out-of-order data, the next   */
+/*    quick_ack_segments data segments are acknowledged immediately.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*    ack_segments                          Full size segments per ACK    */
+/*    quick_ack_segments                    Segments acknowledged         */
+/*                                            immediately, zero disables  */
+/*                                            the quick-ACK mode          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_ack_policy_set(NX_TCP_SOCKET *socket_ptr, UINT ack_segments, UINT quick_ack_segments)
+{
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+NX_IP *ip_ptr;
+
+
+    /* Setup IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SOCKET_ACK_POLICY_SET, socket_ptr, ack_segments, quick_ack_segments, 0, NX_TRACE_TCP_EVENTS, 0, 0);
+
+    /* Get mutex protection.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Setup the ACK policy.  */
+    socket_ptr -> nx_tcp_socket_ack_segments =        ack_segments;
+    socket_ptr -> nx_tcp_socket_quick_ack_segments =  quick_ack_segments;
+
+    /* Limit the segments left in the quick-ACK mode to the new value.  */
+    if (socket_ptr -> nx_tcp_socket_quick_ack_count > quick_ack_segments)
+    {
+        socket_ptr -> nx_tcp_socket_quick_ack_count =  quick_ack_segments;
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_TCP_ACK_POLICY */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(ack_segments);
+    NX_PARAMETER_NOT_USED(quick_ack_segments);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+}
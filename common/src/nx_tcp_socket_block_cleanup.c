@@ -27,6 +27,7 @@
 
 #include "nx_api.h"
 #include "nx_tcp.h"
+#include "nx_packet.h"
 #include "nx_ipv6.h"
 #ifdef NX_ENABLE_HTTP_PROXY
 #include "nx_http_proxy_client.h"
@@ -57,6 +58,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_http_proxy_client_cleanup         Clean up HTTP Proxy           */
+/*    _nx_packet_release                    Release initial data          */
+/*    _nx_tcp_socket_ack_pending_remove     Remove socket from ACK list   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -106,6 +109,54 @@ VOID  _nx_tcp_socket_block_cleanup(NX_TCP_SOCKET *socket_ptr)
     /* Reset fast recovery stage. */
     socket_ptr -> nx_tcp_socket_fast_recovery = NX_FALSE;
 
+#ifdef NX_ENABLE_TCP_SACK
+    /* Reset the SACK state, it is negotiated again by the next connection.  */
+    socket_ptr -> nx_tcp_socket_sack_permitted = NX_FALSE;
+    socket_ptr -> nx_tcp_socket_sack_scoreboard_count = 0;
+#endif /* NX_ENABLE_TCP_SACK */
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+    /* Discard the round trip time measurement of the connection.  */
+    socket_ptr -> nx_tcp_socket_rtt_timing = NX_FALSE;
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Reset the timestamps and the measured round trip time, and return to the configured
+       retransmission timeout.  */
+    socket_ptr -> nx_tcp_socket_timestamp_permitted = NX_FALSE;
+    socket_ptr -> nx_tcp_socket_timestamp_recent = 0;
+    socket_ptr -> nx_tcp_socket_timestamp_recent_time = 0;
+    socket_ptr -> nx_tcp_socket_timestamp_echo = 0;
+    socket_ptr -> nx_tcp_socket_rtt_smoothed = 0;
+    socket_ptr -> nx_tcp_socket_rtt_variance = 0;
+    socket_ptr -> nx_tcp_socket_rto = 0;
+    socket_ptr -> nx_tcp_socket_timeout_rate = socket_ptr -> nx_tcp_socket_timeout_rate_initial;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_PACING
+    /* Reset the pacing credit and the measured round trip time.  The pacing rate set by the
+       application is kept.  */
+    socket_ptr -> nx_tcp_socket_pacing_credit = 0;
+    socket_ptr -> nx_tcp_socket_pacing_rtt = 0;
+    socket_ptr -> nx_tcp_socket_pacing_waiting = NX_FALSE;
+#endif /* NX_ENABLE_TCP_PACING */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Release the initial data of a connection that was not established.  */
+    if (socket_ptr -> nx_tcp_socket_fast_open_packet)
+    {
+        _nx_packet_release(socket_ptr -> nx_tcp_socket_fast_open_packet);
+        socket_ptr -> nx_tcp_socket_fast_open_packet = NX_NULL;
+    }
+    socket_ptr -> nx_tcp_socket_fast_open_length = 0;
+    socket_ptr -> nx_tcp_socket_fast_open_option = NX_FALSE;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Drop the ACK held for the connection.  */
+    _nx_tcp_socket_ack_pending_remove(socket_ptr);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
     /* Connection needs to be closed down immediately.  */
     if (socket_ptr -> nx_tcp_socket_client_type)
     {
@@ -0,0 +1,115 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_congestion_control_set               PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the congestion control module of the socket. If  */
+/*    the connection is established, the module is initialized right      */
+/*    away and starts from the current congestion window. Otherwise the   */
+/*    module is initialized when the connection is established.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*    congestion_control                    Pointer to congestion control */
+/*                                            module                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (nx_tcp_congestion_control_initialize)                              */
+/*                                          Initialize congestion control */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_congestion_control_set(NX_TCP_SOCKET *socket_ptr, const NX_TCP_CONGESTION_CONTROL *congestion_control)
+{
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+NX_IP *ip_ptr;
+
+
+    /* Setup IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SOCKET_CONGESTION_CONTROL_SET, socket_ptr, congestion_control, socket_ptr -> nx_tcp_socket_state, 0, NX_TRACE_TCP_EVENTS, 0, 0);
+
+    /* Get mutex protection.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Setup the congestion control module.  */
+    socket_ptr -> nx_tcp_socket_congestion_control =  congestion_control;
+
+    /* Determine if the connection is established.  */
+    if (socket_ptr -> nx_tcp_socket_state >= NX_TCP_ESTABLISHED)
+    {
+
+        /* Yes, initialize the module for the connection now.  */
+        congestion_control -> nx_tcp_congestion_control_initialize(socket_ptr);
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_TCP_CONGESTION_CONTROL */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(congestion_control);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+}
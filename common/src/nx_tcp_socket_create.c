@@ -135,6 +135,9 @@ NX_TCP_SOCKET *tail_ptr;
 
     /* Setup the default transmit timeout.  */
     socket_ptr -> nx_tcp_socket_timeout_rate =         _nx_tcp_transmit_timer_rate;
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    socket_ptr -> nx_tcp_socket_timeout_rate_initial = _nx_tcp_transmit_timer_rate;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
     socket_ptr -> nx_tcp_socket_timeout_max_retries =  NX_TCP_MAXIMUM_RETRIES;
     socket_ptr -> nx_tcp_socket_timeout_shift =        NX_TCP_RETRY_SHIFT;
 
@@ -156,14 +159,33 @@ NX_TCP_SOCKET *tail_ptr;
     /* Setup the sliding window information.  */
     socket_ptr -> nx_tcp_socket_rx_window_default =   window_size;
     socket_ptr -> nx_tcp_socket_rx_window_current =   window_size;
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+    /* Record the initial window, autotuning is off until the maximum window is set.  */
+    socket_ptr -> nx_tcp_socket_rx_autotune_initial = window_size;
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
     socket_ptr -> nx_tcp_socket_tx_outstanding_bytes = 0;
     socket_ptr -> nx_tcp_socket_tx_window_advertised = 0;
     socket_ptr -> nx_tcp_socket_tx_window_congestion = 0;
 
+    /* Use the NewReno congestion control by default.  */
+    socket_ptr -> nx_tcp_socket_congestion_control = &nx_tcp_congestion_control_newreno;
+
 
     /* Initialize the ack_n_packet counter. */
     socket_ptr -> nx_tcp_socket_ack_n_packet_counter = 1;
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Setup the default ACK policy.  */
+    socket_ptr -> nx_tcp_socket_ack_segments =       NX_TCP_ACK_SEGMENTS;
+    socket_ptr -> nx_tcp_socket_quick_ack_segments = NX_TCP_QUICK_ACK_SEGMENTS;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
+#ifdef NX_ENABLE_TCP_PACING
+    /* Setup the default pacing rate.  */
+    socket_ptr -> nx_tcp_socket_pacing_rate =        NX_TCP_PACING_RATE_DEFAULT;
+#endif /* NX_ENABLE_TCP_PACING */
+
     /* Save the application callback routines.  */
     socket_ptr -> nx_tcp_urgent_data_callback = tcp_urgent_data_callback;
     socket_ptr -> nx_tcp_disconnect_callback =  tcp_disconnect_callback;
@@ -178,6 +200,14 @@ NX_TCP_SOCKET *tail_ptr;
 
 #endif
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Setup the timers of the socket on the timer wheels.  */
+    socket_ptr -> nx_tcp_socket_fast_timer.nx_tcp_timer_socket =  socket_ptr;
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    socket_ptr -> nx_tcp_socket_keepalive_timer.nx_tcp_timer_socket =  socket_ptr;
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_STATE_CHANGE, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, NX_TCP_CLOSED, NX_TRACE_INTERNAL_EVENTS, 0, 0);
 
@@ -54,6 +54,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_tcp_socket_ack_pending_remove     Remove socket from ACK list   */
+/*    _nx_tcp_timer_wheel_remove            Remove timer from wheel       */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*                                                                        */
@@ -111,6 +113,19 @@ NX_IP *ip_ptr;
         return(NX_STILL_BOUND);
     }
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+    /* Make sure the socket is not on the pending ACK list.  */
+    _nx_tcp_socket_ack_pending_remove(socket_ptr);
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Remove the timers of the socket from the timer wheels.  */
+    _nx_tcp_timer_wheel_remove(&(socket_ptr -> nx_tcp_socket_fast_timer));
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    _nx_tcp_timer_wheel_remove(&(socket_ptr -> nx_tcp_socket_keepalive_timer));
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
     /* Disable interrupts.  */
     TX_DISABLE
 
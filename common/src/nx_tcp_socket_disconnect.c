@@ -66,6 +66,8 @@
 /*    _nx_tcp_socket_thread_suspend         Suspend calling thread        */
 /*    _nx_tcp_socket_transmit_queue_flush   Release all transmit packets  */
 /*    _nx_tcp_socket_block_cleanup          Cleanup the socket block      */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
 /*    tx_mutex_get                          Get protection                */
 /*    tx_mutex_put                          Release protection            */
 /*                                                                        */
@@ -128,6 +130,11 @@ NX_IP        *ip_ptr;
         return(NX_NOT_CONNECTED);
     }
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Bring the socket timeouts up to date before they are changed.  */
+    _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
 #ifdef NX_ENABLE_TCP_KEEPALIVE
     /* Clear the TCP Keepalive timer to disable it for this socket (only needed when
        the socket is connected.  */
@@ -306,6 +313,11 @@ NX_IP        *ip_ptr;
         _nx_tcp_packet_send_fin(socket_ptr, (socket_ptr -> nx_tcp_socket_tx_sequence - 1));
     }
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Schedule the socket timeouts on the timer wheel.  */
+    _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
     /* Optionally suspend the thread.  If timeout occurs, return a disconnect timeout status.  If
        immediate response is selected, return a disconnect in progress status.  Only on a real
        disconnect should success be returned.  */
@@ -0,0 +1,135 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_fast_open_receive                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function validates the Fast Open cookie a client      */
+/*    presented in its SYN and, if it is valid, queues the data of the    */
+/*    SYN on the receive queue of the server socket.  The thread          */
+/*    suspended in the accept call is resumed right away so the           */
+/*    application can read the data before the handshake completes.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to server socket      */
+/*    packet_ptr                            Pointer to SYN packet         */
+/*    cookie                                Cookie of the client          */
+/*    cookie_length                         Length of cookie              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               Packet is queued              */
+/*    NX_FALSE                              Packet is not queued          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_fast_open_cookie_generate     Generate cookie of client     */
+/*    _nx_tcp_socket_state_data_check       Queue data of the SYN         */
+/*    _nx_tcp_socket_thread_resume          Resume accept thread          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_fast_open_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, UCHAR *cookie, UINT cookie_length)
+{
+
+NX_TCP_HEADER *tcp_header_ptr;
+UCHAR          expected_cookie[NX_TCP_FAST_OPEN_COOKIE_SIZE];
+ULONG          header_length;
+
+
+    /* Only the cookies of this server are accepted.  */
+    if (cookie_length != NX_TCP_FAST_OPEN_COOKIE_SIZE)
+    {
+        return(NX_FALSE);
+    }
+
+    _nx_tcp_fast_open_cookie_generate(socket_ptr -> nx_tcp_socket_ip_ptr, &(socket_ptr -> nx_tcp_socket_connect_ip), expected_cookie);
+
+    if (memcmp(cookie, expected_cookie, NX_TCP_FAST_OPEN_COOKIE_SIZE) != 0)
+    {
+
+        /* Invalid cookie, the data is dropped and acknowledged by the regular handshake.  */
+        return(NX_FALSE);
+    }
+
+    /* Setup a pointer to the TCP header of the SYN.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    tcp_header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+    /* Determine if the SYN carries any data.  */
+    header_length =  (tcp_header_ptr -> nx_tcp_header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+    if (packet_ptr -> nx_packet_length <= header_length)
+    {
+        return(NX_FALSE);
+    }
+
+    /* The data follows the sequence number consumed by the SYN.  Present the segment
+       as a regular data segment to the receive logic.  */
+    tcp_header_ptr -> nx_tcp_sequence_number++;
+    tcp_header_ptr -> nx_tcp_header_word_3 &=  ~((ULONG)(NX_TCP_SYN_BIT | NX_TCP_FIN_BIT));
+
+    /* Queue the data, advancing the receive sequence past it.  */
+    if (_nx_tcp_socket_state_data_check(socket_ptr, packet_ptr) == NX_FALSE)
+    {
+        return(NX_FALSE);
+    }
+
+    /* Resume the thread suspended in the accept call, the data is ready to be received.  */
+    if (socket_ptr -> nx_tcp_socket_connect_suspended_thread)
+    {
+        _nx_tcp_socket_thread_resume(&(socket_ptr -> nx_tcp_socket_connect_suspended_thread), NX_SUCCESS);
+    }
+
+    /* Return true since the packet was queued.  */
+    return(NX_TRUE);
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
@@ -0,0 +1,117 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_fast_open_send                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function sends the initial data of a Fast Open        */
+/*    connection once it is established.  The data the server already    */
+/*    acknowledged in its SYN+ACK is removed first, the rest is sent as   */
+/*    regular data.  The data the transmit window cannot take yet stays   */
+/*    on the socket and is sent by later calls as the window opens.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to client socket      */
+/*    acked_length                          Data acknowledged by SYN+ACK, */
+/*                                            zero on later calls         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release the packet            */
+/*    _nx_tcp_socket_send                   Send the remaining data       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_syn_sent         Process SYN SENT state        */
+/*    _nx_tcp_socket_state_syn_received     Process SYN RECEIVED state    */
+/*    _nx_tcp_socket_state_transmit_check   Check for transmit window     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_fast_open_send(NX_TCP_SOCKET *socket_ptr, ULONG acked_length)
+{
+
+NX_PACKET *packet_ptr;
+
+
+    /* Pickup the initial data of the connection.  */
+    packet_ptr =  socket_ptr -> nx_tcp_socket_fast_open_packet;
+    socket_ptr -> nx_tcp_socket_fast_open_packet =  NX_NULL;
+    socket_ptr -> nx_tcp_socket_fast_open_length =  0;
+    socket_ptr -> nx_tcp_socket_fast_open_option =  NX_FALSE;
+
+    if (packet_ptr == NX_NULL)
+    {
+        return;
+    }
+
+    /* Remove the data acknowledged by the SYN+ACK, it was taken from the first buffer.  */
+    packet_ptr -> nx_packet_prepend_ptr +=  acked_length;
+    packet_ptr -> nx_packet_length -=  acked_length;
+
+    if (packet_ptr -> nx_packet_length == 0)
+    {
+
+        /* All the data was carried by the SYN.  */
+        _nx_packet_release(packet_ptr);
+        return;
+    }
+
+    /* Send as much of the rest of the data as the transmit window allows.  The IP thread
+       cannot wait, the data left is kept on the socket until the window opens.  */
+    if (_nx_tcp_socket_send(socket_ptr, packet_ptr, NX_NO_WAIT))
+    {
+        socket_ptr -> nx_tcp_socket_fast_open_packet =  packet_ptr;
+    }
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
@@ -0,0 +1,218 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_PACING
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_pacing_check                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function determines if the pacing of the socket allows data   */
+/*    to be sent now. The pacing credit grows at the pacing rate since it */
+/*    was last updated, up to the burst size. Data may be sent while the  */
+/*    credit is above zero. Otherwise the socket waits for the pacing     */
+/*    timer, which is armed for the tick the credit gets above zero.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               Data may be sent              */
+/*    NX_FALSE                              Data is held back             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get current time              */
+/*    tx_timer_activate                     Activate pacing timer         */
+/*    tx_timer_change                       Change pacing timer           */
+/*    tx_timer_deactivate                   Deactivate pacing timer       */
+/*    (nx_tcp_congestion_control_window_get)                              */
+/*                                          Get congestion window         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_pacing_process                Release paced sockets         */
+/*    _nx_tcp_socket_send_internal          Send data on the socket       */
+/*    _nx_tcp_socket_state_transmit_check   Resume suspended senders      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_pacing_check(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_IP  *ip_ptr;
+ULONG   pacing_rate;
+ULONG   tx_window_congestion;
+ULONG   round_trip_time;
+ULONG   gain;
+ULONG   current_time;
+ULONG   expiration;
+ULONG   ticks;
+LONG    burst;
+ULONG64 value;
+
+
+    /* Pickup the pacing rate of the socket.  */
+    pacing_rate =  socket_ptr -> nx_tcp_socket_pacing_rate;
+
+    /* Determine if the socket is paced.  */
+    if (pacing_rate == 0)
+    {
+        return(NX_TRUE);
+    }
+
+    /* Determine if the pacing rate is derived from the congestion window.  */
+    if (pacing_rate == NX_TCP_PACING_RATE_AUTO)
+    {
+
+        /* Pickup the smoothed round trip time in microseconds.  */
+        round_trip_time =  socket_ptr -> nx_tcp_socket_pacing_rtt * (1000000 / NX_IP_PERIODIC_RATE);
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+        /* The round trip time measured from the timestamps is finer than one timer tick.  */
+        if (socket_ptr -> nx_tcp_socket_rtt_smoothed)
+        {
+            round_trip_time =  socket_ptr -> nx_tcp_socket_rtt_smoothed;
+        }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+        /* Data is not paced until the round trip time is measured.  */
+        if (round_trip_time == 0)
+        {
+            return(NX_TRUE);
+        }
+
+        /* Pick up the congestion window from the congestion control module.  */
+        tx_window_congestion =  socket_ptr -> nx_tcp_socket_congestion_control -> nx_tcp_congestion_control_window_get(socket_ptr);
+
+        /* Pace faster in slow start so the congestion window can double each round trip.  */
+        if (tx_window_congestion < socket_ptr -> nx_tcp_socket_tx_slow_start_threshold)
+        {
+            gain =  NX_TCP_PACING_SLOW_START_GAIN;
+        }
+        else
+        {
+            gain =  NX_TCP_PACING_GAIN;
+        }
+
+        /* Compute the rate in bytes per second, the gain is in percent.  */
+        value =  ((ULONG64)tx_window_congestion * gain * 10000) / round_trip_time;
+        if (value >= NX_TCP_PACING_RATE_AUTO)
+        {
+            return(NX_TRUE);
+        }
+        pacing_rate =  (ULONG)value;
+        if (pacing_rate == 0)
+        {
+            pacing_rate =  1;
+        }
+    }
+
+    /* Allow a burst of a few segments, or of the data of one timer tick.  */
+    burst =  (LONG)(NX_TCP_PACING_BURST_SEGMENTS * socket_ptr -> nx_tcp_socket_connect_mss);
+    if (burst < (LONG)(pacing_rate / NX_IP_PERIODIC_RATE))
+    {
+        burst =  (LONG)(pacing_rate / NX_IP_PERIODIC_RATE);
+    }
+
+    /* Add the credit earned since the last update.  */
+    current_time =  tx_time_get();
+    value =  ((ULONG64)pacing_rate * (current_time - socket_ptr -> nx_tcp_socket_pacing_time)) / NX_IP_PERIODIC_RATE;
+    socket_ptr -> nx_tcp_socket_pacing_time =  current_time;
+
+    if ((socket_ptr -> nx_tcp_socket_pacing_credit >= burst) ||
+        (value >= (ULONG64)(burst - socket_ptr -> nx_tcp_socket_pacing_credit)))
+    {
+        socket_ptr -> nx_tcp_socket_pacing_credit =  burst;
+    }
+    else
+    {
+        socket_ptr -> nx_tcp_socket_pacing_credit +=  (LONG)value;
+    }
+
+    /* Determine if data may be sent.  */
+    if (socket_ptr -> nx_tcp_socket_pacing_credit > 0)
+    {
+        return(NX_TRUE);
+    }
+
+    /* Compute the ticks until the credit gets above zero.  */
+    value =  (((ULONG64)(1 - socket_ptr -> nx_tcp_socket_pacing_credit) * NX_IP_PERIODIC_RATE) + (pacing_rate - 1)) / pacing_rate;
+    if (value == 0)
+    {
+        ticks =  1;
+    }
+    else if (value > NX_IP_PERIODIC_RATE)
+    {
+
+        /* Check the credit again at least once a second, the derived rate may change.  */
+        ticks =  NX_IP_PERIODIC_RATE;
+    }
+    else
+    {
+        ticks =  (ULONG)value;
+    }
+
+    /* Wait for the pacing timer.  */
+    socket_ptr -> nx_tcp_socket_pacing_waiting =  NX_TRUE;
+
+    /* Arm the pacing timer of the IP instance if it is not armed to expire before.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+    expiration =  current_time + ticks;
+    if ((ip_ptr -> nx_ip_tcp_pacing_timer_armed == NX_FALSE) ||
+        ((LONG)(expiration - ip_ptr -> nx_ip_tcp_pacing_expiration) < 0))
+    {
+        tx_timer_deactivate(&(ip_ptr -> nx_ip_tcp_pacing_timer));
+        tx_timer_change(&(ip_ptr -> nx_ip_tcp_pacing_timer), ticks, 0);
+        tx_timer_activate(&(ip_ptr -> nx_ip_tcp_pacing_timer));
+
+        ip_ptr -> nx_ip_tcp_pacing_timer_armed =  NX_TRUE;
+        ip_ptr -> nx_ip_tcp_pacing_expiration =  expiration;
+    }
+
+    return(NX_FALSE);
+}
+#endif /* NX_ENABLE_TCP_PACING */
@@ -0,0 +1,117 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_pacing_set                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the pacing rate of the socket. Data of a paced   */
+/*    socket is sent at the rate in bytes per second instead of in bursts */
+/*    of the congestion window. NX_TCP_PACING_RATE_AUTO derives the rate  */
+/*    from the congestion window and the smoothed round trip time, zero   */
+/*    disables pacing.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*    pacing_rate                           Pacing rate in bytes per      */
+/*                                            second                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_socket_state_transmit_check   Resume suspended senders      */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_pacing_set(NX_TCP_SOCKET *socket_ptr, ULONG pacing_rate)
+{
+#ifdef NX_ENABLE_TCP_PACING
+NX_IP *ip_ptr;
+
+
+    /* Setup IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SOCKET_PACING_SET, socket_ptr, pacing_rate, 0, 0, NX_TRACE_TCP_EVENTS, 0, 0);
+
+    /* Get mutex protection.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Setup the pacing rate.  */
+    socket_ptr -> nx_tcp_socket_pacing_rate =  pacing_rate;
+
+    /* Determine if data of the socket is held back at the old rate.  */
+    if (socket_ptr -> nx_tcp_socket_pacing_waiting)
+    {
+
+        /* Yes, check the suspended senders again at the new rate.  */
+        socket_ptr -> nx_tcp_socket_pacing_waiting =  NX_FALSE;
+        _nx_tcp_socket_state_transmit_check(socket_ptr);
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_TCP_PACING */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(pacing_rate);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_TCP_PACING */
+}
@@ -62,6 +62,7 @@
 /*                                                                        */
 /*    _nx_packet_release                    Packet release function       */
 /*    _nx_tcp_socket_connection_reset       Reset connection              */
+/*    _nx_tcp_socket_sack_update            Update SACK scoreboard        */
 /*    _nx_tcp_socket_state_ack_check        Process received ACKs         */
 /*    _nx_tcp_socket_state_closing          Process CLOSING state         */
 /*    _nx_tcp_socket_state_data_check       Process received data         */
@@ -72,6 +73,7 @@
 /*    _nx_tcp_socket_state_syn_received     Process SYN RECEIVED state    */
 /*    _nx_tcp_socket_state_syn_sent         Process SYN SENT state        */
 /*    _nx_tcp_socket_state_transmit_check   Check for transmit ability    */
+/*    _nx_tcp_socket_timestamp_check        Check timestamps of segment   */
 /*    (nx_tcp_urgent_data_callback)         Application urgent callback   */
 /*                                            function                    */
 /*    _nx_http_proxy_client_connect_response_process                      */
@@ -209,6 +211,16 @@ ULONG         tcpip_offload;
             }
         }
 
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+        /* Protection Against Wrapped Sequences.  A segment with an old timestamp is
+           treated as a segment outside the window.  RFC 7323, Section 5.3.  */
+        if ((outside_of_window == NX_FALSE) && (socket_ptr -> nx_tcp_socket_timestamp_permitted) &&
+            (_nx_tcp_socket_timestamp_check(socket_ptr, packet_ptr) == NX_FALSE))
+        {
+            outside_of_window = NX_TRUE;
+        }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
         /* Detect whether or not the data is outside the window.  */
         if (outside_of_window)
         {
@@ -286,6 +298,17 @@ ULONG         tcpip_offload;
         if (socket_ptr -> nx_tcp_socket_state != NX_TCP_SYN_RECEIVED)
         {
 
+#ifdef NX_ENABLE_TCP_SACK
+            /* Update the scoreboard with the SACK option of the ACK.  The option is read from
+               the packet, since the header copy does not include the options.  */
+            if ((socket_ptr -> nx_tcp_socket_sack_permitted) &&
+                (tcp_header_copy.nx_tcp_header_word_3 & NX_TCP_ACK_BIT))
+            {
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                _nx_tcp_socket_sack_update(socket_ptr, (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr);
+            }
+#endif /* NX_ENABLE_TCP_SACK */
+
             /* Check the ACK field.  */
             if (_nx_tcp_socket_state_ack_check(socket_ptr, &tcp_header_copy) == NX_FALSE)
             {
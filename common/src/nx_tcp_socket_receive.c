@@ -63,6 +63,8 @@
 /*                                                                        */
 /*    _nx_tcp_packet_send_ack               Send ACK message              */
 /*    _nx_tcp_socket_thread_suspend         Suspend calling thread        */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -201,6 +203,11 @@ ULONG                  trace_timestamp;
         /* Place the packet pointer in the return pointer.  */
         *packet_ptr =  head_packet_ptr;
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+        /* Bring the socket timeouts up to date before the receive window is changed.  */
+        _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
         /* Check the receive queue count.  */
         if (socket_ptr -> nx_tcp_socket_receive_queue_count == 0)
         {
@@ -215,6 +222,11 @@ ULONG                  trace_timestamp;
             socket_ptr -> nx_tcp_socket_rx_window_current += (*packet_ptr) -> nx_packet_length;
         }
 
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+        /* Tune the receive window from the data delivered to the application.  */
+        _nx_tcp_socket_window_autotune(socket_ptr, (*packet_ptr) -> nx_packet_length);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
         /* Determine if an ACK should be forced out for window update, SWS avoidance algorithm.
            RFC1122, Section4.2.3.3, Page97-98. */
         if (((socket_ptr -> nx_tcp_socket_rx_window_current - socket_ptr -> nx_tcp_socket_rx_window_last_sent) >= (socket_ptr -> nx_tcp_socket_rx_window_default / 2)) &&
@@ -225,6 +237,11 @@ ULONG                  trace_timestamp;
             _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
         }
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+        /* Schedule the socket timeouts on the timer wheel.  */
+        _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
 #ifdef TX_ENABLE_EVENT_TRACE
         /* Update the trace event with the status.  */
         NX_TRACE_EVENT_UPDATE(trace_event, trace_timestamp, NX_TRACE_TCP_SOCKET_RECEIVE, 0, *packet_ptr, (*packet_ptr) -> nx_packet_length, socket_ptr -> nx_tcp_socket_rx_sequence);
@@ -0,0 +1,343 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+#ifdef NX_IPSEC_ENABLE
+#include "nx_ipsec.h"
+#endif /* NX_IPSEC_ENABLE */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit_packet                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retransmits a TCP packet of the transmit queue. The   */
+/*    ACK number, the window size and the checksum of the packet are      */
+/*    updated before it is sent again.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    packet_ptr                            Pointer to packet to resend   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_checksum_compute               Calculate TCP checksum        */
+/*    _nx_ip_packet_send                    Resend the transmit packet    */
+/*    _nx_ipv6_packet_send                  Resend the transmit packet    */
+/*    _nx_tcp_timestamp_option_build        Build timestamps option       */
+/*    _nx_tcp_socket_segment_send           Send with segmentation        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_sack_retransmit        Retransmit SACK hole          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_retransmit_packet(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr)
+{
+
+ULONG          checksum;
+NX_TCP_HEADER *header_ptr;
+ULONG         *source_ip = NX_NULL, *dest_ip = NX_NULL;
+ULONG          original_acknowledgment_number;
+ULONG          original_header_word_3;
+ULONG          original_header_word_4;
+ULONG          window_size;
+#ifdef NX_ENABLE_TCP_SACK
+ULONG          sequence;
+#endif /* NX_ENABLE_TCP_SACK */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+ULONG         *option_ptr;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD)
+UINT           compute_checksum = 1;
+#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) */
+
+#ifdef NX_DISABLE_TCP_TX_CHECKSUM
+    compute_checksum = 0;
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+    /* The acknowledgment of retransmitted data is ambiguous, discard the round trip time
+       measurement.  Karn's algorithm, RFC 6298, Section 3.  */
+    socket_ptr -> nx_tcp_socket_rtt_timing = NX_FALSE;
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+#ifndef NX_DISABLE_IPV4
+    /* Is this an IPv4 connection? */
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+
+        packet_ptr -> nx_packet_ip_version = NX_IP_VERSION_V4;
+
+        /* Get the source and destination addresses. */
+        source_ip = &socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_ip_address;
+        dest_ip = &socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4;
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+
+        /* Set the packet for IPv6 connectivity. */
+        packet_ptr -> nx_packet_ip_version = NX_IP_VERSION_V6;
+
+        /* Get the source and destination addresses. */
+        source_ip = socket_ptr -> nx_tcp_socket_ipv6_addr -> nxd_ipv6_address;
+        dest_ip = socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Pick up the pointer to the head of the TCP packet.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+#ifdef NX_ENABLE_TCP_SACK
+    /* Record the highest sequence retransmitted.  */
+    sequence = header_ptr -> nx_tcp_sequence_number;
+    NX_CHANGE_ULONG_ENDIAN(sequence);
+    sequence += packet_ptr -> nx_packet_length - NX_TCP_SEGMENT_HEADER_SIZE(socket_ptr);
+    if ((INT)(sequence - socket_ptr -> nx_tcp_socket_sack_high_retransmit) > 0)
+    {
+        socket_ptr -> nx_tcp_socket_sack_high_retransmit = sequence;
+    }
+#endif /* NX_ENABLE_TCP_SACK */
+
+    /* Record the original data.  */
+    original_acknowledgment_number = header_ptr -> nx_tcp_acknowledgment_number;
+    original_header_word_3 = header_ptr -> nx_tcp_header_word_3;
+    original_header_word_4 = header_ptr -> nx_tcp_header_word_4;
+
+    /* Update the ACK number in the TCP header.  */
+    header_ptr -> nx_tcp_acknowledgment_number = socket_ptr -> nx_tcp_socket_rx_sequence;
+
+    /* Convert to network byte order for checksum */
+    NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_acknowledgment_number);
+
+    /* Set window size. */
+#ifdef NX_ENABLE_TCP_WINDOW_SCALING
+    window_size = socket_ptr -> nx_tcp_socket_rx_window_current >> socket_ptr -> nx_tcp_rcv_win_scale_value;
+
+    /* Make sure the window_size is less than 0xFFFF. */
+    if (window_size > 0xFFFF)
+    {
+        window_size = 0xFFFF;
+    }
+#else
+    window_size = socket_ptr -> nx_tcp_socket_rx_window_current;
+#endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+
+    header_ptr -> nx_tcp_header_word_3 =        ((NX_TCP_SEGMENT_HEADER_SIZE(socket_ptr) / sizeof(ULONG)) << NX_TCP_HEADER_SHIFT) |
+        NX_TCP_ACK_BIT | NX_TCP_PSH_BIT | window_size;
+
+    /* Swap the content to network byte order. */
+    NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_3);
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* Refresh the timestamps option of the segment.  */
+    if (socket_ptr -> nx_tcp_socket_timestamp_permitted)
+    {
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        option_ptr =  (ULONG *)(header_ptr + 1);
+        _nx_tcp_timestamp_option_build(socket_ptr, option_ptr);
+
+        /* Swap the option words to network byte order.  */
+        NX_CHANGE_ULONG_ENDIAN(option_ptr[0]);
+        NX_CHANGE_ULONG_ENDIAN(option_ptr[1]);
+        NX_CHANGE_ULONG_ENDIAN(option_ptr[2]);
+    }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+    /* Convert back to host byte order to so we can zero out the checksum. */
+    NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
+
+    /* Remember the last ACKed sequence and the last reported window size.  */
+    socket_ptr -> nx_tcp_socket_rx_sequence_acked =    socket_ptr -> nx_tcp_socket_rx_sequence;
+    socket_ptr -> nx_tcp_socket_rx_window_last_sent =  socket_ptr -> nx_tcp_socket_rx_window_current;
+
+    /* Zero out existing checksum before computing new one. */
+    header_ptr -> nx_tcp_header_word_4 = header_ptr -> nx_tcp_header_word_4 & 0x0000FFFF;
+
+    /* Convert back to network byte order to so we can do the checksum. */
+    NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
+
+
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    if (socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM)
+    {
+        compute_checksum = 0;
+    }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+#ifdef NX_IPSEC_ENABLE
+    if ((packet_ptr -> nx_packet_ipsec_sa_ptr != NX_NULL) &&
+        (((NX_IPSEC_SA *)(packet_ptr -> nx_packet_ipsec_sa_ptr)) -> nx_ipsec_sa_encryption_method != NX_CRYPTO_NONE))
+    {
+        compute_checksum = 1;
+    }
+#endif /* NX_IPSEC_ENABLE */
+
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+    if (packet_ptr -> nx_packet_tcp_segment_size)
+    {
+
+        /* The checksum is computed for each segment.  */
+        compute_checksum = 0;
+    }
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+
+#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD)
+    if (compute_checksum)
+#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) */
+    {
+        /* Calculate the TCP checksum without protection.  */
+        checksum =  _nx_ip_checksum_compute(packet_ptr, NX_PROTOCOL_TCP,
+                                            packet_ptr -> nx_packet_length,
+                                            source_ip, dest_ip);
+        checksum = ~checksum & NX_LOWER_16_MASK;
+
+        /* Convert back to host byte order */
+        NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
+
+        /* Move the checksum into header.  */
+        header_ptr -> nx_tcp_header_word_4 =  header_ptr -> nx_tcp_header_word_4 | (checksum << NX_SHIFT_BY_16);
+
+        /* Convert back to network byte order for transmit. */
+        NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
+    }
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    else
+    {
+        packet_ptr -> nx_packet_interface_capability_flag |= NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM;
+    }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+    /* Determine if the retransmitted packet is identical to the original packet.
+       RFC1122, Section3.2.1.5, Page32-33. RFC1122, Section4.2.2.15, Page90-91.  */
+    if ((header_ptr -> nx_tcp_acknowledgment_number == original_acknowledgment_number) &&
+        (header_ptr -> nx_tcp_header_word_3 == original_header_word_3) &&
+        (header_ptr -> nx_tcp_header_word_4 == original_header_word_4))
+    {
+
+        /* Yes, identical packet, update the identification flag.  */
+        packet_ptr -> nx_packet_identical_copy = NX_TRUE;
+    }
+
+
+#ifndef NX_DISABLE_TCP_INFO
+    /* Increment the TCP retransmit count.  */
+    ip_ptr -> nx_ip_tcp_retransmit_packets++;
+
+    /* Increment the TCP retransmit count for the socket.  */
+    socket_ptr -> nx_tcp_socket_retransmit_packets++;
+#endif
+
+#ifdef NX_ENABLE_VLAN
+    if (socket_ptr -> nx_tcp_socket_vlan_priority != NX_VLAN_PRIORITY_INVALID)
+    {
+        packet_ptr -> nx_packet_vlan_priority = socket_ptr -> nx_tcp_socket_vlan_priority;
+    }
+#endif /* NX_ENABLE_VLAN */
+        
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_RETRY, ip_ptr, socket_ptr, packet_ptr, socket_ptr -> nx_tcp_socket_timeout_retries, NX_TRACE_INTERNAL_EVENTS, 0, 0);
+
+    /* Clear the queue next pointer.  */
+    packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+    /* Yes, the driver has finished with the packet at the head of the
+       transmit sent list... so it can be sent again!  */
+
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+#ifdef FEATURE_NX_IPV6
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+
+        /* Set the packet transmit interface before sending. */
+        packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr = socket_ptr -> nx_tcp_socket_ipv6_addr;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Send the packet to the IP component, segmenting it when needed.  */
+    _nx_tcp_socket_segment_send(ip_ptr, socket_ptr, packet_ptr);
+#else
+#ifndef NX_DISABLE_IPV4
+    /* Is this an IPv4 connection? */
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        _nx_ip_packet_send(ip_ptr, packet_ptr,
+                           socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4,
+                           socket_ptr -> nx_tcp_socket_type_of_service,
+                           socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP,
+                           socket_ptr -> nx_tcp_socket_fragment_enable,
+                           socket_ptr -> nx_tcp_socket_next_hop_address);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+
+        /* Handle for an IPv6 connection. */
+        /* Set the packet transmit interface before sending. */
+        packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr = socket_ptr -> nx_tcp_socket_ipv6_addr;
+
+        _nx_ipv6_packet_send(ip_ptr, packet_ptr, NX_PROTOCOL_TCP,
+                             packet_ptr -> nx_packet_length, ip_ptr -> nx_ipv6_hop_limit,
+                             socket_ptr -> nx_tcp_socket_ipv6_addr -> nxd_ipv6_address,
+                             socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6);
+    }
+#endif /* FEATURE_NX_IPV6 */
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+}
@@ -0,0 +1,162 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_rtt_update                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function updates the smoothed round trip time and     */
+/*    its variance with a new sample, and computes the retransmission     */
+/*    timeout of the socket, RFC 6298. Since a sample is taken for every  */
+/*    acknowledgment, the gains are divided by the number of samples      */
+/*    expected per round trip, RFC 7323, Appendix G.                      */
+/*                                                                        */
+/*    The round trip time and the retransmission timeout are in           */
+/*    microseconds. The timeout is converted to timer ticks for the       */
+/*    retransmission timer.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    round_trip_time                       Round trip time sample in us  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_rtt_update(NX_TCP_SOCKET *socket_ptr, ULONG round_trip_time)
+{
+
+ULONG samples;
+ULONG deviation;
+ULONG rto;
+ULONG timeout_rate;
+
+
+    /* Determine if this is the first sample.  */
+    if (socket_ptr -> nx_tcp_socket_rto == 0)
+    {
+
+        /* SRTT = R, RTTVAR = R / 2.  */
+        socket_ptr -> nx_tcp_socket_rtt_smoothed =  round_trip_time;
+        socket_ptr -> nx_tcp_socket_rtt_variance =  round_trip_time >> 1;
+    }
+    else
+    {
+
+        /* Compute the number of samples expected in one round trip, one for every other segment.  */
+        samples =  1;
+        if (socket_ptr -> nx_tcp_socket_connect_mss)
+        {
+            samples =  (socket_ptr -> nx_tcp_socket_tx_outstanding_bytes + (socket_ptr -> nx_tcp_socket_connect_mss << 1) - 1) /
+                (socket_ptr -> nx_tcp_socket_connect_mss << 1);
+            if (samples == 0)
+            {
+                samples =  1;
+            }
+        }
+
+        /* RTTVAR = (1 - beta') * RTTVAR + beta' * |SRTT - R|, beta' = 1 / (4 * samples).  */
+        if (round_trip_time > socket_ptr -> nx_tcp_socket_rtt_smoothed)
+        {
+            deviation =  round_trip_time - socket_ptr -> nx_tcp_socket_rtt_smoothed;
+        }
+        else
+        {
+            deviation =  socket_ptr -> nx_tcp_socket_rtt_smoothed - round_trip_time;
+        }
+        socket_ptr -> nx_tcp_socket_rtt_variance =
+            (ULONG)((LONG)socket_ptr -> nx_tcp_socket_rtt_variance +
+                    ((LONG)deviation - (LONG)socket_ptr -> nx_tcp_socket_rtt_variance) / (LONG)(samples << 2));
+
+        /* SRTT = (1 - alpha') * SRTT + alpha' * R, alpha' = 1 / (8 * samples).  */
+        socket_ptr -> nx_tcp_socket_rtt_smoothed =
+            (ULONG)((LONG)socket_ptr -> nx_tcp_socket_rtt_smoothed +
+                    ((LONG)round_trip_time - (LONG)socket_ptr -> nx_tcp_socket_rtt_smoothed) / (LONG)(samples << 3));
+    }
+
+    /* RTO = SRTT + max (G, K * RTTVAR), K = 4.  */
+    if ((socket_ptr -> nx_tcp_socket_rtt_variance << 2) > NX_TCP_TIMESTAMP_GRANULARITY)
+    {
+        rto =  socket_ptr -> nx_tcp_socket_rtt_smoothed + (socket_ptr -> nx_tcp_socket_rtt_variance << 2);
+    }
+    else
+    {
+        rto =  socket_ptr -> nx_tcp_socket_rtt_smoothed + NX_TCP_TIMESTAMP_GRANULARITY;
+    }
+
+    /* Keep the timeout within the limits.  */
+    if (rto < NX_TCP_RTO_MIN)
+    {
+        rto =  NX_TCP_RTO_MIN;
+    }
+    else if (rto > NX_TCP_RTO_MAX)
+    {
+        rto =  NX_TCP_RTO_MAX;
+    }
+
+    socket_ptr -> nx_tcp_socket_rto =  rto;
+
+    /* Convert the timeout to timer ticks, rounded up.  */
+    timeout_rate =  (ULONG)(((ULONG64)rto * NX_IP_PERIODIC_RATE + 999999) / 1000000);
+    if (timeout_rate == 0)
+    {
+        timeout_rate =  1;
+    }
+
+    socket_ptr -> nx_tcp_socket_timeout_rate =  timeout_rate;
+}
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
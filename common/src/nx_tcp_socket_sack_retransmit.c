@@ -0,0 +1,180 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_SACK
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_sack_retransmit                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function retransmits the next hole in the SACK        */
+/*    scoreboard during the fast recovery. A hole is a transmitted        */
+/*    packet that is neither SACKed by the peer nor retransmitted         */
+/*    already, and is below the highest SACKed data, as described in RFC  */
+/*    6675, Section 4. Retransmitting one hole on each incoming ACK       */
+/*    allows several packets lost in one window to be recovered in one    */
+/*    round trip.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_TRUE                               A hole is retransmitted       */
+/*    NX_FALSE                              No hole is retransmitted      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit_packet      Retransmit a TCP packet       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_sack_retransmit(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_TCP_SACK_BLOCK *scoreboard;
+NX_PACKET         *packet_ptr;
+NX_TCP_HEADER     *header_ptr;
+ULONG              next_sequence;
+ULONG              highest_sequence;
+ULONG              packet_begin_sequence;
+ULONG              packet_end_sequence;
+UINT               count;
+UINT               i = 0;
+
+
+    /* Setup a pointer to the scoreboard.  */
+    scoreboard =  socket_ptr -> nx_tcp_socket_sack_scoreboard;
+    count =       socket_ptr -> nx_tcp_socket_sack_scoreboard_count;
+
+    /* Determine if the peer has SACKed any data.  */
+    if (count == 0)
+    {
+
+        /* No, there is no hole to retransmit.  */
+        return(NX_FALSE);
+    }
+
+    /* Pickup the end of the highest SACKed data.  */
+    highest_sequence =  scoreboard[count - 1].nx_tcp_sack_block_end;
+
+    /* Skip the data already retransmitted in this recovery.  */
+    next_sequence =  socket_ptr -> nx_tcp_socket_tx_sequence - socket_ptr -> nx_tcp_socket_tx_outstanding_bytes;
+    if ((INT)(socket_ptr -> nx_tcp_socket_sack_high_retransmit - next_sequence) > 0)
+    {
+        next_sequence =  socket_ptr -> nx_tcp_socket_sack_high_retransmit;
+    }
+
+    /* Loop through the transmit queue to find the next hole.  */
+    packet_ptr =  socket_ptr -> nx_tcp_socket_transmit_sent_head;
+
+    while (packet_ptr)
+    {
+
+        /* Determine if the packet has been released by the application I/O driver.  Packets
+           still held by the driver are skipped.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if (packet_ptr -> nx_packet_queue_next == (NX_PACKET *)NX_DRIVER_TX_DONE)
+        {
+
+            /* Pick up the pointer to the head of the TCP packet.  */
+            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+            header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+            /* Pickup the sequence numbers of the packet.  */
+            packet_begin_sequence =  header_ptr -> nx_tcp_sequence_number;
+            NX_CHANGE_ULONG_ENDIAN(packet_begin_sequence);
+            packet_end_sequence =  packet_begin_sequence + (packet_ptr -> nx_packet_length - NX_TCP_SEGMENT_HEADER_SIZE(socket_ptr));
+
+            /* Holes are only below the highest SACKed data.  */
+            if ((INT)(packet_begin_sequence - highest_sequence) >= 0)
+            {
+                break;
+            }
+
+            /* Determine if the packet has not been retransmitted yet.  */
+            if ((INT)(packet_end_sequence - next_sequence) > 0)
+            {
+
+                /* Find the first range ending after the begin of the packet.  */
+                while ((i < count) && ((INT)(scoreboard[i].nx_tcp_sack_block_end - packet_begin_sequence) <= 0))
+                {
+                    i++;
+                }
+
+                /* Determine if the packet is SACKed.  */
+                if ((i == count) ||
+                    ((INT)(scoreboard[i].nx_tcp_sack_block_begin - packet_begin_sequence) > 0) ||
+                    ((INT)(scoreboard[i].nx_tcp_sack_block_end - packet_end_sequence) < 0))
+                {
+
+                    /* No, retransmit the hole.  */
+                    _nx_tcp_socket_retransmit_packet(ip_ptr, socket_ptr, packet_ptr);
+
+                    return(NX_TRUE);
+                }
+            }
+        }
+
+        /* Move to the next packet.  */
+        packet_ptr =  packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next;
+
+        /* Determine if we are at the end of the queue.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if (packet_ptr == (NX_PACKET *)NX_PACKET_ENQUEUED)
+        {
+            packet_ptr =  NX_NULL;
+        }
+    }
+
+    /* No hole is found.  */
+    return(NX_FALSE);
+}
+#endif /* NX_ENABLE_TCP_SACK */
@@ -0,0 +1,236 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_SACK
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_sack_update                          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function updates the SACK scoreboard of the socket    */
+/*    with an incoming ACK. The ranges covered by the cumulative          */
+/*    acknowledgment are removed first. Then the blocks of the SACK       */
+/*    option, if any, are merged into the scoreboard. Blocks outside of   */
+/*    the outstanding data are ignored, as are blocks that do not fit in  */
+/*    a full scoreboard when they are above all of its ranges.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    tcp_header_ptr                        Pointer to packet header      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_packet_process         Process packet for socket     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_sack_update(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tcp_header_ptr)
+{
+
+NX_TCP_SACK_BLOCK *scoreboard;
+UCHAR             *option_ptr;
+ULONG              option_area_size;
+ULONG              option_length;
+ULONG              starting_tx_sequence;
+ULONG              begin_sequence;
+ULONG              end_sequence;
+UINT               count;
+UINT               i;
+UINT               j;
+
+
+    /* Setup a pointer to the scoreboard.  */
+    scoreboard =  socket_ptr -> nx_tcp_socket_sack_scoreboard;
+    count =       socket_ptr -> nx_tcp_socket_sack_scoreboard_count;
+
+    /* Pickup the first unacknowledged sequence, moved forward by the ACK if it is acceptable.  */
+    starting_tx_sequence =  socket_ptr -> nx_tcp_socket_tx_sequence - socket_ptr -> nx_tcp_socket_tx_outstanding_bytes;
+    if (((INT)(tcp_header_ptr -> nx_tcp_acknowledgment_number - starting_tx_sequence) > 0) &&
+        ((INT)(tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_tx_sequence) <= 0))
+    {
+        starting_tx_sequence =  tcp_header_ptr -> nx_tcp_acknowledgment_number;
+    }
+
+    /* Remove the ranges covered by the cumulative acknowledgment.  */
+    i = 0;
+    while ((i < count) && ((INT)(scoreboard[i].nx_tcp_sack_block_end - starting_tx_sequence) <= 0))
+    {
+        i++;
+    }
+    if (i)
+    {
+        count -= i;
+        memmove(&scoreboard[0], &scoreboard[i], count * sizeof(NX_TCP_SACK_BLOCK)); /* Use case of memmove is verified.  */
+    }
+
+    /* Trim the first range if it is partially acknowledged.  */
+    if ((count) && ((INT)(scoreboard[0].nx_tcp_sack_block_begin - starting_tx_sequence) < 0))
+    {
+        scoreboard[0].nx_tcp_sack_block_begin =  starting_tx_sequence;
+    }
+
+    /* Setup a pointer to the option area.  */
+    option_ptr =        (UCHAR *)tcp_header_ptr + sizeof(NX_TCP_HEADER);
+    option_area_size =  ((tcp_header_ptr -> nx_tcp_header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG)) - (ULONG)sizeof(NX_TCP_HEADER);
+
+    /* Loop through the option area looking for the SACK option.  */
+    while (option_area_size >= 2)
+    {
+
+        /* Check for end of list.  */
+        if (*option_ptr == NX_TCP_EOL_KIND)
+        {
+
+            /* Yes, end of list, get out!  */
+            break;
+        }
+
+        /* Check for NOP.  */
+        if (*option_ptr == NX_TCP_NOP_KIND)
+        {
+            /* One character option!  Skip this option and move to the next entry. */
+            option_ptr++;
+
+            option_area_size--;
+
+            continue;
+        }
+
+        /* Derive the option length.  */
+        option_length =  *(option_ptr + 1);
+        if ((option_length < 2) || (option_length > option_area_size))
+        {
+
+            /* Illegal option length, get out!  */
+            break;
+        }
+
+        /* Is the current character the SACK type?  */
+        if (*option_ptr == NX_TCP_SACK_KIND)
+        {
+
+            /* Yes, loop through the blocks of the option.  */
+            for (i = 2; (i + NX_TCP_SACK_BLOCK_SIZE) <= option_length; i += NX_TCP_SACK_BLOCK_SIZE)
+            {
+
+                /* Pickup the sequence numbers of the block, in network byte order.  */
+                begin_sequence =  ((ULONG)option_ptr[i] << 24) | ((ULONG)option_ptr[i + 1] << 16) |
+                                  ((ULONG)option_ptr[i + 2] << 8) | (ULONG)option_ptr[i + 3];
+                end_sequence =    ((ULONG)option_ptr[i + 4] << 24) | ((ULONG)option_ptr[i + 5] << 16) |
+                                  ((ULONG)option_ptr[i + 6] << 8) | (ULONG)option_ptr[i + 7];
+
+                /* Ignore the block if it is not within the outstanding data.  */
+                if (((INT)(begin_sequence - starting_tx_sequence) < 0) ||
+                    ((INT)(end_sequence - begin_sequence) <= 0) ||
+                    ((INT)(end_sequence - socket_ptr -> nx_tcp_socket_tx_sequence) > 0))
+                {
+                    continue;
+                }
+
+                /* Find the first range that does not end before the block.  */
+                j = 0;
+                while ((j < count) && ((INT)(scoreboard[j].nx_tcp_sack_block_end - begin_sequence) < 0))
+                {
+                    j++;
+                }
+
+                /* Merge the ranges overlapping or adjacent to the block into the block.  */
+                while ((j < count) && ((INT)(scoreboard[j].nx_tcp_sack_block_begin - end_sequence) <= 0))
+                {
+                    if ((INT)(scoreboard[j].nx_tcp_sack_block_begin - begin_sequence) < 0)
+                    {
+                        begin_sequence =  scoreboard[j].nx_tcp_sack_block_begin;
+                    }
+                    if ((INT)(scoreboard[j].nx_tcp_sack_block_end - end_sequence) > 0)
+                    {
+                        end_sequence =  scoreboard[j].nx_tcp_sack_block_end;
+                    }
+
+                    /* Remove the merged range.  */
+                    count--;
+                    memmove(&scoreboard[j], &scoreboard[j + 1], (count - j) * sizeof(NX_TCP_SACK_BLOCK)); /* Use case of memmove is verified.  */
+                }
+
+                /* Determine if the scoreboard is full.  */
+                if (count == NX_TCP_SACK_SCOREBOARD_SIZE)
+                {
+
+                    /* Yes, the block is dropped if it is above all ranges.  */
+                    if (j == count)
+                    {
+                        continue;
+                    }
+
+                    /* Otherwise, drop the highest range.  */
+                    count--;
+                }
+
+                /* Insert the block in front of the range j.  */
+                memmove(&scoreboard[j + 1], &scoreboard[j], (count - j) * sizeof(NX_TCP_SACK_BLOCK)); /* Use case of memmove is verified.  */
+                scoreboard[j].nx_tcp_sack_block_begin =  begin_sequence;
+                scoreboard[j].nx_tcp_sack_block_end =    end_sequence;
+                count++;
+            }
+
+            /* Only one SACK option is expected.  */
+            break;
+        }
+
+        /* Move to the next option.  */
+        option_ptr =        option_ptr + option_length;
+        option_area_size -= option_length;
+    }
+
+    /* Save the number of ranges in the scoreboard.  */
+    socket_ptr -> nx_tcp_socket_sack_scoreboard_count =  count;
+}
+#endif /* NX_ENABLE_TCP_SACK */
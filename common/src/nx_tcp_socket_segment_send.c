@@ -0,0 +1,430 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+#include "nx_tcp.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+#ifdef NX_IPSEC_ENABLE
+#include "nx_ipsec.h"
+#endif /* NX_IPSEC_ENABLE */
+
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_segment_ip_send                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function passes a TCP packet of the socket to the     */
+/*    IPv4 or the IPv6 component for transmission.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    socket_ptr                            Pointer to socket             */
+/*    packet_ptr                            Pointer to packet to send     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_packet_send                    Send IPv4 packet              */
+/*    _nx_ipv6_packet_send                  Send IPv6 packet              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_segment_send           Send TCP packet               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_tcp_socket_segment_ip_send(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr)
+{
+
+#ifndef NX_DISABLE_IPV4
+    /* Is this an IPv4 connection? */
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        _nx_ip_packet_send(ip_ptr, packet_ptr,
+                           socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4,
+                           socket_ptr -> nx_tcp_socket_type_of_service,
+                           socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP,
+                           socket_ptr -> nx_tcp_socket_fragment_enable,
+                           socket_ptr -> nx_tcp_socket_next_hop_address);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    /* Is this an IPv6 connection? */
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+        _nx_ipv6_packet_send(ip_ptr, packet_ptr, NX_PROTOCOL_TCP,
+                             packet_ptr -> nx_packet_length, ip_ptr -> nx_ipv6_hop_limit,
+                             socket_ptr -> nx_tcp_socket_ipv6_addr -> nxd_ipv6_address,
+                             socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6);
+    }
+#endif /* FEATURE_NX_IPV6 */
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_segment_send                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function passes a TCP data packet to the IP           */
+/*    component. A packet carrying more data than its segment size is     */
+/*    split into segments, unless the interface supports TCP              */
+/*    segmentation offload.                                               */
+/*                                                                        */
+/*    Each segment is a copy of the TCP header of the packet, with the    */
+/*    sequence number adjusted, followed by its share of the data. Only   */
+/*    the last segment has the PSH bit. The checksum of each segment is   */
+/*    computed here, or by the interface when it supports TCP transmit    */
+/*    checksum offload. If a segment can not be allocated, the remaining  */
+/*    data is left to the retransmission of the packet.                   */
+/*                                                                        */
+/*    The packet itself stays on the transmit sent list of the socket.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    socket_ptr                            Pointer to socket             */
+/*    packet_ptr                            Pointer to packet to send     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_checksum_compute               Calculate TCP checksum        */
+/*    _nx_packet_allocate                   Allocate segment              */
+/*    _nx_packet_data_append                Copy data of segment          */
+/*    _nx_packet_release                    Release segment               */
+/*    _nx_packet_transmit_release           Release transmitted packet    */
+/*    _nx_tcp_socket_segment_ip_send        Send packet to IP component   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_retransmit_packet      Retransmit packet             */
+/*    _nx_tcp_socket_send_internal          Send data packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_segment_send(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_TCP_HEADER *header_ptr;
+NX_TCP_HEADER *segment_header_ptr;
+NX_PACKET     *segment_ptr;
+NX_PACKET     *current_packet;
+UCHAR         *current_ptr;
+ULONG          header_word_3;
+ULONG          header_length;
+ULONG          sequence;
+ULONG          segment_size;
+ULONG          remaining_bytes;
+ULONG          data_size;
+ULONG          source_data_size;
+ULONG          copy_size;
+ULONG          data_offset = 0;
+ULONG          checksum;
+ULONG         *source_ip = NX_NULL, *dest_ip = NX_NULL;
+UINT           status = NX_SUCCESS;
+#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+UINT           compute_checksum = 1;
+#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+
+
+    /* Pick up the segment size and the length of the TCP header.  */
+    segment_size = packet_ptr -> nx_packet_tcp_segment_size;
+
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_3 =  header_ptr -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    header_length =  (header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+
+    /* Determine if the packet can be sent as is.  */
+    if ((segment_size == 0) || ((packet_ptr -> nx_packet_length - header_length) <= segment_size)
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+        || ((socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_SEGMENTATION)
+#ifdef NX_IPSEC_ENABLE
+            /* IPsec is applied to each segment.  */
+            && (packet_ptr -> nx_packet_ipsec_sa_ptr == NX_NULL)
+#endif /* NX_IPSEC_ENABLE */
+           )
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+       )
+    {
+
+        /* Yes, the packet fits in one segment, or the interface segments it.  */
+        _nx_tcp_socket_segment_ip_send(ip_ptr, socket_ptr, packet_ptr);
+        return;
+    }
+
+#ifndef NX_DISABLE_IPV4
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+
+        /* Get the source and destination addresses. */
+        source_ip = &socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_ip_address;
+        dest_ip = &socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v4;
+
+        /* Leave room for the IP header in front of the TCP header of each segment.  */
+        data_offset = NX_PHYSICAL_HEADER + sizeof(NX_IPV4_HEADER);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+
+        /* Get the source and destination addresses. */
+        source_ip = socket_ptr -> nx_tcp_socket_ipv6_addr -> nxd_ipv6_address;
+        dest_ip = socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6;
+
+        /* Leave room for the IP header in front of the TCP header of each segment.  */
+        data_offset = NX_PHYSICAL_HEADER + sizeof(NX_IPV6_HEADER);
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_IPSEC_ENABLE
+    /* Increase the data offset when IPsec is enabled. */
+    data_offset += socket_ptr -> nx_tcp_socket_egress_sa_data_offset;
+#endif /* NX_IPSEC_ENABLE */
+
+#ifdef NX_DISABLE_TCP_TX_CHECKSUM
+    compute_checksum = 0;
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
+
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    if (socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM)
+    {
+        compute_checksum = 0;
+    }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+#ifdef NX_IPSEC_ENABLE
+    if ((packet_ptr -> nx_packet_ipsec_sa_ptr != NX_NULL) &&
+        (((NX_IPSEC_SA *)(packet_ptr -> nx_packet_ipsec_sa_ptr)) -> nx_ipsec_sa_encryption_method != NX_CRYPTO_NONE))
+    {
+        compute_checksum = 1;
+    }
+#endif /* NX_IPSEC_ENABLE */
+
+    /* Pick up the sequence number of the first segment.  */
+    sequence =  header_ptr -> nx_tcp_sequence_number;
+    NX_CHANGE_ULONG_ENDIAN(sequence);
+
+    /* Mark the beginning of data, behind the TCP header.  */
+    remaining_bytes =  packet_ptr -> nx_packet_length - header_length;
+    current_packet =  packet_ptr;
+    current_ptr =  packet_ptr -> nx_packet_prepend_ptr + header_length;
+
+    /* Loop to send the segments.  */
+    while (remaining_bytes)
+    {
+
+        /* Obtain the size of the data in this segment.  */
+        if (remaining_bytes > segment_size)
+        {
+            data_size = segment_size;
+        }
+        else
+        {
+            data_size = remaining_bytes;
+        }
+
+        /* Allocate a packet for the segment.  */
+        status = _nx_packet_allocate(packet_ptr -> nx_packet_pool_owner, &segment_ptr, data_offset, NX_NO_WAIT);
+        if (status != NX_SUCCESS)
+        {
+            break;
+        }
+
+        /* Copy the TCP header.  */
+        memcpy(segment_ptr -> nx_packet_prepend_ptr, packet_ptr -> nx_packet_prepend_ptr, header_length); /* Use case of memcpy is verified. */
+        segment_ptr -> nx_packet_append_ptr =  segment_ptr -> nx_packet_prepend_ptr + header_length;
+        segment_ptr -> nx_packet_length =  header_length;
+
+        /* Copy the data of the segment.  */
+        remaining_bytes -= data_size;
+        while (data_size)
+        {
+
+            /* Figure out whether or not the source packet still contains data. */
+            /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+            source_data_size = (ULONG)(current_packet -> nx_packet_append_ptr - current_ptr);
+            while (source_data_size == 0)
+            {
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+                /* The current buffer is exhausted.  Move to the next buffer on the source packet chain. */
+                current_packet = current_packet -> nx_packet_next;
+
+                if (current_packet == NX_NULL)
+#endif /* NX_DISABLE_PACKET_CHAIN */
+                {
+
+                    /* No more data in the source packet. This is an unrecoverable error. */
+                    _nx_packet_release(segment_ptr);
+                    _nx_packet_transmit_release(packet_ptr);
+                    return;
+                }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+                /* Mark the beginning of data in the next packet. */
+                current_ptr = current_packet -> nx_packet_prepend_ptr;
+
+                /* Compute the amount of data present in this source buffer. */
+                /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+                source_data_size = (ULONG)(current_packet -> nx_packet_append_ptr - current_ptr);
+#endif /* NX_DISABLE_PACKET_CHAIN */
+            }
+
+            /* copy_size = min(segment, source) */
+            if (data_size > source_data_size)
+            {
+                copy_size = source_data_size;
+            }
+            else
+            {
+                copy_size = data_size;
+            }
+
+            /* Append data.  */
+            status = _nx_packet_data_append(segment_ptr, current_ptr, copy_size,
+                                            packet_ptr -> nx_packet_pool_owner, NX_NO_WAIT);
+            if (status != NX_SUCCESS)
+            {
+                break;
+            }
+
+            /* Advance in the source packet.  */
+            data_size -= copy_size;
+            current_ptr += copy_size;
+        }
+
+        /* Check for errors with data append.  */
+        if (status != NX_SUCCESS)
+        {
+
+            /* Release the segment, the data is sent again when the packet is retransmitted.  */
+            _nx_packet_release(segment_ptr);
+            break;
+        }
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        segment_header_ptr =  (NX_TCP_HEADER *)segment_ptr -> nx_packet_prepend_ptr;
+
+        /* Setup the sequence number of the segment.  */
+        segment_header_ptr -> nx_tcp_sequence_number =  sequence;
+        NX_CHANGE_ULONG_ENDIAN(segment_header_ptr -> nx_tcp_sequence_number);
+        sequence += segment_ptr -> nx_packet_length - header_length;
+
+        /* Only the last segment pushes the data.  */
+        if (remaining_bytes)
+        {
+            segment_header_ptr -> nx_tcp_header_word_3 =  header_word_3 & ~((ULONG)NX_TCP_PSH_BIT);
+            NX_CHANGE_ULONG_ENDIAN(segment_header_ptr -> nx_tcp_header_word_3);
+        }
+
+        /* Clear the checksum.  */
+        segment_header_ptr -> nx_tcp_header_word_4 =  0;
+
+#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+        if (compute_checksum)
+#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+        {
+
+            /* Calculate the TCP checksum of the segment.  */
+            checksum =  _nx_ip_checksum_compute(segment_ptr, NX_PROTOCOL_TCP,
+                                                (UINT)segment_ptr -> nx_packet_length,
+                                                source_ip, dest_ip);
+            checksum = ~checksum & NX_LOWER_16_MASK;
+
+            /* Move the checksum into header.  */
+            segment_header_ptr -> nx_tcp_header_word_4 =  (checksum << NX_SHIFT_BY_16);
+            NX_CHANGE_ULONG_ENDIAN(segment_header_ptr -> nx_tcp_header_word_4);
+        }
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+        else
+        {
+            segment_ptr -> nx_packet_interface_capability_flag |= NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM;
+        }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+        /* Setup the segment for transmission like the packet.  */
+        segment_ptr -> nx_packet_ip_version =  packet_ptr -> nx_packet_ip_version;
+        segment_ptr -> nx_packet_address =  packet_ptr -> nx_packet_address;
+#ifdef NX_IPSEC_ENABLE
+        segment_ptr -> nx_packet_ipsec_sa_ptr =  packet_ptr -> nx_packet_ipsec_sa_ptr;
+#endif /* NX_IPSEC_ENABLE */
+#ifdef NX_ENABLE_VLAN
+        segment_ptr -> nx_packet_vlan_priority =  packet_ptr -> nx_packet_vlan_priority;
+#endif /* NX_ENABLE_VLAN */
+
+        /* Send the segment to the IP component.  */
+        _nx_tcp_socket_segment_ip_send(ip_ptr, socket_ptr, segment_ptr);
+    }
+
+    /* The packet is not passed to the driver, it can be retransmitted now.  */
+    _nx_packet_transmit_release(packet_ptr);
+}
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
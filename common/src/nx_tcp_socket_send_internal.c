@@ -238,6 +238,13 @@ NX_TCP_HEADER  *header_ptr;
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*    _nx_tcp_socket_driver_send            TCP/IP offload send function  */
+/*    (nx_tcp_congestion_control_window_get)                              */
+/*                                          Get congestion window         */
+/*    tx_time_get                           Get current time              */
+/*    _nx_tcp_timestamp_option_build        Build timestamps option       */
+/*    _nx_tcp_socket_segment_send           Send with segmentation        */
+/*    _nx_tcp_socket_pacing_check           Check pacing of the socket    */
+/*    _nx_packet_data_append_checksum       Append data and sum it        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -280,6 +287,7 @@ NX_TCP_HEADER  *header_ptr;
 ULONG           checksum = 0;
 ULONG           sequence_number;
 ULONG           tx_window_current;
+ULONG           tx_window_congestion;
 ULONG           remaining_bytes;
 ULONG          *source_ip = NX_NULL, *dest_ip = NX_NULL;
 ULONG           send_mss;
@@ -295,13 +303,26 @@ UCHAR           preempted = NX_FALSE;
 UCHAR           adjust_packet;
 UINT            old_threshold = 0;
 ULONG           window_size;
+ULONG           tcp_header_size;
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+ULONG          *option_ptr;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+ULONG           segmentation_size;
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
 #ifdef NX_ENABLE_TCPIP_OFFLOAD
 UINT            status;
 NX_INTERFACE   *interface_ptr;
 #endif /* NX_ENABLE_TCPIP_OFFLOAD */
-#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD)
 UINT            compute_checksum = 1;
-#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) */
+#ifndef NX_DISABLE_TCP_TX_CHECKSUM
+ULONG          *data_checksum_ptr;
+ULONG           data_checksum;
+ULONG           copy_checksum;
+USHORT          tmp;
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
 
 #ifdef NX_DISABLE_TCP_TX_CHECKSUM
     compute_checksum = 0;
@@ -437,6 +458,28 @@ UINT            compute_checksum = 1;
     /* Get the max mss this socket could send  */
     send_mss = socket_ptr -> nx_tcp_socket_connect_mss;
 
+    /* Get the size of the TCP header, including the options of data segments.  */
+    tcp_header_size = NX_TCP_SEGMENT_HEADER_SIZE(socket_ptr);
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    /* The timestamps option takes room from the data of each segment.  RFC 6691.  */
+    if (socket_ptr -> nx_tcp_socket_timestamp_permitted)
+    {
+        data_offset += NX_TCP_TIMESTAMP_OPTION_SIZE;
+        send_mss -= NX_TCP_TIMESTAMP_OPTION_SIZE;
+    }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+    /* Send up to a whole number of segments in one packet.  The packet is segmented
+       by the interface, or before it is passed to the IP layer.  */
+    segmentation_size = (NX_TCP_SEGMENTATION_SIZE_MAX / send_mss) * send_mss;
+    if (segmentation_size < send_mss)
+    {
+        segmentation_size = send_mss;
+    }
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+
     /* Get original pool. */
     pool_ptr = packet_ptr -> nx_packet_pool_owner;
 
@@ -444,10 +487,13 @@ UINT            compute_checksum = 1;
     for (;;)
     {
 
+        /* Pick up the congestion window from the congestion control module.  */
+        tx_window_congestion = socket_ptr -> nx_tcp_socket_congestion_control -> nx_tcp_congestion_control_window_get(socket_ptr);
+
         /* Pick up the min(cwnd, swnd) */
-        if (socket_ptr -> nx_tcp_socket_tx_window_advertised > socket_ptr -> nx_tcp_socket_tx_window_congestion)
+        if (socket_ptr -> nx_tcp_socket_tx_window_advertised > tx_window_congestion)
         {
-            tx_window_current = socket_ptr -> nx_tcp_socket_tx_window_congestion;
+            tx_window_current = tx_window_congestion;
 
             /* On the first and second duplicate ACKs received, the total FlightSize would
                remain less than or equal to cwnd plus 2*SMSS.
@@ -479,11 +525,35 @@ UINT            compute_checksum = 1;
             tx_window_current = 0;
         }
 
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+        /* Pick up the min(tx_window, segmentation_size). */
+        if (tx_window_current > segmentation_size)
+        {
+            tx_window_current = segmentation_size;
+        }
+#else
         /* Pick up the min(tx_window, send_mss). */
         if (tx_window_current > send_mss)
         {
             tx_window_current = send_mss;
         }
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+
+#ifdef NX_ENABLE_TCP_PACING
+        /* Hold the data back while the pacing credit of the socket is used up.  */
+        if ((tx_window_current != 0) && (_nx_tcp_socket_pacing_check(socket_ptr) == NX_FALSE))
+        {
+            tx_window_current = 0;
+        }
+#endif /* NX_ENABLE_TCP_PACING */
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+        /* Hold the data back until the initial data of a Fast Open connection is sent.  */
+        if (socket_ptr -> nx_tcp_socket_fast_open_packet)
+        {
+            tx_window_current = 0;
+        }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 
 
         /* Store the data that is left. */
@@ -507,8 +577,21 @@ UINT            compute_checksum = 1;
                 /* Starting address of TCP header need to be four bytes aligned. */
                 adjust_packet = NX_TRUE;
             }
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+            /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+            else if ((ULONG)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start) < data_offset)
+            {
+
+                /* There is no room for the TCP header with the timestamps option. */
+                adjust_packet = NX_TRUE;
+            }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
 #ifndef NX_DISABLE_PACKET_CHAIN
             else if ((packet_ptr -> nx_packet_next != NX_NULL) &&
+#ifdef NX_ENABLE_PACKET_EXTERNAL_BUFFER
+                     /* Data in external buffer is sent without copy.  */
+                     ((packet_ptr -> nx_packet_next) -> nx_packet_external_buffer_notify == NX_NULL) &&
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
                      ((packet_ptr -> nx_packet_length + data_offset) < pool_ptr -> nx_packet_pool_payload_size) &&
                      (pool_ptr -> nx_packet_pool_available > 0))
             {
@@ -568,6 +651,26 @@ UINT            compute_checksum = 1;
                     remaining_bytes = packet_ptr -> nx_packet_length;
                 }
 
+#ifndef NX_DISABLE_TCP_TX_CHECKSUM
+                /* Sum the data while it is copied when the checksum is computed in software.  */
+                data_checksum_ptr = &copy_checksum;
+                data_checksum = 0;
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+                if (socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_TCP_TX_CHECKSUM)
+                {
+                    data_checksum_ptr = NX_NULL;
+                }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+                if (remaining_bytes > send_mss)
+                {
+
+                    /* Each segment is summed when the packet is segmented.  */
+                    data_checksum_ptr = NX_NULL;
+                }
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
+
                 /* Points to the source packet. */
                 current_packet = packet_ptr;
 
@@ -664,9 +767,21 @@ UINT            compute_checksum = 1;
                     /* Release the mutex before a blocking call. */
                     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
+#ifndef NX_DISABLE_TCP_TX_CHECKSUM
+                    /* Append data, summing it when the checksum is computed in software. */
+                    ret = _nx_packet_data_append_checksum(send_packet, current_ptr, copy_size,
+                                                          pool_ptr, wait_option, data_checksum_ptr);
+
+                    /* Add the sum of the data appended.  */
+                    if ((ret == NX_SUCCESS) && (data_checksum_ptr))
+                    {
+                        data_checksum += copy_checksum;
+                    }
+#else
                     /* Append data. */
                     ret = _nx_packet_data_append(send_packet, current_ptr, copy_size,
                                                  pool_ptr, wait_option);
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
 
                     /* Regain exclusive access to IP instance. */
                     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
@@ -716,21 +831,38 @@ UINT            compute_checksum = 1;
 
                 /* Send the packet directly. */
                 send_packet = packet_ptr;
+
+#ifndef NX_DISABLE_TCP_TX_CHECKSUM
+                /* The data is summed with the TCP header.  */
+                data_checksum_ptr = NX_NULL;
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
             }
 
             /* Now the send_packet can be sent. */
             /* Set IP version. */
             send_packet -> nx_packet_ip_version = (UCHAR)(socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version);
 
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+            /* Segment the packet if it carries more than one MSS of data.  */
+            if (send_packet -> nx_packet_length > send_mss)
+            {
+                send_packet -> nx_packet_tcp_segment_size = send_mss;
+            }
+            else
+            {
+                send_packet -> nx_packet_tcp_segment_size = 0;
+            }
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+
 #ifdef NX_IPSEC_ENABLE
             send_packet -> nx_packet_ipsec_sa_ptr = socket_ptr -> nx_tcp_socket_egress_sa;
 #endif /* NX_IPSEC_ENABLE */
 
             /* Prepend the TCP header to the packet.  First, make room for the TCP header.  */
-            send_packet -> nx_packet_prepend_ptr =  send_packet -> nx_packet_prepend_ptr - sizeof(NX_TCP_HEADER);
+            send_packet -> nx_packet_prepend_ptr =  send_packet -> nx_packet_prepend_ptr - tcp_header_size;
 
             /* Add the length of the TCP header.  */
-            send_packet -> nx_packet_length =  send_packet -> nx_packet_length + (ULONG)sizeof(NX_TCP_HEADER);
+            send_packet -> nx_packet_length =  send_packet -> nx_packet_length + tcp_header_size;
 
             /* Pickup the pointer to the head of the TCP packet.  */
             /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
@@ -753,9 +885,19 @@ UINT            compute_checksum = 1;
             window_size = socket_ptr -> nx_tcp_socket_rx_window_current;
 #endif /* NX_ENABLE_TCP_WINDOW_SCALING */
 
-            header_ptr -> nx_tcp_header_word_3 =        NX_TCP_HEADER_SIZE | NX_TCP_ACK_BIT | NX_TCP_PSH_BIT | window_size;
+            header_ptr -> nx_tcp_header_word_3 =        ((tcp_header_size / sizeof(ULONG)) << NX_TCP_HEADER_SHIFT) |
+                NX_TCP_ACK_BIT | NX_TCP_PSH_BIT | window_size;
             header_ptr -> nx_tcp_header_word_4 =        0;
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+            /* Data sent with the ACK of received data means the application answers the peer.
+               The connection is interactive until the delayed ACK timer expires.  */
+            if (socket_ptr -> nx_tcp_socket_rx_sequence_acked != socket_ptr -> nx_tcp_socket_rx_sequence)
+            {
+                socket_ptr -> nx_tcp_socket_ack_interactive =  NX_TRUE;
+            }
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
             /* Remember the last ACKed sequence and the last reported window size.  */
             socket_ptr -> nx_tcp_socket_rx_sequence_acked =    socket_ptr -> nx_tcp_socket_rx_sequence;
             socket_ptr -> nx_tcp_socket_rx_window_last_sent =  socket_ptr -> nx_tcp_socket_rx_window_current;
@@ -770,6 +912,22 @@ UINT            compute_checksum = 1;
             NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_3);
             NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
 
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+            /* Build the timestamps option behind the TCP header.  */
+            if (socket_ptr -> nx_tcp_socket_timestamp_permitted)
+            {
+
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                option_ptr =  (ULONG *)(header_ptr + 1);
+                _nx_tcp_timestamp_option_build(socket_ptr, option_ptr);
+
+                /* Swap the option words to network byte order.  */
+                NX_CHANGE_ULONG_ENDIAN(option_ptr[0]);
+                NX_CHANGE_ULONG_ENDIAN(option_ptr[1]);
+                NX_CHANGE_ULONG_ENDIAN(option_ptr[2]);
+            }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
             /* Release the protection.  */
             tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -794,14 +952,48 @@ UINT            compute_checksum = 1;
             }
 #endif /* NX_IPSEC_ENABLE */
 
-#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+            if (send_packet -> nx_packet_tcp_segment_size)
+            {
+
+                /* The checksum is computed for each segment.  */
+                compute_checksum = 0;
+            }
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
+
+#if defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD)
             if (compute_checksum)
-#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+#endif /* defined(NX_DISABLE_TCP_TX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) || defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) */
             {
-                /* Calculate the TCP checksum without protection.  */
-                checksum =  _nx_ip_checksum_compute(send_packet, NX_PROTOCOL_TCP,
-                                                    (UINT)send_packet -> nx_packet_length,
-                                                    source_ip, dest_ip);
+#ifndef NX_DISABLE_TCP_TX_CHECKSUM
+                /* Determine if the data was summed while it was copied.  */
+                if (data_checksum_ptr)
+                {
+
+                    /* Sum the pseudo header and the TCP header only, then add the length and the
+                       sum of the data.  */
+                    checksum =  _nx_ip_checksum_compute(send_packet, NX_PROTOCOL_TCP,
+                                                        (UINT)tcp_header_size,
+                                                        source_ip, dest_ip);
+                    data_checksum = (data_checksum >> NX_SHIFT_BY_16) + (data_checksum & NX_LOWER_16_MASK);
+                    data_checksum = (data_checksum >> NX_SHIFT_BY_16) + (data_checksum & NX_LOWER_16_MASK);
+
+                    /* The sum of the data is in memory order.  */
+                    tmp = (USHORT)data_checksum;
+                    NX_CHANGE_USHORT_ENDIAN(tmp);
+                    checksum += (send_packet -> nx_packet_length - tcp_header_size) + tmp;
+                    checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
+                    checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
+                }
+                else
+#endif /* NX_DISABLE_TCP_TX_CHECKSUM */
+                {
+
+                    /* Calculate the TCP checksum without protection.  */
+                    checksum =  _nx_ip_checksum_compute(send_packet, NX_PROTOCOL_TCP,
+                                                        (UINT)send_packet -> nx_packet_length,
+                                                        source_ip, dest_ip);
+                }
                 checksum = ~checksum & NX_LOWER_16_MASK;
             }
 #ifdef NX_ENABLE_INTERFACE_CAPABILITY
@@ -866,7 +1058,7 @@ UINT            compute_checksum = 1;
 
             /* Adjust the transmit sequence number to reflect the output data.  */
             socket_ptr -> nx_tcp_socket_tx_sequence = socket_ptr -> nx_tcp_socket_tx_sequence +
-                (send_packet -> nx_packet_length - (ULONG)sizeof(NX_TCP_HEADER));
+                (send_packet -> nx_packet_length - tcp_header_size);
 
             /* Restore interrupts.  */
             TX_RESTORE
@@ -874,13 +1066,23 @@ UINT            compute_checksum = 1;
             /* Reset zero window probe flag. */
             socket_ptr -> nx_tcp_socket_zero_window_probe_has_data = NX_FALSE;
 
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+            /* Time this segment for the round trip time measurement if no segment is timed.  */
+            if (socket_ptr -> nx_tcp_socket_rtt_timing == NX_FALSE)
+            {
+                socket_ptr -> nx_tcp_socket_rtt_timing = NX_TRUE;
+                socket_ptr -> nx_tcp_socket_rtt_sequence = socket_ptr -> nx_tcp_socket_tx_sequence;
+                socket_ptr -> nx_tcp_socket_rtt_start_time = tx_time_get();
+            }
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
             /* Move the checksum into header.  */
             NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
             header_ptr -> nx_tcp_header_word_4 =  (checksum << NX_SHIFT_BY_16);
             NX_CHANGE_ULONG_ENDIAN(header_ptr -> nx_tcp_header_word_4);
 
             /* Place the packet on the sent list.  */
-            data_left -= (send_packet -> nx_packet_length - (ULONG)sizeof(NX_TCP_HEADER));
+            data_left -= (send_packet -> nx_packet_length - tcp_header_size);
             if (socket_ptr -> nx_tcp_socket_transmit_sent_head)
             {
 
@@ -895,10 +1097,20 @@ UINT            compute_checksum = 1;
                 socket_ptr -> nx_tcp_socket_transmit_sent_head =  send_packet;
                 socket_ptr -> nx_tcp_socket_transmit_sent_tail =  send_packet;
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+                /* Bring the socket timeouts up to date before they are changed.  */
+                _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
                 /* Setup a timeout for the packet at the head of the list.  */
                 socket_ptr -> nx_tcp_socket_timeout =          socket_ptr -> nx_tcp_socket_timeout_rate;
                 socket_ptr -> nx_tcp_socket_timeout_retries =  0;
                 socket_ptr -> nx_tcp_socket_tx_outstanding_bytes = 0;
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+                /* Schedule the socket timeouts on the timer wheel.  */
+                _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
             }
 
             /* Set the next pointer to NX_PACKET_ENQUEUED to indicate the packet is part of a TCP queue.  */
@@ -910,15 +1122,23 @@ UINT            compute_checksum = 1;
 
             /* Increase the transmit outstanding byte count. */
             socket_ptr -> nx_tcp_socket_tx_outstanding_bytes +=
-                (send_packet -> nx_packet_length - (ULONG)sizeof(NX_TCP_HEADER));
+                (send_packet -> nx_packet_length - tcp_header_size);
+
+#ifdef NX_ENABLE_TCP_PACING
+            /* Charge the data sent to the pacing credit of a paced socket.  */
+            if (socket_ptr -> nx_tcp_socket_pacing_rate)
+            {
+                socket_ptr -> nx_tcp_socket_pacing_credit -= (LONG)(send_packet -> nx_packet_length - tcp_header_size);
+            }
+#endif /* NX_ENABLE_TCP_PACING */
 #ifndef NX_DISABLE_TCP_INFO
             /* Increment the TCP packet sent count and bytes sent count.  */
             ip_ptr -> nx_ip_tcp_packets_sent++;
-            ip_ptr -> nx_ip_tcp_bytes_sent += send_packet -> nx_packet_length - (ULONG)sizeof(NX_TCP_HEADER);
+            ip_ptr -> nx_ip_tcp_bytes_sent += send_packet -> nx_packet_length - tcp_header_size;
 
             /* Increment the TCP packet sent count and bytes sent count for the socket.  */
             socket_ptr -> nx_tcp_socket_packets_sent++;
-            socket_ptr -> nx_tcp_socket_bytes_sent += send_packet -> nx_packet_length - (ULONG)sizeof(NX_TCP_HEADER);
+            socket_ptr -> nx_tcp_socket_bytes_sent += send_packet -> nx_packet_length - tcp_header_size;
 #endif /* NX_DISABLE_TCP_INFO */
 
 #ifdef NX_ENABLE_VLAN
@@ -929,8 +1149,12 @@ UINT            compute_checksum = 1;
 #endif /* NX_ENABLE_VLAN */
 
             /* If trace is enabled, insert this event into the trace buffer.  */
-            NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_DATA_SEND, ip_ptr, socket_ptr, send_packet, socket_ptr -> nx_tcp_socket_tx_sequence - (send_packet -> nx_packet_length - sizeof(NX_TCP_HEADER)), NX_TRACE_INTERNAL_EVENTS, 0, 0);
+            NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_DATA_SEND, ip_ptr, socket_ptr, send_packet, socket_ptr -> nx_tcp_socket_tx_sequence - (send_packet -> nx_packet_length - tcp_header_size), NX_TRACE_INTERNAL_EVENTS, 0, 0);
 
+#ifdef NX_ENABLE_TCP_SEGMENTATION_OFFLOAD
+            /* Send the TCP packet to the IP component, segmenting it when needed.  */
+            _nx_tcp_socket_segment_send(ip_ptr, socket_ptr, send_packet);
+#else
             /* Send the TCP packet to the IP component.  */
 #ifndef NX_DISABLE_IPV4
             if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
@@ -961,6 +1185,7 @@ UINT            compute_checksum = 1;
                                      socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_address.v6);
             }
 #endif /* FEATURE_NX_IPV6 */
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
 
             if (data_left == 0)
             {
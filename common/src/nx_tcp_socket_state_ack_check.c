@@ -64,9 +64,13 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    (nx_tcp_congestion_control_ack)       Grow congestion window        */
 /*    _nx_tcp_packet_send_ack               Send ACK message              */
 /*    _nx_packet_release                    Packet release function       */
 /*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_sack_retransmit        Retransmit SACK hole          */
+/*    _nx_tcp_socket_rtt_update             Update round trip time        */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -112,7 +116,11 @@ ULONG          starting_tx_sequence;
 ULONG          ending_tx_sequence;
 ULONG          ending_rx_sequence;
 ULONG          acked_bytes;
+ULONG          round_trip_time;
 ULONG          tcp_payload_length;
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+ULONG          timestamp_elapsed;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
 UINT           wrapped_flag = NX_FALSE;
 
 
@@ -278,6 +286,14 @@ UINT           wrapped_flag = NX_FALSE;
 
                         /* CWND += MSS  */
                         socket_ptr -> nx_tcp_socket_tx_window_congestion += socket_ptr -> nx_tcp_socket_connect_mss;
+
+#ifdef NX_ENABLE_TCP_SACK
+                        /* Retransmit the next hole reported by SACK.  RFC 6675, Section 5.  */
+                        if (socket_ptr -> nx_tcp_socket_sack_scoreboard_count)
+                        {
+                            _nx_tcp_socket_sack_retransmit(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr);
+                        }
+#endif /* NX_ENABLE_TCP_SACK */
                     }
                 }
 
@@ -496,6 +512,53 @@ UINT           wrapped_flag = NX_FALSE;
             /* Calculate ACKed length. */
             acked_bytes = tcp_header_ptr -> nx_tcp_acknowledgment_number - starting_tx_sequence;
 
+            /* No round trip time is measured by default.  */
+            round_trip_time = NX_TCP_RTT_INVALID;
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+            /* Determine if the timed segment is acknowledged.  */
+            if ((socket_ptr -> nx_tcp_socket_rtt_timing == NX_TRUE) &&
+                ((INT)(tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_rtt_sequence) >= 0))
+            {
+
+                /* Yes, take the round trip time sample.  */
+                round_trip_time = tx_time_get() - socket_ptr -> nx_tcp_socket_rtt_start_time;
+                socket_ptr -> nx_tcp_socket_rtt_timing = NX_FALSE;
+
+#ifdef NX_ENABLE_TCP_PACING
+                /* Smooth the round trip time used to derive the pacing rate, with a gain of 1/8
+                   as in RFC 6298.  A sample below one timer tick counts as one tick.  */
+                if (socket_ptr -> nx_tcp_socket_pacing_rtt == 0)
+                {
+                    socket_ptr -> nx_tcp_socket_pacing_rtt = round_trip_time;
+                }
+                else
+                {
+                    socket_ptr -> nx_tcp_socket_pacing_rtt = (socket_ptr -> nx_tcp_socket_pacing_rtt * 7 + round_trip_time) >> 3;
+                }
+
+                if (socket_ptr -> nx_tcp_socket_pacing_rtt == 0)
+                {
+                    socket_ptr -> nx_tcp_socket_pacing_rtt = 1;
+                }
+#endif /* NX_ENABLE_TCP_PACING */
+            }
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+            /* Measure the round trip time from the echoed timestamp.  RFC 7323, Section 4.  */
+            if ((socket_ptr -> nx_tcp_socket_timestamp_permitted) && (socket_ptr -> nx_tcp_socket_timestamp_echo != 0))
+            {
+
+                /* Ignore an echo that is not one of our recent timestamps.  */
+                timestamp_elapsed = NX_TCP_TIMESTAMP_GET() - socket_ptr -> nx_tcp_socket_timestamp_echo;
+                if (timestamp_elapsed <= (NX_TCP_RTO_MAX / 1000))
+                {
+                    _nx_tcp_socket_rtt_update(socket_ptr, timestamp_elapsed * 1000);
+                }
+            }
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+
             if (socket_ptr -> nx_tcp_socket_fast_recovery == NX_TRUE)
             {
 
@@ -509,42 +572,8 @@ UINT           wrapped_flag = NX_FALSE;
             else
             {
 
-                /* Adjust the transmit window.  In slow start phase, the transmit window is incremented for every ACK.
-                   In Congestion Avoidance phase, the window is incremented for every RTT. Section 3.1, Page 4-7, RFC5681.  */
-                if (socket_ptr -> nx_tcp_socket_tx_window_congestion >= socket_ptr -> nx_tcp_socket_tx_slow_start_threshold)
-                {
-
-                    /* In Congestion avoidance phase, for every ACK it receives, increase the window size using the
-                       following approximation:
-                       cwnd = cwnd + MSS * MSS / cwnd;  */
-                    temp = socket_ptr -> nx_tcp_socket_connect_mss2 / socket_ptr -> nx_tcp_socket_tx_window_congestion;
-
-                    /* If the above formula yields 0, the result SHOULD be rounded up to 1 byte.  */
-                    if (temp == 0)
-                    {
-                        temp = 1;
-                    }
-                    socket_ptr -> nx_tcp_socket_tx_window_congestion = socket_ptr -> nx_tcp_socket_tx_window_congestion + temp;
-                }
-                else
-                {
-
-                    /* In Slow start phase:
-                       cwnd += min (N, SMSS),
-                       where N is the number of ACKed bytes. */
-                    if (acked_bytes < socket_ptr -> nx_tcp_socket_connect_mss)
-                    {
-
-                        /* In Slow start phase. Increase the cwnd by acked bytes.*/
-                        socket_ptr -> nx_tcp_socket_tx_window_congestion += acked_bytes;
-                    }
-                    else
-                    {
-
-                        /* In Slow start phase. Increase the cwnd by full MSS for every ack.*/
-                        socket_ptr -> nx_tcp_socket_tx_window_congestion += socket_ptr -> nx_tcp_socket_connect_mss;
-                    }
-                }
+                /* Let the congestion control module grow the transmit window.  */
+                socket_ptr -> nx_tcp_socket_congestion_control -> nx_tcp_congestion_control_ack(socket_ptr, acked_bytes, round_trip_time);
             }
         }
 
@@ -734,8 +763,19 @@ UINT           wrapped_flag = NX_FALSE;
         if (socket_ptr -> nx_tcp_socket_fast_recovery == NX_TRUE)
         {
 
-            /* Only partial data are ACKed. Retransmit packet immediately. */
-            _nx_tcp_socket_retransmit(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr, NX_FALSE);
+#ifdef NX_ENABLE_TCP_SACK
+            /* Retransmit the next hole reported by SACK, which is not necessarily at the front of the queue.  */
+            if (socket_ptr -> nx_tcp_socket_sack_scoreboard_count)
+            {
+                _nx_tcp_socket_sack_retransmit(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr);
+            }
+            else
+#endif /* NX_ENABLE_TCP_SACK */
+            {
+
+                /* Only partial data are ACKed. Retransmit packet immediately. */
+                _nx_tcp_socket_retransmit(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr, NX_FALSE);
+            }
         }
 
         return(NX_TRUE);
@@ -185,6 +185,7 @@ VOID _nx_tcp_socket_state_data_trim_front(NX_PACKET *packet_ptr, ULONG amount)
 {
 NX_PACKET *work_ptr = packet_ptr;
 ULONG      work_length;
+ULONG      header_length;
 
     if (amount >= packet_ptr -> nx_packet_length || amount == 0)
     {
@@ -195,8 +196,13 @@ ULONG      work_length;
     /* Adjust the packet length.  */
     packet_ptr -> nx_packet_length -= amount;
 
+    /* Calculate the header size, including the options.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    header_length = (((NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_3 >> NX_TCP_HEADER_SHIFT) *
+        (ULONG)sizeof(ULONG);
+
     /* Move prepend_ptr of first packet to TCP data.  */
-    packet_ptr -> nx_packet_prepend_ptr += sizeof(NX_TCP_HEADER);
+    packet_ptr -> nx_packet_prepend_ptr += header_length;
 
 #ifndef NX_DISABLE_PACKET_CHAIN
     /* Walk down the packet chain for the amount. */
@@ -273,7 +279,7 @@ ULONG      work_length;
 #endif /* NX_DISABLE_PACKET_CHAIN */
 
     /* Restore prepend_ptr of first packet to TCP data.  */
-    packet_ptr -> nx_packet_prepend_ptr -= sizeof(NX_TCP_HEADER);
+    packet_ptr -> nx_packet_prepend_ptr -= header_length;
 }
 
 
@@ -308,6 +314,7 @@ ULONG      work_length;
 /*    _nx_packet_release                    Release packet on overlap     */
 /*    _nx_tcp_socket_thread_resume          Resume suspended thread       */
 /*    _nx_tcp_packet_send_ack               Send immediate ACK            */
+/*    _nx_tcp_socket_ack_policy_check       Apply ACK policy              */
 /*    (nx_tcp_receive_callback)             Packet receive notify function*/
 /*    _nx_tcp_socket_state_data_trim        Trim off extra bytes          */
 /*    _nx_tcp_socket_state_data_trim_front  Trim off front extra bytes    */
@@ -364,6 +371,13 @@ ULONG          tcpip_offload;
 #ifdef NX_ENABLE_LOW_WATERMARK
 UCHAR          drop_packet = NX_FALSE;
 #endif /* NX_ENABLE_LOW_WATERMARK */
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+UINT           coalesced = NX_FALSE;
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+UINT           in_sequence = NX_FALSE;
+NX_IP         *ack_ip_ptr;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
 #if ((!defined(NX_DISABLE_TCP_INFO)) || defined(TX_ENABLE_EVENT_TRACE))
 NX_IP         *ip_ptr;
 
@@ -392,6 +406,15 @@ NX_IP         *ip_ptr;
     /* Calculate the data length in the packet.  */
     packet_data_length = packet_ptr -> nx_packet_length - header_length;
 
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+    /* Determine if the packet is coalesced from more than one segment.  */
+    if ((packet_ptr -> nx_packet_tcp_coalesced) &&
+        (packet_data_length > packet_ptr -> nx_packet_tcp_segment_size))
+    {
+        coalesced = NX_TRUE;
+    }
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
+
     /* Pickup the end sequence of this packet. The end sequence is one byte to the last byte in this packet. */
     packet_end_sequence =  tcp_header_ptr -> nx_tcp_sequence_number + packet_data_length;
 
@@ -540,6 +563,10 @@ NX_IP         *ip_ptr;
     {
 
         /* Yes, this is the simple case of adding receive packets in sequence.  */
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+        in_sequence = NX_TRUE;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
 #ifdef NX_ENABLE_LOW_WATERMARK
         /* If this packet is to be dropped, do nothing. */
         if (drop_packet == NX_FALSE)
@@ -618,14 +645,35 @@ NX_IP         *ip_ptr;
     else if (socket_ptr -> nx_tcp_socket_receive_queue_head == NX_NULL)
     {
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+        /* Data is missing, acknowledge the following data immediately so the sender
+           recovers quickly once the missing data arrives.  */
+        socket_ptr -> nx_tcp_socket_quick_ack_count =  socket_ptr -> nx_tcp_socket_quick_ack_segments;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
 #ifdef NX_ENABLE_LOW_WATERMARK
         /* If this packet is to be dropped, do nothing. */
         if (drop_packet == NX_FALSE)
         {
 #endif /* NX_ENABLE_LOW_WATERMARK */
 
-            /* Packet data begins to the right of the expected sequence (out of sequence data). Force an ACK. */
-            _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+#ifdef NX_ENABLE_TCP_SACK
+            if (socket_ptr -> nx_tcp_socket_sack_permitted)
+            {
+
+                /* Report the block of this packet first in the SACK option.  RFC 2018, Section 4.  */
+                socket_ptr -> nx_tcp_socket_sack_recent_sequence = packet_begin_sequence;
+
+                /* Force an ACK after the packet is queued, so the SACK option includes it.  */
+                need_ack = NX_TRUE;
+            }
+            else
+#endif /* NX_ENABLE_TCP_SACK */
+            {
+
+                /* Packet data begins to the right of the expected sequence (out of sequence data). Force an ACK. */
+                _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+            }
 
             /* Add debug information. */
             NX_PACKET_DEBUG(NX_PACKET_TCP_RECEIVE_QUEUE, __LINE__, packet_ptr);
@@ -666,6 +714,12 @@ NX_IP         *ip_ptr;
 
         /* Out of order insertion with packets on the queue. */
 
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+        /* Data is missing, acknowledge the following data immediately so the sender
+           recovers quickly once the missing data arrives.  */
+        socket_ptr -> nx_tcp_socket_quick_ack_count =  socket_ptr -> nx_tcp_socket_quick_ack_segments;
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
         /* Either this packet is not in order or other out-of-order packets have already been
            received.  In this case searching the receive list must be done to find the proper
            place for the new packet.  */
@@ -673,10 +727,29 @@ NX_IP         *ip_ptr;
         /* Go through the received packet chain, and locate the first packet that the
            packet_begin_sequence is to the right of the end of it. */
 
-        /* Packet data begins to the right of the expected sequence (out of sequence data). Force an ACK. */
-        if (((INT)(packet_begin_sequence - socket_ptr -> nx_tcp_socket_rx_sequence)) > 0)
+#ifdef NX_ENABLE_TCP_SACK
+        if (socket_ptr -> nx_tcp_socket_sack_permitted)
         {
-            _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+
+            /* Report the block of out of sequence data first in the SACK option.  RFC 2018, Section 4.  */
+            if (((INT)(packet_begin_sequence - socket_ptr -> nx_tcp_socket_rx_sequence)) > 0)
+            {
+                socket_ptr -> nx_tcp_socket_sack_recent_sequence = packet_begin_sequence;
+            }
+
+            /* Force an ACK after the packet is queued, so the SACK option is up to date.
+               Data filling a hole is also acknowledged immediately.  */
+            need_ack = NX_TRUE;
+        }
+        else
+#endif /* NX_ENABLE_TCP_SACK */
+        {
+
+            /* Packet data begins to the right of the expected sequence (out of sequence data). Force an ACK. */
+            if (((INT)(packet_begin_sequence - socket_ptr -> nx_tcp_socket_rx_sequence)) > 0)
+            {
+                _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+            }
         }
 
         /* At this point, it is guaranteed that the receive queue contains packets. */
@@ -1056,6 +1129,11 @@ NX_IP         *ip_ptr;
         /* Update the rx_window_last_sent for SWS avoidance algorithm.
            RFC1122, Section4.2.3.3, Page97-98.  */
         socket_ptr -> nx_tcp_socket_rx_window_last_sent -= (socket_ptr -> nx_tcp_socket_rx_sequence - original_rx_sequence);
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+        /* Measure the round trip time seen by the receiver.  */
+        _nx_tcp_socket_window_autotune_rtt(socket_ptr);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
     }
 
 #ifdef NX_TCP_MAX_OUT_OF_ORDER_PACKETS
@@ -1150,6 +1228,11 @@ NX_IP         *ip_ptr;
         /* Increase the receive window size.  */
         socket_ptr -> nx_tcp_socket_rx_window_current += packet_ptr -> nx_packet_length;
 
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+        /* Tune the receive window from the data delivered to the application.  */
+        _nx_tcp_socket_window_autotune(socket_ptr, packet_ptr -> nx_packet_length);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
         /* Remove the suspended thread from the list.  */
 
         /* Decrement the suspension count.  */
@@ -1206,7 +1289,17 @@ NX_IP         *ip_ptr;
             }
         }
 
-#ifdef NX_TCP_ACK_EVERY_N_PACKETS
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+        /* Determine if an ACK is due under the ACK policy of the socket.  */
+        if ((socket_ptr -> nx_tcp_socket_state == NX_TCP_ESTABLISHED) &&
+            ((tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_FIN_BIT) == 0) &&
+            (_nx_tcp_socket_ack_policy_check(socket_ptr)))
+        {
+
+            /* Need to send an ACK.  */
+            need_ack = NX_TRUE;
+        }
+#elif defined(NX_TCP_ACK_EVERY_N_PACKETS)
         /* Determine if we need to ACK up to the current sequence number.  */
 
         /* If we are still in an ESTABLISHED state, a FIN isn't present and we can
@@ -1227,13 +1320,45 @@ NX_IP         *ip_ptr;
             }
         }
 #endif
+
+#ifdef NX_ENABLE_TCP_RECEIVE_OFFLOAD
+        /* The segments of a coalesced packet are acknowledged at once, as at least
+           every second full size segment is acknowledged.  RFC 5681, Section 4.2.  */
+        if (coalesced)
+        {
+            need_ack = NX_TRUE;
+        }
+#endif /* NX_ENABLE_TCP_RECEIVE_OFFLOAD */
     }
 
     if (need_ack == NX_TRUE)
     {
 
-        /* Need to send ACK.  */
-        _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+        /* Setup the IP pointer.  */
+        ack_ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+        /* Determine if the ACK of in-sequence data can be coalesced with the ACKs of the
+           following packets of the batch.  ACKs of out-of-order data are never delayed,
+           the sender counts them as duplicate ACKs.  */
+        if (in_sequence && ack_ip_ptr -> nx_ip_tcp_ack_pending_active)
+        {
+
+            /* Yes, place the socket on the pending ACK list if it is not already there.  */
+            if (!socket_ptr -> nx_tcp_socket_ack_pending)
+            {
+                socket_ptr -> nx_tcp_socket_ack_pending =  NX_TRUE;
+                socket_ptr -> nx_tcp_socket_ack_pending_next =  ack_ip_ptr -> nx_ip_tcp_ack_pending_head;
+                ack_ip_ptr -> nx_ip_tcp_ack_pending_head =  socket_ptr;
+            }
+        }
+        else
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+        {
+
+            /* Need to send ACK.  */
+            _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+        }
     }
 
     /* Return true since the packet was queued.  */
@@ -59,8 +59,12 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    (nx_tcp_congestion_control_initialize)                              */
+/*                                          Initialize congestion control */
 /*    _nx_tcp_socket_thread_resume          Resume suspended thread       */
 /*    _nx_tcp_packet_send_rst               Send RST packet               */
+/*    _nx_tcp_socket_fast_open_send         Send initial data             */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -143,6 +147,16 @@ VOID  _nx_tcp_socket_state_syn_received(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER
                 }
             }
 
+            /* Initialize the congestion control module for the connection.  */
+            socket_ptr -> nx_tcp_socket_congestion_control -> nx_tcp_congestion_control_initialize(socket_ptr);
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+            /* Acknowledge the first data segments immediately, the sender starts from a small window.  */
+            socket_ptr -> nx_tcp_socket_quick_ack_count =  socket_ptr -> nx_tcp_socket_quick_ack_segments;
+            socket_ptr -> nx_tcp_socket_ack_interactive =  NX_FALSE;
+            socket_ptr -> nx_tcp_socket_ack_receive_time =  tx_time_get();
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
             /* Move into the ESTABLISHED state.  */
             socket_ptr -> nx_tcp_socket_state =  NX_TCP_ESTABLISHED;
 #ifndef NX_DISABLE_EXTENDED_NOTIFY_SUPPORT
@@ -169,6 +183,14 @@ VOID  _nx_tcp_socket_state_syn_received(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER
             /* Update the value of nx_tcp_socket_rx_sequence_acked */
             socket_ptr -> nx_tcp_socket_rx_sequence_acked =    socket_ptr -> nx_tcp_socket_rx_sequence;
 
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+            /* Send the initial data of a client that met a simultaneous open.  */
+            if (socket_ptr -> nx_tcp_socket_fast_open_packet)
+            {
+                _nx_tcp_socket_fast_open_send(socket_ptr, 0);
+            }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
             /* Determine if we need to wake a thread suspended on the connection.  */
             if (socket_ptr -> nx_tcp_socket_connect_suspended_thread)
             {
@@ -61,11 +61,15 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    (nx_tcp_congestion_control_initialize)                              */
+/*                                          Initialize congestion control */
 /*    _nx_tcp_packet_send_ack               Send ACK packet               */
 /*    _nx_tcp_packet_send_syn               Send SYN packet               */
 /*    _nx_tcp_packet_send_rst               Send RST packet               */
 /*    _nx_tcp_socket_thread_resume          Resume suspended thread       */
 /*    _nx_http_proxy_client_connect         Connect with HTTP Proxy       */
+/*    _nx_tcp_socket_fast_open_send         Send initial data             */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -86,18 +90,35 @@
 VOID  _nx_tcp_socket_state_syn_sent(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tcp_header_ptr, NX_PACKET *packet_ptr)
 {
 
+UINT  acknowledgment_valid;
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+ULONG fast_open_acked = 0;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 
 #ifndef TX_ENABLE_EVENT_TRACE
     NX_PARAMETER_NOT_USED(packet_ptr);
 #endif /* TX_ENABLE_EVENT_TRACE */
 
+    /* Determine if the ACK acknowledges the SYN.  */
+    acknowledgment_valid =  (tcp_header_ptr -> nx_tcp_acknowledgment_number == socket_ptr -> nx_tcp_socket_tx_sequence);
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* The ACK may also acknowledge the data the SYN carried with the Fast Open cookie.  */
+    if ((!acknowledgment_valid) && (socket_ptr -> nx_tcp_socket_fast_open_length) &&
+        (((INT)(tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_tx_sequence)) > 0) &&
+        ((tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_tx_sequence) <= socket_ptr -> nx_tcp_socket_fast_open_length))
+    {
+        fast_open_acked =  tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_tx_sequence;
+        acknowledgment_valid =  NX_TRUE;
+    }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
     /* Check if a RST is present. */
     if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_RST_BIT)
     {
 
         /* Check if the ACK was acceptable. According to RFC 793, Section 3.9, Page 67.  */
-        if ((tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) &&
-            (tcp_header_ptr -> nx_tcp_acknowledgment_number == socket_ptr -> nx_tcp_socket_tx_sequence))
+        if ((tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) && (acknowledgment_valid))
         {
 
 #ifndef NX_DISABLE_TCP_INFO
@@ -118,14 +139,18 @@ VOID  _nx_tcp_socket_state_syn_sent(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tc
     }
     /* Determine if a valid SYN/ACK is present.  */
     else if ((tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_SYN_BIT) &&
-             (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) &&
-             (tcp_header_ptr -> nx_tcp_acknowledgment_number == socket_ptr -> nx_tcp_socket_tx_sequence))
+             (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) && (acknowledgment_valid))
     {
 
         /* Yes, this is a proper SYN/ACK message.  We need to send an ACK
            back the other direction before we go into the ESTABLISHED
            state.  */
 
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+        /* Move past the data the SYN delivered.  */
+        socket_ptr -> nx_tcp_socket_tx_sequence +=  fast_open_acked;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
         /* Save the sequence number.  */
         socket_ptr -> nx_tcp_socket_rx_sequence =  tcp_header_ptr -> nx_tcp_sequence_number + 1;
 
@@ -180,6 +205,16 @@ VOID  _nx_tcp_socket_state_syn_sent(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tc
             }
         }
 
+        /* Initialize the congestion control module for the connection.  */
+        socket_ptr -> nx_tcp_socket_congestion_control -> nx_tcp_congestion_control_initialize(socket_ptr);
+
+#ifdef NX_ENABLE_TCP_ACK_POLICY
+        /* Acknowledge the first data segments immediately, the sender starts from a small window.  */
+        socket_ptr -> nx_tcp_socket_quick_ack_count =  socket_ptr -> nx_tcp_socket_quick_ack_segments;
+        socket_ptr -> nx_tcp_socket_ack_interactive =  NX_FALSE;
+        socket_ptr -> nx_tcp_socket_ack_receive_time =  tx_time_get();
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
+
         /* Send the ACK.  */
         _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
 
@@ -202,6 +237,11 @@ VOID  _nx_tcp_socket_state_syn_sent(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tc
         }
 #endif
 
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+        /* Send the initial data the SYN did not deliver.  */
+        _nx_tcp_socket_fast_open_send(socket_ptr, fast_open_acked);
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
 #ifdef NX_ENABLE_HTTP_PROXY
 
         /* Check if the HTTP Proxy is started and waiting for TCP socket connection.  */
@@ -283,8 +323,7 @@ VOID  _nx_tcp_socket_state_syn_sent(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tc
         _nx_tcp_packet_send_syn(socket_ptr, (socket_ptr -> nx_tcp_socket_tx_sequence - 1));
     }
     /* Check for an invalid response to an attempted connection.  */
-    else if ((tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) &&
-             (tcp_header_ptr -> nx_tcp_acknowledgment_number != socket_ptr -> nx_tcp_socket_tx_sequence))
+    else if ((tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT) && (!acknowledgment_valid))
     {
 
         /* Invalid response was received, it is likely that the other side still
@@ -60,11 +60,17 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_tcp_socket_fast_open_send         Send initial data             */
+/*    _nx_tcp_socket_pacing_check           Check pacing of the socket    */
 /*    _nx_tcp_socket_thread_resume          Resume suspended thread       */
+/*    (nx_tcp_congestion_control_window_get)                              */
+/*                                          Get congestion window         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    _nx_tcp_socket_packet_process         Process TCP packet for socket */
+/*    _nx_tcp_pacing_process                Release paced sockets         */
+/*    _nx_tcp_socket_pacing_set             Set pacing rate of socket     */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -79,6 +85,21 @@ VOID  _nx_tcp_socket_state_transmit_check(NX_TCP_SOCKET *socket_ptr)
 {
 
 ULONG tx_window_current;
+ULONG tx_window_congestion;
+
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    /* Send the initial data of a Fast Open connection the window could not take before.  */
+    if (socket_ptr -> nx_tcp_socket_fast_open_packet)
+    {
+        _nx_tcp_socket_fast_open_send(socket_ptr, 0);
+
+        /* Keep the threads suspended until all the initial data is sent.  */
+        if (socket_ptr -> nx_tcp_socket_fast_open_packet)
+        {
+            return;
+        }
+    }
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
 
     /* Now check to see if there is a thread suspended attempting to transmit.  */
     if (socket_ptr -> nx_tcp_socket_transmit_suspension_list)
@@ -88,10 +109,13 @@ ULONG tx_window_current;
            is lower than its request size.  Determine if the current transmit window
            size can now accommodate the request.  */
 
+        /* Pick up the congestion window from the congestion control module.  */
+        tx_window_congestion = socket_ptr -> nx_tcp_socket_congestion_control -> nx_tcp_congestion_control_window_get(socket_ptr);
+
         /* Pick up the min(cwnd, swnd) */
-        if (socket_ptr -> nx_tcp_socket_tx_window_advertised > socket_ptr -> nx_tcp_socket_tx_window_congestion)
+        if (socket_ptr -> nx_tcp_socket_tx_window_advertised > tx_window_congestion)
         {
-            tx_window_current = socket_ptr -> nx_tcp_socket_tx_window_congestion;
+            tx_window_current = tx_window_congestion;
 
             /* On the first and second duplicate ACKs received, the total FlightSize would
                remain less than or equal to cwnd plus 2*SMSS.
@@ -123,6 +147,15 @@ ULONG tx_window_current;
             tx_window_current = 0;
         }
 
+#ifdef NX_ENABLE_TCP_PACING
+        /* Keep the thread suspended while the pacing of the socket holds data back.  The
+           pacing timer checks the socket again.  */
+        if ((tx_window_current) && (_nx_tcp_socket_pacing_check(socket_ptr) == NX_FALSE))
+        {
+            tx_window_current = 0;
+        }
+#endif /* NX_ENABLE_TCP_PACING */
+
 
         /* Determine if the current transmit window (received from the connected socket)
            is large enough to handle the transmit.  */
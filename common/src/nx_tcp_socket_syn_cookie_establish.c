@@ -0,0 +1,213 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+#include "nx_ip.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_syn_cookie_establish                 PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function establishes a server socket from the ACK     */
+/*    that completed a handshake started with a SYN cookie.  The socket   */
+/*    is already bound and holds the address, port and MSS of the client. */
+/*    The state of the SYN+ACK is rebuilt from the ACK, then the ACK and  */
+/*    any data it carries are processed as in the SYN RECEIVED state.     */
+/*    This function must be called with the IP protection held.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to server socket      */
+/*    packet_ptr                            Pointer to ACK packet         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_packet_send_ack               Send ACK packet               */
+/*    _nx_tcp_socket_packet_process         Process packet on socket      */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*    _nx_tcp_server_socket_relisten        Server socket relisten        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_syn_cookie_establish(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_TCP_HEADER *tcp_header_ptr;
+ULONG          mss = 0;
+
+
+    /* Setup a pointer to the TCP header of the ACK.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    tcp_header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Bring the socket timeouts up to date before they are changed.  */
+    _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
+    /* Rebuild the sequence numbers of the handshake, the cookie was our initial sequence number.  */
+    socket_ptr -> nx_tcp_socket_rx_sequence =            tcp_header_ptr -> nx_tcp_sequence_number;
+    socket_ptr -> nx_tcp_socket_tx_sequence =            tcp_header_ptr -> nx_tcp_acknowledgment_number;
+    socket_ptr -> nx_tcp_socket_tx_sequence_recover =    tcp_header_ptr -> nx_tcp_acknowledgment_number - 1;
+    socket_ptr -> nx_tcp_socket_previous_highest_ack =   tcp_header_ptr -> nx_tcp_acknowledgment_number - 1;
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+    /* Start the receive window of the connection from the initial window.  */
+    _nx_tcp_socket_window_autotune_reset(socket_ptr);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
+    /* The SYN+ACK advertised a window of one segment, the full window is announced once
+       the connection is established.  */
+    socket_ptr -> nx_tcp_socket_rx_window_current =      socket_ptr -> nx_tcp_socket_rx_window_default;
+    socket_ptr -> nx_tcp_socket_rx_window_last_sent =    socket_ptr -> nx_tcp_socket_peer_mss;
+
+    /* The SYN+ACK offered none of the options that need state.  */
+#ifdef NX_ENABLE_TCP_WINDOW_SCALING
+    socket_ptr -> nx_tcp_snd_win_scale_value =  0xFF;
+    socket_ptr -> nx_tcp_rcv_win_scale_value =  0;
+#endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+#ifdef NX_ENABLE_TCP_SACK
+    socket_ptr -> nx_tcp_socket_sack_permitted =  NX_FALSE;
+#endif /* NX_ENABLE_TCP_SACK */
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+    socket_ptr -> nx_tcp_socket_timestamp_permitted =  NX_FALSE;
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+    socket_ptr -> nx_tcp_socket_fast_open_option =  NX_FALSE;
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+
+    /* Compute the MSS the SYN+ACK advertised.  */
+#ifndef NX_DISABLE_IPV4
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        mss = (ULONG)((socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_ip_mtu_size - sizeof(NX_IPV4_HEADER)) - sizeof(NX_TCP_HEADER));
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version == NX_IP_VERSION_V6)
+    {
+        mss = (ULONG)((socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_ip_mtu_size - sizeof(NX_IPV6_HEADER)) - sizeof(NX_TCP_HEADER));
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    mss &= 0x0000FFFFUL;
+
+    if ((socket_ptr -> nx_tcp_socket_mss < mss) && socket_ptr -> nx_tcp_socket_mss)
+    {
+
+        /* Use the custom MSS. */
+        mss = socket_ptr -> nx_tcp_socket_mss;
+    }
+
+    /* Update the connect MSS from the MSS of the cookie.  */
+    if (mss < socket_ptr -> nx_tcp_socket_peer_mss)
+    {
+        socket_ptr -> nx_tcp_socket_connect_mss  = mss;
+    }
+    else
+    {
+        socket_ptr -> nx_tcp_socket_connect_mss =  socket_ptr -> nx_tcp_socket_peer_mss;
+    }
+
+    /* Compute the SMSS * SMSS value, so later TCP module doesn't need to redo the multiplication. */
+    socket_ptr -> nx_tcp_socket_connect_mss2 =
+        socket_ptr -> nx_tcp_socket_connect_mss * socket_ptr -> nx_tcp_socket_connect_mss;
+
+    /* CLEANUP: Clean up any existing socket data before making a new connection. */
+    socket_ptr -> nx_tcp_socket_fin_received =  NX_FALSE;
+    socket_ptr -> nx_tcp_socket_fin_acked =  NX_FALSE;
+    socket_ptr -> nx_tcp_socket_timeout =  0;
+    socket_ptr -> nx_tcp_socket_timeout_retries =  0;
+    socket_ptr -> nx_tcp_socket_tx_outstanding_bytes = 0;
+    socket_ptr -> nx_tcp_socket_packets_sent = 0;
+    socket_ptr -> nx_tcp_socket_bytes_sent = 0;
+    socket_ptr -> nx_tcp_socket_packets_received = 0;
+    socket_ptr -> nx_tcp_socket_bytes_received = 0;
+    socket_ptr -> nx_tcp_socket_retransmit_packets = 0;
+    socket_ptr -> nx_tcp_socket_checksum_errors = 0;
+    socket_ptr -> nx_tcp_socket_transmit_sent_head  =  NX_NULL;
+    socket_ptr -> nx_tcp_socket_transmit_sent_tail  =  NX_NULL;
+    socket_ptr -> nx_tcp_socket_transmit_sent_count =  0;
+    socket_ptr -> nx_tcp_socket_receive_queue_count =  0;
+    socket_ptr -> nx_tcp_socket_receive_queue_head  =  NX_NULL;
+    socket_ptr -> nx_tcp_socket_receive_queue_tail  =  NX_NULL;
+
+#ifndef NX_DISABLE_TCP_INFO
+    /* Increment the number of connections established from a SYN cookie.  */
+    socket_ptr -> nx_tcp_socket_ip_ptr -> nx_ip_tcp_syn_cookies_received++;
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_STATE_CHANGE, socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, NX_TCP_SYN_RECEIVED, NX_TRACE_INTERNAL_EVENTS, 0, 0);
+
+    /* Process the ACK as the answer to the SYN+ACK of the socket.  */
+    socket_ptr -> nx_tcp_socket_state =  NX_TCP_SYN_RECEIVED;
+    _nx_tcp_socket_packet_process(socket_ptr, packet_ptr);
+
+    /* Announce the full receive window.  */
+    if ((socket_ptr -> nx_tcp_socket_state == NX_TCP_ESTABLISHED) &&
+        (socket_ptr -> nx_tcp_socket_rx_window_current > socket_ptr -> nx_tcp_socket_rx_window_last_sent))
+    {
+        _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
+    }
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Schedule the socket timeouts on the timer wheel.  */
+    _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+}
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
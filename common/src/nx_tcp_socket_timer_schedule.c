@@ -0,0 +1,163 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_timer_schedule                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the timers of the TCP socket on the timer      */
+/*    wheels at the tick the first active timeout expires. A timer        */
+/*    without an active timeout is removed from its wheel. It is called   */
+/*    after the timeouts have been changed, and assumes they are up to    */
+/*    date with the tick of their last update.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_timer_wheel_insert            Insert timer into wheel       */
+/*    _nx_tcp_timer_wheel_remove            Remove timer from wheel       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_periodic_processing      Fast TCP periodic processing  */
+/*    _nx_tcp_packet_process                Process incoming packet       */
+/*    _nx_tcp_periodic_processing           TCP periodic processing       */
+/*    _nx_tcp_server_socket_accept          Accept connection             */
+/*    _nx_tcp_socket_disconnect             Disconnect socket             */
+/*    _nx_tcp_socket_driver_establish       Establish connection          */
+/*    _nx_tcp_socket_receive                Receive data from socket      */
+/*    _nx_tcp_socket_send_internal          Send data on socket           */
+/*    _nxd_tcp_client_socket_connect        Connect client socket         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_timer_schedule(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_IP        *ip_ptr;
+NX_TCP_TIMER *timer_ptr;
+ULONG         ticks;
+ULONG         delayed_ack_ticks;
+
+
+    /* Setup the IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* Pickup the fast timer of the socket.  */
+    timer_ptr =  &(socket_ptr -> nx_tcp_socket_fast_timer);
+
+    /* Compute the number of ticks until the timeout expires.  A timeout expires
+       at the tick it is no longer larger than the fast timer rate.  */
+    ticks =  0;
+    if (socket_ptr -> nx_tcp_socket_timeout)
+    {
+        ticks =  ((socket_ptr -> nx_tcp_socket_timeout - 1) / _nx_tcp_fast_timer_rate) + 1;
+    }
+
+    /* Determine if the socket has delayed sending an ACK.  */
+    if ((socket_ptr -> nx_tcp_socket_state >= NX_TCP_ESTABLISHED) &&
+        ((socket_ptr -> nx_tcp_socket_rx_sequence != socket_ptr -> nx_tcp_socket_rx_sequence_acked) ||
+         (socket_ptr -> nx_tcp_socket_rx_window_last_sent < socket_ptr -> nx_tcp_socket_rx_window_current)))
+    {
+
+        /* Yes, compute the number of ticks until the delayed ACK timeout expires.  */
+        delayed_ack_ticks =  1;
+        if (socket_ptr -> nx_tcp_socket_delayed_ack_timeout)
+        {
+            delayed_ack_ticks =  ((socket_ptr -> nx_tcp_socket_delayed_ack_timeout - 1) / _nx_tcp_fast_timer_rate) + 1;
+        }
+
+        /* Use the first expiration.  */
+        if ((ticks == 0) || (delayed_ack_ticks < ticks))
+        {
+            ticks =  delayed_ack_ticks;
+        }
+    }
+
+    /* Determine if a fast timeout is active.  */
+    if (ticks)
+    {
+
+        /* Yes, place the timer on the fast timer wheel.  */
+        _nx_tcp_timer_wheel_insert(&(ip_ptr -> nx_ip_tcp_fast_timer_wheel), timer_ptr,
+                                   timer_ptr -> nx_tcp_timer_updated + ticks);
+    }
+    else
+    {
+
+        /* No, remove the timer from the wheel.  */
+        _nx_tcp_timer_wheel_remove(timer_ptr);
+    }
+
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    /* Pickup the keepalive timer of the socket.  */
+    timer_ptr =  &(socket_ptr -> nx_tcp_socket_keepalive_timer);
+
+    /* Determine if the keepalive timer is active.  */
+    if ((socket_ptr -> nx_tcp_socket_keepalive_enabled) &&
+        (socket_ptr -> nx_tcp_socket_state == NX_TCP_ESTABLISHED) && (socket_ptr -> nx_tcp_socket_keepalive_timeout))
+    {
+
+        /* Yes, place the timer on the keepalive timer wheel.  The keepalive timeout is
+           in seconds, the same as the ticks of the keepalive timer wheel.  */
+        _nx_tcp_timer_wheel_insert(&(ip_ptr -> nx_ip_tcp_keepalive_timer_wheel), timer_ptr,
+                                   timer_ptr -> nx_tcp_timer_updated + socket_ptr -> nx_tcp_socket_keepalive_timeout);
+    }
+    else
+    {
+
+        /* No, remove the timer from the wheel.  */
+        _nx_tcp_timer_wheel_remove(timer_ptr);
+    }
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+}
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
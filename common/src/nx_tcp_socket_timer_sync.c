@@ -0,0 +1,184 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_timer_sync                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function brings the timeouts of the TCP socket up to date      */
+/*    with the current ticks of the timer wheels. The periodic            */
+/*    processing does not decrement the timeouts of sockets it does not   */
+/*    visit, so this function subtracts the time elapsed since the        */
+/*    timeouts were last updated. It must be called before the timeouts,  */
+/*    or the states they depend on, are changed. The current tick of a    */
+/*    timer on the expired list has not been processed yet, so the        */
+/*    timeouts are brought up to the previous tick.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_periodic_processing      Fast TCP periodic processing  */
+/*    _nx_tcp_packet_process                Process incoming packet       */
+/*    _nx_tcp_periodic_processing           TCP periodic processing       */
+/*    _nx_tcp_server_socket_accept          Accept connection             */
+/*    _nx_tcp_socket_disconnect             Disconnect socket             */
+/*    _nx_tcp_socket_driver_establish       Establish connection          */
+/*    _nx_tcp_socket_receive                Receive data from socket      */
+/*    _nx_tcp_socket_send_internal          Send data on socket           */
+/*    _nxd_tcp_client_socket_connect        Connect client socket         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_timer_sync(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_IP              *ip_ptr;
+NX_TCP_TIMER_WHEEL *wheel_ptr;
+NX_TCP_TIMER       *timer_ptr;
+ULONG               tick;
+ULONG               elapsed;
+
+
+    /* Setup the IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* Pickup the fast timer of the socket.  */
+    wheel_ptr =  &(ip_ptr -> nx_ip_tcp_fast_timer_wheel);
+    timer_ptr =  &(socket_ptr -> nx_tcp_socket_fast_timer);
+
+    /* Pickup the tick the timeouts are brought up to.  */
+    tick =  wheel_ptr -> nx_tcp_timer_wheel_tick;
+    if (timer_ptr -> nx_tcp_timer_list == &(wheel_ptr -> nx_tcp_timer_wheel_expired))
+    {
+        tick--;
+    }
+
+    /* Compute the time elapsed since the timeouts were updated.  */
+    elapsed =  (tick - timer_ptr -> nx_tcp_timer_updated) * _nx_tcp_fast_timer_rate;
+    timer_ptr -> nx_tcp_timer_updated =  tick;
+
+    /* Determine if time has elapsed.  */
+    if (elapsed)
+    {
+
+        /* Determine if the socket has delayed sending an ACK.  */
+        if ((socket_ptr -> nx_tcp_socket_state >= NX_TCP_ESTABLISHED) &&
+            ((socket_ptr -> nx_tcp_socket_rx_sequence != socket_ptr -> nx_tcp_socket_rx_sequence_acked) ||
+             (socket_ptr -> nx_tcp_socket_rx_window_last_sent < socket_ptr -> nx_tcp_socket_rx_window_current)))
+        {
+
+            /* Yes, update the delayed ACK timeout.  An expired timeout is handled by
+               the next fast periodic processing.  */
+            if (socket_ptr -> nx_tcp_socket_delayed_ack_timeout > elapsed)
+            {
+                socket_ptr -> nx_tcp_socket_delayed_ack_timeout -= elapsed;
+            }
+            else
+            {
+                socket_ptr -> nx_tcp_socket_delayed_ack_timeout =  1;
+            }
+        }
+
+        /* Determine if a timeout is active.  */
+        if (socket_ptr -> nx_tcp_socket_timeout)
+        {
+
+            /* Yes, update the timeout.  */
+            if (socket_ptr -> nx_tcp_socket_timeout > elapsed)
+            {
+                socket_ptr -> nx_tcp_socket_timeout -= elapsed;
+            }
+            else
+            {
+                socket_ptr -> nx_tcp_socket_timeout =  1;
+            }
+        }
+    }
+
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    /* Pickup the keepalive timer of the socket.  */
+    wheel_ptr =  &(ip_ptr -> nx_ip_tcp_keepalive_timer_wheel);
+    timer_ptr =  &(socket_ptr -> nx_tcp_socket_keepalive_timer);
+
+    /* Pickup the tick the keepalive timeout is brought up to.  */
+    tick =  wheel_ptr -> nx_tcp_timer_wheel_tick;
+    if (timer_ptr -> nx_tcp_timer_list == &(wheel_ptr -> nx_tcp_timer_wheel_expired))
+    {
+        tick--;
+    }
+
+    /* Compute the number of seconds elapsed since the keepalive timeout was updated.  */
+    elapsed =  tick - timer_ptr -> nx_tcp_timer_updated;
+    timer_ptr -> nx_tcp_timer_updated =  tick;
+
+    /* Determine if the keepalive timer is active.  */
+    if ((elapsed) && (socket_ptr -> nx_tcp_socket_keepalive_enabled) &&
+        (socket_ptr -> nx_tcp_socket_state == NX_TCP_ESTABLISHED) && (socket_ptr -> nx_tcp_socket_keepalive_timeout))
+    {
+
+        /* Yes, update the keepalive timeout.  */
+        if (socket_ptr -> nx_tcp_socket_keepalive_timeout > elapsed)
+        {
+            socket_ptr -> nx_tcp_socket_keepalive_timeout -= elapsed;
+        }
+        else
+        {
+            socket_ptr -> nx_tcp_socket_keepalive_timeout =  1;
+        }
+    }
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+}
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
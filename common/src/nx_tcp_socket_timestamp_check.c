@@ -0,0 +1,152 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_timestamp_check                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function processes the timestamps option of a         */
+/*    segment received on a connection that uses timestamps, RFC 7323.    */
+/*                                                                        */
+/*    A segment with a timestamp older than the most recent timestamp of  */
+/*    the peer (TS.Recent) is a duplicate of an earlier segment, and      */
+/*    NX_FALSE is returned so it is dropped by Protection Against         */
+/*    Wrapped Sequences (PAWS), unless it is a reset. TS.Recent is not    */
+/*    used when the connection was idle for more than 24 days.            */
+/*                                                                        */
+/*    Otherwise TS.Recent is updated if the segment covers the last       */
+/*    acknowledged sequence number, and the timestamp echo reply of an    */
+/*    acknowledgment is saved for the round trip time measurement. A      */
+/*    segment without the option is accepted.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    packet_ptr                            Pointer to packet to process  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_FALSE                              Segment fails PAWS check      */
+/*    NX_TRUE                               Segment passes PAWS check     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_timestamp_option_get          Get timestamps option         */
+/*    NX_TCP_TIMESTAMP_GET                  Get timestamp clock           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_packet_process         Process packet for socket     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_timestamp_check(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_TCP_HEADER *tcp_header_ptr;
+ULONG          header_length;
+ULONG          timestamp_value;
+ULONG          timestamp_echo;
+ULONG          current_time;
+UINT           timestamp_found;
+
+
+    /* No echo is used unless the segment carries one.  */
+    socket_ptr -> nx_tcp_socket_timestamp_echo =  0;
+
+    /* Setup a pointer to the TCP header.  The first words of the header are already in host
+       byte order, while the option area is not.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    tcp_header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_length =  (tcp_header_ptr -> nx_tcp_header_word_3 >> NX_TCP_HEADER_SHIFT) * (ULONG)sizeof(ULONG);
+
+    /* Search for the timestamps option.  */
+    if ((header_length <= sizeof(NX_TCP_HEADER)) ||
+        (_nx_tcp_timestamp_option_get(packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER),
+                                      header_length - (ULONG)sizeof(NX_TCP_HEADER), &timestamp_found,
+                                      &timestamp_value, &timestamp_echo) == NX_FALSE) ||
+        (timestamp_found == NX_FALSE))
+    {
+
+        /* No timestamps, accept the segment.  */
+        return(NX_TRUE);
+    }
+
+    current_time =  NX_TCP_TIMESTAMP_GET();
+
+    /* Determine if TS.Recent is too old to be used.  RFC 7323, Section 5.5.  */
+    if ((current_time - socket_ptr -> nx_tcp_socket_timestamp_recent_time) > NX_TCP_TIMESTAMP_RECENT_EXPIRE)
+    {
+
+        /* Yes, take the timestamp of this segment.  */
+        socket_ptr -> nx_tcp_socket_timestamp_recent =  timestamp_value;
+    }
+
+    /* Determine if the segment is older than the most recent one.  RFC 7323, Section 5.3, R1.  */
+    if (((INT)(timestamp_value - socket_ptr -> nx_tcp_socket_timestamp_recent) < 0) &&
+        (!(tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_RST_BIT)))
+    {
+
+        /* Yes, the segment is a duplicate.  */
+        return(NX_FALSE);
+    }
+
+    /* Update TS.Recent if the segment covers the last acknowledged sequence number.
+       RFC 7323, Section 4.3.  */
+    if ((INT)(tcp_header_ptr -> nx_tcp_sequence_number - socket_ptr -> nx_tcp_socket_rx_sequence_acked) <= 0)
+    {
+        socket_ptr -> nx_tcp_socket_timestamp_recent =  timestamp_value;
+        socket_ptr -> nx_tcp_socket_timestamp_recent_time =  current_time;
+    }
+
+    /* Save the echo of an acknowledgment to measure the round trip time.  */
+    if (tcp_header_ptr -> nx_tcp_header_word_3 & NX_TCP_ACK_BIT)
+    {
+        socket_ptr -> nx_tcp_socket_timestamp_echo =  timestamp_echo;
+    }
+
+    return(NX_TRUE);
+}
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
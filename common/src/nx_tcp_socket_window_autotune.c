@@ -0,0 +1,177 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_window_autotune                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function tunes the receive window of a socket from    */
+/*    the rate the application receives data.  Once per round trip time   */
+/*    seen by the receiver, if the application received more data than   */
+/*    in any round trip time before, the window is grown to twice that    */
+/*    amount so that the sender is not limited by the window while its    */
+/*    congestion window grows.  The window is bounded by the maximum set  */
+/*    by the application and by the window scale of the connection, and   */
+/*    it grows by at most half of the free space of the packet pool.  The */
+/*    window never shrinks during a connection.  This function is called  */
+/*    when data is delivered to the application, with the IP protection   */
+/*    held.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*    bytes_received                        Bytes delivered to the        */
+/*                                            application                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get the current time          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_receive                Receive data from a socket    */
+/*    _nx_tcp_socket_state_data_check       Process received data         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_window_autotune(NX_TCP_SOCKET *socket_ptr, ULONG bytes_received)
+{
+
+ULONG           current_time;
+ULONG           copied;
+ULONG           window;
+ULONG           window_limit;
+ULONG           increase_limit;
+NX_PACKET_POOL *pool_ptr;
+
+
+    /* Determine if the receive window of the socket is tuned.  */
+    if (socket_ptr -> nx_tcp_socket_rx_autotune_maximum == 0)
+    {
+
+        /* No, nothing to tune.  */
+        return;
+    }
+
+    /* Account for the data received by the application.  */
+    copied =  socket_ptr -> nx_tcp_socket_rx_autotune_copied + bytes_received;
+    socket_ptr -> nx_tcp_socket_rx_autotune_copied =  copied;
+
+    /* The window is tuned once per round trip time, which must have been measured.  */
+    if (socket_ptr -> nx_tcp_socket_rx_autotune_rtt == 0)
+    {
+        return;
+    }
+
+    /* Pickup the current time.  */
+    current_time =  tx_time_get();
+
+    /* Determine if a round trip time has passed.  */
+    if ((current_time - socket_ptr -> nx_tcp_socket_rx_autotune_time) < socket_ptr -> nx_tcp_socket_rx_autotune_rtt)
+    {
+        return;
+    }
+
+    /* Determine if the application received more than in any round trip time before.  */
+    if (copied > socket_ptr -> nx_tcp_socket_rx_autotune_space)
+    {
+
+        /* Yes, offer twice the data received so that the window stays ahead of the sender.  */
+        window =  copied << 1;
+
+        /* Bound the window by the maximum of the application.  */
+        window_limit =  socket_ptr -> nx_tcp_socket_rx_autotune_maximum;
+
+#ifdef NX_ENABLE_TCP_WINDOW_SCALING
+        /* And by the largest window that can be advertised with the scale of the connection.  */
+        if (window_limit > ((ULONG)NX_LOWER_16_MASK << socket_ptr -> nx_tcp_rcv_win_scale_value))
+        {
+            window_limit =  (ULONG)NX_LOWER_16_MASK << socket_ptr -> nx_tcp_rcv_win_scale_value;
+        }
+#else
+        /* And by the largest window that can be advertised without scaling.  */
+        if (window_limit > NX_LOWER_16_MASK)
+        {
+            window_limit =  NX_LOWER_16_MASK;
+        }
+#endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+
+        if (window > window_limit)
+        {
+            window =  window_limit;
+        }
+
+        /* Determine if the window grows.  */
+        if (window > socket_ptr -> nx_tcp_socket_rx_window_default)
+        {
+
+            /* Data in the grown window is held in packets of the default pool, leave at least
+               half of the free packets to other sockets.  */
+            pool_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr -> nx_ip_default_packet_pool;
+            increase_limit =  (pool_ptr -> nx_packet_pool_available * pool_ptr -> nx_packet_pool_payload_size) >> 1;
+            if ((window - socket_ptr -> nx_tcp_socket_rx_window_default) > increase_limit)
+            {
+                window =  socket_ptr -> nx_tcp_socket_rx_window_default + increase_limit;
+            }
+
+            /* Grow the default and the current window by the same amount.  */
+            socket_ptr -> nx_tcp_socket_rx_window_current += window - socket_ptr -> nx_tcp_socket_rx_window_default;
+            socket_ptr -> nx_tcp_socket_rx_window_default =  window;
+        }
+
+        /* Remember the most data received in one round trip time.  */
+        socket_ptr -> nx_tcp_socket_rx_autotune_space =  copied;
+    }
+
+    /* Start the next round trip time.  */
+    socket_ptr -> nx_tcp_socket_rx_autotune_copied =  0;
+    socket_ptr -> nx_tcp_socket_rx_autotune_time =    current_time;
+}
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
@@ -0,0 +1,96 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_window_autotune_reset                PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function starts the receive window of a new           */
+/*    connection from the window the socket was created with, so that a   */
+/*    window grown by an earlier connection is tuned again.  It is called */
+/*    before the receive window of the connection is set up, with the IP  */
+/*    protection held.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get the current time          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_server_socket_accept          Accept a TCP connection       */
+/*    _nxd_tcp_client_socket_connect        Connect a TCP client socket   */
+/*    _nx_tcp_socket_syn_cookie_establish   Establish socket from cookie  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_window_autotune_reset(NX_TCP_SOCKET *socket_ptr)
+{
+
+    /* Determine if the receive window of the socket is tuned.  */
+    if (socket_ptr -> nx_tcp_socket_rx_autotune_maximum)
+    {
+
+        /* Yes, start from the window the socket was created with.  */
+        socket_ptr -> nx_tcp_socket_rx_window_default =  socket_ptr -> nx_tcp_socket_rx_autotune_initial;
+    }
+
+    /* Clear the measurements of the previous connection.  */
+    socket_ptr -> nx_tcp_socket_rx_autotune_rtt =           0;
+    socket_ptr -> nx_tcp_socket_rx_autotune_rtt_sequence =  0;
+    socket_ptr -> nx_tcp_socket_rx_autotune_rtt_time =      0;
+    socket_ptr -> nx_tcp_socket_rx_autotune_copied =        0;
+    socket_ptr -> nx_tcp_socket_rx_autotune_time =          tx_time_get();
+    socket_ptr -> nx_tcp_socket_rx_autotune_space =         0;
+}
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
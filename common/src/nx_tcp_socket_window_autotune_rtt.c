@@ -0,0 +1,135 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_window_autotune_rtt                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function measures the round trip time seen by the     */
+/*    receiver of a socket whose receive window is tuned.  A measurement  */
+/*    ends when the data of one receive window beyond the sequence number */
+/*    at its start has arrived, which takes one round trip time when the  */
+/*    sender fills the window.  The smallest sample is taken at once,     */
+/*    larger samples are smoothed.  This function is called when the      */
+/*    received data advanced the receive sequence number, with the IP     */
+/*    protection held.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get the current time          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_data_check       Process received data         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_window_autotune_rtt(NX_TCP_SOCKET *socket_ptr)
+{
+
+ULONG current_time;
+ULONG rtt;
+
+
+    /* Determine if the receive window of the socket is tuned.  */
+    if (socket_ptr -> nx_tcp_socket_rx_autotune_maximum == 0)
+    {
+
+        /* No, nothing to measure.  */
+        return;
+    }
+
+    /* Pickup the current time.  */
+    current_time =  tx_time_get();
+
+    /* Determine if a measurement is in progress.  */
+    if (socket_ptr -> nx_tcp_socket_rx_autotune_rtt_time != 0)
+    {
+
+        /* Determine if the data of the window has arrived.  */
+        if ((INT)(socket_ptr -> nx_tcp_socket_rx_sequence - socket_ptr -> nx_tcp_socket_rx_autotune_rtt_sequence) < 0)
+        {
+
+            /* No, the measurement is still in progress.  */
+            return;
+        }
+
+        /* A window received within the same tick counts as one tick.  */
+        rtt =  current_time - socket_ptr -> nx_tcp_socket_rx_autotune_rtt_time;
+        if (rtt == 0)
+        {
+            rtt =  1;
+        }
+
+        /* Take a smaller sample at once, the sender may not have filled the window before.  */
+        if ((socket_ptr -> nx_tcp_socket_rx_autotune_rtt == 0) ||
+            (rtt < socket_ptr -> nx_tcp_socket_rx_autotune_rtt))
+        {
+            socket_ptr -> nx_tcp_socket_rx_autotune_rtt =  rtt;
+        }
+        else
+        {
+
+            /* Smooth the larger sample with a gain of 1/8.  */
+            socket_ptr -> nx_tcp_socket_rx_autotune_rtt =
+                ((socket_ptr -> nx_tcp_socket_rx_autotune_rtt * 7) + rtt) >> 3;
+        }
+    }
+
+    /* Start the next measurement, which ends when the data of the current window has arrived.  */
+    socket_ptr -> nx_tcp_socket_rx_autotune_rtt_sequence =  socket_ptr -> nx_tcp_socket_rx_sequence +
+                                                            socket_ptr -> nx_tcp_socket_rx_window_default;
+    socket_ptr -> nx_tcp_socket_rx_autotune_rtt_time =      current_time;
+}
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
@@ -0,0 +1,113 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_check                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function checks whether an ACK that matches no socket */
+/*    completes a handshake started with a SYN cookie.  The acknowledged  */
+/*    sequence number must be a cookie computed in the current or in the  */
+/*    previous time period for the connection.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to ACK packet         */
+/*    tcp_header_ptr                        Pointer to TCP header         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    mss                                   MSS of the client, zero if    */
+/*                                            the cookie is not valid     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_compute            Compute SYN cookie            */
+/*    tx_time_get                           Get system time               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_syn_cookie_check(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr)
+{
+
+static const ULONG mss_table[] = NX_TCP_SYN_COOKIE_MSS_TABLE;
+ULONG              cookie;
+ULONG              count;
+ULONG              age;
+ULONG              mss_index;
+
+
+    /* The SYN+ACK consumed one sequence number on each side.  */
+    cookie =  tcp_header_ptr -> nx_tcp_acknowledgment_number - 1;
+
+    /* Find how many periods ago the cookie was created.  */
+    count =  tx_time_get() / (NX_IP_PERIODIC_RATE * NX_TCP_SYN_COOKIE_PERIOD);
+    age =    (count - (cookie >> NX_TCP_SYN_COOKIE_COUNT_SHIFT)) & NX_TCP_SYN_COOKIE_COUNT_MASK;
+
+    /* Determine if the cookie has expired.  */
+    if (age > 1)
+    {
+        return(0);
+    }
+
+    /* Pickup the MSS index the cookie claims.  */
+    mss_index =  (cookie >> NX_TCP_SYN_COOKIE_MSS_SHIFT) & NX_TCP_SYN_COOKIE_MSS_MASK;
+
+    /* Compute the cookie again and compare.  */
+    if (_nx_tcp_syn_cookie_compute(ip_ptr, packet_ptr, tcp_header_ptr, tcp_header_ptr -> nx_tcp_sequence_number - 1,
+                                   count - age, mss_index) != cookie)
+    {
+        return(0);
+    }
+
+    /* Return the MSS of the client.  */
+    return(mss_table[mss_index]);
+}
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
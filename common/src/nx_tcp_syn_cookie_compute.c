@@ -0,0 +1,196 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+#include "nx_ip.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_mix                              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function mixes one word into a hash value, with the   */
+/*    finalizer of MurmurHash3.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hash                                  Hash value                    */
+/*    value                                 Word to mix in                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    hash                                  New hash value                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_compute            Compute SYN cookie            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+static ULONG  _nx_tcp_syn_cookie_mix(ULONG hash, ULONG value)
+{
+
+    hash ^= value;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return(hash);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_compute                          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function computes the SYN cookie of a connection      */
+/*    request, the initial sequence number of the SYN+ACK a server sends  */
+/*    when the listen queue is full.  The cookie carries the time count   */
+/*    and the MSS index, and a keyed hash of the addresses, the ports and */
+/*    the initial sequence number of the client, so the final ACK of the  */
+/*    handshake is validated without any state kept for the request.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to packet of client   */
+/*    tcp_header_ptr                        Pointer to TCP header         */
+/*    client_sequence                       Initial sequence number of    */
+/*                                            client                      */
+/*    count                                 Time count of the cookie      */
+/*    mss_index                             Index of the MSS of client    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    cookie                                SYN cookie                    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_mix                Mix word into hash            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_check              Check SYN cookie              */
+/*    _nx_tcp_syn_cookie_send               Send SYN cookie               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_syn_cookie_compute(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr,
+                                  ULONG client_sequence, ULONG count, ULONG mss_index)
+{
+
+ULONG hash;
+#ifdef FEATURE_NX_IPV6
+UINT  i;
+#endif /* FEATURE_NX_IPV6 */
+
+
+    /* Start from the secret of the IP instance.  */
+    hash =  ip_ptr -> nx_ip_tcp_syn_cookie_key[0];
+
+#ifndef NX_DISABLE_IPV4
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+    {
+    NX_IPV4_HEADER *ip_header_ptr;
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ip_header_ptr =  (NX_IPV4_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+        /* Mix in the IPv4 addresses.  */
+        hash =  _nx_tcp_syn_cookie_mix(hash, ip_header_ptr -> nx_ip_header_source_ip);
+        hash =  _nx_tcp_syn_cookie_mix(hash, ip_header_ptr -> nx_ip_header_destination_ip);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
+    {
+    NX_IPV6_HEADER *ipv6_header_ptr;
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ipv6_header_ptr =  (NX_IPV6_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+        /* Mix in the words of the IPv6 addresses.  */
+        for (i = 0; i < 4; i++)
+        {
+            hash =  _nx_tcp_syn_cookie_mix(hash, ipv6_header_ptr -> nx_ip_header_source_ip[i]);
+            hash =  _nx_tcp_syn_cookie_mix(hash, ipv6_header_ptr -> nx_ip_header_destination_ip[i]);
+        }
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Mix in the ports, the sequence number of the client, and the fields carried in the cookie
+       so they can not be altered.  */
+    hash =  _nx_tcp_syn_cookie_mix(hash, tcp_header_ptr -> nx_tcp_header_word_0);
+    hash =  _nx_tcp_syn_cookie_mix(hash, client_sequence);
+    hash =  _nx_tcp_syn_cookie_mix(hash, (count << 2) | mss_index);
+    hash =  _nx_tcp_syn_cookie_mix(hash, ip_ptr -> nx_ip_tcp_syn_cookie_key[1]);
+
+    /* Build the cookie.  */
+    return(((count & NX_TCP_SYN_COOKIE_COUNT_MASK) << NX_TCP_SYN_COOKIE_COUNT_SHIFT) |
+           ((mss_index & NX_TCP_SYN_COOKIE_MSS_MASK) << NX_TCP_SYN_COOKIE_MSS_SHIFT) |
+           (hash & NX_TCP_SYN_COOKIE_HASH_MASK));
+}
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
@@ -0,0 +1,177 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+#include "nx_ip.h"
+
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_ENABLE_TCP_SYN_COOKIES
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_syn_cookie_send                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function answers a connection request that can not   */
+/*    be queued with a SYN+ACK whose sequence number is a SYN cookie.     */
+/*    Nothing is kept for the request, the MSS of the client is rounded   */
+/*    down to an entry of NX_TCP_SYN_COOKIE_MSS_TABLE, and the options    */
+/*    that need state, window scaling, SACK and timestamps, are not       */
+/*    offered.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to SYN packet         */
+/*    tcp_header_ptr                        Pointer to TCP header         */
+/*    mss                                   MSS of the client             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_find                     Find suitable outgoing        */
+/*                                            interface                   */
+/*    _nx_tcp_packet_send_syn               Send SYN+ACK packet           */
+/*    _nx_tcp_syn_cookie_compute            Compute SYN cookie            */
+/*    tx_time_get                           Get system time               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_syn_cookie_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr, NX_TCP_HEADER *tcp_header_ptr, ULONG mss)
+{
+
+static const ULONG mss_table[] = NX_TCP_SYN_COOKIE_MSS_TABLE;
+NX_TCP_SOCKET      fake_socket;
+ULONG              mss_index;
+ULONG              cookie;
+
+
+    /* Pickup the largest MSS of the table the client supports.  */
+    mss_index =  NX_TCP_SYN_COOKIE_MSS_MASK;
+    while ((mss_index > 0) && (mss_table[mss_index] > mss))
+    {
+        mss_index--;
+    }
+
+    /* Compute the cookie.  */
+    cookie =  _nx_tcp_syn_cookie_compute(ip_ptr, packet_ptr, tcp_header_ptr, tcp_header_ptr -> nx_tcp_sequence_number,
+                                         tx_time_get() / (NX_IP_PERIODIC_RATE * NX_TCP_SYN_COOKIE_PERIOD), mss_index);
+
+    /* Clear the fake socket first.  */
+    memset((void *)&fake_socket, 0, sizeof(NX_TCP_SOCKET));
+
+    /* Build a fake socket so we can send the SYN+ACK without a socket for the request.  */
+    fake_socket.nx_tcp_socket_ip_ptr = ip_ptr;
+
+    /* Set the connection IP address.  */
+#ifndef NX_DISABLE_IPV4
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+    {
+    NX_IPV4_HEADER *ip_header_ptr;
+
+        /* Set the IP header.  */
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ip_header_ptr =  (NX_IPV4_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+        /* Set the connection ip.  */
+        fake_socket.nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V4;
+        fake_socket.nx_tcp_socket_connect_ip.nxd_ip_address.v4 = ip_header_ptr -> nx_ip_header_source_ip;
+
+        /* Assume the interface that receives the incoming packet is the best interface
+           for sending responses. */
+        fake_socket.nx_tcp_socket_connect_interface = packet_ptr -> nx_packet_address.nx_packet_interface_ptr;
+        fake_socket.nx_tcp_socket_next_hop_address = NX_NULL;
+
+        /* Find the next hop info. */
+        _nx_ip_route_find(ip_ptr, fake_socket.nx_tcp_socket_connect_ip.nxd_ip_address.v4, &fake_socket.nx_tcp_socket_connect_interface,
+                          &fake_socket.nx_tcp_socket_next_hop_address);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
+    {
+    NX_IPV6_HEADER *ipv6_header_ptr;
+
+        /* Set the IP header.  */
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ipv6_header_ptr = (NX_IPV6_HEADER *)packet_ptr -> nx_packet_ip_header;
+
+        /* Set the connection ip.  */
+        fake_socket.nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V6;
+        COPY_IPV6_ADDRESS(&ipv6_header_ptr -> nx_ip_header_source_ip[0], fake_socket.nx_tcp_socket_connect_ip.nxd_ip_address.v6);
+
+        /* Set the outgoing address.  */
+        fake_socket.nx_tcp_socket_ipv6_addr = packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr;
+
+        /* Set the connect ip interface.  */
+        fake_socket.nx_tcp_socket_connect_interface = packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr -> nxd_ipv6_address_attached;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Set the source port and destination port.  */
+    fake_socket.nx_tcp_socket_port  = (UINT)(tcp_header_ptr -> nx_tcp_header_word_0 & NX_LOWER_16_MASK);
+    fake_socket.nx_tcp_socket_connect_port = (UINT)(tcp_header_ptr -> nx_tcp_header_word_0 >> NX_SHIFT_BY_16);
+    fake_socket.nx_tcp_socket_time_to_live = (UINT)NX_IP_TIME_TO_LIVE;
+
+    /* Answer as a server socket that received the SYN.  The window is limited to one segment
+       until the connection is established on a socket.  */
+    fake_socket.nx_tcp_socket_state = NX_TCP_SYN_RECEIVED;
+    fake_socket.nx_tcp_socket_peer_mss = mss_table[mss_index];
+    fake_socket.nx_tcp_socket_rx_window_current = mss_table[mss_index];
+    fake_socket.nx_tcp_socket_rx_sequence = tcp_header_ptr -> nx_tcp_sequence_number + 1;
+#ifdef NX_ENABLE_TCP_WINDOW_SCALING
+    fake_socket.nx_tcp_snd_win_scale_value = 0xFF;
+#endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+
+    /* Send the SYN+ACK with the cookie as sequence number.  */
+    _nx_tcp_packet_send_syn(&fake_socket, cookie);
+}
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
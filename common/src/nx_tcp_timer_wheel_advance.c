@@ -0,0 +1,169 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_timer_wheel_advance                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function advances the TCP timer wheel by one tick. When the    */
+/*    wheel reaches the next slot of a higher level, the timers of that   */
+/*    slot are placed again in the lower levels. The timers expiring at   */
+/*    the new tick are then moved to the expired list of the wheel, for   */
+/*    the caller to process.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wheel_ptr                             Pointer to timer wheel        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_timer_wheel_insert            Insert timer into wheel       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_periodic_processing      Fast TCP periodic processing  */
+/*    _nx_tcp_periodic_processing           TCP periodic processing       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_timer_wheel_advance(NX_TCP_TIMER_WHEEL *wheel_ptr)
+{
+
+ULONG         tick;
+UINT          level;
+NX_TCP_TIMER *timer_ptr;
+NX_TCP_TIMER *next_ptr;
+NX_TCP_TIMER **list_ptr;
+
+
+    /* Advance the wheel.  */
+    wheel_ptr -> nx_tcp_timer_wheel_tick++;
+    tick =  wheel_ptr -> nx_tcp_timer_wheel_tick;
+
+    /* Loop through the higher levels, starting from the top level.  */
+    for (level = NX_TCP_TIMER_WHEEL_LEVELS - 1; level > 0; level--)
+    {
+
+        /* Determine if the wheel reaches the next slot of this level.  */
+        if (tick & ((((ULONG)1) << (level * NX_TCP_TIMER_WHEEL_BITS)) - 1))
+        {
+
+            /* No, move to the next level.  */
+            continue;
+        }
+
+        /* Detach the timers of the slot.  */
+        list_ptr =   &(wheel_ptr -> nx_tcp_timer_wheel_slots[level][(tick >> (level * NX_TCP_TIMER_WHEEL_BITS)) & NX_TCP_TIMER_WHEEL_MASK]);
+        timer_ptr =  *list_ptr;
+        *list_ptr =  NX_NULL;
+
+        /* Place each timer again.  */
+        while (timer_ptr)
+        {
+
+            /* Pickup the next timer.  */
+            next_ptr =  timer_ptr -> nx_tcp_timer_next;
+
+            /* The timer is no longer on the slot list.  */
+            timer_ptr -> nx_tcp_timer_list =  NX_NULL;
+
+            /* Determine if the timer expires at this tick.  */
+            if (timer_ptr -> nx_tcp_timer_expiration == tick)
+            {
+
+                /* Yes, link it to the slot of this tick in the lowest level.  */
+                list_ptr =  &(wheel_ptr -> nx_tcp_timer_wheel_slots[0][tick & NX_TCP_TIMER_WHEEL_MASK]);
+                timer_ptr -> nx_tcp_timer_next =      *list_ptr;
+                timer_ptr -> nx_tcp_timer_previous =  NX_NULL;
+                if (*list_ptr)
+                {
+                    (*list_ptr) -> nx_tcp_timer_previous =  timer_ptr;
+                }
+                *list_ptr =  timer_ptr;
+                timer_ptr -> nx_tcp_timer_list =  list_ptr;
+            }
+            else
+            {
+
+                /* Place the timer in a lower level.  */
+                _nx_tcp_timer_wheel_insert(wheel_ptr, timer_ptr, timer_ptr -> nx_tcp_timer_expiration);
+            }
+
+            /* Move to the next timer.  */
+            timer_ptr =  next_ptr;
+        }
+    }
+
+    /* Detach the timers expiring at this tick.  */
+    list_ptr =   &(wheel_ptr -> nx_tcp_timer_wheel_slots[0][tick & NX_TCP_TIMER_WHEEL_MASK]);
+    timer_ptr =  *list_ptr;
+    *list_ptr =  NX_NULL;
+
+    /* Move them to the expired list.  */
+    while (timer_ptr)
+    {
+
+        /* Pickup the next timer.  */
+        next_ptr =  timer_ptr -> nx_tcp_timer_next;
+
+        /* Link the timer to the front of the expired list.  */
+        timer_ptr -> nx_tcp_timer_next =      wheel_ptr -> nx_tcp_timer_wheel_expired;
+        timer_ptr -> nx_tcp_timer_previous =  NX_NULL;
+        if (wheel_ptr -> nx_tcp_timer_wheel_expired)
+        {
+            (wheel_ptr -> nx_tcp_timer_wheel_expired) -> nx_tcp_timer_previous =  timer_ptr;
+        }
+        wheel_ptr -> nx_tcp_timer_wheel_expired =  timer_ptr;
+        timer_ptr -> nx_tcp_timer_list =  &(wheel_ptr -> nx_tcp_timer_wheel_expired);
+
+        /* Move to the next timer.  */
+        timer_ptr =  next_ptr;
+    }
+}
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
@@ -0,0 +1,157 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_timer_wheel_insert                          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function arms the TCP timer to expire at the specified tick    */
+/*    of the timer wheel. The timer is placed in the slot of the lowest   */
+/*    level that covers the expiration. A timer beyond the top level is   */
+/*    placed in the last slot of the top level to be reached, and is      */
+/*    placed again when the wheel reaches it. A timer does not expire     */
+/*    before the next tick.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wheel_ptr                             Pointer to timer wheel        */
+/*    timer_ptr                             Pointer to timer              */
+/*    expiration                            Tick the timer expires at     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_timer_wheel_remove            Remove timer from wheel       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_timer_wheel_advance           Advance timer wheel           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_timer_wheel_insert(NX_TCP_TIMER_WHEEL *wheel_ptr, NX_TCP_TIMER *timer_ptr, ULONG expiration)
+{
+
+ULONG          ticks;
+UINT           level;
+UINT           index;
+NX_TCP_TIMER **list_ptr;
+
+
+    /* Compute the number of ticks until the expiration.  */
+    ticks =  expiration - wheel_ptr -> nx_tcp_timer_wheel_tick;
+
+    /* Determine if the expiration has already been reached.  */
+    if ((ticks == 0) || (ticks & 0x80000000))
+    {
+
+        /* Yes, expire the timer at the next tick.  */
+        ticks =       1;
+        expiration =  wheel_ptr -> nx_tcp_timer_wheel_tick + 1;
+    }
+
+    /* Determine if the timer is already armed.  */
+    if (timer_ptr -> nx_tcp_timer_list)
+    {
+
+        /* Determine if the expiration is the same.  */
+        if ((timer_ptr -> nx_tcp_timer_expiration == expiration) &&
+            (timer_ptr -> nx_tcp_timer_list != &(wheel_ptr -> nx_tcp_timer_wheel_expired)))
+        {
+
+            /* Nothing to do, just return.  */
+            return;
+        }
+
+        /* Remove the timer from its current slot.  */
+        _nx_tcp_timer_wheel_remove(timer_ptr);
+    }
+
+    /* Save the expiration.  */
+    timer_ptr -> nx_tcp_timer_expiration =  expiration;
+
+    /* Find the lowest level that covers the expiration.  */
+    for (level = 0; level < (NX_TCP_TIMER_WHEEL_LEVELS - 1); level++)
+    {
+
+        /* Is the expiration in the ticks covered by this level?  */
+        if ((ticks >> ((level + 1) * NX_TCP_TIMER_WHEEL_BITS)) == 0)
+        {
+
+            /* Yes, use this level.  */
+            break;
+        }
+    }
+
+    /* Determine if the expiration is beyond the top level.  */
+    if ((ticks >> (level * NX_TCP_TIMER_WHEEL_BITS)) >= NX_TCP_TIMER_WHEEL_SIZE)
+    {
+
+        /* Yes, use the last slot to be reached.  */
+        index =  (UINT)(((wheel_ptr -> nx_tcp_timer_wheel_tick >> (level * NX_TCP_TIMER_WHEEL_BITS)) - 1) & NX_TCP_TIMER_WHEEL_MASK);
+    }
+    else
+    {
+
+        /* Use the slot of the expiration.  */
+        index =  (UINT)((expiration >> (level * NX_TCP_TIMER_WHEEL_BITS)) & NX_TCP_TIMER_WHEEL_MASK);
+    }
+
+    /* Link the timer to the front of the slot list.  */
+    list_ptr =  &(wheel_ptr -> nx_tcp_timer_wheel_slots[level][index]);
+    timer_ptr -> nx_tcp_timer_next =      *list_ptr;
+    timer_ptr -> nx_tcp_timer_previous =  NX_NULL;
+    if (*list_ptr)
+    {
+        (*list_ptr) -> nx_tcp_timer_previous =  timer_ptr;
+    }
+    *list_ptr =  timer_ptr;
+    timer_ptr -> nx_tcp_timer_list =  list_ptr;
+}
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
@@ -0,0 +1,108 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_timer_wheel_remove                          PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function disarms the TCP timer by removing it from the list    */
+/*    it is on, either a slot of the timer wheel or the expired list.     */
+/*    Nothing is done if the timer is not armed.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                             Pointer to timer              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_periodic_processing      Fast TCP periodic processing  */
+/*    _nx_tcp_periodic_processing           TCP periodic processing       */
+/*    _nx_tcp_socket_delete                 Delete socket                 */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_timer_wheel_insert            Insert timer into wheel       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_timer_wheel_remove(NX_TCP_TIMER *timer_ptr)
+{
+
+    /* Determine if the timer is armed.  */
+    if (timer_ptr -> nx_tcp_timer_list == NX_NULL)
+    {
+
+        /* No, just return.  */
+        return;
+    }
+
+    /* Unlink the timer from the previous timer or the list head.  */
+    if (timer_ptr -> nx_tcp_timer_previous)
+    {
+        (timer_ptr -> nx_tcp_timer_previous) -> nx_tcp_timer_next =  timer_ptr -> nx_tcp_timer_next;
+    }
+    else
+    {
+        *(timer_ptr -> nx_tcp_timer_list) =  timer_ptr -> nx_tcp_timer_next;
+    }
+
+    /* Unlink the timer from the next timer.  */
+    if (timer_ptr -> nx_tcp_timer_next)
+    {
+        (timer_ptr -> nx_tcp_timer_next) -> nx_tcp_timer_previous =  timer_ptr -> nx_tcp_timer_previous;
+    }
+
+    /* Clear the links of the timer.  */
+    timer_ptr -> nx_tcp_timer_next =      NX_NULL;
+    timer_ptr -> nx_tcp_timer_previous =  NX_NULL;
+    timer_ptr -> nx_tcp_timer_list =      NX_NULL;
+}
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
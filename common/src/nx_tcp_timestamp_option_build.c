@@ -0,0 +1,91 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_timestamp_option_build                      PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function builds the timestamps option of a segment,   */
+/*    RFC 7323. The option is preceded by two NOPs, so the timestamps     */
+/*    are aligned on words. The timestamp value (TSval) is the current    */
+/*    time of the timestamp clock, and the timestamp echo reply (TSecr)   */
+/*    is the most recent timestamp received from the peer (TS.Recent).    */
+/*                                                                        */
+/*    The three option words are built in host byte order.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to socket             */
+/*    option_ptr                            Pointer to option words       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_TCP_TIMESTAMP_GET                  Get timestamp clock           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_send_control           Send TCP control packet       */
+/*    _nx_tcp_socket_retransmit_packet      Retransmit packet             */
+/*    _nx_tcp_socket_send_internal          Send data packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_timestamp_option_build(NX_TCP_SOCKET *socket_ptr, ULONG *option_ptr)
+{
+
+    /* Build the option kind and length, behind two NOPs.  */
+    option_ptr[0] =  NX_TCP_TIMESTAMP_OPTION;
+
+    /* Build the timestamp value from the timestamp clock.  */
+    option_ptr[1] =  NX_TCP_TIMESTAMP_GET();
+
+    /* Echo the most recent timestamp of the peer.  */
+    option_ptr[2] =  socket_ptr -> nx_tcp_socket_timestamp_recent;
+}
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
@@ -0,0 +1,166 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+#ifdef NX_ENABLE_TCP_TIMESTAMPS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_timestamp_option_get                        PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function searches for the timestamps option, RFC      */
+/*    7323. If found, first check the option length, if option length is  */
+/*    not valid, it returns NX_FALSE to the caller, else it returns the   */
+/*    TSval and TSecr fields of the option and NX_TRUE to the caller.     */
+/*    Otherwise, the option is not found and NX_TRUE is returned.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    option_ptr                            Pointer to option area        */
+/*    option_area_size                      Size of option area           */
+/*    timestamp_found                       Timestamps option found flag  */
+/*    timestamp_value                       Timestamp value (TSval)       */
+/*    timestamp_echo                        Timestamp echo reply (TSecr)  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_FALSE                              TCP option is invalid         */
+/*    NX_TRUE                               TCP option is valid           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                TCP packet processing         */
+/*    _nx_tcp_server_socket_relisten        Socket relisten processing    */
+/*    _nx_tcp_socket_timestamp_check        Check timestamps of segment   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_timestamp_option_get(UCHAR *option_ptr, ULONG option_area_size, UINT *timestamp_found,
+                                   ULONG *timestamp_value, ULONG *timestamp_echo)
+{
+
+ULONG option_length;
+
+
+    /* Set the option as not found, in case the segment does not contain the timestamps option. */
+    *timestamp_found = NX_FALSE;
+
+    /* Loop through the option area looking for the timestamps option.  */
+    while (option_area_size >= 2)
+    {
+
+        /* Is the current character the timestamps type?  */
+        if (*option_ptr == NX_TCP_TIMESTAMP_KIND)
+        {
+
+            /* Yes, we found it!  */
+
+            /* Check the option length, if option length is not equal to 10, return NX_FALSE.  */
+            if ((*(option_ptr + 1) != NX_TCP_TIMESTAMP_LENGTH) || (option_area_size < NX_TCP_TIMESTAMP_LENGTH))
+            {
+                return(NX_FALSE);
+            }
+
+            /* Pickup the timestamps, in network byte order.  */
+            *timestamp_value = ((ULONG)option_ptr[2] << 24) | ((ULONG)option_ptr[3] << 16) |
+                               ((ULONG)option_ptr[4] << 8) | (ULONG)option_ptr[5];
+            *timestamp_echo =  ((ULONG)option_ptr[6] << 24) | ((ULONG)option_ptr[7] << 16) |
+                               ((ULONG)option_ptr[8] << 8) | (ULONG)option_ptr[9];
+
+            *timestamp_found = NX_TRUE;
+
+            break;
+        }
+
+        /* Otherwise, process relative to the option type.  */
+
+        /* Check for end of list.  */
+        if (*option_ptr == NX_TCP_EOL_KIND)
+        {
+
+            /* Yes, end of list, get out!  */
+            break;
+        }
+
+        /* Check for NOP.  */
+        if (*option_ptr == NX_TCP_NOP_KIND)
+        {
+            /* One character option!  Skip this option and move to the next entry. */
+            option_ptr++;
+
+            option_area_size--;
+        }
+        else
+        {
+
+            /* Derive the option length.  */
+            option_length = *(option_ptr + 1);
+
+            if (option_length == 0)
+            {
+                /* Illegal option length. */
+                return(NX_FALSE);
+            }
+
+            /* Move the option pointer forward.  */
+            option_ptr =  option_ptr + option_length;
+
+            /* Determine if this is greater than the option area size.  */
+            if (option_length > option_area_size)
+            {
+                return(NX_FALSE);
+            }
+            else
+            {
+                option_area_size =  option_area_size - option_length;
+            }
+        }
+    }
+
+    /* Return.  */
+    return(NX_TRUE);
+}
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
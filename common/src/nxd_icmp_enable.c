@@ -109,6 +109,13 @@ UINT _nxd_icmp_enable(NX_IP *ip_ptr)
     /* Set the initial size to zero. */
     ip_ptr -> nx_ipv6_destination_table_size = 0;
 
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* Clear the hash buckets of the tables and the list of entries being probed. */
+    memset(ip_ptr -> nx_ipv6_nd_cache_hash, 0, sizeof(ip_ptr -> nx_ipv6_nd_cache_hash));
+    memset(ip_ptr -> nx_ipv6_destination_hash, 0, sizeof(ip_ptr -> nx_ipv6_destination_hash));
+    ip_ptr -> nx_ipv6_nd_cache_probe_list = NX_NULL;
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
+
 #ifdef NX_ENABLE_IPV6_PATH_MTU_DISCOVERY
     /* Set up the MTU path discovery periodic update. */
     ip_ptr -> nx_destination_table_periodic_update = _nx_icmpv6_destination_table_periodic_update;
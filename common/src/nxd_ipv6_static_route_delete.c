@@ -0,0 +1,123 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol version 6 (IPv6)                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+#include "nx_ip.h"
+#include "nx_nd_cache.h"
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_ipv6_static_route_delete                       PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes an IPv6 static route from the routing trie.   */
+/*    The destinations of the prefix are removed from the destination     */
+/*    table, so that they find their next hop again.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    network_address                       Network address               */
+/*    prefix_length                         Prefix length of the network  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_ip_route_trie_search              Search a route of a prefix    */
+/*    _nx_ip_route_trie_remove              Remove a route from a routing */
+/*                                            trie                        */
+/*    _nx_invalidate_destination_prefix     Invalidate destinations of a  */
+/*                                            prefix                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_ipv6_static_route_delete(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length)
+{
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+NX_IP_ROUTE_NODE *node_ptr;
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NXD_TRACE_IPV6_STATIC_ROUTE_DELETE, ip_ptr, network_address -> nxd_ip_address.v6[3], prefix_length, 0, NX_TRACE_IP_EVENTS, 0, 0);
+
+    /* Obtain the IP mutex so we can manipulate the routing trie.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Search the route.  */
+    node_ptr =  _nx_ip_route_trie_search(ip_ptr -> nx_ip_route_trie_ipv6, network_address -> nxd_ip_address.v6, prefix_length);
+    if (node_ptr == NX_NULL)
+    {
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    /* Destinations of the prefix must find their next hop again.  */
+    _nx_invalidate_destination_prefix(ip_ptr, node_ptr -> nx_ip_route_node_prefix, prefix_length);
+
+    /* Remove the route.  */
+    _nx_ip_route_trie_remove(ip_ptr, &(ip_ptr -> nx_ip_route_trie_ipv6), node_ptr);
+    ip_ptr -> nx_ip_route_trie_count--;
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success to the caller.  */
+    return(NX_SUCCESS);
+
+#else /* !(FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE) */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(network_address);
+    NX_PARAMETER_NOT_USED(prefix_length);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
+}
@@ -0,0 +1,113 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol version 6 (IPv6)                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_ipv6.h"
+
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_ipv6_static_route_find                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the next hop of a destination in the IPv6       */
+/*    static routes of an interface.  The longest matching prefix with a  */
+/*    route on the interface is used.  Link-local destinations are        */
+/*    always on-link and are not routed.  It is called with the IP        */
+/*    protection held.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    if_ptr                                Outgoing interface            */
+/*    dest_addr                             Destination address           */
+/*    next_hop_address                      Next hop address to return    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_SUCCESS                            A route is found              */
+/*    NX_NOT_FOUND                          No route is found             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_trie_find                Find the longest matching     */
+/*                                            node                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ipv6_packet_send                  Send IPv6 packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_ipv6_static_route_find(NX_IP *ip_ptr, NX_INTERFACE *if_ptr, ULONG *dest_addr, ULONG *next_hop_address)
+{
+
+NX_IP_ROUTE_NODE *node_ptr;
+
+
+    /* Link-local destinations are not routed.  */
+    if (IPv6_Address_Type(dest_addr) & IPV6_ADDRESS_LINKLOCAL)
+    {
+        return(NX_NOT_FOUND);
+    }
+
+    /* Search the routing trie from the longest matching prefix to the shortest.  */
+    for (node_ptr = _nx_ip_route_trie_find(ip_ptr -> nx_ip_route_trie_ipv6, dest_addr, 128);
+         node_ptr != NX_NULL;
+         node_ptr = node_ptr -> nx_ip_route_node_parent)
+    {
+
+        /* Skip nodes without a route, and routes of other interfaces.  */
+        if ((node_ptr -> nx_ip_route_node_interface == NX_NULL) ||
+            (node_ptr -> nx_ip_route_node_interface != if_ptr))
+        {
+            continue;
+        }
+
+        /* Use the next hop of the route.  */
+        COPY_IPV6_ADDRESS(node_ptr -> nx_ip_route_node_next_hop, next_hop_address);
+        return(NX_SUCCESS);
+    }
+
+    /* No route is found.  */
+    return(NX_NOT_FOUND);
+}
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
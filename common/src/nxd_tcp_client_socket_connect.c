@@ -217,8 +217,11 @@ NX_IP        *ip_ptr;
 /*                                                                        */
 /*    _nx_tcp_socket_thread_suspend         Suspend thread for connection */
 /*    _nx_tcp_packet_send_syn               Send SYN packet               */
+/*    _nx_tcp_socket_timer_schedule         Schedule socket timeouts      */
+/*    _nx_tcp_socket_timer_sync             Update socket timeouts        */
 /*    _nx_ip_route_find                     Find a suitable outgoing      */
 /*                                            interface.                  */
+/*    _nx_ip_route_cache_find               Find route through the cache  */
 /*    tx_mutex_get                          Obtain protection             */
 /*    tx_mutex_put                          Release protection            */
 /*    _nx_http_proxy_client_initialize      Initialize the HTTP Proxy     */
@@ -276,7 +279,11 @@ ULONG         ip_address_log = 0;
 #ifndef NX_DISABLE_IPV4
     if (server_ip -> nxd_ip_version == NX_IP_VERSION_V4)
     {
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+        if (_nx_ip_route_cache_find(ip_ptr, server_ip -> nxd_ip_address.v4, &outgoing_interface, &socket_ptr -> nx_tcp_socket_next_hop_address) != NX_SUCCESS)
+#else
         if (_nx_ip_route_find(ip_ptr, server_ip -> nxd_ip_address.v4, &outgoing_interface, &socket_ptr -> nx_tcp_socket_next_hop_address) != NX_SUCCESS)
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
         {
             /* Return an IP address error code.  */
             return(NX_IP_ADDRESS_ERROR);
@@ -438,6 +445,11 @@ ULONG         ip_address_log = 0;
         socket_ptr -> nx_tcp_socket_tx_sequence =  socket_ptr -> nx_tcp_socket_tx_sequence + ((ULONG)(((ULONG)0x10000))) + ((ULONG)NX_RAND());
     }
 
+#ifdef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+    /* Start the receive window of the connection from the initial window.  */
+    _nx_tcp_socket_window_autotune_reset(socket_ptr);
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */
+
     /* Ensure the rx window size logic is reset.  */
     socket_ptr -> nx_tcp_socket_rx_window_current =    socket_ptr -> nx_tcp_socket_rx_window_default;
     socket_ptr -> nx_tcp_socket_rx_window_last_sent =  socket_ptr -> nx_tcp_socket_rx_window_default;
@@ -449,10 +461,20 @@ ULONG         ip_address_log = 0;
     /* Increment the sequence number.  */
     socket_ptr -> nx_tcp_socket_tx_sequence++;
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Bring the socket timeouts up to date before they are changed.  */
+    _nx_tcp_socket_timer_sync(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
     /* Setup a timeout so the connection attempt can be sent again.  */
     socket_ptr -> nx_tcp_socket_timeout =          socket_ptr -> nx_tcp_socket_timeout_rate;
     socket_ptr -> nx_tcp_socket_timeout_retries =  0;
 
+#ifdef NX_ENABLE_TCP_TIMER_WHEEL
+    /* Schedule the socket timeouts on the timer wheel.  */
+    _nx_tcp_socket_timer_schedule(socket_ptr);
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
+
     /* CLEANUP: In case any existing packets on socket's receive queue.  */
     if (socket_ptr -> nx_tcp_socket_receive_queue_count)
     {
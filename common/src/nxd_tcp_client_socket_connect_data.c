@@ -0,0 +1,176 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+#include "nx_packet.h"
+
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_tcp_client_socket_connect_data                 PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function handles the connect request for the supplied socket   */
+/*    with TCP Fast Open.  The SYN requests a cookie from the server, or  */
+/*    presents the cookie saved from a previous connection along with     */
+/*    the initial data of the packet.  The data not acknowledged by the   */
+/*    SYN+ACK is sent once the connection is established.                 */
+/*                                                                        */
+/*    Once the connection attempt is started, the packet is released by   */
+/*    NetX Duo whatever the outcome.  It stays with the application only  */
+/*    when NX_NOT_BOUND or NX_NOT_CLOSED is returned.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP client socket  */
+/*    server_ip                             IP address of server          */
+/*    server_port                           Port number of server         */
+/*    packet_ptr                            Pointer to initial data       */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_tcp_client_socket_connect        Actual client socket connect  */
+/*                                            function                    */
+/*    _nx_tcp_socket_send                   Send the initial data         */
+/*    _nx_packet_release                    Release the packet            */
+/*    tx_mutex_get                          Obtain protection             */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_tcp_client_socket_connect_data(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip,
+                                          UINT server_port, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+#ifdef NX_ENABLE_TCP_FAST_OPEN
+NX_IP     *ip_ptr;
+NX_PACKET *pending_packet_ptr;
+UINT       status;
+
+
+    /* Setup IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_CLIENT_SOCKET_CONNECT_DATA, ip_ptr, socket_ptr, packet_ptr, server_port, NX_TRACE_TCP_EVENTS, 0, 0);
+
+    /* Obtain the IP mutex so the initial data can be attached to the socket.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Determine if the socket is bound.  */
+    if (!socket_ptr -> nx_tcp_socket_bound_next)
+    {
+
+        /* Release protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return a not bound error code.  */
+        return(NX_NOT_BOUND);
+    }
+
+    /* Determine if the socket is in a pre-connection state without pending data.  */
+    if (((socket_ptr -> nx_tcp_socket_state != NX_TCP_CLOSED) && (socket_ptr -> nx_tcp_socket_state != NX_TCP_TIMED_WAIT)) ||
+        (socket_ptr -> nx_tcp_socket_fast_open_packet))
+    {
+
+        /* Release protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return a not closed error code.  */
+        return(NX_NOT_CLOSED);
+    }
+
+    /* Attach the initial data and request the Fast Open option in the SYN.  */
+    socket_ptr -> nx_tcp_socket_fast_open_packet =  packet_ptr;
+    socket_ptr -> nx_tcp_socket_fast_open_length =  0;
+    socket_ptr -> nx_tcp_socket_fast_open_option =  NX_TRUE;
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Start the connection.  */
+    status =  _nxd_tcp_client_socket_connect(socket_ptr, server_ip, server_port, wait_option);
+
+    /* Detach the initial data if the connection did not take it.  Data left by the transmit
+       window after the connection is established stays on the socket.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+    pending_packet_ptr =  NX_NULL;
+    if ((status != NX_IN_PROGRESS) && (socket_ptr -> nx_tcp_socket_fast_open_packet == packet_ptr) &&
+        (socket_ptr -> nx_tcp_socket_fast_open_option))
+    {
+        pending_packet_ptr =  packet_ptr;
+        socket_ptr -> nx_tcp_socket_fast_open_packet =  NX_NULL;
+        socket_ptr -> nx_tcp_socket_fast_open_length =  0;
+        socket_ptr -> nx_tcp_socket_fast_open_option =  NX_FALSE;
+    }
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    if (pending_packet_ptr)
+    {
+
+        /* Send the data on a connection established without the SYN handshake of the
+           stack, otherwise release it.  */
+        if ((status != NX_SUCCESS) || (_nx_tcp_socket_send(socket_ptr, pending_packet_ptr, wait_option)))
+        {
+            _nx_packet_release(pending_packet_ptr);
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+#else /* !NX_ENABLE_TCP_FAST_OPEN  */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(server_ip);
+    NX_PARAMETER_NOT_USED(server_port);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
+}
@@ -381,8 +381,13 @@ UINT           compute_checksum = 1;
     {
 
         /* Look for a suitable interface. */
+#ifdef NX_ENABLE_IP_ROUTE_CACHE
+        _nx_ip_route_cache_find(ip_ptr, ip_address -> nxd_ip_address.v4, &packet_ptr -> nx_packet_address.nx_packet_interface_ptr,
+                                &next_hop_address);
+#else
         _nx_ip_route_find(ip_ptr, ip_address -> nxd_ip_address.v4, &packet_ptr -> nx_packet_address.nx_packet_interface_ptr,
                           &next_hop_address);
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
 
         /* Check the packet interface.  */
         if (!packet_ptr -> nx_packet_address.nx_packet_interface_ptr)
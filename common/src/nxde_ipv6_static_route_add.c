@@ -0,0 +1,133 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol version 6 (IPv6)                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ipv6.h"
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+#include "nx_ip.h"
+
+/* Bring in externs for caller checking code.  */
+NX_CALLER_CHECKING_EXTERNS
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_ipv6_static_route_add                         PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the IPv6 static route add        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    network_address                       Network address               */
+/*    prefix_length                         Prefix length of the network  */
+/*    next_hop                              Next hop address              */
+/*    interface_index                       Index of the interface        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_ipv6_static_route_add            Actual IPv6 static route add  */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxde_ipv6_static_route_add(NX_IP *ip_ptr, NXD_ADDRESS *network_address, ULONG prefix_length,
+                                  NXD_ADDRESS *next_hop, UINT interface_index)
+{
+#if defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IP_ROUTE_TRIE)
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) ||
+        (network_address == NX_NULL) || (next_hop == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for valid IP version and prefix length.  */
+    if ((network_address -> nxd_ip_version != NX_IP_VERSION_V6) ||
+        (next_hop -> nxd_ip_version != NX_IP_VERSION_V6) ||
+        (prefix_length > 128))
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    if (interface_index >= NX_MAX_PHYSICAL_INTERFACES)
+    {
+        return(NX_INVALID_INTERFACE);
+    }
+
+    /* Make sure the interface is valid.  */
+    if (ip_ptr -> nx_ip_interface[interface_index].nx_interface_valid != NX_TRUE)
+    {
+        return(NX_INVALID_INTERFACE);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual IPv6 static route add function.  */
+    status =  _nxd_ipv6_static_route_add(ip_ptr, network_address, prefix_length, next_hop, interface_index);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !(FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE) */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(network_address);
+    NX_PARAMETER_NOT_USED(prefix_length);
+    NX_PARAMETER_NOT_USED(next_hop);
+    NX_PARAMETER_NOT_USED(interface_index);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* FEATURE_NX_IPV6 && NX_ENABLE_IP_ROUTE_TRIE */
+}
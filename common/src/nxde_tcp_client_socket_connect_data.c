@@ -0,0 +1,171 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+#include "nx_packet.h"
+#include "nx_ipv6.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_tcp_client_socket_connect_data                PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the TCP client socket connect    */
+/*    with initial data function call.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP client socket  */
+/*    server_ip                             IP address of server          */
+/*    server_port                           Port number of server         */
+/*    packet_ptr                            Pointer to initial data       */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Actual completion status      */
+/*    NX_PTR_ERROR                          Invalid pointer input         */
+/*    NX_INVALID_PACKET                     Invalid packet                */
+/*    NX_NOT_ENABLED                        TCP not enabled               */
+/*    NX_IP_ADDRESS_ERROR                   Invalid TCP server IP address */
+/*    NX_INVALID_PORT                       Invalid TCP server port       */
+/*    NX_UNDERFLOW                          Invalid packet prepend        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_tcp_client_socket_connect_data   Actual client socket connect  */
+/*                                            with data function          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxde_tcp_client_socket_connect_data(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip,
+                                           UINT server_port, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+
+UINT status;
+UINT ip_header_size = 0;
+
+
+    /* Check for invalid input pointers.  */
+    if ((socket_ptr == NX_NULL) || (socket_ptr -> nx_tcp_socket_id != NX_TCP_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet pointer.  */
+    /*lint -e{923} suppress cast of ULONG to pointer.  */
+    if ((packet_ptr == NX_NULL) || (packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED)))
+    {
+        return(NX_INVALID_PACKET);
+    }
+
+    /* Verify TCP is enabled.  */
+    if (!(socket_ptr -> nx_tcp_socket_ip_ptr) -> nx_ip_tcp_packet_receive)
+    {
+        return(NX_NOT_ENABLED);
+    }
+
+    /* Check for valid TCP server address. */
+    if (server_ip == NX_NULL)
+    {
+        return(NX_IP_ADDRESS_ERROR);
+    }
+
+#ifndef NX_DISABLE_IPV4
+    /* Check for a valid server IP address if the server_ip is version IPv4.  */
+    if (server_ip -> nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        if (((server_ip -> nxd_ip_address.v4 & NX_IP_CLASS_A_MASK) != NX_IP_CLASS_A_TYPE) &&
+            ((server_ip -> nxd_ip_address.v4 & NX_IP_CLASS_B_MASK) != NX_IP_CLASS_B_TYPE) &&
+            ((server_ip -> nxd_ip_address.v4 & NX_IP_CLASS_C_MASK) != NX_IP_CLASS_C_TYPE))
+        {
+            return(NX_IP_ADDRESS_ERROR);
+        }
+
+        ip_header_size = (UINT)sizeof(NX_IPV4_HEADER);
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (server_ip -> nxd_ip_version == NX_IP_VERSION_V6)
+    {
+        ip_header_size = (UINT)sizeof(NX_IPV6_HEADER);
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Check that the server IP address version is either IPv4 or IPv6. */
+    if (ip_header_size == 0)
+    {
+        return(NX_IP_ADDRESS_ERROR);
+    }
+
+    /* Check for an invalid port.  */
+    if (((ULONG)server_port) > (ULONG)NX_MAX_PORT)
+    {
+        return(NX_INVALID_PORT);
+    }
+
+    /* Check for an invalid packet prepend pointer.  */
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    if ((INT)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start) < (INT)(ip_header_size + sizeof(NX_TCP_HEADER)))
+    {
+        return(NX_UNDERFLOW);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual TCP client socket connect with data function.  */
+    status =  _nxd_tcp_client_socket_connect_data(socket_ptr, server_ip, server_port, packet_ptr, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
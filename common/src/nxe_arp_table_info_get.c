@@ -0,0 +1,108 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_arp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_arp_table_info_get                             PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the ARP table information get    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    table_size                            Destination for number of     */
+/*                                            table entries               */
+/*    table_entries                         Destination for number of ARP */
+/*                                            entries in the table        */
+/*    table_longest_chain                   Destination for number of ARP */
+/*                                            entries in the longest list */
+/*    cache_hits                            Destination for number of     */
+/*                                            packets sent to a resolved  */
+/*                                            ARP entry                   */
+/*    cache_misses                          Destination for number of     */
+/*                                            packets sent to an          */
+/*                                            unresolved ARP entry        */
+/*    cache_evictions                       Destination for number of ARP */
+/*                                            entries reused              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_arp_table_info_get                Actual ARP table information  */
+/*                                            get function                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_arp_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_entries,
+                              ULONG *table_longest_chain, ULONG *cache_hits,
+                              ULONG *cache_misses, ULONG *cache_evictions)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual ARP table information get function.  */
+    status =  _nx_arp_table_info_get(ip_ptr, table_size, table_entries, table_longest_chain,
+                                     cache_hits, cache_misses, cache_evictions);
+
+    /* Return completion status.  */
+    return(status);
+}
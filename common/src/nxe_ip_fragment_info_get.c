@@ -0,0 +1,108 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_ip_fragment_info_get                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the IP fragment information get  */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    contexts_in_use                       Destination for number of     */
+/*                                            reassembly contexts in use  */
+/*    duplicates                            Destination for number of     */
+/*                                            duplicate fragments         */
+/*                                            replaced                    */
+/*    oversize_drops                        Destination for number of     */
+/*                                            fragments beyond the        */
+/*                                            maximum datagram size       */
+/*    limit_drops                           Destination for number of     */
+/*                                            fragments beyond the        */
+/*                                            fragment limit              */
+/*    context_evictions                     Destination for number of     */
+/*                                            contexts reused             */
+/*    reassembly_failures                   Destination for number of     */
+/*                                            datagrams not reassembled   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_fragment_info_get              Actual IP fragment            */
+/*                                            information get function    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_ip_fragment_info_get(NX_IP *ip_ptr, ULONG *contexts_in_use, ULONG *duplicates,
+                                ULONG *oversize_drops, ULONG *limit_drops, ULONG *context_evictions,
+                                ULONG *reassembly_failures)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual IP fragment information get function.  */
+    status =  _nx_ip_fragment_info_get(ip_ptr, contexts_in_use, duplicates, oversize_drops,
+                                       limit_drops, context_evictions, reassembly_failures);
+
+    /* Return completion status.  */
+    return(status);
+}
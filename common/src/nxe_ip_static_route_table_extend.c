@@ -0,0 +1,113 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+/* Bring in externs for caller checking code.  */
+NX_CALLER_CHECKING_EXTERNS
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_ip_static_route_table_extend                   PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the IP static route table        */
+/*    extend function call.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    table_memory                          Pointer to table memory       */
+/*    table_size                            Size of table memory in bytes */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_static_route_table_extend      Actual static route table     */
+/*                                            extend function             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_ip_static_route_table_extend(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size)
+{
+#ifdef NX_ENABLE_IP_ROUTE_TRIE
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) || (table_memory == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for invalid table size, the memory must hold the nodes of one route.  */
+    if (table_size < (2 * sizeof(NX_IP_ROUTE_NODE)))
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual IP static route table extend function.  */
+    status =  _nx_ip_static_route_table_extend(ip_ptr, table_memory, table_size);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_IP_ROUTE_TRIE */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(table_memory);
+    NX_PARAMETER_NOT_USED(table_size);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
+}
@@ -0,0 +1,118 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_allocate_bulk                           PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet allocate bulk         */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pool to allocate packets from */
+/*    packet_array                          Array to place allocated      */
+/*                                            packet pointers             */
+/*    packet_count                          Number of packets requested   */
+/*    packet_type                           Type of packet to allocate    */
+/*    allocated_count                       Pointer to place the number   */
+/*                                            of packets allocated        */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate_bulk              Actual packet allocate bulk   */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_allocate_bulk(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_array, UINT packet_count,
+                                ULONG packet_type, UINT *allocated_count, ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((pool_ptr == NX_NULL) || (pool_ptr -> nx_packet_pool_id != NX_PACKET_POOL_ID) ||
+        (packet_array == NX_NULL) || (allocated_count == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet count.  */
+    if (packet_count == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for an invalid packet type - for alignment purposes, it must be evenly divisible by the size
+       of a ULONG.  */
+    if (packet_type % sizeof(ULONG))
+    {
+        return(NX_OPTION_ERROR);
+    }
+
+    /* Check for a thread caller if the wait option specifies suspension.  */
+    NX_THREAD_WAIT_CALLER_CHECKING
+
+    /* Call actual packet allocate bulk function.  */
+    status =  _nx_packet_allocate_bulk(pool_ptr, packet_array, packet_count, packet_type, allocated_count, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
@@ -0,0 +1,119 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_cache_create                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet cache create          */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pool the cache is created on  */
+/*    cache_ptr                             Packet cache control block    */
+/*    name_ptr                              Packet cache string pointer   */
+/*    cache_size                            Maximum number of packets     */
+/*                                            held in the cache           */
+/*    batch_size                            Number of packets moved       */
+/*                                            between cache and pool at   */
+/*                                            once                        */
+/*    cache_control_block_size              Size of packet cache control  */
+/*                                            block                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_create               Actual packet cache create    */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_cache_create(NX_PACKET_POOL *pool_ptr, NX_PACKET_CACHE *cache_ptr, CHAR *name_ptr,
+                               ULONG cache_size, ULONG batch_size, UINT cache_control_block_size)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((pool_ptr == NX_NULL) || (pool_ptr -> nx_packet_pool_id != NX_PACKET_POOL_ID) ||
+        (cache_ptr == NX_NULL) || (cache_control_block_size != (UINT)sizeof(NX_PACKET_CACHE)))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check whether the packet cache is already created.  */
+    if (cache_ptr -> nx_packet_cache_id == NX_PACKET_CACHE_ID)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid cache size or batch size.  */
+    if ((cache_size == 0) || (batch_size == 0) || (batch_size > cache_size))
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual packet cache create function.  */
+    status =  _nx_packet_cache_create(pool_ptr, cache_ptr, name_ptr, cache_size, batch_size);
+
+    /* Return completion status.  */
+    return(status);
+}
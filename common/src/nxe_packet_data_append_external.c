@@ -0,0 +1,128 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_data_append_external                    PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet data append external  */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to packet to append   */
+/*                                            to                          */
+/*    data_start                            Pointer to start of the data  */
+/*    data_size                             Number of bytes to append     */
+/*    release_notify                        Buffer release notify         */
+/*                                            function                    */
+/*    context                               Context of notify function    */
+/*    pool_ptr                              Pool to allocate packet from  */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_data_append_external       Actual packet data append     */
+/*                                            external function           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_data_append_external(NX_PACKET *packet_ptr, VOID *data_start, ULONG data_size,
+                                       VOID (*release_notify)(VOID *buffer_start, ULONG buffer_size, VOID *context),
+                                       VOID *context, NX_PACKET_POOL *pool_ptr, ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((pool_ptr == NX_NULL) || (pool_ptr -> nx_packet_pool_id != NX_PACKET_POOL_ID) ||
+        (packet_ptr == NX_NULL) || (data_start == NX_NULL) || (release_notify == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid size of data to append.  */
+    if (!data_size)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for an invalid packet prepend pointer.  */
+    /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+    if (packet_ptr -> nx_packet_prepend_ptr < packet_ptr -> nx_packet_data_start)
+    {
+        return(NX_UNDERFLOW);
+    }
+
+    /* Check for an invalid packet append pointer.  */
+    /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+    if (packet_ptr -> nx_packet_append_ptr > packet_ptr -> nx_packet_data_end)
+    {
+        return(NX_OVERFLOW);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREAD_WAIT_CALLER_CHECKING
+
+    /* Call actual packet data append external function.  */
+    status =  _nx_packet_data_append_external(packet_ptr, data_start, data_size, release_notify,
+                                              context, pool_ptr, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
@@ -0,0 +1,141 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_release_bulk                            PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet release bulk          */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_array                          Array of packets to release   */
+/*    packet_count                          Number of packets in the      */
+/*                                            array                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release_bulk               Actual packet release bulk    */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_release_bulk(NX_PACKET **packet_array, UINT packet_count)
+{
+
+UINT       status;
+UINT       i;
+NX_PACKET *packet_ptr;
+
+
+    /* Check for an invalid packet array.  */
+    if (packet_array == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet count.  */
+    if (packet_count == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Loop to check all packets in the array.  */
+    for (i = 0; i < packet_count; i++)
+    {
+
+        /* Setup packet pointer.  */
+        packet_ptr =  packet_array[i];
+
+        /* Simple integrity check on the packet.  */
+        if ((packet_ptr == NX_NULL) || (packet_ptr -> nx_packet_pool_owner == NX_NULL) ||
+            ((packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_id != NX_PACKET_POOL_ID))
+        {
+
+            return(NX_PTR_ERROR);
+        }
+
+        /* Check for an invalid packet prepend pointer.  */
+        /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+        if (packet_ptr -> nx_packet_prepend_ptr < packet_ptr -> nx_packet_data_start)
+        {
+            return(NX_UNDERFLOW);
+        }
+
+        /* Check for an invalid packet append pointer.  */
+        /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+        if (packet_ptr -> nx_packet_append_ptr > packet_ptr -> nx_packet_data_end)
+        {
+            return(NX_OVERFLOW);
+        }
+    }
+
+    /* Call actual packet release bulk function.  */
+    status =  _nx_packet_release_bulk(packet_array, packet_count);
+
+    /* Determine if the packet release was successful.  */
+    if (status == NX_SUCCESS)
+    {
+
+        /* Yes, now clear the application's packet pointers so they can't be accidentally
+           used again by the application.  This is only done when error checking is
+           enabled.  */
+        for (i = 0; i < packet_count; i++)
+        {
+            packet_array[i] =  NX_NULL;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
@@ -0,0 +1,114 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_tcp_connection_table_info_get                  PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the TCP connection table         */
+/*    information get function call.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to the IP instance    */
+/*    table_size                            Destination for number of     */
+/*                                            table entries               */
+/*    table_connections                     Destination for number of     */
+/*                                            connections in the table    */
+/*    table_entries_used                    Destination for number of     */
+/*                                            entries used                */
+/*    table_longest_chain                   Destination for number of     */
+/*                                            connections in the longest  */
+/*                                            entry                       */
+/*    table_lookups                         Destination for number of     */
+/*                                            lookups                     */
+/*    table_hits                            Destination for number of     */
+/*                                            lookups found a connection  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_connection_table_info_get     Actual TCP connection table   */
+/*                                            information get function    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_tcp_connection_table_info_get(NX_IP *ip_ptr, ULONG *table_size, ULONG *table_connections,
+                                         ULONG *table_entries_used, ULONG *table_longest_chain,
+                                         ULONG *table_lookups, ULONG *table_hits)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check to see if TCP is enabled.  */
+    if (!ip_ptr -> nx_ip_tcp_packet_receive)
+    {
+        return(NX_NOT_ENABLED);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual TCP connection table information get function.  */
+    status =  _nx_tcp_connection_table_info_get(ip_ptr, table_size, table_connections, table_entries_used,
+                                                table_longest_chain, table_lookups, table_hits);
+
+    /* Return completion status.  */
+    return(status);
+}
@@ -0,0 +1,109 @@
+/***************************************************************************
+ * Copyright (c) 2024 Microsoft Corporation 
+ * Copyright (c) 2025-present Eclipse ThreadX Contributors
+ * 
+ * This program and the accompanying materials are made available under the
+ * terms of the MIT License which is available at
+ * https://opensource.org/licenses/MIT.
+ * 
+ * SPDX-License-Identifier: MIT
+ **************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_tcp_socket_congestion_control_set              PORTABLE C      */
+/*                                                           6.4.3        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Eclipse ThreadX Contributors                                        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the TCP socket congestion        */
+/*    control set function call.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*    congestion_control                    Pointer to congestion control */
+/*                                            module                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_socket_congestion_control_set Actual congestion control set */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     Eclipse ThreadX          Initial Version 6.4.3         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_tcp_socket_congestion_control_set(NX_TCP_SOCKET *socket_ptr, const NX_TCP_CONGESTION_CONTROL *congestion_control)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((socket_ptr == NX_NULL) || (socket_ptr -> nx_tcp_socket_id != NX_TCP_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid congestion control module.  */
+    if ((congestion_control == NX_NULL) ||
+        (congestion_control -> nx_tcp_congestion_control_initialize == NX_NULL) ||
+        (congestion_control -> nx_tcp_congestion_control_ack == NX_NULL) ||
+        (congestion_control -> nx_tcp_congestion_control_loss == NX_NULL) ||
+        (congestion_control -> nx_tcp_congestion_control_timeout == NX_NULL) ||
+        (congestion_control -> nx_tcp_congestion_control_window_get == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check to see if TCP is enabled.  */
+    if (!(socket_ptr -> nx_tcp_socket_ip_ptr) -> nx_ip_tcp_packet_receive)
+    {
+        return(NX_NOT_ENABLED);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual TCP socket congestion control set function.  */
+    status =  _nx_tcp_socket_congestion_control_set(socket_ptr, congestion_control);
+
+    /* Return completion status.  */
+    return(status);
+}
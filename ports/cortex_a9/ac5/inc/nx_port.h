@@ -149,6 +149,42 @@
 #endif /* htonl */
 #endif
 
+/* Define the NEON routine that returns the 64-bit sum of 32-bit words for the checksum
+   computation.  The words are added pairwise into 64-bit lanes, so no carry is lost.  */
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+
+static __inline ULONG64 _nx_checksum_words_neon(ULONG *long_ptr, ULONG word_count)
+{
+uint64x2_t sum = vdupq_n_u64(0);
+ULONG64    words_checksum;
+
+    /* Sum four words at a time.  */
+    while (word_count >= 4)
+    {
+        sum = vpadalq_u32(sum, vld1q_u32((const uint32_t *)long_ptr));
+        long_ptr += 4;
+        word_count -= 4;
+    }
+
+    words_checksum = vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1);
+
+    /* Sum the remaining words.  */
+    while (word_count)
+    {
+        words_checksum += *long_ptr;
+        long_ptr++;
+        word_count--;
+    }
+
+    return(words_checksum);
+}
+
+#ifndef NX_CHECKSUM_WORDS
+#define NX_CHECKSUM_WORDS(ptr, count)       _nx_checksum_words_neon(ptr, count)
+#endif /* NX_CHECKSUM_WORDS */
+#endif /* __ARM_NEON */
+
 
 /* Define several macros for the error checking shell in NetX.  */
 
@@ -146,6 +146,116 @@
 #endif
 
 
+/* Define the vectorized routines that return the 64-bit sum of 32-bit words for the
+   checksum computation.  The words are widened to 64-bit lanes, so no carry is lost.  */
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef __SSE2__
+static inline ULONG64 _nx_checksum_words_sse2(ULONG *long_ptr, ULONG word_count)
+{
+__m128i zero = _mm_setzero_si128();
+__m128i sum = _mm_setzero_si128();
+__m128i data;
+ULONG64 lanes[2];
+ULONG64 words_checksum;
+
+    /* Sum four words at a time.  */
+    while (word_count >= 4)
+    {
+        data = _mm_loadu_si128((__m128i *)long_ptr);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(data, zero));
+        sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(data, zero));
+        long_ptr += 4;
+        word_count -= 4;
+    }
+
+    _mm_storeu_si128((__m128i *)lanes, sum);
+    words_checksum = lanes[0] + lanes[1];
+
+    /* Sum the remaining words.  */
+    while (word_count)
+    {
+        words_checksum += *long_ptr;
+        long_ptr++;
+        word_count--;
+    }
+
+    return(words_checksum);
+}
+#endif /* __SSE2__ */
+
+#ifdef __AVX2__
+static inline ULONG64 _nx_checksum_words_avx2(ULONG *long_ptr, ULONG word_count)
+{
+__m256i zero = _mm256_setzero_si256();
+__m256i sum = _mm256_setzero_si256();
+__m256i data;
+ULONG64 lanes[4];
+ULONG64 words_checksum;
+
+    /* Sum eight words at a time.  */
+    while (word_count >= 8)
+    {
+        data = _mm256_loadu_si256((__m256i *)long_ptr);
+        sum = _mm256_add_epi64(sum, _mm256_unpacklo_epi32(data, zero));
+        sum = _mm256_add_epi64(sum, _mm256_unpackhi_epi32(data, zero));
+        long_ptr += 8;
+        word_count -= 8;
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, sum);
+    words_checksum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    /* Sum the remaining words with the SSE2 routine.  */
+    return(words_checksum + _nx_checksum_words_sse2(long_ptr, word_count));
+}
+#endif /* __AVX2__ */
+
+#ifdef __ARM_NEON
+static inline ULONG64 _nx_checksum_words_neon(ULONG *long_ptr, ULONG word_count)
+{
+uint64x2_t sum = vdupq_n_u64(0);
+ULONG64    words_checksum;
+
+    /* Sum four words at a time.  */
+    while (word_count >= 4)
+    {
+        sum = vpadalq_u32(sum, vld1q_u32((const uint32_t *)long_ptr));
+        long_ptr += 4;
+        word_count -= 4;
+    }
+
+    words_checksum = vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1);
+
+    /* Sum the remaining words.  */
+    while (word_count)
+    {
+        words_checksum += *long_ptr;
+        long_ptr++;
+        word_count--;
+    }
+
+    return(words_checksum);
+}
+#endif /* __ARM_NEON */
+
+#ifndef NX_CHECKSUM_WORDS
+#if defined(__AVX2__)
+#define NX_CHECKSUM_WORDS(ptr, count)       _nx_checksum_words_avx2(ptr, count)
+#elif defined(__SSE2__)
+#define NX_CHECKSUM_WORDS(ptr, count)       _nx_checksum_words_sse2(ptr, count)
+#elif defined(__ARM_NEON)
+#define NX_CHECKSUM_WORDS(ptr, count)       _nx_checksum_words_neon(ptr, count)
+#endif
+#endif /* NX_CHECKSUM_WORDS */
+
+
 /* Define several macros for the error checking shell in NetX.  */
 
 #ifndef TX_TIMER_PROCESS_IN_ISR
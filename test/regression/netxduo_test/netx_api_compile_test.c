@@ -84,6 +84,8 @@ NX_PACKET *pkt_ptr = NX_NULL;
     nx_arp_static_entries_delete(0);
     nx_arp_static_entry_create(0, 0, 0, 0);
     nx_arp_static_entry_delete(0, 0, 0, 0);
+    nx_arp_table_info_get(0, 0, 0, 0, 0, 0, 0);
+    nx_arp_table_resize(0, 0, 0);
 
     /* APIs for ICMP */
     nx_icmp_enable(0);
@@ -120,6 +122,7 @@ NX_PACKET *pkt_ptr = NX_NULL;
     nx_ip_forwarding_enable(0);
     nx_ip_fragment_disable(0);
     nx_ip_fragment_enable(0);
+    nx_ip_fragment_info_get(0, 0, 0, 0, 0, 0, 0);
     nx_ip_gateway_address_clear(0);
     nx_ip_gateway_address_get(0, 0);
     nx_ip_gateway_address_set(0, 0);
@@ -142,12 +145,20 @@ NX_PACKET *pkt_ptr = NX_NULL;
     nx_ip_interface_status_check(0, 0, 0, 0, 0);
     nx_ip_link_status_change_notify_set(0, 0);
     nx_ip_max_payload_size_find(0, 0, 0, 0, 0, 0, 0, 0);
+    nx_ip_packet_pool_group_set(0, 0);
+#ifndef NX_ENABLE_PACKET_POOL_GROUP
+    _nx_ip_packet_pool_group_set(0, 0);
+#endif
     nx_ip_status_check(0, 0, 0, 0);
     nx_ip_static_route_add(0, 0, 0, 0);
     nx_ip_static_route_delete(0, 0, 0);
 #ifndef NX_ENABLE_IP_STATIC_ROUTING
     _nx_ip_static_route_add(0, 0, 0, 0);
     _nx_ip_static_route_delete(0, 0, 0);
+#endif
+    nx_ip_static_route_table_extend(0, 0, 0);
+#ifndef NX_ENABLE_IP_ROUTE_TRIE
+    _nx_ip_static_route_table_extend(0, 0, 0);
 #endif
     nx_ipv4_multicast_interface_join(0, 0, 0);
     nx_ipv4_multicast_interface_leave(0, 0, 0);
@@ -177,6 +188,12 @@ NX_PACKET *pkt_ptr = NX_NULL;
     _nxd_ipv6_stateless_address_autoconfig_disable(0, 0);
     _nxd_ipv6_stateless_address_autoconfig_enable(0, 0);
 #endif
+    nxd_ipv6_static_route_add(0, 0, 0, 0, 0);
+    nxd_ipv6_static_route_delete(0, 0, 0);
+#if !defined(FEATURE_NX_IPV6) || !defined(NX_ENABLE_IP_ROUTE_TRIE)
+    _nxd_ipv6_static_route_add(0, 0, 0, 0, 0);
+    _nxd_ipv6_static_route_delete(0, 0, 0);
+#endif
 
     /* APIs for RAW service. */
     nx_ip_raw_packet_disable(0);
@@ -201,20 +218,60 @@ NX_PACKET *pkt_ptr = NX_NULL;
 
     /* APIs for packet pool. */
     nx_packet_allocate(0, 0, 0, 0);
+    nx_packet_allocate_bulk(0, 0, 0, 0, 0, 0);
+    nx_packet_cache_allocate(0, 0, 0, 0);
+    nx_packet_cache_create(0, 0, 0, 0, 0);
+    nx_packet_cache_delete(0);
+    nx_packet_cache_flush(0);
+    nx_packet_cache_release(0, pkt_ptr);
+#ifndef NX_ENABLE_PACKET_CACHE
+    _nx_packet_cache_allocate(0, 0, 0, 0);
+    _nx_packet_cache_create(0, 0, 0, 0, 0);
+    _nx_packet_cache_delete(0);
+    _nx_packet_cache_drain(0, 0);
+    _nx_packet_cache_flush(0);
+    _nx_packet_cache_release(0, 0);
+    _nx_packet_pool_cache_info_get(0, 0, 0, 0);
+#endif
+    nx_packet_clone(0, 0, 0, 0);
+#ifndef NX_ENABLE_PACKET_CLONE
+    _nx_packet_clone(0, 0, 0, 0);
+    _nx_packet_pool_shared_info_get(0, 0, 0);
+#endif
     nx_packet_copy(0, 0, 0, 0);
     nx_packet_data_append(0, 0, 0, 0, 0);
+    nx_packet_data_append_external(0, 0, 0, 0, 0, 0, 0);
+#if !defined(NX_ENABLE_PACKET_EXTERNAL_BUFFER) || defined(NX_DISABLE_PACKET_CHAIN)
+    _nx_packet_data_append_external(0, 0, 0, 0, 0, 0, 0);
+#endif
     nx_packet_data_extract_offset(0, 0, 0, 0, 0);
     nx_packet_data_retrieve(0, 0, 0);
     nx_packet_length_get(0, 0);
     nx_packet_pool_create(0, 0, 0, 0, 0);
     nx_packet_pool_delete(0);
+    nx_packet_pool_group_allocate(0, 0, 0, 0, 0);
+    nx_packet_pool_group_create(0, 0);
+    nx_packet_pool_group_delete(0);
+    nx_packet_pool_group_info_get(0, 0, 0);
+    nx_packet_pool_group_pool_add(0, 0);
+#ifndef NX_ENABLE_PACKET_POOL_GROUP
+    _nx_packet_pool_group_allocate(0, 0, 0, 0, 0);
+    _nx_packet_pool_group_create(0, 0);
+    _nx_packet_pool_group_delete(0);
+    _nx_packet_pool_group_info_get(0, 0, 0);
+    _nx_packet_pool_group_pool_add(0, 0);
+#endif
+    nx_packet_pool_cache_info_get(0, 0, 0, 0);
     nx_packet_pool_info_get(0, 0, 0, 0, 0, 0);
     nx_packet_pool_low_watermark_set(0, 0);
+    nx_packet_pool_shared_info_get(0, 0, 0);
 #ifndef NX_ENABLE_LOW_WATERMARK
     _nx_packet_pool_low_watermark_set(0, 0);
 #endif
     nx_packet_release(pkt_ptr);
+    nx_packet_release_bulk(0, 0);
     nx_packet_transmit_release(pkt_ptr);
+    nx_packet_transmit_release_bulk(0, 0);
 
     /* APIs for RARP. */
     nx_rarp_disable(0);
@@ -226,6 +283,8 @@ NX_PACKET *pkt_ptr = NX_NULL;
     nx_tcp_client_socket_connect(0, 0, 0, 0);
     nx_tcp_client_socket_port_get(0, 0);
     nx_tcp_client_socket_unbind(0);
+    nx_tcp_connection_table_enable(0, 0, 0);
+    nx_tcp_connection_table_info_get(0, 0, 0, 0, 0, 0, 0);
     nx_tcp_enable(0);
     nx_tcp_free_port_find(0, 0, 0);
     nx_tcp_info_get(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
@@ -234,7 +293,15 @@ NX_PACKET *pkt_ptr = NX_NULL;
     nx_tcp_server_socket_relisten(0, 0, 0);
     nx_tcp_server_socket_unaccept(0);
     nx_tcp_server_socket_unlisten(0, 0);
+    nx_tcp_socket_ack_policy_set(0, 0, 0);
+#ifndef NX_ENABLE_TCP_ACK_POLICY
+    _nx_tcp_socket_ack_policy_set(0, 0, 0);
+#endif
     nx_tcp_socket_bytes_available(0, 0);
+    nx_tcp_socket_congestion_control_set(0, 0);
+#ifndef NX_ENABLE_TCP_CONGESTION_CONTROL
+    _nx_tcp_socket_congestion_control_set(0, 0);
+#endif
     nx_tcp_socket_create(0, 0, 0, 0, 0, 0, 0, 0, 0);
     nx_tcp_socket_delete(0);
     nx_tcp_socket_disconnect(0, 0);
@@ -248,6 +315,10 @@ NX_PACKET *pkt_ptr = NX_NULL;
     nx_tcp_socket_mss_get(0, 0);
     nx_tcp_socket_mss_peer_get(0, 0);
     nx_tcp_socket_mss_set(0, 0);
+    nx_tcp_socket_pacing_set(0, 0);
+#ifndef NX_ENABLE_TCP_PACING
+    _nx_tcp_socket_pacing_set(0, 0);
+#endif
     nx_tcp_socket_peer_info_get(0, 0, 0);
     nx_tcp_socket_queue_depth_notify_set(0, 0);
 #ifndef NX_ENABLE_TCP_QUEUE_DEPTH_UPDATE_NOTIFY
@@ -266,8 +337,16 @@ NX_PACKET *pkt_ptr = NX_NULL;
     _nx_tcp_socket_timed_wait_callback(0, 0);
 #endif
     nx_tcp_socket_transmit_configure(0, 0, 0, 0, 0);
+    nx_tcp_socket_window_autotune_set(0, 0);
+#ifndef NX_ENABLE_TCP_WINDOW_AUTOTUNING
+    _nx_tcp_socket_window_autotune_set(0, 0);
+#endif
     nx_tcp_socket_window_update_notify_set(0, 0);
     nxd_tcp_client_socket_connect(0, 0, 0, 0);
+    nxd_tcp_client_socket_connect_data(0, 0, 0, 0, 0);
+#ifndef NX_ENABLE_TCP_FAST_OPEN
+    _nxd_tcp_client_socket_connect_data(0, 0, 0, 0, 0);
+#endif
     nxd_tcp_socket_peer_info_get(0, 0, 0);
 
     /* APIs for UDP */
@@ -2,6 +2,7 @@
 
 #include   "tx_api.h"
 #include   "nx_api.h"
+#include   "nx_arp.h"
 
 extern void    test_control_return(UINT status);
 
@@ -111,6 +112,9 @@ UINT        i;
 
 #if (NX_ARP_EXPIRATION_RATE != NX_ARP_UPDATE_RATE)
     ip_0.nx_ip_arp_dynamic_list -> nx_arp_entry_next_update = NX_ARP_UPDATE_RATE;
+#ifdef NX_ENABLE_ARP_HASH_TABLE
+    _nx_arp_entry_timer_schedule(&ip_0, ip_0.nx_ip_arp_dynamic_list);
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
 #endif /* (NX_ARP_EXPIRATION_RATE == 0) */
 
     for (i = 0; i < NX_ARP_MAXIMUM_RETRIES + 1; i++)
@@ -0,0 +1,349 @@
+/* This NetX test concentrates on the resizable ARP table and the ARP timer wheel.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_arp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_ARP_HASH_TABLE) && !defined(NX_DISABLE_IPV4)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               0x88
+#define     DESTINATION             IP_ADDRESS(1, 2, 3, 5)
+#define     UNREACHABLE             IP_ADDRESS(1, 2, 3, 99)
+#define     FIRST_PEER              IP_ADDRESS(1, 2, 3, 10)
+#define     PEERS                   40
+#define     TABLE_SIZE              256
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_IP                   ip_1;
+static NX_UDP_SOCKET           socket_0;
+static NX_UDP_SOCKET           socket_1;
+
+static NX_ARP                 *arp_table[TABLE_SIZE + 3];
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    send_packet(void);
+static void    check_peers(void);
+static NX_ARP *find_entry(ULONG ip_address);
+extern void    _nx_ram_network_driver_1500(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_arp_table_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 1536, pointer, 1536 * 16);
+    pointer = pointer + 1536 * 16;
+
+    /* Create the IP instances.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    status += nx_ip_create(&ip_1, "NetX IP Instance 1", DESTINATION, 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable ARP and supply ARP cache memory for the IP instances.  */
+    status += nx_arp_enable(&ip_0, (void *) pointer, sizeof(NX_ARP) * (PEERS + 8));
+    pointer = pointer + sizeof(NX_ARP) * (PEERS + 8);
+    status += nx_arp_enable(&ip_1, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+
+    /* Enable UDP processing.  */
+    status += nx_udp_enable(&ip_0);
+    status += nx_udp_enable(&ip_1);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+ULONG       table_size;
+ULONG       table_entries;
+ULONG       longest_chain;
+ULONG       cache_hits;
+ULONG       cache_misses;
+ULONG       cache_evictions;
+NX_ARP     *arp_ptr;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   ARP Table Test............................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the parameters of the ARP table services.  */
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if (nx_arp_table_resize(NX_NULL, arp_table, sizeof(arp_table)) != NX_PTR_ERROR)
+    {
+        error_counter++;
+    }
+
+    if (nx_arp_table_resize(&ip_0, arp_table, sizeof(NX_ARP *) - 1) != NX_SIZE_ERROR)
+    {
+        error_counter++;
+    }
+
+    if (nx_arp_table_info_get(NX_NULL, &table_size, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL) != NX_PTR_ERROR)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Create the sockets.  */
+    status = nx_udp_socket_create(&ip_0, &socket_0, "Socket 0", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_create(&ip_1, &socket_1, "Socket 1", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_bind(&socket_0, TEST_PORT, NX_NO_WAIT);
+    status += nx_udp_socket_bind(&socket_1, TEST_PORT, NX_NO_WAIT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Add the peers, the built-in table has fewer lists than peers.  */
+    for (i = 0; i < PEERS; i++)
+    {
+        status += nx_arp_dynamic_entry_set(&ip_0, FIRST_PEER + i, 0x0011, 0x22334400 + i);
+    }
+
+    status += nx_arp_table_info_get(&ip_0, &table_size, &table_entries, &longest_chain, NX_NULL, NX_NULL, NX_NULL);
+    if ((status) || (table_size != NX_ARP_TABLE_SIZE) || (table_entries != PEERS) || (longest_chain < 2))
+    {
+        error_counter++;
+    }
+
+    /* Move the ARP table to larger memory, which is rounded down to a power of two.  */
+    status = nx_arp_table_resize(&ip_0, arp_table, sizeof(arp_table));
+    status += nx_arp_table_info_get(&ip_0, &table_size, &table_entries, &longest_chain, NX_NULL, NX_NULL, NX_NULL);
+    if ((status) || (table_size != TABLE_SIZE) || (table_entries != PEERS) || (longest_chain != 1))
+    {
+        error_counter++;
+    }
+    check_peers();
+
+    /* The first packet to the destination waits for ARP resolution, the next ones are sent
+       to the resolved entry.  */
+    send_packet();
+    send_packet();
+    send_packet();
+
+#ifndef NX_DISABLE_ARP_INFO
+    status = nx_arp_table_info_get(&ip_0, NX_NULL, NX_NULL, NX_NULL, &cache_hits, &cache_misses, NX_NULL);
+    if ((status) || (cache_misses != 1) || (cache_hits != 2))
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ARP_INFO */
+
+    /* An unresolved entry is updated by the timer wheel, NX_ARP_UPDATE_RATE seconds later.  */
+    status = nx_arp_dynamic_entry_set(&ip_0, UNREACHABLE, 0, 0);
+    arp_ptr = find_entry(UNREACHABLE);
+    if ((status) || (arp_ptr == NX_NULL) || (arp_ptr -> nx_arp_timer_list == NX_NULL) ||
+        (arp_ptr -> nx_arp_timer_expiration != ip_0.nx_ip_arp_timer_tick + NX_ARP_UPDATE_RATE))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    tx_thread_sleep((NX_ARP_UPDATE_RATE + 1) * NX_IP_PERIODIC_RATE);
+    if ((arp_ptr -> nx_arp_ip_address != UNREACHABLE) || (arp_ptr -> nx_arp_retries != 1) ||
+        (arp_ptr -> nx_arp_timer_list == NX_NULL))
+    {
+        error_counter++;
+    }
+
+    /* Deleting the entry removes it from the timer wheel.  */
+    status = nx_arp_entry_delete(&ip_0, UNREACHABLE);
+    if ((status) || (arp_ptr -> nx_arp_timer_list != NX_NULL))
+    {
+        error_counter++;
+    }
+
+    /* Adding more peers than ARP entries reuses the least recently used entries.  */
+    for (i = 0; i < ip_0.nx_ip_arp_total_entries; i++)
+    {
+        status += nx_arp_dynamic_entry_set(&ip_0, FIRST_PEER + PEERS + i, 0x0011, 0x22335500 + i);
+    }
+
+#ifndef NX_DISABLE_ARP_INFO
+    status += nx_arp_table_info_get(&ip_0, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, &cache_evictions);
+    if ((status) || (cache_evictions < PEERS))
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ARP_INFO */
+
+    /* Move the ARP table back to the built-in table.  */
+    status += nx_arp_dynamic_entries_invalidate(&ip_0);
+    for (i = 0; i < PEERS; i++)
+    {
+        status += nx_arp_dynamic_entry_set(&ip_0, FIRST_PEER + i, 0x0011, 0x22334400 + i);
+    }
+    status += nx_arp_table_resize(&ip_0, NX_NULL, 0);
+    status += nx_arp_table_info_get(&ip_0, &table_size, &table_entries, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    if ((status) || (table_size != NX_ARP_TABLE_SIZE) || (table_entries != PEERS))
+    {
+        error_counter++;
+    }
+    check_peers();
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send a packet to the destination and receive it.  */
+static void    send_packet(void)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    status = nx_packet_data_append(packet_ptr, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26, &pool_0, NX_NO_WAIT);
+    status += nx_udp_socket_send(&socket_0, packet_ptr, DESTINATION, TEST_PORT);
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+        error_counter++;
+        return;
+    }
+
+    status = nx_udp_socket_receive(&socket_1, &packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    nx_packet_release(packet_ptr);
+}
+
+/* Check the physical address of each peer is found.  */
+static void    check_peers(void)
+{
+UINT        i;
+ULONG       physical_msw;
+ULONG       physical_lsw;
+
+
+    for (i = 0; i < PEERS; i++)
+    {
+        if ((nx_arp_hardware_address_find(&ip_0, FIRST_PEER + i, &physical_msw, &physical_lsw) != NX_SUCCESS) ||
+            (physical_msw != 0x0011) || (physical_lsw != 0x22334400 + i))
+        {
+            error_counter++;
+        }
+    }
+}
+
+/* Find the ARP entry of an IP address in the ARP table.  */
+static NX_ARP *find_entry(ULONG ip_address)
+{
+NX_ARP     *arp_ptr;
+NX_ARP     *list_head;
+
+
+    list_head = ip_0.nx_ip_arp_table[NX_ARP_TABLE_INDEX(&ip_0, ip_address)];
+    arp_ptr = list_head;
+    while (arp_ptr)
+    {
+        if (arp_ptr -> nx_arp_ip_address == ip_address)
+        {
+            return(arp_ptr);
+        }
+
+        arp_ptr = arp_ptr -> nx_arp_active_next;
+        if (arp_ptr == list_head)
+        {
+            break;
+        }
+    }
+
+    return(NX_NULL);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_arp_table_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   ARP Table Test............................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_ARP_HASH_TABLE */
@@ -0,0 +1,153 @@
+/* This NetX test concentrates on the incremental checksum update operations.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ip.h"
+
+extern void  test_control_return(UINT status);
+
+#ifdef __PRODUCT_NETXDUO__
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_WORDS              16
+#define     TEST_LOOPS              1000
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   test_data[TEST_WORDS];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static USHORT  full_checksum(void);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_checksum_adjust_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        i;
+UINT        loop;
+UINT        index;
+USHORT      checksum;
+USHORT      old_short;
+USHORT      new_short;
+ULONG       old_value;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Checksum Adjust Test......................................");
+
+    /* Fill the test data.  */
+    for (i = 0; i < TEST_WORDS; i++)
+    {
+        test_data[i] =  (ULONG)NX_RAND();
+    }
+
+    for (loop = 0; loop < TEST_LOOPS; loop++)
+    {
+
+        /* Update a 16-bit field.  */
+        checksum = full_checksum();
+        index = (UINT)NX_RAND() % TEST_WORDS;
+        old_short = (USHORT)(test_data[index] & NX_LOWER_16_MASK);
+        new_short = (USHORT)NX_RAND();
+        test_data[index] = (test_data[index] & 0xFFFF0000) | new_short;
+        if (_nx_ip_checksum_adjust(checksum, old_short, new_short) != full_checksum())
+        {
+            error_counter++;
+        }
+
+        /* Update a 32-bit field.  */
+        checksum = full_checksum();
+        index = (UINT)NX_RAND() % TEST_WORDS;
+        old_value = test_data[index];
+        test_data[index] = ((ULONG)NX_RAND() << 16) ^ (ULONG)NX_RAND();
+        if (_nx_ip_checksum_adjust_ulong(checksum, old_value, test_data[index]) != full_checksum())
+        {
+            error_counter++;
+        }
+
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Compute the checksum of the test data.  */
+static USHORT  full_checksum(void)
+{
+ULONG   checksum = 0;
+UINT    i;
+
+
+    for (i = 0; i < TEST_WORDS; i++)
+    {
+        checksum += test_data[i] >> 16;
+        checksum += test_data[i] & NX_LOWER_16_MASK;
+    }
+
+    checksum = (checksum >> 16) + (checksum & NX_LOWER_16_MASK);
+    checksum = (checksum >> 16) + (checksum & NX_LOWER_16_MASK);
+
+    return((USHORT)(~checksum));
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_checksum_adjust_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Checksum Adjust Test......................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* __PRODUCT_NETXDUO__ */
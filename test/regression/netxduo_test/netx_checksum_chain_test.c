@@ -0,0 +1,345 @@
+/* This NetX test concentrates on the checksum computation of chained packets, the routines that sum words
+   for the checksum and the copy and checksum operation.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ip.h"
+#include   "nx_packet.h"
+
+extern void  test_control_return(UINT status);
+
+#ifdef __PRODUCT_NETXDUO__
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_SIZE               1500
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   test_data[TEST_SIZE / sizeof(ULONG) + 1];
+static ULONG                   copy_buffer[TEST_SIZE / sizeof(ULONG) + 1];
+
+/* Define the routines that sum words, each compared with the portable routine.  */
+
+static ULONG64 checksum_words_selected(ULONG *long_ptr, ULONG word_count);
+
+static ULONG64               (*checksum_words_routines[])(ULONG *long_ptr, ULONG word_count) =
+{
+    checksum_words_selected,
+#ifdef __SSE2__
+    _nx_checksum_words_sse2,
+#endif /* __SSE2__ */
+#ifdef __AVX2__
+    _nx_checksum_words_avx2,
+#endif /* __AVX2__ */
+#ifdef __ARM_NEON
+    _nx_checksum_words_neon,
+#endif /* __ARM_NEON */
+};
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static USHORT  reference_checksum(UCHAR *data, UINT length);
+static void    verify_copy(UINT source_offset, UINT destination_offset, UINT length);
+static void    verify_words(UCHAR *data, UINT length);
+static void    verify_packet(UINT length);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_checksum_chain_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        i;
+UINT        length;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Checksum Chain Test.......................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Fill the test data.  */
+    for (i = 0; i < TEST_SIZE; i++)
+    {
+        ((UCHAR *)test_data)[i] =  (UCHAR)((i * 7) + (i >> 8) + 1);
+    }
+
+    /* Every routine that sums words matches the portable routine, for all alignments and lengths.  */
+    for (i = 0; i < 4; i++)
+    {
+        for (length = 0; length <= TEST_SIZE - 4; length += 4)
+        {
+            verify_words((UCHAR *)test_data + i, length);
+        }
+    }
+
+    /* Copy and checksum with all combinations of alignments and short lengths.  */
+    for (length = 0; length < 40; length++)
+    {
+        for (i = 0; i < 16; i++)
+        {
+            verify_copy(i & 3, i >> 2, length);
+        }
+    }
+
+    /* Copy and checksum large buffers.  */
+    for (length = TEST_SIZE - 8; length < TEST_SIZE - 3; length++)
+    {
+        verify_copy(0, 0, length);
+        verify_copy(1, 0, length);
+        verify_copy(2, 2, length);
+        verify_copy(3, 1, length);
+    }
+
+    /* The checksum of single and chained packets matches the reference.  */
+    for (length = 1; length <= TEST_SIZE; length += 37)
+    {
+        verify_packet(length);
+    }
+    verify_packet(TEST_SIZE);
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Compute the checksum in network byte order one byte at a time.  */
+static USHORT  reference_checksum(UCHAR *data, UINT length)
+{
+ULONG   checksum = 0;
+UINT    i;
+
+
+    for (i = 0; i + 1 < length; i += 2)
+    {
+        checksum += ((ULONG)data[i] << 8) | data[i + 1];
+    }
+
+    if (length & 1)
+    {
+        checksum += (ULONG)data[length - 1] << 8;
+    }
+
+    checksum = (checksum >> 16) + (checksum & 0xFFFF);
+    checksum = (checksum >> 16) + (checksum & 0xFFFF);
+
+    return((USHORT)checksum);
+}
+
+static ULONG64 checksum_words_selected(ULONG *long_ptr, ULONG word_count)
+{
+    return(NX_CHECKSUM_WORDS(long_ptr, word_count));
+}
+
+static void    verify_words(UCHAR *data, UINT length)
+{
+ULONG64 words_checksum;
+UINT    i;
+
+
+    /* Sum the whole words of the data.  */
+    words_checksum = _nx_ip_checksum_words((ULONG *)data, length >> 2);
+
+    for (i = 0; i < sizeof(checksum_words_routines) / sizeof(checksum_words_routines[0]); i++)
+    {
+        if (checksum_words_routines[i]((ULONG *)data, length >> 2) != words_checksum)
+        {
+            error_counter++;
+        }
+    }
+}
+
+static void    verify_copy(UINT source_offset, UINT destination_offset, UINT length)
+{
+ULONG   checksum;
+USHORT  tmp;
+
+
+    memset(copy_buffer, 0xFF, sizeof(copy_buffer));
+
+    checksum = _nx_ip_checksum_copy((UCHAR *)copy_buffer + destination_offset,
+                                    (UCHAR *)test_data + source_offset, length);
+
+    /* The partial checksum is in host memory order.  */
+    tmp = (USHORT)checksum;
+    NX_CHANGE_USHORT_ENDIAN(tmp);
+
+    if ((checksum > 0xFFFF) || (tmp != reference_checksum((UCHAR *)test_data + source_offset, length)) ||
+        (memcmp((UCHAR *)copy_buffer + destination_offset, (UCHAR *)test_data + source_offset, length)))
+    {
+        error_counter++;
+    }
+
+    /* The bytes around the destination are not modified.  */
+    if (((destination_offset) && (((UCHAR *)copy_buffer)[destination_offset - 1] != 0xFF)) ||
+        (((UCHAR *)copy_buffer)[destination_offset + length] != 0xFF))
+    {
+        error_counter++;
+    }
+}
+
+static void    verify_packet(UINT length)
+{
+NX_PACKET  *packet_ptr;
+NX_PACKET  *current_packet;
+USHORT      tmp;
+ULONG       checksum;
+ULONG       part_checksum;
+UINT        offset;
+UINT        part_length;
+
+
+    /* Build a packet, chained if the data does not fit.  */
+    if (nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT))
+    {
+        error_counter++;
+        return;
+    }
+
+#ifdef NX_DISABLE_PACKET_CHAIN
+    /* Skip the data that does not fit into one packet.  */
+    if (length > (UINT)(packet_ptr -> nx_packet_data_end - packet_ptr -> nx_packet_prepend_ptr))
+    {
+        nx_packet_release(packet_ptr);
+        return;
+    }
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    /* Append the data in parts of odd sizes, summing each part as it is copied.  */
+    checksum = 0;
+    for (offset = 0; offset < length; offset += part_length)
+    {
+        part_length = (offset & 1) ? 7 : 3 + (offset % 101);
+        if (part_length > length - offset)
+        {
+            part_length = length - offset;
+        }
+
+        if (_nx_packet_data_append_checksum(packet_ptr, (UCHAR *)test_data + offset, part_length,
+                                            &pool_0, NX_NO_WAIT, &part_checksum))
+        {
+            error_counter++;
+            nx_packet_release(packet_ptr);
+            return;
+        }
+
+        if (part_checksum > 0xFFFF)
+        {
+            error_counter++;
+        }
+        checksum += part_checksum;
+    }
+
+    /* The sum of the parts is the sum of the data, in host memory order.  */
+    checksum = (checksum >> 16) + (checksum & 0xFFFF);
+    checksum = (checksum >> 16) + (checksum & 0xFFFF);
+    tmp = (USHORT)checksum;
+    NX_CHANGE_USHORT_ENDIAN(tmp);
+    if ((packet_ptr -> nx_packet_length != length) || (tmp != reference_checksum((UCHAR *)test_data, length)) ||
+        (memcmp(packet_ptr -> nx_packet_prepend_ptr, test_data,
+                (UINT)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr))))
+    {
+        error_counter++;
+    }
+
+    /* Sum the words of each packet in the chain, aligned and unaligned.  */
+    current_packet = packet_ptr;
+    while (current_packet)
+    {
+        part_length = (UINT)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+        for (offset = 0; (offset < 4) && (offset < part_length); offset++)
+        {
+            verify_words(current_packet -> nx_packet_prepend_ptr + offset, part_length - offset);
+        }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+        current_packet = current_packet -> nx_packet_next;
+#else
+        current_packet = NX_NULL;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+    }
+
+    /* ICMP checksum does not cover the pseudo header.  */
+    tmp = _nx_ip_checksum_compute(packet_ptr, NX_PROTOCOL_ICMP, length, NX_NULL, NX_NULL);
+    if (tmp != reference_checksum((UCHAR *)test_data, length))
+    {
+        error_counter++;
+    }
+
+    nx_packet_release(packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_checksum_chain_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Checksum Chain Test.......................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* __PRODUCT_NETXDUO__ */
@@ -292,6 +292,11 @@ UINT             i;
     /* Now move this desitnation table entry from the first one to the second one. */
     memcpy(&ip_0.nx_ipv6_destination_table[1], &ip_0.nx_ipv6_destination_table[0], sizeof(ip_0.nx_ipv6_destination_table[0]));
     ip_0.nx_ipv6_destination_table[0].nx_ipv6_destination_entry_valid = NX_FALSE; 
+
+#ifdef NX_ENABLE_IPV6_ND_HASH_TABLE
+    /* The moved entry takes the place of the first one at the head of its hash bucket. */
+    ip_0.nx_ipv6_destination_hash[ip_0.nx_ipv6_destination_table[1].nx_ipv6_destination_entry_hash_index] = &ip_0.nx_ipv6_destination_table[1];
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
     
 
     /* Send ICMP redirect packet to ip_0. */
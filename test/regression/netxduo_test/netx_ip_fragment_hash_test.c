@@ -0,0 +1,400 @@
+/* This NetX test concentrates on the hashed IP fragment reassembly contexts.  */
+/* Test sequence:
+ * 1. Send TEST_DATAGRAMS datagrams whose first fragments are delayed, the latest datagram
+ *    the least, so all the datagrams are in flight and complete out of order.
+ * 2. Send a datagram whose middle fragment is duplicated.
+ * 3. Send one datagram more than NX_IP_FRAGMENT_CONTEXT_MAX with their last fragments dropped,
+ *    so the context of the oldest datagram is reused.
+ */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ip.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_FRAGMENTATION) && \
+    defined(NX_ENABLE_IP_FRAGMENT_HASH_TABLE)
+#include   "nx_ipv4.h"
+#include   "nx_ram_network_driver_test_1500.h"
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_DATAGRAMS          4
+#define     TEST_MESSAGE_SIZE       3000
+
+#define     TEST_MODE_REORDER       1
+#define     TEST_MODE_DUPLICATE     2
+#define     TEST_MODE_DROP_LAST     3
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_IP                   ip_1;
+static NX_UDP_SOCKET           socket_0;
+static NX_UDP_SOCKET           socket_1;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static UINT                    test_mode;
+static UINT                    delayed_fragments;
+static UINT                    duplicated_fragments;
+static CHAR                    message[TEST_MESSAGE_SIZE];
+static CHAR                    receive_buffer[TEST_MESSAGE_SIZE];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    send_message(UINT size, CHAR fill);
+static void    receive_message(UINT size);
+static void    check_contexts(ULONG expected_contexts);
+extern void    _nx_ram_network_driver_1500(struct NX_IP_DRIVER_STRUCT *driver_req);
+extern UINT    (*advanced_packet_process_callback)(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr);
+static UINT    my_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_ip_fragment_hash_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    test_mode =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 1536, pointer, 1536 * 64);
+    pointer = pointer + 1536 * 64;
+
+    /* Create the IP instances.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    status += nx_ip_create(&ip_1, "NetX IP Instance 1", IP_ADDRESS(1, 2, 3, 5), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable ARP, UDP and IP fragmentation for the IP instances.  */
+    status += nx_arp_enable(&ip_0, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+    status += nx_arp_enable(&ip_1, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+    status += nx_udp_enable(&ip_0);
+    status += nx_udp_enable(&ip_1);
+    status += nx_ip_fragment_enable(&ip_0);
+    status += nx_ip_fragment_enable(&ip_1);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT    status;
+UINT    i;
+ULONG   contexts_in_use;
+ULONG   duplicates;
+ULONG   oversize_drops;
+ULONG   limit_drops;
+ULONG   context_evictions;
+ULONG   reassembly_failures;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   IP Fragment Hash Test.....................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create and bind the UDP sockets.  */
+    status =  nx_udp_socket_create(&ip_0, &socket_0, "Socket 0", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_create(&ip_1, &socket_1, "Socket 1", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, TEST_DATAGRAMS * 2);
+    status += nx_udp_socket_bind(&socket_0, 0x88, NX_NO_WAIT);
+    status += nx_udp_socket_bind(&socket_1, 0x89, NX_NO_WAIT);
+
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Resolve the address of ip_1 before the fragments are inspected.  */
+    send_message(16, 'a');
+    receive_message(16);
+
+    advanced_packet_process_callback = my_packet_process;
+
+    /* Send the datagrams with their first fragments delayed.  */
+    test_mode =  TEST_MODE_REORDER;
+    delayed_fragments =  0;
+    for (i = 0; i < TEST_DATAGRAMS; i++)
+    {
+        send_message(TEST_MESSAGE_SIZE, (CHAR)('0' + i));
+    }
+
+    /* All the datagrams are being reassembled.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 10);
+    check_contexts(TEST_DATAGRAMS);
+    status =  nx_ip_fragment_info_get(&ip_1, &contexts_in_use, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    if ((status) || (contexts_in_use != TEST_DATAGRAMS) || (delayed_fragments != TEST_DATAGRAMS))
+    {
+        error_counter++;
+    }
+
+    /* The latest datagram completes first.  */
+    for (i = TEST_DATAGRAMS; i > 0; i--)
+    {
+        memset(message, '0' + i - 1, TEST_MESSAGE_SIZE);
+        receive_message(TEST_MESSAGE_SIZE);
+    }
+    check_contexts(0);
+    if ((ip_1.nx_ip_fragment_assembly_head) || (ip_1.nx_ip_fragment_assembly_tail))
+    {
+        error_counter++;
+    }
+
+    /* Send a datagram whose middle fragment is duplicated.  */
+    test_mode =  TEST_MODE_DUPLICATE;
+    duplicated_fragments =  0;
+    send_message(TEST_MESSAGE_SIZE, 'd');
+    receive_message(TEST_MESSAGE_SIZE);
+    check_contexts(0);
+    status =  nx_ip_fragment_info_get(&ip_1, NX_NULL, &duplicates, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    if ((status) || (duplicated_fragments != 1))
+    {
+        error_counter++;
+    }
+#ifndef NX_DISABLE_IP_INFO
+    if (duplicates != 1)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_IP_INFO */
+
+    /* Fill all the contexts and one more, so the oldest context is reused.  */
+    test_mode =  TEST_MODE_DROP_LAST;
+    for (i = 0; i <= NX_IP_FRAGMENT_CONTEXT_MAX; i++)
+    {
+        send_message(2000, 'e');
+    }
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 10);
+    check_contexts(NX_IP_FRAGMENT_CONTEXT_MAX);
+    status =  nx_ip_fragment_info_get(&ip_1, &contexts_in_use, &duplicates, &oversize_drops, &limit_drops,
+                                      &context_evictions, &reassembly_failures);
+    if ((status) || (contexts_in_use != NX_IP_FRAGMENT_CONTEXT_MAX))
+    {
+        error_counter++;
+    }
+#ifndef NX_DISABLE_IP_INFO
+    if ((duplicates != 1) || (oversize_drops != 0) || (limit_drops != 0) ||
+        (context_evictions != 1) || (reassembly_failures != 1))
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_IP_INFO */
+
+    /* Disabling fragmentation releases the contexts.  */
+    status =  nx_ip_fragment_disable(&ip_1);
+    status += nx_ip_fragment_enable(&ip_1);
+    status += nx_ip_fragment_info_get(&ip_1, &contexts_in_use, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    if ((status) || (contexts_in_use != 0))
+    {
+        error_counter++;
+    }
+    check_contexts(0);
+
+    advanced_packet_process_callback = NX_NULL;
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    else
+    {
+
+        printf("SUCCESS!\n");
+        test_control_return(0);
+    }
+}
+
+/* Send a UDP message of the size filled with the character from ip_0 to ip_1.  */
+static void    send_message(UINT size, CHAR fill)
+{
+UINT       status;
+NX_PACKET *packet_ptr;
+
+
+    memset(message, fill, size);
+    status =  nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_WAIT_FOREVER);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    status =  nx_packet_data_append(packet_ptr, message, size, &pool_0, NX_WAIT_FOREVER);
+    status += nx_udp_socket_send(&socket_0, packet_ptr, IP_ADDRESS(1, 2, 3, 5), 0x89);
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+        error_counter++;
+    }
+}
+
+/* Receive a UDP message on ip_1 and compare it with the last message.  */
+static void    receive_message(UINT size)
+{
+UINT       status;
+ULONG      bytes;
+NX_PACKET *packet_ptr;
+
+
+    status =  nx_udp_socket_receive(&socket_1, &packet_ptr, 2 * NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    status =  nx_packet_data_retrieve(packet_ptr, receive_buffer, &bytes);
+    if ((status) || (bytes != size) || (memcmp(receive_buffer, message, size)))
+    {
+        error_counter++;
+    }
+    nx_packet_release(packet_ptr);
+}
+
+/* Check every active context of ip_1 is in the bucket it was linked to, and the active
+   list holds the first fragments of the re-assembly queue in order.  */
+static void    check_contexts(ULONG expected_contexts)
+{
+ULONG                   contexts = 0;
+NX_IP_FRAGMENT_CONTEXT *context;
+NX_IP_FRAGMENT_CONTEXT *bucket;
+NX_PACKET              *fragment;
+
+
+    fragment =  ip_1.nx_ip_fragment_assembly_head;
+    for (context = ip_1.nx_ip_fragment_context_active_head; context; context = context -> nx_ip_fragment_context_next)
+    {
+        if (context -> nx_ip_fragment_context_head != fragment)
+        {
+            error_counter++;
+            return;
+        }
+        fragment =  fragment -> nx_packet_queue_next;
+
+        for (bucket = ip_1.nx_ip_fragment_context_hash[context -> nx_ip_fragment_context_hash_index];
+             bucket && (bucket != context); bucket = bucket -> nx_ip_fragment_context_hash_next)
+        {
+        }
+
+        if (bucket == NX_NULL)
+        {
+            error_counter++;
+        }
+        contexts++;
+    }
+
+    if ((fragment != NX_NULL) || (contexts != expected_contexts) || (ip_1.nx_ip_fragment_contexts_used != expected_contexts))
+    {
+        error_counter++;
+    }
+}
+
+static UINT    my_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr)
+{
+NX_IPV4_HEADER *header;
+ULONG           word_1;
+
+
+    /* Only inspect the IP packets sent by ip_0.  */
+    if ((ip_ptr != &ip_0) || (packet_ptr -> nx_packet_length <= 28))
+        return NX_TRUE;
+
+    header = (NX_IPV4_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    word_1 = header -> nx_ip_header_word_1;
+    NX_CHANGE_ULONG_ENDIAN(word_1);
+
+    /* Is it fragmented?  */
+    if ((word_1 & NX_IP_FRAGMENT_MASK) == 0)
+        return NX_TRUE;
+
+    if ((test_mode == TEST_MODE_REORDER) && ((word_1 & NX_IP_OFFSET_MASK) == 0))
+    {
+
+        /* Delay the first fragment, the later datagrams for less time.  */
+        *operation_ptr = NX_RAMDRIVER_OP_DELAY;
+        *delay_ptr = (TEST_DATAGRAMS - delayed_fragments) * (NX_IP_PERIODIC_RATE / 5);
+        delayed_fragments++;
+    }
+    else if ((test_mode == TEST_MODE_DUPLICATE) && (word_1 & NX_IP_OFFSET_MASK) && (word_1 & NX_IP_MORE_FRAGMENT))
+    {
+
+        /* Duplicate the middle fragment.  */
+        *operation_ptr = NX_RAMDRIVER_OP_DUPLICATE;
+        duplicated_fragments++;
+    }
+    else if ((test_mode == TEST_MODE_DROP_LAST) && ((word_1 & NX_IP_MORE_FRAGMENT) == 0))
+    {
+
+        /* Drop the last fragment.  */
+        *operation_ptr = NX_RAMDRIVER_OP_DROP;
+    }
+
+    return NX_TRUE;
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_ip_fragment_hash_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   IP Fragment Hash Test.....................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH_TABLE */
@@ -0,0 +1,275 @@
+/* This NetX test concentrates on the route cache of the IPv4 send path.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ipv4.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_IP_ROUTE_CACHE) && defined(NX_ENABLE_IP_STATIC_ROUTING) && !defined(NX_DISABLE_IPV4)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               0x88
+#define     DESTINATION             IP_ADDRESS(1, 2, 3, 5)
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_IP                   ip_1;
+static NX_UDP_SOCKET           socket_0;
+static NX_UDP_SOCKET           socket_1;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    send_packet(void);
+static void    check_route(ULONG destination, UINT expected_status, ULONG expected_next_hop);
+extern void    _nx_ram_network_driver_1500(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_ip_route_cache_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 1536, pointer, 1536 * 16);
+    pointer = pointer + 1536 * 16;
+
+    /* Create the IP instances.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    status += nx_ip_create(&ip_1, "NetX IP Instance 1", DESTINATION, 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable ARP and supply ARP cache memory for the IP instances.  */
+    status += nx_arp_enable(&ip_0, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+    status += nx_arp_enable(&ip_1, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+
+    /* Enable UDP processing.  */
+    status += nx_udp_enable(&ip_0);
+    status += nx_udp_enable(&ip_1);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT                     status;
+NX_IP_ROUTE_CACHE_ENTRY *entry_ptr;
+ULONG                    arp_generation;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   IP Route Cache Test.......................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_udp_socket_create(&ip_0, &socket_0, "Socket 0", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_create(&ip_1, &socket_1, "Socket 1", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_bind(&socket_0, TEST_PORT, NX_NO_WAIT);
+    status += nx_udp_socket_bind(&socket_1, TEST_PORT, NX_NO_WAIT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    entry_ptr = &(ip_0.nx_ip_route_cache[NX_IP_ROUTE_CACHE_INDEX(DESTINATION)]);
+
+    /* The first packet finds the route and resolves the next hop.  */
+    send_packet();
+    if ((entry_ptr -> nx_ip_route_cache_destination != DESTINATION) ||
+        (entry_ptr -> nx_ip_route_cache_next_hop != DESTINATION) ||
+        (entry_ptr -> nx_ip_route_cache_interface != &(ip_0.nx_ip_interface[0])))
+    {
+        error_counter++;
+    }
+
+    /* The next packet uses the cached route and stores the ARP entry of the next hop.  */
+    send_packet();
+    if ((entry_ptr -> nx_ip_route_cache_arp == NX_NULL) ||
+        (entry_ptr -> nx_ip_route_cache_arp -> nx_arp_ip_address != DESTINATION))
+    {
+        error_counter++;
+    }
+
+    /* Then the packets are sent without a lookup.  */
+    send_packet();
+
+#ifndef NX_DISABLE_IP_INFO
+    if ((ip_0.nx_ip_route_cache_misses != 1) || (ip_0.nx_ip_route_cache_hits != 2))
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_IP_INFO */
+
+    /* A static route to the destination replaces the cached route.  */
+    status = nx_ip_static_route_add(&ip_0, DESTINATION, 0xFFFFFFFFUL, IP_ADDRESS(1, 2, 3, 6));
+    check_route(DESTINATION, NX_SUCCESS, IP_ADDRESS(1, 2, 3, 6));
+
+    status += nx_ip_static_route_delete(&ip_0, DESTINATION, 0xFFFFFFFFUL);
+    check_route(DESTINATION, NX_SUCCESS, DESTINATION);
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* A destination out of the network is reached through the gateway once it is set.  */
+    check_route(IP_ADDRESS(5, 6, 7, 8), NX_IP_ADDRESS_ERROR, 0);
+    status = nx_ip_gateway_address_set(&ip_0, IP_ADDRESS(1, 2, 3, 1));
+    check_route(IP_ADDRESS(5, 6, 7, 8), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 1));
+    status += nx_ip_gateway_address_clear(&ip_0);
+    check_route(IP_ADDRESS(5, 6, 7, 8), NX_IP_ADDRESS_ERROR, 0);
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* Removing the ARP entries invalidates the cached ARP entry, the next hop is resolved again.  */
+    arp_generation = ip_0.nx_ip_route_cache_arp_generation;
+    status = nx_arp_dynamic_entries_invalidate(&ip_0);
+    if ((status) || (ip_0.nx_ip_route_cache_arp_generation == arp_generation))
+    {
+        error_counter++;
+    }
+
+    send_packet();
+    send_packet();
+    if ((entry_ptr -> nx_ip_route_cache_arp == NX_NULL) ||
+        (entry_ptr -> nx_ip_route_cache_arp_generation != ip_0.nx_ip_route_cache_arp_generation))
+    {
+        error_counter++;
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send a packet to the destination and receive it.  */
+static void    send_packet(void)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    status = nx_packet_data_append(packet_ptr, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26, &pool_0, NX_NO_WAIT);
+    status += nx_udp_socket_send(&socket_0, packet_ptr, DESTINATION, TEST_PORT);
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+        error_counter++;
+        return;
+    }
+
+    status = nx_udp_socket_receive(&socket_1, &packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    if (packet_ptr -> nx_packet_length != 26)
+    {
+        error_counter++;
+    }
+
+    nx_packet_release(packet_ptr);
+}
+
+/* Find the route of a destination through the route cache and check the next hop.  */
+static void    check_route(ULONG destination, UINT expected_status, ULONG expected_next_hop)
+{
+NX_INTERFACE *interface_ptr = NX_NULL;
+ULONG         next_hop_address = 0;
+
+
+    if (_nx_ip_route_cache_find(&ip_0, destination, &interface_ptr, &next_hop_address) != expected_status)
+    {
+        error_counter++;
+    }
+    else if ((expected_status == NX_SUCCESS) && (next_hop_address != expected_next_hop))
+    {
+        error_counter++;
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_ip_route_cache_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   IP Route Cache Test.......................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_IP_ROUTE_CACHE */
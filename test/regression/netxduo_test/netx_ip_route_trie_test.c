@@ -0,0 +1,366 @@
+/* This NetX test concentrates on the longest prefix match of the static routing trie.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ip.h"
+#ifdef FEATURE_NX_IPV6
+#include   "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_IP_ROUTE_TRIE) && !defined(NX_DISABLE_IPV4)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     ROUTES_EXTENDED         24
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+
+/* Define the memory for the routes beyond the routing table size.  */
+
+static NX_IP_ROUTE_NODE        route_memory[ROUTES_EXTENDED * 2];
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    check_route(ULONG destination, UINT expected_status, ULONG expected_next_hop);
+extern void    _nx_ram_network_driver_1500(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_ip_route_trie_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 1536, pointer, 1536 * 8);
+    pointer = pointer + 1536 * 8;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+ULONG       i;
+#ifdef FEATURE_NX_IPV6
+NXD_ADDRESS network_address;
+NXD_ADDRESS next_hop;
+ULONG       destination[4];
+ULONG       next_hop_address[4];
+#endif /* FEATURE_NX_IPV6 */
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   IP Route Trie Test........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The routing trie only holds contiguous network masks.  */
+    status = nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 0, 0, 0), IP_ADDRESS(255, 0, 255, 0), IP_ADDRESS(1, 2, 3, 10));
+    if (status != NX_INVALID_PARAMETERS)
+    {
+        error_counter++;
+    }
+
+    /* Fill the routes built into the IP instance.  */
+    for (i = 0; i < NX_IP_ROUTING_TABLE_SIZE; i++)
+    {
+        status = nx_ip_static_route_add(&ip_0, IP_ADDRESS(20, 0, i, 0), IP_ADDRESS(255, 255, 255, 0), IP_ADDRESS(1, 2, 3, 20));
+        if (status)
+        {
+            error_counter++;
+        }
+    }
+
+    status = nx_ip_static_route_add(&ip_0, IP_ADDRESS(20, 0, i, 0), IP_ADDRESS(255, 255, 255, 0), IP_ADDRESS(1, 2, 3, 20));
+    if (status != NX_OVERFLOW)
+    {
+        error_counter++;
+    }
+
+    /* Check the parameters of the table extend service.  */
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if (nx_ip_static_route_table_extend(&ip_0, NX_NULL, sizeof(route_memory)) != NX_PTR_ERROR)
+    {
+        error_counter++;
+    }
+
+    if (nx_ip_static_route_table_extend(&ip_0, route_memory, sizeof(NX_IP_ROUTE_NODE)) != NX_SIZE_ERROR)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Add the memory for more routes.  */
+    status = nx_ip_static_route_table_extend(&ip_0, route_memory, sizeof(route_memory));
+    if (status)
+    {
+        error_counter++;
+    }
+
+    for (; i < NX_IP_ROUTING_TABLE_SIZE + ROUTES_EXTENDED; i++)
+    {
+        status = nx_ip_static_route_add(&ip_0, IP_ADDRESS(20, 0, i, 0), IP_ADDRESS(255, 255, 255, 0), IP_ADDRESS(1, 2, 3, 20));
+        if (status)
+        {
+            error_counter++;
+        }
+    }
+
+    status = nx_ip_static_route_add(&ip_0, IP_ADDRESS(20, 0, i, 0), IP_ADDRESS(255, 255, 255, 0), IP_ADDRESS(1, 2, 3, 20));
+    if ((status != NX_OVERFLOW) || (ip_0.nx_ip_routing_table_entry_count != NX_IP_ROUTING_TABLE_SIZE + ROUTES_EXTENDED))
+    {
+        error_counter++;
+    }
+
+    /* Every route is found.  */
+    for (i = 0; i < NX_IP_ROUTING_TABLE_SIZE + ROUTES_EXTENDED; i++)
+    {
+        check_route(IP_ADDRESS(20, 0, i, 1), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 20));
+    }
+    check_route(IP_ADDRESS(20, 0, i, 1), NX_IP_ADDRESS_ERROR, 0);
+
+    /* Delete the routes, all nodes go back to the free list.  */
+    for (i = 0; i < NX_IP_ROUTING_TABLE_SIZE + ROUTES_EXTENDED; i++)
+    {
+        status = nx_ip_static_route_delete(&ip_0, IP_ADDRESS(20, 0, i, 0), IP_ADDRESS(255, 255, 255, 0));
+        if (status)
+        {
+            error_counter++;
+        }
+    }
+
+    if ((ip_0.nx_ip_routing_table_entry_count != 0) || (ip_0.nx_ip_route_trie_count != 0) ||
+        (ip_0.nx_ip_route_trie_ipv4 != NX_NULL))
+    {
+        error_counter++;
+    }
+
+    /* Add nested routes in an order that needs nodes to join the prefixes.  */
+    status =  nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 1, 2, 128), IP_ADDRESS(255, 255, 255, 128), IP_ADDRESS(1, 2, 3, 13));
+    status += nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 1, 2, 0), IP_ADDRESS(255, 255, 255, 0), IP_ADDRESS(1, 2, 3, 12));
+    status += nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 0, 0, 0), IP_ADDRESS(255, 0, 0, 0), IP_ADDRESS(1, 2, 3, 10));
+    status += nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 1, 0, 0), IP_ADDRESS(255, 255, 0, 0), IP_ADDRESS(1, 2, 3, 11));
+    status += nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 1, 3, 0), IP_ADDRESS(255, 255, 255, 0), IP_ADDRESS(1, 2, 3, 14));
+    status += nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 1, 2, 77), IP_ADDRESS(255, 255, 255, 255), IP_ADDRESS(1, 2, 3, 15));
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* The longest matching prefix is used.  */
+    check_route(IP_ADDRESS(10, 1, 2, 200), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 13));
+    check_route(IP_ADDRESS(10, 1, 2, 5), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 12));
+    check_route(IP_ADDRESS(10, 1, 2, 77), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 15));
+    check_route(IP_ADDRESS(10, 1, 3, 9), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 14));
+    check_route(IP_ADDRESS(10, 1, 9, 9), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 11));
+    check_route(IP_ADDRESS(10, 9, 9, 9), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 10));
+    check_route(IP_ADDRESS(11, 1, 2, 5), NX_IP_ADDRESS_ERROR, 0);
+
+    /* Update the next hop of an existing route.  */
+    status = nx_ip_static_route_add(&ip_0, IP_ADDRESS(10, 1, 0, 0), IP_ADDRESS(255, 255, 0, 0), IP_ADDRESS(1, 2, 3, 16));
+    if ((status) || (ip_0.nx_ip_routing_table_entry_count != 6))
+    {
+        error_counter++;
+    }
+    check_route(IP_ADDRESS(10, 1, 9, 9), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 16));
+
+    /* Deleting a route falls back to the next shorter prefix.  */
+    status = nx_ip_static_route_delete(&ip_0, IP_ADDRESS(10, 1, 2, 0), IP_ADDRESS(255, 255, 255, 0));
+    if (status)
+    {
+        error_counter++;
+    }
+    check_route(IP_ADDRESS(10, 1, 2, 5), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 16));
+    check_route(IP_ADDRESS(10, 1, 2, 200), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 13));
+    check_route(IP_ADDRESS(10, 1, 2, 77), NX_SUCCESS, IP_ADDRESS(1, 2, 3, 15));
+
+    /* A deleted route is not found again.  */
+    status = nx_ip_static_route_delete(&ip_0, IP_ADDRESS(10, 1, 2, 0), IP_ADDRESS(255, 255, 255, 0));
+    if (status != NX_NOT_SUCCESSFUL)
+    {
+        error_counter++;
+    }
+
+    /* A node joining two prefixes holds no route.  */
+    status = nx_ip_static_route_delete(&ip_0, IP_ADDRESS(10, 1, 2, 0), IP_ADDRESS(255, 255, 254, 0));
+    if (status != NX_NOT_SUCCESSFUL)
+    {
+        error_counter++;
+    }
+
+#ifdef FEATURE_NX_IPV6
+    /* Add IPv6 routes with nested prefixes.  */
+    network_address.nxd_ip_version = NX_IP_VERSION_V6;
+    network_address.nxd_ip_address.v6[0] = 0x20010DB8;
+    network_address.nxd_ip_address.v6[1] = 0;
+    network_address.nxd_ip_address.v6[2] = 0;
+    network_address.nxd_ip_address.v6[3] = 0;
+    next_hop.nxd_ip_version = NX_IP_VERSION_V6;
+    next_hop.nxd_ip_address.v6[0] = 0xFE800000;
+    next_hop.nxd_ip_address.v6[1] = 0;
+    next_hop.nxd_ip_address.v6[2] = 0;
+    next_hop.nxd_ip_address.v6[3] = 1;
+    status = nxd_ipv6_static_route_add(&ip_0, &network_address, 32, &next_hop, 0);
+
+    network_address.nxd_ip_address.v6[1] = 0x00010000;
+    next_hop.nxd_ip_address.v6[3] = 2;
+    status += nxd_ipv6_static_route_add(&ip_0, &network_address, 48, &next_hop, 0);
+    if (status)
+    {
+        error_counter++;
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if (nxd_ipv6_static_route_add(&ip_0, &network_address, 129, &next_hop, 0) != NX_INVALID_PARAMETERS)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* The IPv4 and IPv6 routes share the routing table.  */
+    if (ip_0.nx_ip_route_trie_count != 7)
+    {
+        error_counter++;
+    }
+
+    destination[0] = 0x20010DB8;
+    destination[1] = 0x00010000;
+    destination[2] = 0;
+    destination[3] = 0x1234;
+    tx_mutex_get(&(ip_0.nx_ip_protection), TX_WAIT_FOREVER);
+    status = _nxd_ipv6_static_route_find(&ip_0, &ip_0.nx_ip_interface[0], destination, next_hop_address);
+    if ((status) || (next_hop_address[3] != 2))
+    {
+        error_counter++;
+    }
+
+    destination[1] = 0x00020000;
+    status = _nxd_ipv6_static_route_find(&ip_0, &ip_0.nx_ip_interface[0], destination, next_hop_address);
+    if ((status) || (next_hop_address[3] != 1))
+    {
+        error_counter++;
+    }
+
+    /* Routes of other interfaces and link-local destinations are not used.  */
+#if NX_MAX_IP_INTERFACES > 1
+    if (_nxd_ipv6_static_route_find(&ip_0, &ip_0.nx_ip_interface[1], destination, next_hop_address) != NX_NOT_FOUND)
+    {
+        error_counter++;
+    }
+#endif
+
+    destination[0] = 0xFE800000;
+    if (_nxd_ipv6_static_route_find(&ip_0, &ip_0.nx_ip_interface[0], destination, next_hop_address) != NX_NOT_FOUND)
+    {
+        error_counter++;
+    }
+    tx_mutex_put(&(ip_0.nx_ip_protection));
+
+    /* Delete the longer prefix, the destination falls back to the shorter one.  */
+    status = nxd_ipv6_static_route_delete(&ip_0, &network_address, 48);
+    destination[0] = 0x20010DB8;
+    destination[1] = 0x00010000;
+    status += _nxd_ipv6_static_route_find(&ip_0, &ip_0.nx_ip_interface[0], destination, next_hop_address);
+    if ((status) || (next_hop_address[3] != 1))
+    {
+        error_counter++;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    check_route(ULONG destination, UINT expected_status, ULONG expected_next_hop)
+{
+UINT          status;
+NX_INTERFACE *interface_ptr = NX_NULL;
+ULONG         next_hop_address;
+
+
+    status = _nx_ip_route_find(&ip_0, destination, &interface_ptr, &next_hop_address);
+    if (status != expected_status)
+    {
+        error_counter++;
+    }
+    else if ((status == NX_SUCCESS) &&
+             ((next_hop_address != expected_next_hop) || (interface_ptr != &ip_0.nx_ip_interface[0])))
+    {
+        error_counter++;
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_ip_route_trie_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   IP Route Trie Test........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_IP_ROUTE_TRIE */
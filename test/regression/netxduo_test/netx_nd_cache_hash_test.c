@@ -0,0 +1,377 @@
+/* This NetX test concentrates on the hashed IPv6 neighbor cache and destination table.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ip.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(FEATURE_NX_IPV6) && defined(NX_ENABLE_IPV6_ND_HASH_TABLE)
+#include   "nx_nd_cache.h"
+#include   "nx_icmpv6.h"
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_DESTINATIONS       4
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_IP                   ip_1;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static NXD_ADDRESS             global_address_0;
+static NXD_ADDRESS             global_address_1;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    check_nd_cache_hash(UINT expected_entries);
+static void    check_destination_hash(void);
+extern void    _nx_ram_network_driver_1500(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_nd_cache_hash_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 1536, pointer, 1536 * 16);
+    pointer = pointer + 1536 * 16;
+
+    /* Create the IP instances.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    status += nx_ip_create(&ip_1, "NetX IP Instance 1", IP_ADDRESS(1, 2, 3, 5), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable IPv6 and ICMPv6 for the IP instances.  */
+    status += nxd_ipv6_enable(&ip_0);
+    status += nxd_ipv6_enable(&ip_1);
+    status += nxd_icmp_enable(&ip_0);
+    status += nxd_icmp_enable(&ip_1);
+
+    /* Set the global addresses of the IP instances.  */
+    global_address_0.nxd_ip_version = NX_IP_VERSION_V6;
+    global_address_0.nxd_ip_address.v6[0] = 0x20010000;
+    global_address_0.nxd_ip_address.v6[1] = 0x00000000;
+    global_address_0.nxd_ip_address.v6[2] = 0x00000000;
+    global_address_0.nxd_ip_address.v6[3] = 0x10000001;
+    status += nxd_ipv6_address_set(&ip_0, 0, &global_address_0, 64, NX_NULL);
+
+    global_address_1.nxd_ip_version = NX_IP_VERSION_V6;
+    global_address_1.nxd_ip_address.v6[0] = 0x20010000;
+    global_address_1.nxd_ip_address.v6[1] = 0x00000000;
+    global_address_1.nxd_ip_address.v6[2] = 0x00000000;
+    global_address_1.nxd_ip_address.v6[3] = 0x10000002;
+    status += nxd_ipv6_address_set(&ip_1, 0, &global_address_1, 64, NX_NULL);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT                       status;
+UINT                       i;
+NX_PACKET                 *packet_ptr;
+ND_CACHE_ENTRY            *nd_entry;
+NX_IPV6_DESTINATION_ENTRY *dest_entry;
+NX_IPV6_DESTINATION_ENTRY *dest_entries[TEST_DESTINATIONS];
+NXD_ADDRESS                address;
+ULONG                      destinations[TEST_DESTINATIONS][4];
+CHAR                       mac_address[6];
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   ND Cache Hash Test........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Wait for the Duplicate Address Detection.  */
+    tx_thread_sleep(5 * NX_IP_PERIODIC_RATE);
+
+    /* Fill the ND cache with static entries.  */
+    status = nxd_nd_cache_invalidate(&ip_0);
+    if (status)
+    {
+        error_counter++;
+    }
+
+    address = global_address_1;
+    mac_address[0] = 0x00;
+    mac_address[1] = 0x11;
+    mac_address[2] = 0x22;
+    mac_address[3] = 0x33;
+    mac_address[4] = 0x44;
+    mac_address[5] = 0x00;
+    for (i = 0; i < NX_IPV6_NEIGHBOR_CACHE_SIZE; i++)
+    {
+        address.nxd_ip_address.v6[3] = 0x20000000 + i;
+        mac_address[5] = (CHAR)i;
+        status = nxd_nd_cache_entry_set(&ip_0, address.nxd_ip_address.v6, 0, mac_address);
+        if (status)
+        {
+            error_counter++;
+        }
+    }
+
+    /* Each neighbor is found in the bucket of its address.  */
+    for (i = 0; i < NX_IPV6_NEIGHBOR_CACHE_SIZE; i++)
+    {
+        address.nxd_ip_address.v6[3] = 0x20000000 + i;
+        if ((_nx_nd_cache_find_entry(&ip_0, address.nxd_ip_address.v6, &nd_entry) != NX_SUCCESS) ||
+            (nd_entry -> nx_nd_cache_dest_ip[3] != address.nxd_ip_address.v6[3]) ||
+            (nd_entry -> nx_nd_cache_mac_addr[5] != (UCHAR)i))
+        {
+            error_counter++;
+        }
+    }
+    check_nd_cache_hash(NX_IPV6_NEIGHBOR_CACHE_SIZE);
+
+    /* After the cache is invalidated no neighbor is found.  */
+    status = nxd_nd_cache_invalidate(&ip_0);
+    for (i = 0; i < NX_IPV6_NEIGHBOR_CACHE_SIZE; i++)
+    {
+        address.nxd_ip_address.v6[3] = 0x20000000 + i;
+        if (_nx_nd_cache_find_entry(&ip_0, address.nxd_ip_address.v6, &nd_entry) == NX_SUCCESS)
+        {
+            error_counter++;
+        }
+    }
+    check_nd_cache_hash(0);
+    if ((status) || (ip_0.nx_ipv6_nd_cache_probe_list != NX_NULL))
+    {
+        error_counter++;
+    }
+
+    /* A packet to an absent neighbor starts the neighbor discovery, the entry is probed.  */
+    address.nxd_ip_address.v6[3] = 0x10000099;
+    nxd_icmp_ping(&ip_0, &address, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26, &packet_ptr, NX_NO_WAIT);
+    nd_entry = ip_0.nx_ipv6_nd_cache_probe_list;
+    if ((nd_entry == NX_NULL) ||
+        (nd_entry -> nx_nd_cache_nd_status != ND_CACHE_STATE_INCOMPLETE) ||
+        (nd_entry -> nx_nd_cache_dest_ip[3] != address.nxd_ip_address.v6[3]) ||
+        (nd_entry -> nx_nd_cache_probe_next != NX_NULL))
+    {
+        error_counter++;
+    }
+
+    /* Once the solicitations are used up the entry is deleted and leaves the list.  */
+    tx_thread_sleep(5 * NX_IP_PERIODIC_RATE);
+    if ((ip_0.nx_ipv6_nd_cache_probe_list != NX_NULL) ||
+        (_nx_nd_cache_find_entry(&ip_0, address.nxd_ip_address.v6, &nd_entry) == NX_SUCCESS))
+    {
+        error_counter++;
+    }
+
+    /* A neighbor that answers is reachable, and leaves the list at the next fast update.  */
+    status = nxd_icmp_ping(&ip_0, &global_address_1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26, &packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+    }
+    else
+    {
+        nx_packet_release(packet_ptr);
+    }
+
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 5);
+    if ((_nx_nd_cache_find_entry(&ip_0, global_address_1.nxd_ip_address.v6, &nd_entry) != NX_SUCCESS) ||
+        (nd_entry -> nx_nd_cache_nd_status != ND_CACHE_STATE_REACHABLE) ||
+        (nd_entry -> nx_nd_cache_probe_list != NX_NULL) ||
+        (ip_0.nx_ipv6_nd_cache_probe_list != NX_NULL))
+    {
+        error_counter++;
+    }
+
+    /* Add destinations reached through the neighbor.  */
+    for (i = 0; i < TEST_DESTINATIONS; i++)
+    {
+        destinations[i][0] = 0x20020000;
+        destinations[i][1] = 0x00000000;
+        destinations[i][2] = 0x00000000;
+        destinations[i][3] = 0x30000000 + i;
+
+        status = _nx_icmpv6_dest_table_add(&ip_0, destinations[i], &dest_entries[i], global_address_1.nxd_ip_address.v6,
+                                           0, 0, &ip_0.nx_ipv6_address[0]);
+        if ((status) || (dest_entries[i] -> nx_ipv6_destination_entry_nd_entry != nd_entry))
+        {
+            error_counter++;
+        }
+    }
+
+    /* Each destination is found in the bucket of its address.  */
+    for (i = 0; i < TEST_DESTINATIONS; i++)
+    {
+        if ((_nx_icmpv6_dest_table_find(&ip_0, destinations[i], &dest_entry, 0, 0) != NX_SUCCESS) ||
+            (dest_entry != dest_entries[i]))
+        {
+            error_counter++;
+        }
+    }
+    check_destination_hash();
+
+    /* An invalidated destination is no longer found, and its slot is used for a new destination.  */
+    dest_entries[0] -> nx_ipv6_destination_entry_valid = NX_FALSE;
+    ip_0.nx_ipv6_destination_table_size--;
+    if (_nx_icmpv6_dest_table_find(&ip_0, destinations[0], &dest_entry, 0, 0) == NX_SUCCESS)
+    {
+        error_counter++;
+    }
+
+    destinations[0][3] = 0x30000100;
+    status = _nx_icmpv6_dest_table_add(&ip_0, destinations[0], &dest_entry, global_address_1.nxd_ip_address.v6,
+                                       0, 0, &ip_0.nx_ipv6_address[0]);
+    if ((status) || (dest_entry != dest_entries[0]))
+    {
+        error_counter++;
+    }
+
+    for (i = 0; i < TEST_DESTINATIONS; i++)
+    {
+        if ((_nx_icmpv6_dest_table_find(&ip_0, destinations[i], &dest_entry, 0, 0) != NX_SUCCESS) ||
+            (dest_entry != dest_entries[i]))
+        {
+            error_counter++;
+        }
+    }
+    check_destination_hash();
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Check every valid ND cache entry is in the bucket of its address, once.  */
+static void    check_nd_cache_hash(UINT expected_entries)
+{
+UINT            i;
+UINT            entries = 0;
+ND_CACHE_ENTRY *entry;
+
+
+    for (i = 0; i < NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE; i++)
+    {
+        for (entry = ip_0.nx_ipv6_nd_cache_hash[i]; entry; entry = entry -> nx_nd_cache_hash_next)
+        {
+            if (entry -> nx_nd_cache_hash_index != i)
+            {
+                error_counter++;
+            }
+
+            if (entry -> nx_nd_cache_nd_status == ND_CACHE_STATE_INVALID)
+            {
+                continue;
+            }
+
+            if (NX_IPV6_ADDRESS_HASH_INDEX(entry -> nx_nd_cache_dest_ip, NX_IPV6_NEIGHBOR_CACHE_HASH_SIZE) != i)
+            {
+                error_counter++;
+            }
+            entries++;
+        }
+    }
+
+    if (entries != expected_entries)
+    {
+        error_counter++;
+    }
+}
+
+/* Check every valid destination entry is in the bucket of its address, once.  */
+static void    check_destination_hash(void)
+{
+UINT                       i;
+UINT                       entries = 0;
+NX_IPV6_DESTINATION_ENTRY *entry;
+
+
+    for (i = 0; i < NX_IPV6_DESTINATION_TABLE_HASH_SIZE; i++)
+    {
+        for (entry = ip_0.nx_ipv6_destination_hash[i]; entry; entry = entry -> nx_ipv6_destination_entry_hash_next)
+        {
+            if (!entry -> nx_ipv6_destination_entry_valid)
+            {
+                continue;
+            }
+
+            if (NX_IPV6_ADDRESS_HASH_INDEX(entry -> nx_ipv6_destination_entry_destination_address,
+                                           NX_IPV6_DESTINATION_TABLE_HASH_SIZE) != i)
+            {
+                error_counter++;
+            }
+            entries++;
+        }
+    }
+
+    if (entries != ip_0.nx_ipv6_destination_table_size)
+    {
+        error_counter++;
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_nd_cache_hash_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   ND Cache Hash Test........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_IPV6_ND_HASH_TABLE */
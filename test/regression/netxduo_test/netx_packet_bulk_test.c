@@ -0,0 +1,328 @@
+/* This NetX test concentrates on the packet bulk allocate and release operations.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_packet.h"
+
+extern void  test_control_return(UINT status);
+
+#ifdef __PRODUCT_NETXDUO__
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_SIZE               256
+#define     TEST_COUNT              16
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+static TX_THREAD               ntest_1;
+
+static NX_PACKET_POOL          pool_0;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static UCHAR                   pool_area[TEST_COUNT * (sizeof(NX_PACKET) + TEST_SIZE + 64)];
+static NX_PACKET              *packets[TEST_COUNT * 2];
+static NX_PACKET              *waiting_packet;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    ntest_1_entry(ULONG thread_input);
+static void    check_available(ULONG expected_available);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_bulk_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Create the thread waiting for a packet.  */
+    tx_thread_create(&ntest_1, "thread 1", ntest_1_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            3, 3, TX_NO_TIME_SLICE, TX_DONT_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", TEST_SIZE, pool_area, sizeof(pool_area));
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+UINT        count;
+ULONG       total_packets;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Bulk Test..........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Pickup the number of packets in the pool.  */
+    nx_packet_pool_info_get(&pool_0, &total_packets, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    if ((total_packets < TEST_COUNT) || (total_packets >= TEST_COUNT * 2))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    /* A zero packet count is rejected.  */
+    status = nx_packet_allocate_bulk(&pool_0, packets, 0, 0, &count, NX_NO_WAIT);
+    if (status != NX_SIZE_ERROR)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Allocate a few packets.  */
+    status = nx_packet_allocate_bulk(&pool_0, packets, 4, NX_UDP_PACKET, &count, NX_NO_WAIT);
+    if ((status) || (count != 4))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets - 4);
+
+    /* Check the packets.  */
+    for (i = 0; i < count; i++)
+    {
+        if ((packets[i] -> nx_packet_prepend_ptr != packets[i] -> nx_packet_data_start + NX_UDP_PACKET) ||
+            (packets[i] -> nx_packet_append_ptr != packets[i] -> nx_packet_prepend_ptr) ||
+            (packets[i] -> nx_packet_length != 0) ||
+            (packets[i] -> nx_packet_union_next.nx_packet_tcp_queue_next != (NX_PACKET *)NX_PACKET_ALLOCATED))
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+
+#if defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD)
+        /* Leave a segment size in the packet, it must not survive the release.  */
+        packets[i] -> nx_packet_tcp_segment_size =  1000;
+#endif /* defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD) */
+    }
+
+    /* Release them in bulk.  */
+    status = nx_packet_release_bulk(packets, count);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets);
+
+    /* Request more packets than available, only the available ones are returned.  */
+    status = nx_packet_allocate_bulk(&pool_0, packets, TEST_COUNT * 2, 0, &count, NX_NO_WAIT);
+    if ((status) || (count != total_packets))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(0);
+
+#if defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD)
+    /* The segment size of the packets is cleared.  */
+    for (i = 0; i < count; i++)
+    {
+        if (packets[i] -> nx_packet_tcp_segment_size != 0)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+#endif /* defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) || defined(NX_ENABLE_TCP_RECEIVE_OFFLOAD) */
+
+    /* The pool is empty.  */
+    status = nx_packet_allocate_bulk(&pool_0, &packets[count], 1, 0, &i, NX_NO_WAIT);
+    if ((status != NX_NO_PACKET) || (i != 0))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+    /* Chain the second packet to the first one, the chain is released as a whole.  */
+    packets[0] -> nx_packet_next =  packets[1];
+    packets[1] =  packets[count - 1];
+    count--;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    /* Let thread 1 wait for a packet.  */
+    waiting_packet =  NX_NULL;
+    tx_thread_resume(&ntest_1);
+
+    /* Release all packets, the waiting thread gets the first one.  */
+    status = nx_packet_release_bulk(packets, count);
+    if ((status) || (waiting_packet == NX_NULL))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets - 1);
+
+    /* Release the packet of thread 1.  */
+    status = nx_packet_release(waiting_packet);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets);
+
+    /* Release a packet twice.  */
+    status = nx_packet_allocate_bulk(&pool_0, packets, 2, 0, &count, NX_NO_WAIT);
+    if ((status) || (count != 2))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    packets[2] =  packets[0];
+    status = nx_packet_release_bulk(packets, 3);
+    if (status != NX_PTR_ERROR)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets);
+
+    /* Simulate a queued TCP packet and a regular packet completed by the driver.  */
+    status = nx_packet_allocate_bulk(&pool_0, packets, 2, NX_TCP_PACKET, &count, NX_NO_WAIT);
+    if ((status) || (count != 2))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    waiting_packet =  packets[0];
+    waiting_packet -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ENQUEUED;
+    waiting_packet -> nx_packet_ip_header_length =  20;
+    waiting_packet -> nx_packet_prepend_ptr -= 20;
+    waiting_packet -> nx_packet_length =  20;
+
+    status = nx_packet_transmit_release_bulk(packets, count);
+    if ((status) || (waiting_packet -> nx_packet_queue_next != (NX_PACKET *)NX_DRIVER_TX_DONE) ||
+        (waiting_packet -> nx_packet_length != 0) || (waiting_packet -> nx_packet_ip_header_length != 0))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets - 1);
+
+    /* Release the TCP packet.  */
+    waiting_packet -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
+    status = nx_packet_release(waiting_packet);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_available(total_packets);
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    ntest_1_entry(ULONG thread_input)
+{
+
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    /* Wait for a packet.  */
+    status =  nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_WAIT_FOREVER);
+    if ((status) || (packet_ptr -> nx_packet_prepend_ptr != packet_ptr -> nx_packet_data_start + NX_UDP_PACKET))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    waiting_packet =  packet_ptr;
+}
+
+static void    check_available(ULONG expected_available)
+{
+ULONG   available;
+
+
+    nx_packet_pool_info_get(&pool_0, NX_NULL, &available, NX_NULL, NX_NULL, NX_NULL);
+
+    if (available != expected_available)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_bulk_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Bulk Test..........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* __PRODUCT_NETXDUO__ */
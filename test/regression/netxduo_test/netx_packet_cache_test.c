@@ -0,0 +1,295 @@
+/* This NetX test concentrates on the packet cache operations.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_packet.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_PACKET_CACHE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_SIZE               256
+#define     TEST_COUNT              16
+#define     CACHE_SIZE              8
+#define     BATCH_SIZE              4
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_PACKET_CACHE         cache_0;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static UCHAR                   pool_area[TEST_COUNT * (sizeof(NX_PACKET) + TEST_SIZE + 64)];
+static NX_PACKET              *packets[TEST_COUNT];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    check_cache(ULONG expected_available, ULONG expected_cached,
+                           ULONG expected_hits, ULONG expected_misses);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_cache_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", TEST_SIZE, pool_area, sizeof(pool_area));
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+ULONG       total_packets;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Cache Test.........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Pickup the number of packets in the pool.  */
+    nx_packet_pool_info_get(&pool_0, &total_packets, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    if (total_packets < TEST_COUNT)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    /* Batch size larger than cache size is rejected.  */
+    status = nx_packet_cache_create(&pool_0, &cache_0, "Cache 0", BATCH_SIZE, CACHE_SIZE);
+    if (status != NX_SIZE_ERROR)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Create the packet cache.  */
+    status = nx_packet_cache_create(&pool_0, &cache_0, "Cache 0", CACHE_SIZE, BATCH_SIZE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_cache(total_packets, 0, 0, 0);
+
+    /* The first allocation refills the cache with one batch.  */
+    status = nx_packet_cache_allocate(&cache_0, &packets[0], NX_UDP_PACKET, NX_NO_WAIT);
+    if ((status) || (packets[0] -> nx_packet_prepend_ptr != packets[0] -> nx_packet_data_start + NX_UDP_PACKET))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_cache(total_packets - BATCH_SIZE, BATCH_SIZE - 1, 0, 1);
+
+    /* The rest of the batch is served by the cache.  */
+    for (i = 1; i < BATCH_SIZE; i++)
+    {
+        status = nx_packet_cache_allocate(&cache_0, &packets[i], 0, NX_NO_WAIT);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+    check_cache(total_packets - BATCH_SIZE, 0, BATCH_SIZE - 1, 1);
+
+    /* Refill once more.  */
+    for (i = BATCH_SIZE; i < 2 * BATCH_SIZE + 1; i++)
+    {
+        status = nx_packet_cache_allocate(&cache_0, &packets[i], 0, NX_NO_WAIT);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+    check_cache(total_packets - 3 * BATCH_SIZE, BATCH_SIZE - 1, 2 * BATCH_SIZE - 2, 3);
+
+    /* Release packets until the cache is full.  */
+    for (i = 0; i < CACHE_SIZE - BATCH_SIZE + 1; i++)
+    {
+        status = nx_packet_cache_release(&cache_0, packets[i]);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+    check_cache(total_packets - 3 * BATCH_SIZE, CACHE_SIZE, 2 * BATCH_SIZE - 2, 3);
+
+    /* One more packet drains one batch back to the pool.  */
+    status = nx_packet_cache_release(&cache_0, packets[i]);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_cache(total_packets - 2 * BATCH_SIZE, CACHE_SIZE + 1 - BATCH_SIZE, 2 * BATCH_SIZE - 2, 3);
+
+    /* Flush the cache.  */
+    status = nx_packet_cache_flush(&cache_0);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_cache(total_packets - (2 * BATCH_SIZE + 1) + (CACHE_SIZE - BATCH_SIZE + 2), 0, 2 * BATCH_SIZE - 2, 3);
+
+    /* Release the remaining packets to the pool.  */
+    for (i = CACHE_SIZE - BATCH_SIZE + 2; i < 2 * BATCH_SIZE + 1; i++)
+    {
+        status = nx_packet_release(packets[i]);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+    check_cache(total_packets, 0, 2 * BATCH_SIZE - 2, 3);
+
+    /* Exhaust the pool through the cache.  */
+    for (i = 0; i < total_packets; i++)
+    {
+        status = nx_packet_cache_allocate(&cache_0, &packets[i % TEST_COUNT], 0, NX_NO_WAIT);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+
+    /* The pool and the cache are empty now.  */
+    status = nx_packet_cache_allocate(&cache_0, &packets[0], 0, NX_NO_WAIT);
+    if (status != NX_NO_PACKET)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Delete the cache, statistics are kept by the pool.  */
+    status = nx_packet_cache_delete(&cache_0);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    status = nx_packet_pool_cache_info_get(&pool_0, NX_NULL, NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    /* The deleted cache can not be used.  */
+    status = nx_packet_cache_allocate(&cache_0, &packets[0], 0, NX_NO_WAIT);
+    if (status != NX_PTR_ERROR)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    check_cache(ULONG expected_available, ULONG expected_cached,
+                           ULONG expected_hits, ULONG expected_misses)
+{
+ULONG   available;
+ULONG   cached;
+ULONG   hits;
+ULONG   misses;
+
+
+    nx_packet_pool_info_get(&pool_0, NX_NULL, &available, NX_NULL, NX_NULL, NX_NULL);
+    nx_packet_pool_cache_info_get(&pool_0, &cached, &hits, &misses);
+
+    if ((available != expected_available) || (cached != expected_cached) ||
+        (hits != expected_hits) || (misses != expected_misses))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_cache_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Cache Test.........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_PACKET_CACHE */
@@ -0,0 +1,362 @@
+/* This NetX test concentrates on the packet clone operation.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_packet.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_PACKET_CLONE) && !defined(NX_DISABLE_IPV4)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_SIZE               600
+#define     TEST_PORT               0x88
+#define     TEST_HEADER_SIZE        28
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_UDP_SOCKET           socket_0;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   total_packets;
+static UCHAR                   test_data[TEST_SIZE];
+static UCHAR                   receive_buffer[TEST_SIZE];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    check_packet(NX_PACKET *packet_ptr);
+static void    check_pool(ULONG expected_available, ULONG expected_shared, ULONG expected_references);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_clone_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable ARP and supply ARP cache memory.  */
+    status += nx_arp_enable(&ip_0, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+
+    /* Enable UDP processing.  */
+    status += nx_udp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+ULONG       available;
+NX_PACKET  *packet_ptr;
+NX_PACKET  *clone_ptr;
+NX_PACKET  *second_clone_ptr;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Clone Test.........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Fill the test data.  */
+    for (i = 0; i < TEST_SIZE; i++)
+    {
+        test_data[i] =  (UCHAR)i;
+    }
+
+    /* Pickup the number of packets in the pool.  */
+    nx_packet_pool_info_get(&pool_0, &total_packets, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    check_pool(total_packets, 0, 0);
+
+    /* Build a packet chain.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append(packet_ptr, test_data, TEST_SIZE, &pool_0, NX_NO_WAIT);
+    if ((status) || (packet_ptr -> nx_packet_next == NX_NULL))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    nx_packet_pool_info_get(&pool_0, NX_NULL, &available, NX_NULL, NX_NULL, NX_NULL);
+
+    /* The packet carries no protocol headers, only the headroom is copied.  */
+    packet_ptr -> nx_packet_ip_header =  NX_NULL;
+
+    /* Clone the packet.  */
+    status = nx_packet_clone(packet_ptr, &clone_ptr, &pool_0, NX_NO_WAIT);
+    if ((status) || (clone_ptr -> nx_packet_length != TEST_SIZE) ||
+        (clone_ptr -> nx_packet_prepend_ptr != clone_ptr -> nx_packet_data_start + NX_UDP_PACKET))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_packet(clone_ptr);
+
+    /* The clone references the data of the first packet of the source.  */
+    if ((clone_ptr -> nx_packet_append_ptr != clone_ptr -> nx_packet_prepend_ptr) ||
+        (clone_ptr -> nx_packet_next -> nx_packet_prepend_ptr != packet_ptr -> nx_packet_prepend_ptr))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Clone it once more.  */
+    status = nx_packet_clone(packet_ptr, &second_clone_ptr, &pool_0, NX_NO_WAIT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_packet(second_clone_ptr);
+    check_pool(available - 8, 3, 6);
+
+    /* Release the source packet, the shared packets are kept.  */
+    status = nx_packet_release(packet_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(available - 8, 3, 6);
+
+    /* Release the first clone.  */
+    status = nx_packet_release(clone_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(available - 4, 3, 3);
+
+    /* Release the second clone, all packets are returned to the pool.  */
+    status = nx_packet_release(second_clone_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(total_packets, 0, 0);
+
+    /* Clone a packet and release the clone first.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append(packet_ptr, test_data, TEST_SIZE, &pool_0, NX_NO_WAIT);
+    packet_ptr -> nx_packet_ip_header =  NX_NULL;
+    status += nx_packet_clone(packet_ptr, &clone_ptr, &pool_0, NX_NO_WAIT);
+    status += nx_packet_release(clone_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(available, 0, 0);
+
+    /* The source packet is still valid.  */
+    check_packet(packet_ptr);
+    status = nx_packet_release(packet_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(total_packets, 0, 0);
+
+    /* Clone a packet that starts with IPv4 and UDP headers.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append(packet_ptr, test_data, TEST_SIZE, &pool_0, NX_NO_WAIT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    packet_ptr -> nx_packet_prepend_ptr -=  TEST_HEADER_SIZE;
+    packet_ptr -> nx_packet_length +=  TEST_HEADER_SIZE;
+    packet_ptr -> nx_packet_ip_header =  packet_ptr -> nx_packet_prepend_ptr;
+    memset(packet_ptr -> nx_packet_prepend_ptr, 0, TEST_HEADER_SIZE);
+    packet_ptr -> nx_packet_prepend_ptr[0] =  0x45;
+    packet_ptr -> nx_packet_prepend_ptr[9] =  NX_PROTOCOL_UDP;
+
+    /* Only the headers are copied, the data of the first packet is shared.  */
+    status = nx_packet_clone(packet_ptr, &clone_ptr, &pool_0, NX_NO_WAIT);
+    if ((status) || (clone_ptr -> nx_packet_length != TEST_SIZE + TEST_HEADER_SIZE) ||
+        (clone_ptr -> nx_packet_append_ptr != clone_ptr -> nx_packet_prepend_ptr + TEST_HEADER_SIZE) ||
+        (clone_ptr -> nx_packet_prepend_ptr == packet_ptr -> nx_packet_prepend_ptr) ||
+        (clone_ptr -> nx_packet_next -> nx_packet_prepend_ptr != packet_ptr -> nx_packet_prepend_ptr + TEST_HEADER_SIZE))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(available - 4, 3, 3);
+
+    status = nx_packet_release(packet_ptr);
+    status += nx_packet_release(clone_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(total_packets, 0, 0);
+
+    /* Create a UDP socket.  */
+    status = nx_udp_socket_create(&ip_0, &socket_0, "Socket 0", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_bind(&socket_0, TEST_PORT, NX_WAIT_FOREVER);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Send a packet chain through the loopback interface.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append(packet_ptr, test_data, TEST_SIZE, &pool_0, NX_NO_WAIT);
+    status += nx_udp_socket_send(&socket_0, packet_ptr, IP_ADDRESS(127, 0, 0, 1), TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Receive the packet.  */
+    status = nx_udp_socket_receive(&socket_0, &packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_packet(packet_ptr);
+
+    /* The data received is shared with the packet sent.  */
+    nx_packet_pool_shared_info_get(&pool_0, &available, NX_NULL);
+    if (available == 0)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    status = nx_packet_release(packet_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_pool(total_packets, 0, 0);
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    check_packet(NX_PACKET *packet_ptr)
+{
+UINT    status;
+ULONG   bytes;
+
+
+    status = nx_packet_data_retrieve(packet_ptr, receive_buffer, &bytes);
+    if ((status) || (bytes != TEST_SIZE) || (memcmp(receive_buffer, test_data, TEST_SIZE)))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+}
+
+static void    check_pool(ULONG expected_available, ULONG expected_shared, ULONG expected_references)
+{
+ULONG   available;
+ULONG   shared;
+ULONG   references;
+
+
+    nx_packet_pool_info_get(&pool_0, NX_NULL, &available, NX_NULL, NX_NULL, NX_NULL);
+    nx_packet_pool_shared_info_get(&pool_0, &shared, &references);
+
+    if ((available != expected_available) || (shared != expected_shared) || (references != expected_references))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_clone_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Clone Test.........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_PACKET_CLONE */
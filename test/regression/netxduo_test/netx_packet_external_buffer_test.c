@@ -0,0 +1,410 @@
+/* This NetX test concentrates on packets referencing external buffers.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_packet.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_PACKET_EXTERNAL_BUFFER) && \
+    !defined(NX_DISABLE_PACKET_CHAIN) && !defined(NX_DISABLE_IPV4)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_SIZE               100
+#define     TEST_PORT               12
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+static TX_THREAD               ntest_1;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_IP                   ip_1;
+static NX_UDP_SOCKET           udp_socket_0;
+static NX_UDP_SOCKET           udp_socket_1;
+static NX_TCP_SOCKET           client_socket;
+static NX_TCP_SOCKET           server_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   notify_counter;
+static ULONG                   zero_copy_counter;
+static VOID                   *notify_buffer;
+static ULONG                   notify_size;
+static VOID                   *notify_context;
+static ULONG                   external_buffer[TEST_SIZE / sizeof(ULONG)];
+static UCHAR                   receive_buffer[TEST_SIZE];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    ntest_1_entry(ULONG thread_input);
+static void    buffer_release_notify(VOID *buffer_start, ULONG buffer_size, VOID *context);
+static void    check_release(VOID *context);
+static UINT    driver_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+extern UINT    (*advanced_packet_process_callback)(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_external_buffer_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    notify_counter =  0;
+    zero_copy_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Create the server thread.  */
+    tx_thread_create(&ntest_1, "thread 1", ntest_1_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            3, 3, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Create IP instances.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    status += nx_ip_create(&ip_1, "NetX IP Instance 1", IP_ADDRESS(1, 2, 3, 5), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable ARP and supply ARP cache memory.  */
+    status += nx_arp_enable(&ip_0, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+    status += nx_arp_enable(&ip_1, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+
+    /* Enable UDP and TCP processing for both IP instances.  */
+    status += nx_udp_enable(&ip_0);
+    status += nx_udp_enable(&ip_1);
+    status += nx_tcp_enable(&ip_0);
+    status += nx_tcp_enable(&ip_1);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+ULONG       total_packets;
+ULONG       available;
+NX_PACKET  *packet_ptr;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet External Buffer Test...............................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Fill the external buffer.  */
+    for (i = 0; i < TEST_SIZE; i++)
+    {
+        ((UCHAR *)external_buffer)[i] =  (UCHAR)i;
+    }
+
+    /* Pickup the number of packets in the pool.  */
+    nx_packet_pool_info_get(&pool_0, &total_packets, &available, NX_NULL, NX_NULL, NX_NULL);
+
+    /* Allocate a packet with some data.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append(packet_ptr, "ABCD", 4, &pool_0, NX_NO_WAIT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    /* A notify function is required.  */
+    status = nx_packet_data_append_external(packet_ptr, external_buffer, TEST_SIZE, NX_NULL, NX_NULL, &pool_0, NX_NO_WAIT);
+    if (status != NX_PTR_ERROR)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Append the external buffer.  */
+    status = nx_packet_data_append_external(packet_ptr, external_buffer, TEST_SIZE, buffer_release_notify,
+                                            &pool_0, &pool_0, NX_NO_WAIT);
+    if ((status) || (packet_ptr -> nx_packet_length != TEST_SIZE + 4) ||
+        (packet_ptr -> nx_packet_last != packet_ptr -> nx_packet_next) ||
+        (packet_ptr -> nx_packet_next -> nx_packet_prepend_ptr != (UCHAR *)external_buffer) ||
+        (packet_ptr -> nx_packet_next -> nx_packet_append_ptr != (UCHAR *)external_buffer + TEST_SIZE))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Retrieve the data.  */
+    status = nx_packet_data_extract_offset(packet_ptr, 4, receive_buffer, TEST_SIZE, &available);
+    if ((status) || (available != TEST_SIZE) || (memcmp(receive_buffer, external_buffer, TEST_SIZE)))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The buffer is not returned yet.  */
+    if (notify_counter != 0)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Release the packet, the external buffer is returned.  */
+    status = nx_packet_release(packet_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_release(&pool_0);
+
+    /* All packets of the pool have their own data area again.  */
+    nx_packet_pool_info_get(&pool_0, NX_NULL, &available, NX_NULL, NX_NULL, NX_NULL);
+    if (available != total_packets)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create UDP sockets.  */
+    status = nx_udp_socket_create(&ip_0, &udp_socket_0, "UDP Socket 0", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_create(&ip_1, &udp_socket_1, "UDP Socket 1", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, 5);
+    status += nx_udp_socket_bind(&udp_socket_0, TEST_PORT, NX_WAIT_FOREVER);
+    status += nx_udp_socket_bind(&udp_socket_1, TEST_PORT, NX_WAIT_FOREVER);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the packets sent by IP instance 0.  */
+    advanced_packet_process_callback = driver_packet_process;
+
+    /* Send the external buffer over UDP.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append_external(packet_ptr, external_buffer, TEST_SIZE, buffer_release_notify,
+                                             &udp_socket_0, &pool_0, NX_NO_WAIT);
+    status += nx_udp_socket_send(&udp_socket_0, packet_ptr, IP_ADDRESS(1, 2, 3, 5), TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Receive the data.  */
+    status = nx_udp_socket_receive(&udp_socket_1, &packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    status = nx_packet_data_retrieve(packet_ptr, receive_buffer, &available);
+    if ((status) || (available != TEST_SIZE) || (memcmp(receive_buffer, external_buffer, TEST_SIZE)))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    nx_packet_release(packet_ptr);
+
+    /* The buffer is returned once the driver is done with it.  */
+    check_release(&udp_socket_0);
+
+    /* Create a client socket.  */
+    status = nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 200,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, TEST_PORT, NX_WAIT_FOREVER);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(1, 2, 3, 5), TEST_PORT, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Send the external buffer over TCP.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    status += nx_packet_data_append_external(packet_ptr, external_buffer, TEST_SIZE, buffer_release_notify,
+                                             &client_socket, &pool_0, NX_NO_WAIT);
+    status += nx_tcp_socket_send(&client_socket, packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Wait for the server to receive the data and acknowledge it.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 10);
+
+    /* The buffer is returned once the data is acknowledged.  */
+    check_release(&client_socket);
+
+    advanced_packet_process_callback = NX_NULL;
+
+    /* Both UDP and TCP sent the data without copy.  */
+    if ((error_counter) || (zero_copy_counter != 2))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* All packets are returned to the pool.  */
+    nx_packet_pool_info_get(&pool_0, NX_NULL, &available, NX_NULL, NX_NULL, NX_NULL);
+    if (available != total_packets)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    ntest_1_entry(ULONG thread_input)
+{
+
+UINT        status;
+ULONG       bytes;
+NX_PACKET  *packet_ptr;
+
+
+    /* Create a server socket.  */
+    status = nx_tcp_socket_create(&ip_1, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 200,
+                                  NX_NULL, NX_NULL);
+
+    /* Setup this thread to listen.  */
+    status += nx_tcp_server_socket_listen(&ip_1, TEST_PORT, &server_socket, 5, NX_NULL);
+
+    /* Accept a client socket connection.  */
+    status += nx_tcp_server_socket_accept(&server_socket, NX_WAIT_FOREVER);
+
+    /* Receive the data.  */
+    status += nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_IP_PERIODIC_RATE);
+
+    /* Check for error.  */
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    status = nx_packet_data_retrieve(packet_ptr, receive_buffer, &bytes);
+    if ((status) || (bytes != TEST_SIZE) || (memcmp(receive_buffer, external_buffer, TEST_SIZE)))
+    {
+        error_counter++;
+    }
+
+    nx_packet_release(packet_ptr);
+}
+
+static void    buffer_release_notify(VOID *buffer_start, ULONG buffer_size, VOID *context)
+{
+
+    notify_counter++;
+    notify_buffer =  buffer_start;
+    notify_size =  buffer_size;
+    notify_context =  context;
+}
+
+static void    check_release(VOID *context)
+{
+
+    if ((notify_counter != 1) || (notify_buffer != (VOID *)external_buffer) ||
+        (notify_size != TEST_SIZE) || (notify_context != context))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    notify_counter =  0;
+}
+
+static UINT    driver_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr)
+{
+
+    /* Count the packets sent by IP instance 0 that still reference the external buffer.  */
+    if ((ip_ptr == &ip_0) && (packet_ptr -> nx_packet_next) &&
+        (packet_ptr -> nx_packet_next -> nx_packet_data_start == (UCHAR *)external_buffer))
+    {
+        zero_copy_counter++;
+    }
+
+    return(NX_TRUE);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_external_buffer_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet External Buffer Test...............................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_PACKET_EXTERNAL_BUFFER */
@@ -0,0 +1,360 @@
+/* This NetX test concentrates on the packet pool group operations.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_packet.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_PACKET_POOL_GROUP) && !defined(NX_DISABLE_IPV4)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     SMALL_SIZE              128
+#define     MEDIUM_SIZE             512
+#define     LARGE_SIZE              1536
+#define     SMALL_COUNT             8
+#define     MEDIUM_COUNT            4
+#define     LARGE_COUNT             2
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+static TX_THREAD               ntest_1;
+
+static NX_PACKET_POOL          pool_0;
+static NX_PACKET_POOL          small_pool;
+static NX_PACKET_POOL          medium_pool;
+static NX_PACKET_POOL          large_pool;
+static NX_PACKET_POOL_GROUP    group_0;
+static NX_IP                   ip_0;
+static NX_IP                   ip_1;
+static NX_TCP_SOCKET           client_socket;
+static NX_TCP_SOCKET           server_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   small_tcp_packets;
+static ULONG                   other_tcp_packets;
+static UCHAR                   small_area[SMALL_COUNT * (sizeof(NX_PACKET) + SMALL_SIZE + 64)];
+static UCHAR                   medium_area[MEDIUM_COUNT * (sizeof(NX_PACKET) + MEDIUM_SIZE + 64)];
+static UCHAR                   large_area[LARGE_COUNT * (sizeof(NX_PACKET) + LARGE_SIZE + 64)];
+static NX_PACKET              *packets[SMALL_COUNT * 2];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    ntest_1_entry(ULONG thread_input);
+static void    check_allocate(ULONG packet_length, NX_PACKET_POOL *expected_pool);
+static UINT    driver_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+extern UINT    (*advanced_packet_process_callback)(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_pool_group_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    small_tcp_packets =  0;
+    other_tcp_packets =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Create the server thread.  */
+    tx_thread_create(&ntest_1, "thread 1", ntest_1_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            3, 3, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the default packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Create the packet pools of the group.  */
+    status += nx_packet_pool_create(&small_pool, "Small Packet Pool", SMALL_SIZE, small_area, sizeof(small_area));
+    status += nx_packet_pool_create(&medium_pool, "Medium Packet Pool", MEDIUM_SIZE, medium_area, sizeof(medium_area));
+    status += nx_packet_pool_create(&large_pool, "Large Packet Pool", LARGE_SIZE, large_area, sizeof(large_area));
+
+    /* Create IP instances.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    status += nx_ip_create(&ip_1, "NetX IP Instance 1", IP_ADDRESS(1, 2, 3, 5), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable ARP and supply ARP cache memory.  */
+    status += nx_arp_enable(&ip_0, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+    status += nx_arp_enable(&ip_1, (void *) pointer, 1024);
+    pointer = pointer + 1024;
+
+    /* Enable TCP processing for both IP instances.  */
+    status += nx_tcp_enable(&ip_0);
+    status += nx_tcp_enable(&ip_1);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+UINT        pool_count;
+ULONG       fallbacks;
+ULONG       small_packets;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Pool Group Test....................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the packet pool group.  */
+    status = nx_packet_pool_group_create(&group_0, "Group 0");
+
+    /* Add the pools in random order.  */
+    status += nx_packet_pool_group_pool_add(&group_0, &large_pool);
+    status += nx_packet_pool_group_pool_add(&group_0, &small_pool);
+    status += nx_packet_pool_group_pool_add(&group_0, &medium_pool);
+    status += nx_packet_pool_group_info_get(&group_0, &pool_count, &fallbacks);
+    if ((status) || (pool_count != 3) || (fallbacks != 0) ||
+        (group_0.nx_packet_pool_group_pools[0] != &small_pool) ||
+        (group_0.nx_packet_pool_group_pools[1] != &medium_pool) ||
+        (group_0.nx_packet_pool_group_pools[2] != &large_pool))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* A pool can only be added once.  */
+    status = nx_packet_pool_group_pool_add(&group_0, &small_pool);
+    if (status != NX_DUPLICATED_ENTRY)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Allocate from the best-fit class.  */
+    check_allocate(60, &small_pool);
+    check_allocate(SMALL_SIZE, &small_pool);
+    check_allocate(SMALL_SIZE + 1, &medium_pool);
+    check_allocate(1400, &large_pool);
+
+    /* The largest class is used when no class is large enough.  */
+    check_allocate(9000, &large_pool);
+
+    /* Exhaust the small pool.  */
+    nx_packet_pool_info_get(&small_pool, &small_packets, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    for (i = 0; i < small_packets; i++)
+    {
+        status = nx_packet_allocate(&small_pool, &packets[i], 0, NX_NO_WAIT);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Small packets are served by the medium class now.  */
+    check_allocate(60, &medium_pool);
+    status = nx_packet_pool_group_info_get(&group_0, NX_NULL, &fallbacks);
+    if ((status) || (fallbacks != 1))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Release the small packets.  */
+    for (i = 0; i < small_packets; i++)
+    {
+        status = nx_packet_release(packets[i]);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Deleting a pool removes it from the group.  */
+    status = nx_packet_pool_delete(&medium_pool);
+    status += nx_packet_pool_group_info_get(&group_0, &pool_count, NX_NULL);
+    if ((status) || (pool_count != 2) ||
+        (group_0.nx_packet_pool_group_pools[0] != &small_pool) ||
+        (group_0.nx_packet_pool_group_pools[1] != &large_pool))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_allocate(SMALL_SIZE + 1, &large_pool);
+
+    /* Use the group for TCP control packets of IP instance 0.  */
+    status = nx_ip_packet_pool_group_set(&ip_0, &group_0);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create a client socket.  */
+    status = nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 200,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, 12, NX_WAIT_FOREVER);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the packets sent by IP instance 0.  */
+    advanced_packet_process_callback = driver_packet_process;
+
+    /* Connect to the server, SYN and ACK are control packets.  */
+    status = nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(1, 2, 3, 5), 12, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    advanced_packet_process_callback = NX_NULL;
+
+    /* All control packets are from the small class.  */
+    if ((error_counter) || (small_tcp_packets < 2) || (other_tcp_packets != 0))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    ntest_1_entry(ULONG thread_input)
+{
+
+UINT        status;
+
+
+    /* Create a server socket.  */
+    status = nx_tcp_socket_create(&ip_1, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 200,
+                                  NX_NULL, NX_NULL);
+
+    /* Setup this thread to listen.  */
+    status += nx_tcp_server_socket_listen(&ip_1, 12, &server_socket, 5, NX_NULL);
+
+    /* Accept a client socket connection.  */
+    status += nx_tcp_server_socket_accept(&server_socket, NX_WAIT_FOREVER);
+
+    /* Check for error.  */
+    if (status)
+        error_counter++;
+}
+
+static void    check_allocate(ULONG packet_length, NX_PACKET_POOL *expected_pool)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    status = nx_packet_pool_group_allocate(&group_0, &packet_ptr, 0, packet_length, NX_NO_WAIT);
+    if ((status) || (packet_ptr -> nx_packet_pool_owner != expected_pool))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    status = nx_packet_release(packet_ptr);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+}
+
+static UINT    driver_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT *operation_ptr, UINT *delay_ptr)
+{
+
+    /* Only check the TCP packets sent by IP instance 0.  */
+    if ((ip_ptr != &ip_0) || (packet_ptr -> nx_packet_ip_version != NX_IP_VERSION_V4) ||
+        (packet_ptr -> nx_packet_prepend_ptr[9] != NX_PROTOCOL_TCP))
+    {
+        return(NX_TRUE);
+    }
+
+    /* Check the pool of the packet.  */
+    if (packet_ptr -> nx_packet_pool_owner == &small_pool)
+    {
+        small_tcp_packets++;
+    }
+    else
+    {
+        other_tcp_packets++;
+    }
+
+    return(NX_TRUE);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_packet_pool_group_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   Packet Pool Group Test....................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_PACKET_POOL_GROUP */
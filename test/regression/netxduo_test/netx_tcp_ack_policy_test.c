@@ -0,0 +1,353 @@
+/* This NetX test concentrates on the TCP ACK policy.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_ACK_POLICY) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            100
+#define     SEGMENT_COUNT           10
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   ack_packets;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static ULONG   send_data(UINT count, UINT burst);
+static void    receive_data(UINT count);
+static void    count_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_ack_policy_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 16384);
+    pointer = pointer + 16384;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP ACK Policy Test.......................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the parameters of the ACK policy.  */
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if ((nx_tcp_socket_ack_policy_set(NX_NULL, 2, 8) != NX_PTR_ERROR) ||
+        (nx_tcp_socket_ack_policy_set(&server_socket, 0, 8) != NX_INVALID_PARAMETERS))
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Setup the connection with a small MSS, so the data covers several segments.  */
+    status = nx_tcp_socket_mss_set(&client_socket, SEGMENT_SIZE);
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Open the congestion window, so all segments are sent at once.  */
+    client_socket.nx_tcp_socket_tx_window_congestion = 0xFFFF;
+
+    /* The first segments of the connection are acknowledged immediately, then every second
+       full size segment is acknowledged.  */
+    if (send_data(SEGMENT_COUNT, NX_FALSE) != NX_TCP_QUICK_ACK_SEGMENTS + ((SEGMENT_COUNT - NX_TCP_QUICK_ACK_SEGMENTS) / NX_TCP_ACK_SEGMENTS))
+    {
+        error_counter++;
+    }
+    receive_data(SEGMENT_COUNT);
+
+    /* The ACKs of the segments received together are coalesced into one ACK.  */
+    if (send_data(SEGMENT_COUNT, NX_TRUE) != 1)
+    {
+        error_counter++;
+    }
+    receive_data(SEGMENT_COUNT);
+
+    /* Acknowledge every fourth full size segment, without the quick-ACK mode.  */
+    status = nx_tcp_socket_ack_policy_set(&server_socket, 4, 0);
+    if ((status) || (send_data(8, NX_FALSE) != 2))
+    {
+        error_counter++;
+    }
+    receive_data(8);
+
+    /* The remaining data is acknowledged by the delayed ACK timer.  */
+    if (send_data(2, NX_FALSE) != 0)
+    {
+        error_counter++;
+    }
+    tx_thread_sleep(NX_IP_PERIODIC_RATE);
+    if ((ack_packets != 1) || (client_socket.nx_tcp_socket_transmit_sent_head != NX_NULL))
+    {
+        error_counter++;
+    }
+    receive_data(2);
+
+    /* No ACK is left pending.  */
+    if ((ip_0.nx_ip_tcp_ack_pending_head != NX_NULL) || (server_socket.nx_tcp_socket_ack_pending))
+    {
+        error_counter++;
+    }
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+
+    /* Leave both sockets on the pending ACK list.  */
+    tx_mutex_get(&(ip_0.nx_ip_protection), TX_WAIT_FOREVER);
+    server_socket.nx_tcp_socket_ack_pending = NX_TRUE;
+    server_socket.nx_tcp_socket_ack_pending_next = NX_NULL;
+    client_socket.nx_tcp_socket_ack_pending = NX_TRUE;
+    client_socket.nx_tcp_socket_ack_pending_next = &server_socket;
+    ip_0.nx_ip_tcp_ack_pending_head = &client_socket;
+    tx_mutex_put(&(ip_0.nx_ip_protection));
+
+    /* The client socket is removed from the list when it is unbound.  */
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    if ((ip_0.nx_ip_tcp_ack_pending_head != &server_socket) || (client_socket.nx_tcp_socket_ack_pending))
+    {
+        error_counter++;
+    }
+
+    /* The server socket is removed from the list when it is unaccepted.  */
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    if ((ip_0.nx_ip_tcp_ack_pending_head != NX_NULL) || (server_socket.nx_tcp_socket_ack_pending))
+    {
+        error_counter++;
+    }
+
+    /* And when it is deleted.  */
+    tx_mutex_get(&(ip_0.nx_ip_protection), TX_WAIT_FOREVER);
+    server_socket.nx_tcp_socket_ack_pending = NX_TRUE;
+    ip_0.nx_ip_tcp_ack_pending_head = &server_socket;
+    tx_mutex_put(&(ip_0.nx_ip_protection));
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    status += nx_tcp_socket_delete(&server_socket);
+    if ((status) || (ip_0.nx_ip_tcp_ack_pending_head != NX_NULL) || (server_socket.nx_tcp_socket_ack_pending))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send full size segments from the client, one by one or before the IP thread runs, and
+   return the number of ACKs sent by the server.  */
+static ULONG   send_data(UINT count, UINT burst)
+{
+UINT        status;
+UINT        i;
+UINT        old_threshold = 0;
+NX_PACKET  *packet_ptr;
+
+
+    ack_packets = 0;
+    ip_0.nx_ip_tcp_packet_receive = count_tcp_packet_receive;
+
+    /* Queue all segments on the loopback interface before they are received.  */
+    if (burst)
+    {
+        tx_thread_preemption_change(&ntest_0, 0, &old_threshold);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        memset(packet_ptr -> nx_packet_prepend_ptr, 'a' + i, SEGMENT_SIZE);
+        packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + SEGMENT_SIZE;
+        packet_ptr -> nx_packet_length = SEGMENT_SIZE;
+
+        status = nx_tcp_socket_send(&client_socket, packet_ptr, NX_NO_WAIT);
+        if (status)
+        {
+            nx_packet_release(packet_ptr);
+            error_counter++;
+            break;
+        }
+    }
+
+    if (burst)
+    {
+        tx_thread_preemption_change(&ntest_0, old_threshold, &old_threshold);
+    }
+
+    return(ack_packets);
+}
+
+/* Receive the data sent by the client.  */
+static void    receive_data(UINT count)
+{
+UINT        status;
+ULONG       expected;
+NX_PACKET  *packet_ptr;
+
+
+    expected = 0;
+    while (expected < count * SEGMENT_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        expected += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    if (expected != count * SEGMENT_SIZE)
+    {
+        error_counter++;
+    }
+}
+
+static void    count_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+NX_TCP_HEADER  *tcp_header_ptr;
+ULONG           header_word_0;
+ULONG           header_word_3;
+
+
+    tcp_header_ptr = (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_0 = tcp_header_ptr -> nx_tcp_header_word_0;
+    header_word_3 = tcp_header_ptr -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_0);
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+
+    /* Count the ACKs without data sent by the server.  */
+    if (((header_word_0 >> NX_SHIFT_BY_16) == TEST_PORT) &&
+        ((header_word_3 & (NX_TCP_SYN_BIT | NX_TCP_FIN_BIT | NX_TCP_RST_BIT | NX_TCP_ACK_BIT)) == NX_TCP_ACK_BIT) &&
+        (packet_ptr -> nx_packet_length == (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG)))
+    {
+        ack_packets++;
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_ack_policy_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP ACK Policy Test.......................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_ACK_POLICY */
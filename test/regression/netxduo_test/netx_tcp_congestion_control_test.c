@@ -0,0 +1,344 @@
+/* This NetX test concentrates on the pluggable TCP congestion control modules.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_CONGESTION_CONTROL) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            100
+#define     SEGMENT_COUNT           20
+
+/* Segment with the first transmission dropped.  */
+#define     DROP_SEGMENT            3
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   initial_sequence;
+static UINT                    drop_data;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    transfer_data(UINT drop);
+static void    drop_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_congestion_control_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    drop_data =  NX_FALSE;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 32768);
+    pointer = pointer + 32768;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT                        status;
+NX_TCP_CONGESTION_CONTROL   bad_module;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Congestion Control Test...............................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* NewReno is the default congestion control.  */
+    if (client_socket.nx_tcp_socket_congestion_control != &nx_tcp_congestion_control_newreno)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    /* A module must provide all operations.  */
+    bad_module = nx_tcp_congestion_control_cubic;
+    bad_module.nx_tcp_congestion_control_loss = NX_NULL;
+    if ((nx_tcp_socket_congestion_control_set(&client_socket, NX_NULL) != NX_PTR_ERROR) ||
+        (nx_tcp_socket_congestion_control_set(&client_socket, &bad_module) != NX_PTR_ERROR))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#else
+    NX_PARAMETER_NOT_USED(bad_module);
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Select CUBIC before the connection is setup.  */
+    status = nx_tcp_socket_congestion_control_set(&client_socket, &nx_tcp_congestion_control_cubic);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Setup the connection with a small MSS, so the window covers several segments.  */
+    status = nx_tcp_socket_mss_set(&client_socket, SEGMENT_SIZE);
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Start in congestion avoidance, and lose one segment.  */
+    client_socket.nx_tcp_socket_tx_slow_start_threshold = client_socket.nx_tcp_socket_tx_window_congestion;
+    transfer_data(NX_TRUE);
+
+    /* The window before the loss is recorded, and the window is not collapsed.  */
+    if ((client_socket.nx_tcp_socket_congestion_state.nx_tcp_socket_cubic.nx_tcp_cubic_window_max == 0) ||
+        (client_socket.nx_tcp_socket_tx_window_congestion < 2 * client_socket.nx_tcp_socket_connect_mss))
+    {
+        error_counter++;
+    }
+
+    /* Switch to the delay based module on the established connection.  */
+    status = nx_tcp_socket_congestion_control_set(&client_socket, &nx_tcp_congestion_control_delay);
+    if ((status) ||
+        (client_socket.nx_tcp_socket_congestion_state.nx_tcp_socket_delay.nx_tcp_delay_phase != NX_TCP_DELAY_STARTUP))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    transfer_data(NX_FALSE);
+
+    /* The round trip time and the delivery rate are measured.  */
+    if ((client_socket.nx_tcp_socket_congestion_state.nx_tcp_socket_delay.nx_tcp_delay_min_rtt == 0) ||
+        (client_socket.nx_tcp_socket_congestion_state.nx_tcp_socket_delay.nx_tcp_delay_bandwidth == 0))
+    {
+        error_counter++;
+    }
+
+    /* All data is acknowledged, no segment is timed.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE);
+    if ((client_socket.nx_tcp_socket_transmit_sent_head != NX_NULL) ||
+        (client_socket.nx_tcp_socket_rtt_timing != NX_FALSE))
+    {
+        error_counter++;
+    }
+
+    /* Switch back to NewReno.  */
+    status = nx_tcp_socket_congestion_control_set(&client_socket, &nx_tcp_congestion_control_newreno);
+    if (status)
+    {
+        error_counter++;
+    }
+    transfer_data(NX_FALSE);
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send the segments from the client, and check all data is received in order by the server.  */
+static void    transfer_data(UINT drop)
+{
+UINT        status;
+UINT        i;
+ULONG       expected;
+NX_PACKET  *packet_ptr;
+
+
+    initial_sequence = client_socket.nx_tcp_socket_tx_sequence;
+    drop_data = drop;
+    ip_0.nx_ip_tcp_packet_receive = drop_tcp_packet_receive;
+
+    for (i = 0; i < SEGMENT_COUNT; i++)
+    {
+        status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        memset(packet_ptr -> nx_packet_prepend_ptr, 'a' + i, SEGMENT_SIZE);
+        packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + SEGMENT_SIZE;
+        packet_ptr -> nx_packet_length = SEGMENT_SIZE;
+
+        status = nx_tcp_socket_send(&client_socket, packet_ptr, 5 * NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            nx_packet_release(packet_ptr);
+            error_counter++;
+            break;
+        }
+    }
+
+    expected = 0;
+    while (expected < SEGMENT_COUNT * SEGMENT_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, 5 * NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        for (i = 0; i < packet_ptr -> nx_packet_length; i++)
+        {
+            if (packet_ptr -> nx_packet_prepend_ptr[i] != (UCHAR)('a' + ((expected + i) / SEGMENT_SIZE)))
+            {
+                error_counter++;
+            }
+        }
+        expected += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+
+    /* The segment was dropped.  */
+    if (drop_data)
+    {
+        error_counter++;
+    }
+}
+
+static void    drop_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+NX_TCP_HEADER  *header_ptr;
+ULONG           header_word_3;
+ULONG           sequence;
+ULONG           header_length;
+
+
+    header_ptr = (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_3 = header_ptr -> nx_tcp_header_word_3;
+    sequence = header_ptr -> nx_tcp_sequence_number;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    NX_CHANGE_ULONG_ENDIAN(sequence);
+    header_length = (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG);
+
+    /* Drop the first transmission of the selected segment.  */
+    if ((drop_data) && (packet_ptr -> nx_packet_length > header_length) &&
+        (sequence == initial_sequence + DROP_SEGMENT * SEGMENT_SIZE))
+    {
+        drop_data = NX_FALSE;
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_congestion_control_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Congestion Control Test...............................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
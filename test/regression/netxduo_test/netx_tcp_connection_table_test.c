@@ -0,0 +1,309 @@
+/* This NetX test concentrates on the TCP connection table.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     TEST_CONNECTIONS        4
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket[TEST_CONNECTIONS];
+static NX_TCP_SOCKET           client_socket[TEST_CONNECTIONS];
+static NX_TCP_SOCKET          *small_table[4];
+static NX_TCP_SOCKET          *large_table[16];
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    exchange_data(void);
+static void    check_table(ULONG expected_size, ULONG expected_connections);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_connection_table_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Connection Table Test.................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+    /* The table must hold at least one entry.  */
+    status = nx_tcp_connection_table_enable(&ip_0, small_table, sizeof(NX_TCP_SOCKET *) - 1);
+    if (status != NX_SIZE_ERROR)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Enable the connection table.  The number of entries is rounded down to a power of two.  */
+    status = nx_tcp_connection_table_enable(&ip_0, small_table, sizeof(small_table) - 1);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_table(2, 0);
+
+    /* Create the sockets.  */
+    for (i = 0; i < TEST_CONNECTIONS; i++)
+    {
+        status = nx_tcp_socket_create(&ip_0, &server_socket[i], "Server Socket",
+                                      NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 100,
+                                      NX_NULL, NX_NULL);
+        status += nx_tcp_socket_create(&ip_0, &client_socket[i], "Client Socket",
+                                       NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 100,
+                                       NX_NULL, NX_NULL);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Listen on the test port.  */
+    status = nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket[0], 5, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Setup the connections, all with the same local port of the server.  */
+    for (i = 0; i < TEST_CONNECTIONS; i++)
+    {
+        status = nx_tcp_client_socket_bind(&client_socket[i], NX_ANY_PORT, NX_NO_WAIT);
+        status += nx_tcp_client_socket_connect(&client_socket[i], IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+        status += nx_tcp_server_socket_accept(&server_socket[i], NX_IP_PERIODIC_RATE);
+        if (i < (TEST_CONNECTIONS - 1))
+        {
+            status += nx_tcp_server_socket_relisten(&ip_0, TEST_PORT, &server_socket[i + 1]);
+        }
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+
+    /* Each connection receives its own data.  */
+    exchange_data();
+
+    /* All sockets have received packets, so all are in the table.  */
+    check_table(2, 2 * TEST_CONNECTIONS);
+
+    /* Resize the table, the sockets are moved to the new table.  */
+    status = nx_tcp_connection_table_enable(&ip_0, large_table, sizeof(large_table));
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    check_table(16, 2 * TEST_CONNECTIONS);
+    exchange_data();
+    check_table(16, 2 * TEST_CONNECTIONS);
+
+    /* Close the connections, the sockets are removed from the table.  */
+    nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    for (i = 0; i < TEST_CONNECTIONS; i++)
+    {
+        nx_tcp_socket_disconnect(&server_socket[i], NX_NO_WAIT);
+        nx_tcp_socket_disconnect(&client_socket[i], NX_IP_PERIODIC_RATE);
+        status = nx_tcp_client_socket_unbind(&client_socket[i]);
+        status += nx_tcp_server_socket_unaccept(&server_socket[i]);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+    check_table(16, 0);
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send one byte on each client socket and check it is received by the right server socket.  */
+static void    exchange_data(void)
+{
+UINT        i;
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    for (i = 0; i < TEST_CONNECTIONS; i++)
+    {
+        status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+        if (status)
+        {
+            error_counter++;
+            return;
+        }
+
+        *packet_ptr -> nx_packet_prepend_ptr = (UCHAR)('a' + i);
+        packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + 1;
+        packet_ptr -> nx_packet_length = 1;
+
+        status = nx_tcp_socket_send(&client_socket[i], packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            nx_packet_release(packet_ptr);
+            error_counter++;
+            return;
+        }
+    }
+
+    for (i = 0; i < TEST_CONNECTIONS; i++)
+    {
+        status = nx_tcp_socket_receive(&server_socket[i], &packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            return;
+        }
+
+        if ((packet_ptr -> nx_packet_length != 1) || (*packet_ptr -> nx_packet_prepend_ptr != (UCHAR)('a' + i)))
+        {
+            error_counter++;
+        }
+
+        nx_packet_release(packet_ptr);
+    }
+}
+
+static void    check_table(ULONG expected_size, ULONG expected_connections)
+{
+ULONG   table_size;
+ULONG   connections;
+ULONG   entries_used;
+ULONG   longest_chain;
+ULONG   lookups;
+ULONG   hits;
+
+
+    if (nx_tcp_connection_table_info_get(&ip_0, &table_size, &connections, &entries_used, &longest_chain, &lookups, &hits))
+    {
+        error_counter++;
+        return;
+    }
+
+    if ((table_size != expected_size) || (connections != expected_connections) ||
+        (entries_used > table_size) || (entries_used > connections) ||
+        (longest_chain * entries_used < connections) || (hits > lookups))
+    {
+        error_counter++;
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    /* Packets of established connections are found in the table.  */
+    if ((connections) && (hits == 0))
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_TCP_INFO */
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_connection_table_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Connection Table Test.................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* __PRODUCT_NETXDUO__ */
@@ -0,0 +1,365 @@
+/* This NetX test concentrates on the TCP Fast Open.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_FAST_OPEN) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     DATA_SIZE               64
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   syn_data_packets;
+static ULONG                   data_packets;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    connect_data(UCHAR fill);
+static void    send_data(UCHAR fill, UINT expected_status);
+static void    receive_data(UCHAR fill, ULONG wait_option);
+static void    close_connection(void);
+static void    count_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_fast_open_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 16384);
+    pointer = pointer + 16384;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Fast Open Test........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the parameters of the connect with data service.  */
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if (nxd_tcp_client_socket_connect_data(&client_socket, NX_NULL, TEST_PORT, NX_NULL, NX_NO_WAIT) != NX_INVALID_PACKET)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    ip_0.nx_ip_tcp_packet_receive = count_tcp_packet_receive;
+
+    /* The first connection requests a cookie, the data follows the handshake.  */
+    connect_data('a');
+    receive_data('a', NX_IP_PERIODIC_RATE);
+    if ((syn_data_packets != 0) || (data_packets != 1) ||
+        (ip_0.nx_ip_tcp_fast_open_cache[0].nx_tcp_fast_open_entry_cookie_length != NX_TCP_FAST_OPEN_COOKIE_SIZE))
+    {
+        error_counter++;
+    }
+    close_connection();
+
+    /* The next connection presents the cookie, the data is carried by the SYN and is ready
+       as soon as the connection is accepted.  */
+    connect_data('b');
+    receive_data('b', NX_NO_WAIT);
+    if ((syn_data_packets != 1) || (data_packets != 0))
+    {
+        error_counter++;
+    }
+    close_connection();
+
+    /* An invalid cookie is ignored, the data is sent again after the handshake.  */
+    ip_0.nx_ip_tcp_fast_open_cache[0].nx_tcp_fast_open_entry_cookie[0] ^= 0xFF;
+    connect_data('c');
+    receive_data('c', NX_IP_PERIODIC_RATE);
+    if ((syn_data_packets != 1) || (data_packets != 1))
+    {
+        error_counter++;
+    }
+    close_connection();
+
+    /* The data the receive window of the server cannot take is kept by the client and sent
+       as the window opens, ahead of the data sent next by the application.  */
+    memset(&ip_0.nx_ip_tcp_fast_open_cache[0], 0, sizeof(NX_TCP_FAST_OPEN_ENTRY));
+    server_socket.nx_tcp_socket_rx_window_default = DATA_SIZE / 2;
+    server_socket.nx_tcp_socket_rx_window_current = DATA_SIZE / 2;
+    connect_data('d');
+    if ((data_packets != 1) || (client_socket.nx_tcp_socket_fast_open_packet == NX_NULL))
+    {
+        error_counter++;
+    }
+    send_data('e', NX_WINDOW_OVERFLOW);
+    receive_data('d', NX_IP_PERIODIC_RATE);
+    if ((data_packets != 2) || (client_socket.nx_tcp_socket_fast_open_packet != NX_NULL))
+    {
+        error_counter++;
+    }
+    server_socket.nx_tcp_socket_rx_window_default = 8192;
+    close_connection();
+
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+
+    status = nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Accept on the server, then connect the client with initial data.  */
+static void    connect_data(UCHAR fill)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+NXD_ADDRESS server_ip;
+
+
+    syn_data_packets = 0;
+    data_packets = 0;
+
+    /* The data of a SYN is only delivered if the server already waits for the connection.  */
+    if (nx_tcp_server_socket_accept(&server_socket, NX_NO_WAIT) != NX_IN_PROGRESS)
+    {
+        error_counter++;
+    }
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    memset(packet_ptr -> nx_packet_prepend_ptr, fill, DATA_SIZE);
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + DATA_SIZE;
+    packet_ptr -> nx_packet_length = DATA_SIZE;
+
+    server_ip.nxd_ip_version = NX_IP_VERSION_V4;
+    server_ip.nxd_ip_address.v4 = IP_ADDRESS(127, 0, 0, 1);
+
+    status = nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nxd_tcp_client_socket_connect_data(&client_socket, &server_ip, TEST_PORT, packet_ptr, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+    }
+}
+
+/* Send data from the client without waiting.  */
+static void    send_data(UCHAR fill, UINT expected_status)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    memset(packet_ptr -> nx_packet_prepend_ptr, fill, DATA_SIZE);
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + DATA_SIZE;
+    packet_ptr -> nx_packet_length = DATA_SIZE;
+
+    status = nx_tcp_socket_send(&client_socket, packet_ptr, NX_NO_WAIT);
+    if (status != expected_status)
+    {
+        error_counter++;
+    }
+
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+    }
+}
+
+/* Receive the data sent by the client.  */
+static void    receive_data(UCHAR fill, ULONG wait_option)
+{
+UINT        status;
+ULONG       received;
+NX_PACKET  *packet_ptr;
+
+
+    received = 0;
+    while (received < DATA_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, wait_option);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        if (packet_ptr -> nx_packet_prepend_ptr[0] != fill)
+        {
+            error_counter++;
+        }
+
+        received += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    if (received != DATA_SIZE)
+    {
+        error_counter++;
+    }
+}
+
+static void    close_connection(void)
+{
+UINT        status;
+
+
+    nx_tcp_socket_disconnect(&client_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&server_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_relisten(&ip_0, TEST_PORT, &server_socket);
+    if (status)
+    {
+        error_counter++;
+    }
+}
+
+static void    count_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+NX_TCP_HEADER  *tcp_header_ptr;
+ULONG           header_word_0;
+ULONG           header_word_3;
+
+
+    tcp_header_ptr = (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_0 = tcp_header_ptr -> nx_tcp_header_word_0;
+    header_word_3 = tcp_header_ptr -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_0);
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+
+    /* Record the segments with data sent by the client.  */
+    if (((header_word_0 & NX_LOWER_16_MASK) == TEST_PORT) &&
+        (packet_ptr -> nx_packet_length > (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG)))
+    {
+        if (header_word_3 & NX_TCP_SYN_BIT)
+        {
+            syn_data_packets++;
+        }
+        else
+        {
+            data_packets++;
+        }
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_fast_open_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Fast Open Test........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_FAST_OPEN */
@@ -0,0 +1,250 @@
+/* This NetX test concentrates on the TCP listen requests sharing one entry of the listen table.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+/* Ports in the same entry of the listen table.  */
+#define     PORT_0                  0x80
+#define     PORT_1                  (PORT_0 + NX_TCP_LISTEN_TABLE_SIZE)
+#define     PORT_2                  (PORT_0 + 2 * NX_TCP_LISTEN_TABLE_SIZE)
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket[4];
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static UINT    connect_port(UINT port, NX_TCP_SOCKET *socket_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_listen_table_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Listen Table Test.....................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    for (i = 0; i < 4; i++)
+    {
+        status = nx_tcp_socket_create(&ip_0, &server_socket[i], "Server Socket",
+                                      NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 100,
+                                      NX_NULL, NX_NULL);
+        if (status)
+        {
+
+            printf("ERROR!\n");
+            test_control_return(1);
+        }
+    }
+    status = nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 100,
+                                  NX_NULL, NX_NULL);
+
+    /* Listen on three ports of the same listen table entry.  */
+    status += nx_tcp_server_socket_listen(&ip_0, PORT_0, &server_socket[0], 5, NX_NULL);
+    status += nx_tcp_server_socket_listen(&ip_0, PORT_1, &server_socket[1], 5, NX_NULL);
+    status += nx_tcp_server_socket_listen(&ip_0, PORT_2, &server_socket[2], 5, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* A second listen on the same port is rejected.  */
+    status = nx_tcp_server_socket_listen(&ip_0, PORT_1, &server_socket[3], 5, NX_NULL);
+    if (status != NX_DUPLICATE_LISTEN)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Remove the listen request in the middle of the entry.  */
+    status = nx_tcp_server_socket_unlisten(&ip_0, PORT_1);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The other ports still accept connections.  */
+    status = connect_port(PORT_0, &server_socket[0]);
+    status += connect_port(PORT_2, &server_socket[2]);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The connection to the removed port is reset.  */
+    status = nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), PORT_1, NX_IP_PERIODIC_RATE);
+    if (status == NX_SUCCESS)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+    nx_tcp_client_socket_unbind(&client_socket);
+
+    /* Relisten on a port with a new socket.  */
+    status = nx_tcp_server_socket_unaccept(&server_socket[2]);
+    status += nx_tcp_server_socket_relisten(&ip_0, PORT_2, &server_socket[3]);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Listen on the removed port again.  */
+    status = nx_tcp_server_socket_listen(&ip_0, PORT_1, &server_socket[1], 5, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Connect to the new listen requests.  */
+    status = connect_port(PORT_1, &server_socket[1]);
+    status += connect_port(PORT_2, &server_socket[3]);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Remove all listen requests, the entry of the listen table is empty.  */
+    status = nx_tcp_server_socket_unlisten(&ip_0, PORT_0);
+    status += nx_tcp_server_socket_unlisten(&ip_0, PORT_1);
+    status += nx_tcp_server_socket_unlisten(&ip_0, PORT_2);
+    if ((status) || (ip_0.nx_ip_tcp_listen_table[PORT_0 & NX_TCP_LISTEN_TABLE_MASK] != NX_NULL))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Connect to the port and check the connection is accepted by the socket.  */
+static UINT    connect_port(UINT port, NX_TCP_SOCKET *socket_ptr)
+{
+UINT    status;
+
+
+    status = nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), port, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(socket_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Close the connection from the server side, so the client socket is closed when
+       its disconnect returns.  */
+    nx_tcp_socket_disconnect(socket_ptr, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+
+    return(nx_tcp_client_socket_unbind(&client_socket));
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_listen_table_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Listen Table Test.....................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* __PRODUCT_NETXDUO__ */
@@ -0,0 +1,350 @@
+/* This NetX test concentrates on the TCP pacing.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_PACING) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            100
+#define     SEGMENT_COUNT           10
+
+/* One segment every other timer tick.  */
+#define     PACING_RATE             (SEGMENT_SIZE * NX_IP_PERIODIC_RATE / 2)
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   data_packets;
+static ULONG                   first_time;
+static ULONG                   last_time;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    send_data(UINT count, ULONG wait_option);
+static void    receive_data(UINT count);
+static void    count_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_pacing_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 16384);
+    pointer = pointer + 16384;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Pacing Test...........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the parameters of the pacing set service.  */
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if (nx_tcp_socket_pacing_set(NX_NULL, PACING_RATE) != NX_PTR_ERROR)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Setup the connection with a small MSS, so the data covers several segments.  */
+    status = nx_tcp_socket_mss_set(&client_socket, SEGMENT_SIZE);
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Open the congestion window, so the window does not limit the data sent.  */
+    client_socket.nx_tcp_socket_tx_window_congestion = 0xFFFF;
+
+    /* Without pacing, all segments are sent at once.  */
+    send_data(SEGMENT_COUNT, NX_NO_WAIT);
+    if ((data_packets != SEGMENT_COUNT) || ((last_time - first_time) > 1))
+    {
+        error_counter++;
+    }
+    receive_data(SEGMENT_COUNT);
+
+    /* Pace the socket.  A burst of two segments is sent at once, the rest one segment every
+       other tick.  */
+    status = nx_tcp_socket_pacing_set(&client_socket, PACING_RATE);
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 10);
+    send_data(SEGMENT_COUNT, NX_IP_PERIODIC_RATE);
+    tx_thread_sleep(2);
+    if ((status) || (data_packets != SEGMENT_COUNT) ||
+        ((last_time - first_time) < (SEGMENT_COUNT - NX_TCP_PACING_BURST_SEGMENTS - 1) * 2))
+    {
+        error_counter++;
+    }
+    receive_data(SEGMENT_COUNT);
+
+    /* Data held back is not sent without suspension.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 10);
+    send_data(NX_TCP_PACING_BURST_SEGMENTS, NX_NO_WAIT);
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status == NX_SUCCESS)
+    {
+        memset(packet_ptr -> nx_packet_prepend_ptr, 'z', SEGMENT_SIZE);
+        packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + SEGMENT_SIZE;
+        packet_ptr -> nx_packet_length = SEGMENT_SIZE;
+        if (nx_tcp_socket_send(&client_socket, packet_ptr, NX_NO_WAIT) != NX_WINDOW_OVERFLOW)
+        {
+            error_counter++;
+        }
+        nx_packet_release(packet_ptr);
+    }
+    else
+    {
+        error_counter++;
+    }
+    receive_data(NX_TCP_PACING_BURST_SEGMENTS);
+
+    /* The pacing timer releases the socket.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 10);
+    if ((client_socket.nx_tcp_socket_pacing_waiting) || (ip_0.nx_ip_tcp_pacing_timer_armed))
+    {
+        error_counter++;
+    }
+
+#ifdef NX_ENABLE_TCP_CONGESTION_CONTROL
+    /* Derive the pacing rate from the congestion window and the round trip time.  */
+    status = nx_tcp_socket_pacing_set(&client_socket, NX_TCP_PACING_RATE_AUTO);
+    send_data(SEGMENT_COUNT, NX_IP_PERIODIC_RATE);
+    if ((status) || (data_packets != SEGMENT_COUNT) || (client_socket.nx_tcp_socket_pacing_rtt == 0))
+    {
+        error_counter++;
+    }
+    receive_data(SEGMENT_COUNT);
+#endif /* NX_ENABLE_TCP_CONGESTION_CONTROL */
+
+    /* Disable pacing.  */
+    status = nx_tcp_socket_pacing_set(&client_socket, 0);
+    send_data(SEGMENT_COUNT, NX_NO_WAIT);
+    if ((status) || (data_packets != SEGMENT_COUNT))
+    {
+        error_counter++;
+    }
+    receive_data(SEGMENT_COUNT);
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send full size segments from the client, and record when the first and the last data
+   segment are received.  */
+static void    send_data(UINT count, ULONG wait_option)
+{
+UINT        status;
+UINT        i;
+NX_PACKET  *packet_ptr;
+
+
+    data_packets = 0;
+    first_time = 0;
+    last_time = 0;
+    ip_0.nx_ip_tcp_packet_receive = count_tcp_packet_receive;
+
+    for (i = 0; i < count; i++)
+    {
+        status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        memset(packet_ptr -> nx_packet_prepend_ptr, 'a' + i, SEGMENT_SIZE);
+        packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + SEGMENT_SIZE;
+        packet_ptr -> nx_packet_length = SEGMENT_SIZE;
+
+        status = nx_tcp_socket_send(&client_socket, packet_ptr, wait_option);
+        if (status)
+        {
+            nx_packet_release(packet_ptr);
+            error_counter++;
+            break;
+        }
+    }
+}
+
+/* Receive the data sent by the client.  */
+static void    receive_data(UINT count)
+{
+UINT        status;
+ULONG       expected;
+NX_PACKET  *packet_ptr;
+
+
+    expected = 0;
+    while (expected < count * SEGMENT_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        expected += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    if (expected != count * SEGMENT_SIZE)
+    {
+        error_counter++;
+    }
+}
+
+static void    count_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+NX_TCP_HEADER  *tcp_header_ptr;
+ULONG           header_word_0;
+ULONG           header_word_3;
+
+
+    tcp_header_ptr = (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_0 = tcp_header_ptr -> nx_tcp_header_word_0;
+    header_word_3 = tcp_header_ptr -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_0);
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+
+    /* Record the data segments sent by the client.  */
+    if (((header_word_0 & NX_LOWER_16_MASK) == TEST_PORT) &&
+        (packet_ptr -> nx_packet_length > (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG)))
+    {
+        if (data_packets == 0)
+        {
+            first_time = tx_time_get();
+        }
+        last_time = tx_time_get();
+        data_packets++;
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_pacing_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Pacing Test...........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_PACING */
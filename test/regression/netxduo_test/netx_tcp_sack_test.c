@@ -0,0 +1,318 @@
+/* This NetX test concentrates on the TCP selective acknowledgment.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_SACK) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            10
+#define     SEGMENT_COUNT           12
+
+/* Segments with the first transmission dropped.  */
+#define     DROP_SEGMENTS           ((1 << 2) | (1 << 5) | (1 << 8))
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   initial_sequence;
+static ULONG                   dropped_segments;
+static ULONG                   sack_received;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    sack_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_sack_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    dropped_segments =  0;
+    sack_received =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 16384);
+    pointer = pointer + 16384;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+ULONG       expected;
+NX_PACKET  *packet_ptr;
+#ifndef NX_DISABLE_TCP_INFO
+ULONG       retransmit_packets;
+#endif /* NX_DISABLE_TCP_INFO */
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP SACK Test.............................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 4096,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 4096,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Setup the connection.  */
+    status = nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Both sides offered SACK in the handshake.  */
+    if ((client_socket.nx_tcp_socket_sack_permitted != NX_TRUE) ||
+        (server_socket.nx_tcp_socket_sack_permitted != NX_TRUE))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    retransmit_packets = client_socket.nx_tcp_socket_retransmit_packets;
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* Send all segments at once, and make sure the retransmission timeout does not expire
+       before all the holes are repaired.  */
+    client_socket.nx_tcp_socket_tx_window_congestion = 0xFFFF;
+    client_socket.nx_tcp_socket_timeout_rate = 10 * NX_IP_PERIODIC_RATE;
+    initial_sequence = client_socket.nx_tcp_socket_tx_sequence;
+    ip_0.nx_ip_tcp_packet_receive = sack_tcp_packet_receive;
+
+    for (i = 0; i < SEGMENT_COUNT; i++)
+    {
+        status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        memset(packet_ptr -> nx_packet_prepend_ptr, 'a' + i, SEGMENT_SIZE);
+        packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + SEGMENT_SIZE;
+        packet_ptr -> nx_packet_length = SEGMENT_SIZE;
+
+        status = nx_tcp_socket_send(&client_socket, packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            nx_packet_release(packet_ptr);
+            error_counter++;
+            break;
+        }
+    }
+
+    /* All data is received in order well before the retransmission timeout.  */
+    expected = 0;
+    while (expected < SEGMENT_COUNT * SEGMENT_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, 2 * NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        for (i = 0; i < packet_ptr -> nx_packet_length; i++)
+        {
+            if (packet_ptr -> nx_packet_prepend_ptr[i] != (UCHAR)('a' + ((expected + i) / SEGMENT_SIZE)))
+            {
+                error_counter++;
+            }
+        }
+        expected += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+
+    /* The segments were dropped, and the receiver reported the out of order data.  */
+    if ((dropped_segments != DROP_SEGMENTS) || (sack_received == 0))
+    {
+        error_counter++;
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    /* Each dropped segment is retransmitted.  */
+    if ((client_socket.nx_tcp_socket_retransmit_packets - retransmit_packets) < 3)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* All data is acknowledged, the scoreboard is empty.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE);
+    if ((client_socket.nx_tcp_socket_transmit_sent_head != NX_NULL) ||
+        (client_socket.nx_tcp_socket_sack_scoreboard_count != 0))
+    {
+        error_counter++;
+    }
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The SACK state is reset with the connection.  */
+    if (client_socket.nx_tcp_socket_sack_permitted)
+    {
+        error_counter++;
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    sack_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+NX_TCP_HEADER  *header_ptr;
+ULONG           header_word_3;
+ULONG           sequence;
+ULONG           header_length;
+ULONG           segment;
+UCHAR          *option_ptr;
+
+
+    header_ptr = (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_3 = header_ptr -> nx_tcp_header_word_3;
+    sequence = header_ptr -> nx_tcp_sequence_number;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    NX_CHANGE_ULONG_ENDIAN(sequence);
+    header_length = (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG);
+
+    if (packet_ptr -> nx_packet_length > header_length)
+    {
+
+        /* Drop the first transmission of the selected segments.  */
+        segment = (sequence - initial_sequence) / SEGMENT_SIZE;
+        if ((segment < SEGMENT_COUNT) && (DROP_SEGMENTS & (1 << segment)) && !(dropped_segments & (1 << segment)))
+        {
+            dropped_segments |= (ULONG)(1 << segment);
+            nx_packet_release(packet_ptr);
+            return;
+        }
+    }
+    else if (header_length > sizeof(NX_TCP_HEADER))
+    {
+
+        /* Check for the SACK option in the ACK.  */
+        option_ptr = packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER);
+        if ((option_ptr[0] == NX_TCP_NOP_KIND) && (option_ptr[1] == NX_TCP_NOP_KIND) &&
+            (option_ptr[2] == NX_TCP_SACK_KIND))
+        {
+            sack_received++;
+        }
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_sack_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP SACK Test.............................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_SACK */
@@ -0,0 +1,295 @@
+/* This NetX test concentrates on the TCP segmentation offload.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_SEGMENTATION_OFFLOAD) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            100
+#define     DATA_SIZE               1000
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   data_segments;
+static ULONG                   largest_segment;
+static UCHAR                   data_buffer[DATA_SIZE];
+static UCHAR                   receive_buffer[DATA_SIZE];
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    transfer_data(void);
+static void    segment_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_segmentation_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 32768);
+    pointer = pointer + 32768;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+#ifndef NX_DISABLE_TCP_INFO
+ULONG       packets_sent;
+#endif /* NX_DISABLE_TCP_INFO */
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Segmentation Offload Test.............................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    for (i = 0; i < DATA_SIZE; i++)
+    {
+        data_buffer[i] = (UCHAR)('a' + (i % 26));
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Setup the connection with a small MSS, so the data covers several segments.  */
+    status = nx_tcp_socket_mss_set(&client_socket, SEGMENT_SIZE);
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Open the congestion window, so all data is sent at once.  */
+    client_socket.nx_tcp_socket_tx_window_congestion = 0xFFFF;
+
+#ifndef NX_DISABLE_TCP_INFO
+    packets_sent = client_socket.nx_tcp_socket_packets_sent;
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* The data is sent in one packet, and segmented before it is passed to the interface.  */
+    transfer_data();
+    if ((data_segments != DATA_SIZE / SEGMENT_SIZE) || (largest_segment != SEGMENT_SIZE))
+    {
+        error_counter++;
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    if (client_socket.nx_tcp_socket_packets_sent - packets_sent != 1)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_TCP_INFO */
+
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    /* The interface segments the packet.  */
+    ip_0.nx_ip_interface[NX_LOOPBACK_INTERFACE].nx_interface_capability_flag = NX_INTERFACE_CAPABILITY_TCP_SEGMENTATION;
+    transfer_data();
+    ip_0.nx_ip_interface[NX_LOOPBACK_INTERFACE].nx_interface_capability_flag = 0;
+    if ((data_segments != 1) || (largest_segment != DATA_SIZE))
+    {
+        error_counter++;
+    }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+    /* All data is acknowledged.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE);
+    if (client_socket.nx_tcp_socket_transmit_sent_head != NX_NULL)
+    {
+        error_counter++;
+    }
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send the data in one packet from the client, and check all data is received in order by the server.  */
+static void    transfer_data(void)
+{
+UINT        status;
+ULONG       expected;
+ULONG       bytes_copied;
+NX_PACKET  *packet_ptr;
+
+
+    data_segments = 0;
+    largest_segment = 0;
+    ip_0.nx_ip_tcp_packet_receive = segment_tcp_packet_receive;
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    status = nx_packet_data_append(packet_ptr, data_buffer, DATA_SIZE, &pool_0, NX_NO_WAIT);
+    status += nx_tcp_socket_send(&client_socket, packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+        error_counter++;
+        return;
+    }
+
+    expected = 0;
+    while (expected < DATA_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        status = nx_packet_data_retrieve(packet_ptr, receive_buffer, &bytes_copied);
+        if ((status) || (expected + bytes_copied > DATA_SIZE) ||
+            (memcmp(receive_buffer, &data_buffer[expected], bytes_copied) != 0))
+        {
+            error_counter++;
+        }
+        expected += bytes_copied;
+        nx_packet_release(packet_ptr);
+    }
+
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+}
+
+static void    segment_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+ULONG   header_word_3;
+ULONG   header_length;
+
+
+    header_word_3 = ((NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    header_length = (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG);
+
+    /* Count the segments with data.  */
+    if (packet_ptr -> nx_packet_length > header_length)
+    {
+        data_segments++;
+        if (packet_ptr -> nx_packet_length - header_length > largest_segment)
+        {
+            largest_segment = packet_ptr -> nx_packet_length - header_length;
+        }
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_segmentation_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Segmentation Offload Test.............................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_SEGMENTATION_OFFLOAD */
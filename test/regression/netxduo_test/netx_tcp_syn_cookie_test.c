@@ -0,0 +1,264 @@
+/* This NetX test concentrates on the TCP SYN cookies sent when the listen queue is full.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_SYN_COOKIES) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE) && !defined(NX_DISABLE_TCP_INFO)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     DATA_SIZE               64
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket_0;
+static NX_TCP_SOCKET           server_socket_1;
+static NX_TCP_SOCKET           client_socket_0;
+static NX_TCP_SOCKET           client_socket_1;
+static NX_TCP_SOCKET           client_socket_2;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static UINT    client_connect(NX_TCP_SOCKET *socket_ptr, ULONG wait_option);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_syn_cookie_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 16384);
+    pointer = pointer + 16384;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+ULONG       received;
+NX_PACKET  *packet_ptr;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP SYN Cookie Test.......................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket_0, "Server Socket 0",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &server_socket_1, "Server Socket 1",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket_0, "Client Socket 0",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket_1, "Client Socket 1",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket_2, "Client Socket 2",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+
+    /* Listen with room for a single queued connection request.  */
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket_0, 1, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The first request takes the listen socket, the second one is queued.  */
+    if ((client_connect(&client_socket_0, NX_NO_WAIT) != NX_IN_PROGRESS) ||
+        (client_connect(&client_socket_1, NX_NO_WAIT) != NX_IN_PROGRESS) ||
+        (ip_0.nx_ip_tcp_syn_cookies_sent != 0))
+    {
+        error_counter++;
+    }
+
+    /* The queue is full, the third request is answered with a cookie and the client
+       connects right away.  Its ACK replaces the oldest queued request.  */
+    if ((client_connect(&client_socket_2, NX_IP_PERIODIC_RATE) != NX_SUCCESS) ||
+        (ip_0.nx_ip_tcp_syn_cookies_sent != 1) ||
+        (client_socket_2.nx_tcp_socket_connect_mss > 1460))
+    {
+        error_counter++;
+    }
+
+    /* Complete the connection of the listen socket.  */
+    if ((nx_tcp_server_socket_accept(&server_socket_0, NX_IP_PERIODIC_RATE) != NX_SUCCESS) ||
+        (client_socket_0.nx_tcp_socket_state != NX_TCP_ESTABLISHED))
+    {
+        error_counter++;
+    }
+
+    /* The next socket is established from the queued ACK.  */
+    if ((nx_tcp_server_socket_relisten(&ip_0, TEST_PORT, &server_socket_1) != NX_CONNECTION_PENDING) ||
+        (server_socket_1.nx_tcp_socket_state != NX_TCP_ESTABLISHED) ||
+        (ip_0.nx_ip_tcp_syn_cookies_received != 1) ||
+        (nx_tcp_server_socket_accept(&server_socket_1, NX_NO_WAIT) != NX_SUCCESS))
+    {
+        error_counter++;
+    }
+
+    /* Send data over the connection of the cookie.  */
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    memset(packet_ptr -> nx_packet_prepend_ptr, 'a', DATA_SIZE);
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + DATA_SIZE;
+    packet_ptr -> nx_packet_length = DATA_SIZE;
+
+    if (nx_tcp_socket_send(&client_socket_2, packet_ptr, NX_IP_PERIODIC_RATE))
+    {
+        nx_packet_release(packet_ptr);
+        error_counter++;
+    }
+
+    received = 0;
+    while (received < DATA_SIZE)
+    {
+        if (nx_tcp_socket_receive(&server_socket_1, &packet_ptr, NX_IP_PERIODIC_RATE))
+        {
+            error_counter++;
+            break;
+        }
+
+        if (packet_ptr -> nx_packet_prepend_ptr[0] != 'a')
+        {
+            error_counter++;
+        }
+
+        received += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    if (received != DATA_SIZE)
+    {
+        error_counter++;
+    }
+
+    /* Close the connections.  */
+    nx_tcp_socket_disconnect(&client_socket_0, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket_1, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket_2, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&server_socket_0, NX_IP_PERIODIC_RATE);
+    nx_tcp_socket_disconnect(&server_socket_1, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket_0);
+    status += nx_tcp_client_socket_unbind(&client_socket_1);
+    status += nx_tcp_client_socket_unbind(&client_socket_2);
+    status += nx_tcp_server_socket_unaccept(&server_socket_0);
+    status += nx_tcp_server_socket_unaccept(&server_socket_1);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Bind a client socket and connect it to the server.  */
+static UINT    client_connect(NX_TCP_SOCKET *socket_ptr, ULONG wait_option)
+{
+UINT        status;
+
+
+    status = nx_tcp_client_socket_bind(socket_ptr, NX_ANY_PORT, NX_NO_WAIT);
+    if (status)
+    {
+        return(status);
+    }
+
+    return(nx_tcp_client_socket_connect(socket_ptr, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, wait_option));
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_syn_cookie_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP SYN Cookie Test.......................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_SYN_COOKIES */
@@ -0,0 +1,321 @@
+/* This NetX test concentrates on the TCP timer wheels.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_TIMER_WHEEL) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static UINT                    drop_data;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    retransmit_data(ULONG timeout_rate);
+static void    check_idle(void);
+static void    drop_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_timer_wheel_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    drop_data =  NX_FALSE;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 8192);
+    pointer = pointer + 8192;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Timer Wheel Test......................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 100,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 100,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The timers of the new sockets are not on the wheels.  */
+    check_idle();
+
+    /* Setup the connection.  */
+    status = nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The connection is established, there is nothing to retransmit.  */
+    check_idle();
+
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    /* The keepalive timer of the established connection is on the wheel.  */
+    if ((server_socket.nx_tcp_socket_keepalive_timer.nx_tcp_timer_list == NX_NULL) ||
+        (server_socket.nx_tcp_socket_keepalive_timer.nx_tcp_timer_expiration !=
+         server_socket.nx_tcp_socket_keepalive_timer.nx_tcp_timer_updated + server_socket.nx_tcp_socket_keepalive_timeout))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+
+    /* Retransmit data within the first level of the wheel.  */
+    retransmit_data(NX_IP_PERIODIC_RATE);
+
+    /* Retransmit data beyond the first level of the wheel.  */
+    retransmit_data((NX_TCP_TIMER_WHEEL_SIZE + 8) * (NX_IP_PERIODIC_RATE / NX_TCP_FAST_TIMER_RATE));
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The timers of the closed sockets are removed from the wheels.  */
+    check_idle();
+#ifdef NX_ENABLE_TCP_KEEPALIVE
+    if (server_socket.nx_tcp_socket_keepalive_timer.nx_tcp_timer_list != NX_NULL)
+    {
+        error_counter++;
+    }
+#endif /* NX_ENABLE_TCP_KEEPALIVE */
+
+    /* Delete the sockets.  */
+    status = nx_tcp_socket_delete(&server_socket);
+    status += nx_tcp_socket_delete(&client_socket);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send one byte with the first transmission dropped, and check it is retransmitted after the timeout.  */
+static void    retransmit_data(ULONG timeout_rate)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+#ifndef NX_DISABLE_TCP_INFO
+ULONG       retransmit_packets;
+#endif /* NX_DISABLE_TCP_INFO */
+
+
+#ifndef NX_DISABLE_TCP_INFO
+    retransmit_packets = client_socket.nx_tcp_socket_retransmit_packets;
+#endif /* NX_DISABLE_TCP_INFO */
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    *packet_ptr -> nx_packet_prepend_ptr = 'a';
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + 1;
+    packet_ptr -> nx_packet_length = 1;
+
+    /* Drop the first transmission of the data.  */
+    client_socket.nx_tcp_socket_timeout_rate = timeout_rate;
+    drop_data = NX_TRUE;
+    ip_0.nx_ip_tcp_packet_receive = drop_tcp_packet_receive;
+
+    status = nx_tcp_socket_send(&client_socket, packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+        error_counter++;
+        return;
+    }
+
+    /* The retransmit timer is on the wheel.  */
+    if (client_socket.nx_tcp_socket_fast_timer.nx_tcp_timer_list == NX_NULL)
+    {
+        error_counter++;
+    }
+
+    /* The data is not retransmitted before the timeout.  */
+    tx_thread_sleep(timeout_rate / 2);
+    if (nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_NO_WAIT) != NX_NO_PACKET)
+    {
+        error_counter++;
+        return;
+    }
+
+    /* The data is retransmitted after the timeout.  */
+    status = nx_tcp_socket_receive(&server_socket, &packet_ptr, timeout_rate);
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    if ((packet_ptr -> nx_packet_length != 1) || (*packet_ptr -> nx_packet_prepend_ptr != 'a'))
+    {
+        error_counter++;
+    }
+    nx_packet_release(packet_ptr);
+
+#ifndef NX_DISABLE_TCP_INFO
+    if (client_socket.nx_tcp_socket_retransmit_packets == retransmit_packets)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* Wait for the delayed ACK, then no timeout is active.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE);
+    check_idle();
+}
+
+/* Check the fast timers of the sockets are not on the wheel.  */
+static void    check_idle(void)
+{
+
+    if ((server_socket.nx_tcp_socket_fast_timer.nx_tcp_timer_list != NX_NULL) ||
+        (client_socket.nx_tcp_socket_fast_timer.nx_tcp_timer_list != NX_NULL))
+    {
+        error_counter++;
+    }
+}
+
+static void    drop_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+ULONG   header_word_3;
+
+
+    header_word_3 = ((NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr) -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+
+    /* Drop the first packet with data.  */
+    if ((drop_data) && (!(header_word_3 & NX_TCP_SYN_BIT)) &&
+        (packet_ptr -> nx_packet_length > sizeof(NX_TCP_HEADER)))
+    {
+        drop_data = NX_FALSE;
+        ip_ptr -> nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_timer_wheel_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Timer Wheel Test......................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_TIMER_WHEEL */
@@ -0,0 +1,338 @@
+/* This NetX test concentrates on the TCP timestamps option, the round trip time measurement and PAWS.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_TIMESTAMPS) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            50
+#define     SEGMENT_COUNT           8
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   timestamp_segments;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static UINT    send_data(UCHAR value, ULONG size);
+static void    timestamp_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+extern void    _nx_ram_network_driver_256(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_timestamp_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+    timestamp_segments =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 256, pointer, 16384);
+    pointer = pointer + 16384;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_256,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+UINT        i;
+ULONG       expected;
+NX_PACKET  *packet_ptr;
+#ifndef NX_DISABLE_TCP_INFO
+ULONG       packets_dropped;
+#endif /* NX_DISABLE_TCP_INFO */
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Timestamp Test........................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 4096,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 4096,
+                                   NX_NULL, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Setup the connection.  */
+    status = nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    status += nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Both sides offered timestamps in the handshake.  */
+    if ((client_socket.nx_tcp_socket_timestamp_permitted != NX_TRUE) ||
+        (server_socket.nx_tcp_socket_timestamp_permitted != NX_TRUE))
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Send data, every segment carries the timestamps.  */
+    ip_0.nx_ip_tcp_packet_receive = timestamp_tcp_packet_receive;
+    for (i = 0; i < SEGMENT_COUNT; i++)
+    {
+        if (send_data((UCHAR)('a' + i), SEGMENT_SIZE))
+        {
+            error_counter++;
+            break;
+        }
+    }
+
+    expected = 0;
+    while (expected < SEGMENT_COUNT * SEGMENT_SIZE)
+    {
+        status = nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_IP_PERIODIC_RATE);
+        if (status)
+        {
+            error_counter++;
+            break;
+        }
+
+        for (i = 0; i < packet_ptr -> nx_packet_length; i++)
+        {
+            if (packet_ptr -> nx_packet_prepend_ptr[i] != (UCHAR)('a' + ((expected + i) / SEGMENT_SIZE)))
+            {
+                error_counter++;
+            }
+        }
+        expected += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    /* Wait for the ACKs.  */
+    tx_thread_sleep(NX_IP_PERIODIC_RATE / 2);
+    ip_0.nx_ip_tcp_packet_receive = _nx_tcp_packet_receive;
+
+    /* The data segments carried the timestamps.  */
+    if (timestamp_segments < SEGMENT_COUNT)
+    {
+        error_counter++;
+    }
+
+    /* The retransmission timeout is measured, and is below the default timeout of one second.  */
+    if ((client_socket.nx_tcp_socket_transmit_sent_head != NX_NULL) ||
+        (client_socket.nx_tcp_socket_rto < NX_TCP_RTO_MIN) ||
+        (client_socket.nx_tcp_socket_rtt_smoothed >= client_socket.nx_tcp_socket_rto) ||
+        (client_socket.nx_tcp_socket_timeout_rate >= NX_IP_PERIODIC_RATE))
+    {
+        error_counter++;
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    packets_dropped = ip_0.nx_ip_tcp_receive_packets_dropped;
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* Make the server believe it received a newer timestamp, the next segment is dropped by PAWS.  */
+    server_socket.nx_tcp_socket_timestamp_recent = NX_TCP_TIMESTAMP_GET() + 0x10000;
+    server_socket.nx_tcp_socket_timestamp_recent_time = NX_TCP_TIMESTAMP_GET();
+    if (send_data('z', 1))
+    {
+        error_counter++;
+    }
+
+    if (nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_IP_PERIODIC_RATE / 10) != NX_NO_PACKET)
+    {
+        error_counter++;
+    }
+
+#ifndef NX_DISABLE_TCP_INFO
+    if (ip_0.nx_ip_tcp_receive_packets_dropped == packets_dropped)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_TCP_INFO */
+
+    /* Restore the timestamp of the server, the retransmission is accepted.  */
+    server_socket.nx_tcp_socket_timestamp_recent = 0;
+    status = nx_tcp_socket_receive(&server_socket, &packet_ptr, 5 * NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+    }
+    else
+    {
+        if ((packet_ptr -> nx_packet_length != 1) || (*packet_ptr -> nx_packet_prepend_ptr != 'z'))
+        {
+            error_counter++;
+        }
+        nx_packet_release(packet_ptr);
+    }
+
+    /* Close the connection.  */
+    nx_tcp_socket_disconnect(&server_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&client_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* The timestamps state is reset with the connection, and the configured timeout is restored.  */
+    if ((client_socket.nx_tcp_socket_timestamp_permitted) ||
+        (client_socket.nx_tcp_socket_rto != 0) ||
+        (client_socket.nx_tcp_socket_timeout_rate != client_socket.nx_tcp_socket_timeout_rate_initial))
+    {
+        error_counter++;
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+/* Send one segment of data from the client.  */
+static UINT    send_data(UCHAR value, ULONG size)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+
+
+    status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status)
+    {
+        return(status);
+    }
+
+    memset(packet_ptr -> nx_packet_prepend_ptr, value, size);
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + size;
+    packet_ptr -> nx_packet_length = size;
+
+    status = nx_tcp_socket_send(&client_socket, packet_ptr, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+    }
+
+    return(status);
+}
+
+static void    timestamp_tcp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+NX_TCP_HEADER  *header_ptr;
+ULONG           header_word_3;
+ULONG           header_length;
+UCHAR          *option_ptr;
+
+
+    header_ptr = (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    header_word_3 = header_ptr -> nx_tcp_header_word_3;
+    NX_CHANGE_ULONG_ENDIAN(header_word_3);
+    header_length = (header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG);
+
+    /* Every segment of the connection starts its options with the timestamps.  */
+    option_ptr = packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_TCP_HEADER);
+    if ((header_length < sizeof(NX_TCP_HEADER) + NX_TCP_TIMESTAMP_OPTION_SIZE) ||
+        (option_ptr[0] != NX_TCP_NOP_KIND) || (option_ptr[1] != NX_TCP_NOP_KIND) ||
+        (option_ptr[2] != NX_TCP_TIMESTAMP_KIND) || (option_ptr[3] != NX_TCP_TIMESTAMP_LENGTH))
+    {
+        error_counter++;
+    }
+    else if (packet_ptr -> nx_packet_length > header_length)
+    {
+        timestamp_segments++;
+    }
+
+    _nx_tcp_packet_receive(ip_ptr, packet_ptr);
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_timestamp_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Timestamp Test........................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_TIMESTAMPS */
@@ -0,0 +1,305 @@
+/* This NetX test concentrates on the TCP receive window autotuning.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_tcp.h"
+
+extern void  test_control_return(UINT status);
+
+#if defined(__PRODUCT_NETXDUO__) && defined(NX_ENABLE_TCP_WINDOW_AUTOTUNING) && !defined(NX_DISABLE_IPV4) && !defined(NX_DISABLE_LOOPBACK_INTERFACE)
+
+#define     DEMO_STACK_SIZE         2048
+
+#define     TEST_PORT               80
+#define     SEGMENT_SIZE            1024
+#define     WINDOW_INITIAL          2048
+#define     WINDOW_MAXIMUM          8192
+#define     TRANSFER_TICKS          20
+
+/* Define the ThreadX and NetX object control blocks...  */
+
+static TX_THREAD               ntest_0;
+
+static NX_PACKET_POOL          pool_0;
+static NX_IP                   ip_0;
+static NX_TCP_SOCKET           server_socket;
+static NX_TCP_SOCKET           client_socket;
+
+
+/* Define the counters used in the test application...  */
+
+static ULONG                   error_counter;
+static ULONG                   bytes_sent;
+static ULONG                   bytes_received;
+
+/* Define thread prototypes.  */
+
+static void    ntest_0_entry(ULONG thread_input);
+static void    open_connection(void);
+static void    close_connection(void);
+static void    transfer_data(void);
+extern void    _nx_ram_network_driver_1500(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_window_autotune_test_application_define(void *first_unused_memory)
+#endif
+{
+
+CHAR    *pointer;
+UINT    status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    error_counter =  0;
+
+    /* Create the main thread.  */
+    tx_thread_create(&ntest_0, "thread 0", ntest_0_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create the packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", 1536, pointer, 1536 * 48);
+    pointer = pointer + 1536 * 48;
+
+    /* Create an IP instance.  */
+    status += nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver_1500,
+                           pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Enable TCP processing.  */
+    status += nx_tcp_enable(&ip_0);
+
+    /* Check status  */
+    if (status)
+        error_counter++;
+}
+
+
+
+/* Define the test threads.  */
+
+static void    ntest_0_entry(ULONG thread_input)
+{
+
+UINT        status;
+
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Window Autotune Test..................................");
+
+    /* Check for earlier error.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Create the sockets.  */
+    status = nx_tcp_socket_create(&ip_0, &server_socket, "Server Socket",
+                                  NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, WINDOW_INITIAL,
+                                  NX_NULL, NX_NULL);
+    status += nx_tcp_socket_create(&ip_0, &client_socket, "Client Socket",
+                                   NX_IP_NORMAL, NX_FRAGMENT_OKAY, NX_IP_TIME_TO_LIVE, 8192,
+                                   NX_NULL, NX_NULL);
+    status += nx_tcp_socket_mss_set(&client_socket, SEGMENT_SIZE);
+    status += nx_tcp_server_socket_listen(&ip_0, TEST_PORT, &server_socket, 5, NX_NULL);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check the parameters of the window autotune set service.  */
+#ifndef NX_DISABLE_ERROR_CHECKING
+    if (nx_tcp_socket_window_autotune_set(NX_NULL, WINDOW_MAXIMUM) != NX_PTR_ERROR)
+    {
+        error_counter++;
+    }
+
+    if (nx_tcp_socket_window_autotune_set(&server_socket, 0xFFFFFFFF) != NX_OPTION_ERROR)
+    {
+        error_counter++;
+    }
+#endif /* NX_DISABLE_ERROR_CHECKING */
+
+    /* Without autotuning, the window stays at the size the socket was created with.  */
+    open_connection();
+    transfer_data();
+    if (server_socket.nx_tcp_socket_rx_window_default != WINDOW_INITIAL)
+    {
+        error_counter++;
+    }
+    close_connection();
+
+    /* With autotuning, the window grows while the application keeps up with the sender.  */
+    status = nx_tcp_socket_window_autotune_set(&server_socket, WINDOW_MAXIMUM);
+    open_connection();
+    transfer_data();
+    if ((status) || (server_socket.nx_tcp_socket_rx_autotune_rtt == 0) ||
+        (server_socket.nx_tcp_socket_rx_window_default <= WINDOW_INITIAL) ||
+        (server_socket.nx_tcp_socket_rx_window_default > WINDOW_MAXIMUM))
+    {
+        error_counter++;
+    }
+    close_connection();
+
+    /* The next connection starts from the initial window.  */
+    open_connection();
+    if ((server_socket.nx_tcp_socket_rx_window_default != WINDOW_INITIAL) ||
+        (server_socket.nx_tcp_socket_rx_autotune_rtt != 0))
+    {
+        error_counter++;
+    }
+    close_connection();
+
+    status = nx_tcp_server_socket_unlisten(&ip_0, TEST_PORT);
+    if (status)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    /* Check status.  */
+    if (error_counter)
+    {
+
+        printf("ERROR!\n");
+        test_control_return(1);
+    }
+
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+static void    open_connection(void)
+{
+UINT        status;
+
+
+    status = nx_tcp_client_socket_bind(&client_socket, NX_ANY_PORT, NX_NO_WAIT);
+    status += nx_tcp_client_socket_connect(&client_socket, IP_ADDRESS(127, 0, 0, 1), TEST_PORT, NX_IP_PERIODIC_RATE);
+    status += nx_tcp_server_socket_accept(&server_socket, NX_IP_PERIODIC_RATE);
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* Open the congestion window, so only the receive window limits the data sent.  */
+    client_socket.nx_tcp_socket_tx_window_congestion = 0xFFFF;
+}
+
+static void    close_connection(void)
+{
+UINT        status;
+
+
+    nx_tcp_socket_disconnect(&client_socket, NX_NO_WAIT);
+    nx_tcp_socket_disconnect(&server_socket, NX_IP_PERIODIC_RATE);
+    status = nx_tcp_client_socket_unbind(&client_socket);
+    status += nx_tcp_server_socket_unaccept(&server_socket);
+    status += nx_tcp_server_socket_relisten(&ip_0, TEST_PORT, &server_socket);
+    if (status)
+    {
+        error_counter++;
+    }
+}
+
+/* Every tick, the client fills the receive window of the server and the server reads all of
+   the data.  */
+static void    transfer_data(void)
+{
+UINT        status;
+UINT        i;
+NX_PACKET  *packet_ptr;
+
+
+    bytes_sent = 0;
+    bytes_received = 0;
+
+    for (i = 0; i < TRANSFER_TICKS; i++)
+    {
+
+        /* Send full size segments until the window is full.  */
+        do
+        {
+            status = nx_packet_allocate(&pool_0, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+            if (status)
+            {
+                error_counter++;
+                return;
+            }
+
+            memset(packet_ptr -> nx_packet_prepend_ptr, 'a', SEGMENT_SIZE);
+            packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + SEGMENT_SIZE;
+            packet_ptr -> nx_packet_length = SEGMENT_SIZE;
+
+            status = nx_tcp_socket_send(&client_socket, packet_ptr, NX_NO_WAIT);
+            if (status)
+            {
+
+                /* Part of the segment may have been sent into the rest of the window.  */
+                bytes_sent += SEGMENT_SIZE - packet_ptr -> nx_packet_length;
+                nx_packet_release(packet_ptr);
+            }
+            else
+            {
+                bytes_sent += SEGMENT_SIZE;
+            }
+        } while (status == NX_SUCCESS);
+
+        if (status != NX_WINDOW_OVERFLOW)
+        {
+            error_counter++;
+            return;
+        }
+
+        /* Read all of the data received.  */
+        while (nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_NO_WAIT) == NX_SUCCESS)
+        {
+            bytes_received += packet_ptr -> nx_packet_length;
+            nx_packet_release(packet_ptr);
+        }
+
+        tx_thread_sleep(1);
+    }
+
+    /* Read the data of window updates sent while sleeping.  */
+    while (nx_tcp_socket_receive(&server_socket, &packet_ptr, NX_NO_WAIT) == NX_SUCCESS)
+    {
+        bytes_received += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    if (bytes_received != bytes_sent)
+    {
+        error_counter++;
+    }
+}
+#else
+
+#ifdef CTEST
+VOID test_application_define(void *first_unused_memory)
+#else
+void    netx_tcp_window_autotune_test_application_define(void *first_unused_memory)
+#endif
+{
+
+    /* Print out test information banner.  */
+    printf("NetX Test:   TCP Window Autotune Test..................................N/A\n");
+
+    test_control_return(3);
+}
+#endif /* NX_ENABLE_TCP_WINDOW_AUTOTUNING */